@@ -13,9 +13,11 @@
 #include <cstddef>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
+#include "byte_view.hpp"
 #include "family.hpp"
 #include "padding.hpp"
 #include "processing_block_size.hpp"
@@ -40,7 +42,9 @@ namespace headcode::crypt {
  * algorithm can interpret as initial (or final) data to process.
  *
  * There is one single limitation: an algorithm may be initialized and finalized only once whereas data
- * can be applied in between multiple times.
+ * can be applied in between multiple times. To reuse an algorithm instance for another message call
+ * Reset() (same initialization data, e.g. same key) or Reinitialize() (new initialization data). Both
+ * are way cheaper than creating a new instance via the Factory.
  */
 class Algorithm {
 
@@ -83,9 +87,12 @@ public:
      *          auto algorithm = headcode::crypt::Factory::Create("aes-256-cbc encryptor");
      *          algorithm->Initialize({'key', key}, {'iv', iv});
      *
-     *          // encrypt some data (note: the input will be padded!)
+     *          // encrypt some data (note: the last block will be padded at Finalize!)
      *          std::vector<std::byte> cipher;
      *          algorithm->Add("Hello World!", cipher);
+     *          std::vector<std::byte> cipher_tail;
+     *          algorithm->Finalize(cipher_tail);
+     *          cipher.insert(cipher.end(), cipher_tail.begin(), cipher_tail.end());
      *
      *          // show the cipher
      *          std::cout << headcode::mem::MemoryToHex(cipher) << std::endl;
@@ -151,6 +158,11 @@ private:
      */
     PaddingStrategy block_padding_strategy_ = PaddingStrategy::PADDING_PKCS_5_7;
 
+    /**
+     * @brief   Incoming data of an incomplete block held back until the next Add(...) or Finalize(...).
+     */
+    std::vector<std::byte> carry_;
+
 public:
     /**
      * @brief   Constructor.
@@ -202,15 +214,17 @@ public:
      * to a non-zero value, then it is highly recommended that the length of
      * the input (text) is a multiple of this incoming block size.
      *
-     * Padding will be applied as necessary. Padding is expensive though.
-     * Check the algorithm's description (call to GetDescription()) about the
-     * the incoming block size (block_size_incoming_) and prepare your input
-     * data accordingly to avoid costly operations.
+     * Only whole blocks are handed to the algorithm. The remainder of an incomplete
+     * block is held back in an internal carry buffer and completed with the next call.
+     * Therefore the data may be added in chunks of any size. Padding is applied only
+     * once to the very last incomplete block at Finalize(...).
+     *
+     * The text is viewed in place and not copied.
      *
      * @param   text                the text to add.
      * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
      */
-    int Add(std::string const & text);
+    int Add(std::string_view text);
 
     /**
      * @brief   Adds text to the algorithm
@@ -224,20 +238,21 @@ public:
      * to a non-zero value, then it is highly recommended that the length of
      * the input (text) is a multiple of this incoming block size.
      *
-     * If the block_size_outgoing_ value in the algorithm's description is set
-     * to a non-zero value, then it is highly recommended that the length of
-     * the output (block_outgoing) is a multiple of this outgoing block size.
+     * The outgoing data block is resized to hold the output of the whole blocks
+     * processed in this call.
+     *
+     * Only whole blocks are handed to the algorithm. The remainder of an incomplete
+     * block is held back in an internal carry buffer and completed with the next call.
+     * Therefore the data may be added in chunks of any size. Padding is applied only
+     * once to the very last incomplete block at Finalize(...).
      *
-     * Padding will be applied as necessary. Padding is expensive though.
-     * Check the algorithm's description (call to GetDescription()) about the
-     * the incoming block size (block_size_incoming_) and prepare your input
-     * data accordingly to avoid costly operations.
+     * The text is viewed in place and not copied.
      *
      * @param   text                the text to add.
      * @param   block_outgoing      the outgoing data block.
      * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
      */
-    int Add(std::string const & text, std::vector<std::byte> & block_outgoing);
+    int Add(std::string_view text, std::vector<std::byte> & block_outgoing);
 
     /**
      * @brief   Adds data to the algorithm
@@ -253,10 +268,10 @@ public:
      * to a non-zero value, then it is highly recommended that the length of
      * the input (block_incoming) is a multiple of this incoming block size.
      *
-     * Padding will be applied as necessary. Padding is expensive though.
-     * Check the algorithm's description (call to GetDescription()) about the
-     * the incoming block size (block_size_incoming_) and prepare your input
-     * data accordingly to avoid costly operations.
+     * Only whole blocks are handed to the algorithm. The remainder of an incomplete
+     * block is held back in an internal carry buffer and completed with the next call.
+     * Therefore the data may be added in chunks of any size. Padding is applied only
+     * once to the very last incomplete block at Finalize(...).
      *
      * @param   block_incoming      incoming data block.
      * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
@@ -275,14 +290,13 @@ public:
      * to a non-zero value, then it is highly recommended that the length of
      * the input (block_incoming) is a multiple of this incoming block size.
      *
-     * If the block_size_outgoing_ value in the algorithm's description is set
-     * to a non-zero value, then it is highly recommended that the length of
-     * the output (block_outgoing) is a multiple of this outgoing block size.
+     * The outgoing data block is resized to hold the output of the whole blocks
+     * processed in this call.
      *
-     * Padding will be applied as necessary. Padding is expensive though.
-     * Check the algorithm's description (call to GetDescription()) about the
-     * the incoming block size (block_size_incoming_) and prepare your input
-     * data accordingly to avoid costly operations.
+     * Only whole blocks are handed to the algorithm. The remainder of an incomplete
+     * block is held back in an internal carry buffer and completed with the next call.
+     * Therefore the data may be added in chunks of any size. Padding is applied only
+     * once to the very last incomplete block at Finalize(...).
      *
      * @param   block_incoming      incoming data block.
      * @param   block_outgoing      the outgoing data block.
@@ -290,6 +304,54 @@ public:
      */
     int Add(std::vector<std::byte> const & block_incoming, std::vector<std::byte> & block_outgoing);
 
+    /**
+     * @brief   Adds data to the algorithm
+     *
+     * This variant drops any outgoing blocks the algorithm would produce.
+     *
+     * The incoming data is viewed in place: neither copied nor allocated. Thus
+     * this is the cheapest way to feed text or mapped memory to hashes.
+     *
+     * Only whole blocks are handed to the algorithm. The remainder of an incomplete
+     * block is held back in an internal carry buffer and completed with the next call.
+     * Padding is applied only once to the very last incomplete block at Finalize(...).
+     *
+     * @param   block_incoming      view on the incoming data.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add(ByteView block_incoming);
+
+    /**
+     * @brief   Adds data to the algorithm
+     *
+     * The incoming data is viewed in place: neither copied nor allocated. The outgoing
+     * data block is resized to hold the output of the whole blocks processed in this call.
+     *
+     * Only whole blocks are handed to the algorithm. The remainder of an incomplete
+     * block is held back in an internal carry buffer and completed with the next call.
+     * Padding is applied only once to the very last incomplete block at Finalize(...).
+     *
+     * @param   block_incoming      view on the incoming data.
+     * @param   block_outgoing      the outgoing data block.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add(ByteView block_incoming, std::vector<std::byte> & block_outgoing);
+
+    /**
+     * @brief   Adds data to the algorithm
+     *
+     * Like the other view based Add(...) but the output is written into caller supplied
+     * memory. The outgoing memory must be able to hold the output of all whole blocks
+     * processed in this call (see GetOutgoingSize()), else Error::kInvalidArgument is
+     * returned and nothing is processed.
+     *
+     * @param   block_incoming      view on the incoming data.
+     * @param   block_outgoing      view on the outgoing memory.
+     * @param   size_outgoing       will receive the number of bytes written to block_outgoing.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add(ByteView block_incoming, MutableByteView block_outgoing, std::uint64_t & size_outgoing);
+
     /**
      * @brief   Adds data to the algorithm
      *
@@ -305,7 +367,8 @@ public:
      * to a non-zero value, then it is highly recommended that the length of
      * the output (block_outgoing) is a multiple of this outgoing block size.
      *
-     * The data will **not be** padded and will given to the algorithm instance as-is.
+     * The data will **not be** padded and will given to the algorithm instance as-is. This
+     * also bypasses the carry buffer of incomplete blocks used by the other Add(...) methods.
      * This method expects the data in the proper format and size suitable for the
      * algorithm. BEWARE: if you do not know how, use the other more convenient
      * Add(...) methods. They do have a more elaborated input checking.
@@ -321,6 +384,26 @@ public:
             unsigned char * block_outgoing,
             std::uint64_t & size_outgoing);
 
+    /**
+     * @brief   Returns the number of outgoing bytes an Add(...) of some incoming bytes will produce.
+     *
+     * This takes any pending bytes of an incomplete block in the carry buffer into account.
+     *
+     * @param   size_incoming       the number of incoming bytes to add.
+     * @return  The number of bytes the outgoing memory must hold.
+     */
+    std::uint64_t GetOutgoingSize(std::uint64_t size_incoming) const;
+
+    /**
+     * @brief   Returns the number of bytes Finalize(...) writes into caller supplied memory.
+     *
+     * This is the output of a pending incomplete block in the carry buffer (once padded)
+     * followed by the result size stated in the description.
+     *
+     * @return  The number of bytes the result memory must hold.
+     */
+    std::uint64_t GetFinalizeSize() const;
+
     /**
      * @brief   Returns the padding strategy used for blocks at the Add(...) method.
      * @return  The padding strategy used for in/out blocks.
@@ -342,12 +425,45 @@ public:
      * Finalization data will be padded (though as this is expensive this should be avoided).
      * Please ensure proper size of finalization data according to algorithm description.
      *
+     * A pending incomplete block left by the Add(...) methods is padded and processed
+     * first. Any output of this last block is placed in front of the algorithm's result.
+     *
      * @param   result                  the result of the algorithm.
      * @param   finalization_data       the final data (== final key) to use, if any.
      * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
      */
     int Finalize(std::vector<std::byte> & result,
-                 std::map<std::string, std::vector<std::byte>> const & finalization_data = {});
+                 std::map<std::string, std::vector<std::byte>> const & finalization_data);
+
+    /**
+     * @brief   Finalizes this object instance without any finalization data.
+     *
+     * Same as the other Finalize(...) methods but no finalization data is converted
+     * or padded.
+     *
+     * A pending incomplete block left by the Add(...) methods is padded and processed
+     * first. Any output of this last block is placed in front of the algorithm's result.
+     *
+     * @param   result                  the result of the algorithm.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize(std::vector<std::byte> & result);
+
+    /**
+     * @brief   Finalizes this object instance into caller supplied memory without any finalization data.
+     *
+     * The result memory must be at least of the result size stated in the description
+     * plus the output of any pending incomplete block (see GetFinalizeSize()).
+     *
+     * A pending incomplete block left by the Add(...) methods is padded and processed
+     * first. Any output of this last block is placed in front of the algorithm's result:
+     * if the memory cannot hold it (see GetFinalizeSize()) Error::kInvalidArgument is
+     * returned and nothing is finalized.
+     *
+     * @param   result                  view on the memory receiving the result of the algorithm.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize(MutableByteView result);
 
     /**
      * @brief   Finalizes this object instance.
@@ -363,6 +479,9 @@ public:
      * Finalization data will be padded (though as this is expensive this should be avoided).
      * Please ensure proper size of finalization data according to algorithm description.
      *
+     * A pending incomplete block left by the Add(...) methods is padded and processed
+     * first. Any output of this last block is placed in front of the algorithm's result.
+     *
      * @param   result                  the result of the algorithm.
      * @param   finalization_data       the final data (== final key) to use, if any.
      * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
@@ -386,6 +505,11 @@ public:
      * be passed on as-is to the algorithm, meaning result memory has to be at a proper size.
      * If in doubt, use one of the other Finalize(...) using byte vectors methods.
      *
+     * A pending incomplete block left by the Add(...) methods is padded and processed
+     * first. Any output of this last block is placed in front of the algorithm's result:
+     * if the memory cannot hold it (see GetFinalizeSize()) Error::kInvalidArgument is
+     * returned and nothing is finalized.
+     *
      * @param   result                  the result of the algorithm.
      * @param   result_size             size of the result for finalization.
      * @param   finalization_data       the final data (== final key) to use, if any.
@@ -416,7 +540,16 @@ public:
      * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
      * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
      */
-    int Initialize(std::map<std::string, std::vector<std::byte>> const & initialization_data = {});
+    int Initialize(std::map<std::string, std::vector<std::byte>> const & initialization_data);
+
+    /**
+     * @brief   Initialize this object instance without any initialization data.
+     *
+     * The object **WILL NOT** be initialized twice.
+     *
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize();
 
     /**
      * @brief   Initialize this object instance.
@@ -455,6 +588,56 @@ public:
         return initialized_;
     }
 
+    /**
+     * @brief   Re-initializes this object instance with new initialization data.
+     *
+     * This drops any state and initializes the algorithm again as if it had been
+     * freshly created. Use this to reuse an algorithm instance with a different key.
+     *
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reinitialize(std::map<std::string, std::vector<std::byte>> const & initialization_data);
+
+    /**
+     * @brief   Re-initializes this object instance with new initialization data.
+     *
+     * This drops any state and initializes the algorithm again as if it had been
+     * freshly created. Use this to reuse an algorithm instance with a different key.
+     *
+     * BEWARE: the given data will be handed out to the algorithm as-is, i.e. the memory
+     * pointers as well as the size *must* be sufficient. If in doubt, use the other
+     * Reinitialize(...) method using byte vectors.
+     *
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reinitialize(
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data);
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     *
+     * Any data added so far (including a pending incomplete block) is dropped and the
+     * finalized flag is cleared. The initialization data (e.g. the key) given last is kept:
+     * providers keep their key schedule where possible and restore the initial IV.
+     *
+     * This allows to process message after message with the very same instance:
+     * @code
+     *      algorithm->Initialize({{"key", key}, {"iv", iv}});
+     *      for (auto const & message : messages) {
+     *          algorithm->Add(message, cipher);
+     *          algorithm->Finalize(cipher_tail);
+     *          algorithm->Reset();
+     *      }
+     * @endcode
+     *
+     * Algorithms not supporting a reset return Error::kInvalidOperation: use Reinitialize() then.
+     *
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset();
+
     /**
      * @brief   Sets a new padding strategy used for blocks at the Add(...) method.
      * This changes the padding strategy applied to blocks at the Add(...) method.
@@ -464,7 +647,48 @@ public:
         block_padding_strategy_ = block_padding_strategy;
     }
 
+    /**
+     * @brief   Squeezes more output of an extendable output function (XOF).
+     *
+     * XOFs (like SHAKE or BLAKE3) produce an endless stream of output. Finalize() writes the
+     * start of the stream, each Squeeze() the bytes right after the ones written last. So
+     * output of any length is produced piece by piece in bounded memory:
+     * @code
+     *      algorithm->Add(seed);
+     *      algorithm->Finalize(MutableByteView{mask});
+     *      while (...) {
+     *          algorithm->Squeeze(MutableByteView{mask});
+     *          ...
+     *      }
+     * @endcode
+     *
+     * Squeezing before Finalize() or on an algorithm without extendable output fails with
+     * Error::kInvalidOperation. Reset() drops the stream along with the message.
+     *
+     * @param   output      view on the memory receiving the next output bytes.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Squeeze(MutableByteView output);
+
+    /**
+     * @brief   Squeezes more output of an extendable output function (XOF).
+     *
+     * Same as Squeeze(MutableByteView) on raw memory.
+     *
+     * @param   output      the memory receiving the next output bytes.
+     * @param   size        number of bytes to squeeze.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Squeeze(unsigned char * output, std::uint64_t size);
+
 private:
+    /**
+     * @brief   Pads and processes any pending incomplete block held in the carry buffer.
+     * @param   block_outgoing      the outgoing data of the last block.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int FlushCarry(std::vector<std::byte> & block_outgoing);
+
     /**
      * @brief   Adds data to the algorithm
      * @param   block_incoming      incoming data block to add.
@@ -503,6 +727,22 @@ private:
      */
     virtual int Initialize_(
             std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) = 0;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * The default refuses with Error::kInvalidOperation.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    virtual int Reset_();
+
+    /**
+     * @brief   Squeezes more output after Finalize() (extendable output functions only).
+     * The default refuses with Error::kInvalidOperation.
+     * @param   output      the memory receiving the next output bytes.
+     * @param   size        number of bytes to squeeze.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    virtual int Squeeze_(unsigned char * output, std::uint64_t size);
 };
 
 
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_BATCH_HASHER_HPP
+#define HEADCODE_SPACE_CRYPT_BATCH_HASHER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "algorithm.hpp"
+#include "byte_view.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Hashes many independent messages at once.
+ *
+ * Multi-buffer hashes (e.g. "hcs-mb-sha256") process several messages side by side in
+ * the lanes of the vector registers. Any other hash is served one message after the other.
+ * Get a batch hasher via Factory::CreateBatchHasher():
+ *
+ * @code
+ * auto hasher = headcode::crypt::Factory::CreateBatchHasher("hcs-mb-sha256");
+ * std::vector<headcode::crypt::ByteView> messages{...};
+ * std::vector<std::byte> digests;
+ * hasher->Hash(messages, digests);     // digest i is at i * result size
+ * @endcode
+ *
+ * Each digest is the very same as of Initialize(), Add() and Finalize() of the hash
+ * on the message (i.e. the last block is padded).
+ */
+class BatchHasher {
+
+public:
+    /**
+     * @brief   Destructor.
+     */
+    virtual ~BatchHasher() = default;
+
+    /**
+     * @brief   Gets the description of the hash.
+     * @return  A structure describing the hash.
+     */
+    Algorithm::Description const & GetDescription() const;
+
+    /**
+     * @brief   Gets the number of messages hashed side by side.
+     * @return  The number of lanes (1 if the messages are hashed one after the other).
+     */
+    std::uint64_t GetLanes() const;
+
+    /**
+     * @brief   Hashes a batch of messages.
+     * @param   messages        the messages.
+     * @param   digests         receives the digests: digest i at i * result size.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Hash(std::vector<ByteView> const & messages, std::vector<std::byte> & digests);
+
+    /**
+     * @brief   Hashes a batch of messages into caller supplied memory.
+     * @param   messages        the messages.
+     * @param   count           the number of messages.
+     * @param   digests         receives the digests: digest i at i * result size.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Hash(ByteView const * messages, std::uint64_t count, MutableByteView digests);
+
+private:
+    /**
+     * @brief   Gets the description of the hash.
+     * @return  A structure describing the hash.
+     */
+    virtual Algorithm::Description const & GetDescription_() const = 0;
+
+    /**
+     * @brief   Gets the number of messages hashed side by side.
+     * @return  The number of lanes.
+     */
+    virtual std::uint64_t GetLanes_() const = 0;
+
+    /**
+     * @brief   Hashes a batch of messages.
+     * @param   messages        the messages.
+     * @param   count           the number of messages.
+     * @param   digests         receives the digests (count * result size bytes).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    virtual int Hash_(ByteView const * messages, std::uint64_t count, unsigned char * digests) = 0;
+};
+
+
+}
+
+
+#endif
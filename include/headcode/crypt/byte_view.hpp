@@ -0,0 +1,200 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_BYTE_VIEW_HPP
+#define HEADCODE_SPACE_CRYPT_BYTE_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   A non-owning view on a contiguous read-only memory region.
+ *
+ * This is a poor man's `std::span<std::byte const>` for C++17. It never allocates nor copies:
+ * it just carries a pointer and a size. The viewed memory must outlive the view.
+ *
+ * The member functions are named after `std::span` on purpose.
+ */
+class ByteView {
+
+    unsigned char const * data_ = nullptr;        //!< @brief Start of the viewed memory.
+    std::uint64_t size_ = 0;                      //!< @brief Number of bytes viewed.
+
+public:
+    /**
+     * @brief   Constructor of an empty view.
+     */
+    constexpr ByteView() noexcept = default;
+
+    /**
+     * @brief   Constructor.
+     * @param   data        start of the memory.
+     * @param   size        number of bytes.
+     */
+    constexpr ByteView(unsigned char const * data, std::uint64_t size) noexcept : data_{data}, size_{size} {
+    }
+
+    /**
+     * @brief   Constructor.
+     * @param   data        start of the memory.
+     * @param   size        number of bytes.
+     */
+    ByteView(std::byte const * data, std::uint64_t size) noexcept
+            : data_{reinterpret_cast<unsigned char const *>(data)}, size_{size} {
+    }
+
+    /**
+     * @brief   Constructor viewing the content of a byte vector.
+     * @param   memory      the memory to view.
+     */
+    ByteView(std::vector<std::byte> const & memory) noexcept
+            : data_{reinterpret_cast<unsigned char const *>(memory.data())}, size_{memory.size()} {
+    }
+
+    /**
+     * @brief   Constructor viewing the characters of a text.
+     * @param   text        the text to view.
+     */
+    ByteView(std::string_view text) noexcept
+            : data_{reinterpret_cast<unsigned char const *>(text.data())}, size_{text.size()} {
+    }
+
+    /**
+     * @brief   Returns the start of the viewed memory.
+     * @return  The start of the viewed memory.
+     */
+    constexpr unsigned char const * data() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @brief   Checks if the view is empty.
+     * @return  true, if no bytes are viewed.
+     */
+    constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief   Returns the number of bytes viewed.
+     * @return  The number of bytes viewed.
+     */
+    constexpr std::uint64_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief   Returns a view on a part of this view.
+     * @param   offset      the first byte of the new view.
+     * @param   count       the number of bytes of the new view.
+     * @return  A view on the part of this view.
+     */
+    constexpr ByteView subview(std::uint64_t offset, std::uint64_t count) const noexcept {
+        return ByteView{data_ + offset, count};
+    }
+};
+
+
+/**
+ * @brief   A non-owning view on a contiguous writable memory region.
+ *
+ * This is a poor man's `std::span<std::byte>` for C++17. It never allocates nor copies:
+ * it just carries a pointer and a size. The viewed memory must outlive the view.
+ *
+ * The member functions are named after `std::span` on purpose.
+ */
+class MutableByteView {
+
+    unsigned char * data_ = nullptr;        //!< @brief Start of the viewed memory.
+    std::uint64_t size_ = 0;                //!< @brief Number of bytes viewed.
+
+public:
+    /**
+     * @brief   Constructor of an empty view.
+     */
+    constexpr MutableByteView() noexcept = default;
+
+    /**
+     * @brief   Constructor.
+     * @param   data        start of the memory.
+     * @param   size        number of bytes.
+     */
+    constexpr MutableByteView(unsigned char * data, std::uint64_t size) noexcept : data_{data}, size_{size} {
+    }
+
+    /**
+     * @brief   Constructor.
+     * @param   data        start of the memory.
+     * @param   size        number of bytes.
+     */
+    MutableByteView(std::byte * data, std::uint64_t size) noexcept
+            : data_{reinterpret_cast<unsigned char *>(data)}, size_{size} {
+    }
+
+    /**
+     * @brief   Constructor viewing the content of a byte vector.
+     * @param   memory      the memory to view.
+     */
+    MutableByteView(std::vector<std::byte> & memory) noexcept
+            : data_{reinterpret_cast<unsigned char *>(memory.data())}, size_{memory.size()} {
+    }
+
+    /**
+     * @brief   Returns the start of the viewed memory.
+     * @return  The start of the viewed memory.
+     */
+    constexpr unsigned char * data() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @brief   Checks if the view is empty.
+     * @return  true, if no bytes are viewed.
+     */
+    constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief   Returns the number of bytes viewed.
+     * @return  The number of bytes viewed.
+     */
+    constexpr std::uint64_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief   Returns a view on a part of this view.
+     * @param   offset      the first byte of the new view.
+     * @param   count       the number of bytes of the new view.
+     * @return  A view on the part of this view.
+     */
+    constexpr MutableByteView subview(std::uint64_t offset, std::uint64_t count) const noexcept {
+        return MutableByteView{data_ + offset, count};
+    }
+
+    /**
+     * @brief   Converts to a read-only view.
+     * @return  A read-only view on the same memory.
+     */
+    constexpr operator ByteView() const noexcept {
+        return ByteView{data_, size_};
+    }
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CHECKSUM_HPP
+#define HEADCODE_SPACE_CRYPT_CHECKSUM_HPP
+
+
+#include <cstdint>
+
+
+/**
+ * Combining CRC checksums.
+ *
+ * The checksum of two pieces of data one after the other follows from the checksums of the
+ * pieces and the size of the second one: pieces may be checksummed on different threads or
+ * machines in any order and be put together later on. A checksum is passed as number, i.e.
+ * the big endian bytes of Finalize() of "hcs-crc32c", "hcs-crc32" or "hcs-crc64".
+ *
+ * @code
+ * auto crc = headcode::crypt::CombineCRC32C(crc_a, crc_b, size_b);      // CRC-32C of a followed by b
+ * @endcode
+ */
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Combines two CRC-32C checksums.
+ * @param   crc_a       the checksum of the first piece of data.
+ * @param   crc_b       the checksum of the second piece of data.
+ * @param   size_b      size of the second piece of data.
+ * @return  The checksum of the first piece followed by the second.
+ */
+std::uint32_t CombineCRC32C(std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t size_b);
+
+
+/**
+ * @brief   Combines two CRC-32 checksums.
+ * @param   crc_a       the checksum of the first piece of data.
+ * @param   crc_b       the checksum of the second piece of data.
+ * @param   size_b      size of the second piece of data.
+ * @return  The checksum of the first piece followed by the second.
+ */
+std::uint32_t CombineCRC32(std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t size_b);
+
+
+/**
+ * @brief   Combines two CRC-64 checksums.
+ * @param   crc_a       the checksum of the first piece of data.
+ * @param   crc_b       the checksum of the second piece of data.
+ * @param   size_b      size of the second piece of data.
+ * @return  The checksum of the first piece followed by the second.
+ */
+std::uint64_t CombineCRC64(std::uint64_t crc_a, std::uint64_t crc_b, std::uint64_t size_b);
+
+
+}
+
+
+#endif
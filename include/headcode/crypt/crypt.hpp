@@ -11,10 +11,17 @@
 
 
 #include "algorithm.hpp"
+#include "batch_hasher.hpp"
+#include "byte_view.hpp"
+#include "checksum.hpp"
 #include "error.hpp"
 #include "family.hpp"
 #include "factory.hpp"
+#include "oneshot.hpp"
 #include "padding.hpp"
+#include "parallel.hpp"
+#include "siphash.hpp"
+#include "typed.hpp"
 #include "version.hpp"
 
 
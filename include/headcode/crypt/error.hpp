@@ -19,9 +19,10 @@ namespace headcode::crypt {
  * @brief   Different errors the framework will report.
  */
 enum class Error {
-    kNoError = 0,                 //!< @brief No error occurred, all good.
-    kInvalidArgument = -1,        //!< @brief An argument provided by the user is invalid/unexpected.
-    kInvalidOperation = -2        //!< @brief An operation is invalid (target object is not in propber state).
+    kNoError = 0,                       //!< @brief No error occurred, all good.
+    kInvalidArgument = -1,              //!< @brief An argument provided by the user is invalid/unexpected.
+    kInvalidOperation = -2,             //!< @brief An operation is invalid (target object is not in propber state).
+    kAuthenticationFailed = -3          //!< @brief The data does not match the authentication tag.
 };
 
 
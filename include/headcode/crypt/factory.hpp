@@ -10,19 +10,62 @@
 #define HEADCODE_SPACE_CRYPT_FACTORY_HPP
 
 
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "algorithm.hpp"
+#include "batch_hasher.hpp"
 #include "family.hpp"
 
 
 namespace headcode::crypt {
 
 
+class Pool;
+
+
+/**
+ * @brief   Dense integer index of a registered algorithm, see Factory::Resolve().
+ * The id of an algorithm does not change for the lifetime of the process.
+ */
+using AlgorithmId = std::uint32_t;
+
+
+/**
+ * @brief   The id of no (unknown) algorithm.
+ */
+constexpr AlgorithmId kUnknownAlgorithmId = std::numeric_limits<AlgorithmId>::max();
+
+
 /**
  * @brief   The Algorithm factory.
+ *
+ * Besides creating fresh instances, the factory keeps a pool of recycled instances
+ * per algorithm. Acquire() hands out an instance wrapped in a Handle, which gives
+ * the instance back to the pool when dropped. This saves the allocation and setup
+ * of a new instance per message:
+ *
+ * @code
+ * {
+ *     auto sha256 = headcode::crypt::Factory::Acquire("ltc-sha256");
+ *     sha256->Add(message);
+ *     std::vector<std::byte> hash;
+ *     sha256->Finalize(hash);
+ * }   // <-- the instance is Reset() and parked in the pool for the next Acquire()
+ * @endcode
+ *
+ * Lookups never lock: the registry is an immutable snapshot, replaced as a whole on
+ * Register(). Hot paths may resolve the name of an algorithm once and create instances
+ * by the AlgorithmId then, which saves the string lookup as well:
+ *
+ * @code
+ * static auto const sha256_id = headcode::crypt::Factory::Resolve("ltc-sha256");
+ * auto sha256 = headcode::crypt::Factory::Create(sha256_id);
+ * @endcode
  */
 class Factory {
 
@@ -41,6 +84,16 @@ public:
          */
         virtual std::unique_ptr<Algorithm> operator()() const = 0;
 
+        /**
+         * @brief   Creates a batch hasher with a dedicated multi-buffer implementation.
+         * @param   max_lanes       max number of messages hashed side by side (0 for the best available).
+         * @return  A new batch hasher or nullptr if the algorithm has no multi-buffer implementation.
+         */
+        virtual std::unique_ptr<BatchHasher> CreateBatchHasher(std::uint64_t max_lanes) const {
+            static_cast<void>(max_lanes);
+            return nullptr;
+        }
+
         /**
          * @brief   Gets the algorithm description.
          * @return  A structure describing the algorithm.
@@ -48,6 +101,103 @@ public:
         virtual Algorithm::Description const & GetDescription() const = 0;
     };
 
+    /**
+     * @brief   An algorithm instance borrowed from the pool.
+     * The instance is given back to its pool when the handle is dropped.
+     */
+    class Handle {
+
+        std::unique_ptr<Algorithm> algorithm_;        //!< @brief The borrowed instance.
+        std::shared_ptr<Pool> pool_;                  //!< @brief The pool the instance returns to.
+
+    public:
+        /**
+         * @brief   Constructor of an empty handle.
+         */
+        Handle() = default;
+
+        /**
+         * @brief   Constructor.
+         * @param   algorithm       the borrowed instance.
+         * @param   pool            the pool the instance returns to.
+         */
+        Handle(std::unique_ptr<Algorithm> algorithm, std::shared_ptr<Pool> pool);
+
+        /**
+         * @brief   Copy Constructor.
+         */
+        Handle(Handle const &) = delete;
+
+        /**
+         * @brief   Move Constructor.
+         */
+        Handle(Handle &&) noexcept = default;
+
+        /**
+         * @brief   Destructor. Gives the instance back to the pool.
+         */
+        ~Handle();
+
+        /**
+         * @brief   Assignment.
+         * @return  this.
+         */
+        Handle & operator=(Handle const &) = delete;
+
+        /**
+         * @brief   Move Assignment. The instance held so far is given back to the pool.
+         * @return  this.
+         */
+        Handle & operator=(Handle && rhs) noexcept;
+
+        /**
+         * @brief   Checks if this handle holds an instance.
+         * @return  true, if this handle holds an instance.
+         */
+        explicit operator bool() const noexcept {
+            return algorithm_ != nullptr;
+        }
+
+        /**
+         * @brief   Access to the borrowed instance.
+         * @return  The borrowed instance.
+         */
+        Algorithm & operator*() const noexcept {
+            return *algorithm_;
+        }
+
+        /**
+         * @brief   Access to the borrowed instance.
+         * @return  The borrowed instance.
+         */
+        Algorithm * operator->() const noexcept {
+            return algorithm_.get();
+        }
+
+        /**
+         * @brief   Returns the borrowed instance.
+         * @return  The borrowed instance (or nullptr if the handle is empty).
+         */
+        Algorithm * get() const noexcept {
+            return algorithm_.get();
+        }
+
+        /**
+         * @brief   Gives the instance back to the pool right now. The handle is empty afterwards.
+         */
+        void Release();
+    };
+
+    /**
+     * @brief   Statistics of the pool of a single algorithm.
+     */
+    struct PoolStatistics {
+        std::uint64_t hits_{0};          //!< @brief Number of instances served from the pool.
+        std::uint64_t misses_{0};        //!< @brief Number of instances created since the pool was empty.
+        std::uint64_t size_{0};          //!< @brief Number of idle instances in the pool.
+        std::uint64_t limit_{0};         //!< @brief Max number of idle instances kept.
+    };
+
     /**
      * @brief   Constructor.
      */
@@ -80,6 +230,42 @@ public:
      */
     Factory & operator=(Factory &&) = delete;
 
+    /**
+     * @brief   Borrows an initialized instance of a specific algorithm from its pool.
+     * A recycled instance has been Reset() when it was given back. If the pool is empty,
+     * a new instance is created and initialized.
+     * @param   name        the name of the algorithm.
+     * @return  A handle to an initialized instance (which is empty in case of failure).
+     */
+    static Handle Acquire(std::string const & name);
+
+    /**
+     * @brief   Borrows an initialized instance of a specific algorithm from its pool.
+     * A recycled instance of an algorithm with initialization arguments (e.g. a key) is
+     * reinitialized with the given arguments. Instances without initialization arguments
+     * are handed out as left by Reset().
+     * @param   name                    the name of the algorithm.
+     * @param   initialization_data     the initialization arguments.
+     * @return  A handle to an initialized instance (which is empty in case of failure).
+     */
+    static Handle Acquire(std::string const & name,
+                          std::map<std::string, std::vector<std::byte>> const & initialization_data);
+
+    /**
+     * @brief   Borrows an initialized instance of a specific algorithm from its pool.
+     * @param   id          the id of the algorithm as returned by Resolve().
+     * @return  A handle to an initialized instance (which is empty in case of failure).
+     */
+    static Handle Acquire(AlgorithmId id);
+
+    /**
+     * @brief   Borrows an initialized instance of a specific algorithm from its pool.
+     * @param   id                      the id of the algorithm as returned by Resolve().
+     * @param   initialization_data     the initialization arguments.
+     * @return  A handle to an initialized instance (which is empty in case of failure).
+     */
+    static Handle Acquire(AlgorithmId id, std::map<std::string, std::vector<std::byte>> const & initialization_data);
+
     /**
      * @brief   Create an instance of a specific algorithm.
      * @param   name        the name of the algorithm to create.
@@ -87,11 +273,45 @@ public:
      */
     static std::unique_ptr<Algorithm> Create(std::string const & name);
 
+    /**
+     * @brief   Create an instance of a specific algorithm.
+     * @param   id          the id of the algorithm as returned by Resolve().
+     * @return  A shared pointer pointing to an object (which may be nullptr in case of failure).
+     */
+    static std::unique_ptr<Algorithm> Create(AlgorithmId id);
+
+    /**
+     * @brief   Create a batch hasher for a specific hash.
+     * Hashes with a multi-buffer implementation (e.g. "hcs-mb-sha256") hash several messages
+     * side by side; any other hash algorithm is served one message after the other.
+     * @param   name            the name of the hash.
+     * @param   max_lanes       max number of messages hashed side by side (0 for the best available).
+     * @return  A new batch hasher (or nullptr if the algorithm is unknown or not a hash).
+     */
+    static std::unique_ptr<BatchHasher> CreateBatchHasher(std::string const & name, std::uint64_t max_lanes = 0);
+
     /**
      * @brief   Gets a list of all known algorithms and their descriptions.
+     * The list is a snapshot: it is not changed by a later Register() and stays valid as long
+     * as the returned pointer is held.
      * @return  A list of all algorithms which can be instantiated incl. their descriptions.
      */
-    static std::map<std::string, Algorithm::Description> const & GetAlgorithmDescriptions();
+    static std::shared_ptr<std::map<std::string, Algorithm::Description> const> GetAlgorithmDescriptions();
+
+    /**
+     * @brief   Returns the statistics of the pool of an algorithm.
+     * @param   name        the name of the algorithm.
+     * @return  The pool statistics (all 0 for an unknown algorithm).
+     */
+    static PoolStatistics GetPoolStatistics(std::string const & name);
+
+    /**
+     * @brief   Returns the version of the registry.
+     * The version is increased by each Register(). Caches of algorithm instances compare
+     * the version to notice algorithms which have been registered anew.
+     * @return  The current version of the registry.
+     */
+    static std::uint64_t GetRegistryVersion();
 
     /**
      * @brief   Registers a producer, which can create algorithm instance of a specific name and family.
@@ -100,6 +320,21 @@ public:
      * @param   producer    the Producer instance.
      */
     static void Register(std::string const & name, Family family, std::shared_ptr<Factory::Producer> producer);
+
+    /**
+     * @brief   Resolves the name of an algorithm to its id.
+     * @param   name        the name of the algorithm.
+     * @return  The id of the algorithm (or kUnknownAlgorithmId if the algorithm is unknown).
+     */
+    static AlgorithmId Resolve(std::string const & name);
+
+    /**
+     * @brief   Sets the maximum number of idle instances kept in the pool of an algorithm.
+     * @param   name        the name of the algorithm.
+     * @param   limit       the new limit (0 disables pooling for this algorithm).
+     * @return  true, if the algorithm is known.
+     */
+    static bool SetPoolLimit(std::string const & name, std::uint64_t limit);
 };
 
 
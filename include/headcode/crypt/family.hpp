@@ -18,9 +18,12 @@ namespace headcode::crypt {
  * @brief   Different types of algorithms we know of.
  */
 enum class Family {
-    kSymmetricCipher = 0x0000,        //!< @brief An symmetric algorithm used to encrypt and/or decrypt data.
-    kHash = 0x1000,                   //!< @brief An algorithm which produces hash-sums of data.
-    kUnknown = 0xffff                 //!< @brief An unknown or error like family.
+    kSymmetricCipher = 0x0000,           //!< @brief An symmetric algorithm used to encrypt and/or decrypt data.
+    kHash = 0x1000,                      //!< @brief An algorithm which produces hash-sums of data.
+    kChecksum = 0x2000,                  //!< @brief An algorithm which detects accidental changes of data.
+    kNonCryptographicHash = 0x3000,      //!< @brief A fast hash with no resistance against attacks.
+    kMessageAuthenticationCode = 0x4000, //!< @brief A keyed algorithm which authenticates data.
+    kUnknown = 0xffff                    //!< @brief An unknown or error like family.
 };
 
 
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_ONESHOT_HPP
+#define HEADCODE_SPACE_CRYPT_ONESHOT_HPP
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "byte_view.hpp"
+#include "factory.hpp"
+
+
+/**
+ * One-shot functions: a single call processes a whole message.
+ *
+ * @code
+ * std::vector<std::byte> digest;
+ * headcode::crypt::Digest("openssl-sha256", message, digest);
+ *
+ * std::vector<std::byte> cipher;
+ * headcode::crypt::Encrypt("ltc-aes-128-cbc-encryptor", key, iv, message, cipher);
+ * @endcode
+ *
+ * Each thread keeps one ready to use instance per algorithm, which is Reset() after each
+ * message. Hence there is no allocation and no setup per call. A cipher is re-keyed only
+ * if key or IV differ from the previous call on this thread.
+ *
+ * Results are the very same as with Initialize(), Add() and Finalize() on a fresh instance
+ * (i.e. the last block is padded).
+ *
+ * Authenticated ciphers (GCM, ChaCha20-Poly1305) take AAD and tag, which are not passed here:
+ * they are refused with Error::kInvalidArgument.
+ */
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Decrypts a whole message.
+ * @param   name        the name of the decryptor (e.g. "ltc-aes-128-cbc-decryptor").
+ * @param   key         the key.
+ * @param   iv          the IV (ignored if the algorithm does not take an IV).
+ * @param   data        the message.
+ * @param   result      receives the plain text (incl. the padding), cleared on failure.
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ *          Error::kInvalidArgument for an encryptor or an authenticated cipher.
+ */
+int Decrypt(std::string const & name, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result);
+
+/**
+ * @brief   Decrypts a whole message.
+ * @param   id          the id of the decryptor as returned by Factory::Resolve().
+ * @param   key         the key.
+ * @param   iv          the IV (ignored if the algorithm does not take an IV).
+ * @param   data        the message.
+ * @param   result      receives the plain text (incl. the padding), cleared on failure.
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ *          Error::kInvalidArgument for an encryptor or an authenticated cipher.
+ */
+int Decrypt(AlgorithmId id, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result);
+
+/**
+ * @brief   Computes the digest of a whole message.
+ * @param   name        the name of the hash (e.g. "openssl-sha256").
+ * @param   data        the message.
+ * @param   result      receives the digest, cleared on failure.
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ */
+int Digest(std::string const & name, ByteView data, std::vector<std::byte> & result);
+
+/**
+ * @brief   Computes the digest of a whole message.
+ * @param   id          the id of the hash as returned by Factory::Resolve().
+ * @param   data        the message.
+ * @param   result      receives the digest, cleared on failure.
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ */
+int Digest(AlgorithmId id, ByteView data, std::vector<std::byte> & result);
+
+/**
+ * @brief   Encrypts a whole message.
+ * @param   name        the name of the encryptor (e.g. "ltc-aes-128-cbc-encryptor").
+ * @param   key         the key.
+ * @param   iv          the IV (ignored if the algorithm does not take an IV).
+ * @param   data        the message.
+ * @param   result      receives the cipher text, cleared on failure.
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ *          Error::kInvalidArgument for a decryptor or an authenticated cipher.
+ */
+int Encrypt(std::string const & name, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result);
+
+/**
+ * @brief   Encrypts a whole message.
+ * @param   id          the id of the encryptor as returned by Factory::Resolve().
+ * @param   key         the key.
+ * @param   iv          the IV (ignored if the algorithm does not take an IV).
+ * @param   data        the message.
+ * @param   result      receives the cipher text, cleared on failure.
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ *          Error::kInvalidArgument for a decryptor or an authenticated cipher.
+ */
+int Encrypt(AlgorithmId id, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result);
+
+
+}
+
+
+#endif
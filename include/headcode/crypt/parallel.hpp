@@ -0,0 +1,67 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_PARALLEL_HPP
+#define HEADCODE_SPACE_CRYPT_PARALLEL_HPP
+
+
+#include <cstdint>
+
+
+/**
+ * Parallel processing of large buffers.
+ *
+ * Some algorithms (e.g. "ltc-aes-128-ctr") split a large buffer handed to a single Add()
+ * into slices and process the slices side by side on a process-wide pool of worker threads.
+ * The result is the very same as of processing the buffer on a single thread.
+ *
+ * This is off by default: a library should not spin up threads on its own. Opt in with:
+ *
+ * @code
+ * auto parallelism = headcode::crypt::GetParallelism();
+ * parallelism.threads_ = 0;                         // all cores
+ * parallelism.threshold_ = 4ul * 1024 * 1024;       // only buffers of 4 MiB and more
+ * headcode::crypt::SetParallelism(parallelism);
+ * @endcode
+ */
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Settings of the parallel processing.
+ */
+struct Parallelism {
+
+    /**
+     * @brief   Default minimum size of a buffer processed in parallel.
+     */
+    static constexpr std::uint64_t kDefaultThreshold = 1024ul * 1024ul;
+
+    std::uint64_t threshold_{kDefaultThreshold};        //!< @brief Minimum size of a buffer processed in parallel.
+    unsigned int threads_{1};                           //!< @brief Max threads on a buffer (0: all cores, 1: off).
+};
+
+
+/**
+ * @brief   Gets the current settings of the parallel processing.
+ * @return  The current settings.
+ */
+Parallelism GetParallelism();
+
+
+/**
+ * @brief   Sets the parallel processing for all algorithms of the process.
+ * @param   parallelism     the new settings.
+ */
+void SetParallelism(Parallelism const & parallelism);
+
+
+}
+
+
+#endif
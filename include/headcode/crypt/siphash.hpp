@@ -0,0 +1,254 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_SIPHASH_HPP
+#define HEADCODE_SPACE_CRYPT_SIPHASH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "byte_view.hpp"
+#include "error.hpp"
+
+
+namespace headcode::crypt {
+
+
+namespace detail {
+
+
+/**
+ * @brief   The SipHash state: 4 words of 64 bits.
+ * Shared by the inlined SipHash24 and the "hcs-siphash-2-4*" algorithms.
+ */
+struct SipHashState {
+
+    std::uint64_t v_[4];        //!< @brief The state words.
+
+    /**
+     * @brief   Reads a word of the message (little endian).
+     * @param   data        the 8 bytes of the word.
+     * @return  The word.
+     */
+    static std::uint64_t Load(unsigned char const * data) noexcept {
+        std::uint64_t word = 0;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        // a single load: the byte loop below is not merged by the compiler
+        std::memcpy(&word, data, sizeof(word));
+#else
+        for (int i = 7; i >= 0; --i) {
+            word = (word << 8) | data[i];
+        }
+#endif
+        return word;
+    }
+
+    /**
+     * @brief   Gets the last word: the remaining bytes and the message size in the top byte.
+     * @param   data        the remaining bytes (less than 8).
+     * @param   rest        number of remaining bytes.
+     * @param   size        size of the whole message.
+     * @return  The last word.
+     */
+    static std::uint64_t LoadLast(unsigned char const * data, std::uint64_t rest, std::uint64_t size) noexcept {
+        std::uint64_t word = size << 56;
+        for (std::uint64_t i = 0; i < rest; ++i) {
+            word |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+        }
+        return word;
+    }
+
+    /**
+     * @brief   Starts a message.
+     * @param   k0          the first key word.
+     * @param   k1          the second key word.
+     * @param   wide        128 bit output.
+     */
+    void Start(std::uint64_t k0, std::uint64_t k1, bool wide) noexcept {
+        v_[0] = k0 ^ 0x736f6d6570736575ul;
+        v_[1] = k1 ^ 0x646f72616e646f6dul ^ (wide ? 0xeeul : 0ul);
+        v_[2] = k0 ^ 0x6c7967656e657261ul;
+        v_[3] = k1 ^ 0x7465646279746573ul;
+    }
+
+    /**
+     * @brief   A single SipRound.
+     */
+    void Round() noexcept {
+        v_[0] += v_[1];
+        v_[1] = Rotate(v_[1], 13) ^ v_[0];
+        v_[0] = Rotate(v_[0], 32);
+        v_[2] += v_[3];
+        v_[3] = Rotate(v_[3], 16) ^ v_[2];
+        v_[0] += v_[3];
+        v_[3] = Rotate(v_[3], 21) ^ v_[0];
+        v_[2] += v_[1];
+        v_[1] = Rotate(v_[1], 17) ^ v_[2];
+        v_[2] = Rotate(v_[2], 32);
+    }
+
+    /**
+     * @brief   Compresses a word of the message (2 rounds).
+     * @param   word        the word.
+     */
+    void Compress(std::uint64_t word) noexcept {
+        v_[3] ^= word;
+        Round();
+        Round();
+        v_[0] ^= word;
+    }
+
+    /**
+     * @brief   Compresses all whole words of a message.
+     * @param   data        the message.
+     * @param   size        size of the message.
+     * @return  Number of bytes compressed.
+     */
+    std::uint64_t CompressWords(unsigned char const * data, std::uint64_t size) noexcept {
+        auto words = size / 8;
+        for (std::uint64_t i = 0; i < words; ++i) {
+            Compress(Load(data + 8 * i));
+        }
+        return words * 8;
+    }
+
+    /**
+     * @brief   Gets the first output word (4 rounds).
+     * @param   last        the last word (see LoadLast()).
+     * @param   wide        128 bit output.
+     * @return  The first 64 bit of the output.
+     */
+    std::uint64_t Finish(std::uint64_t last, bool wide) noexcept {
+        Compress(last);
+        v_[2] ^= wide ? 0xeeul : 0xfful;
+        return Squeeze();
+    }
+
+    /**
+     * @brief   Gets the second output word of the 128 bit output (4 rounds).
+     * @return  The second 64 bit of the output.
+     */
+    std::uint64_t FinishHigh() noexcept {
+        v_[1] ^= 0xddul;
+        return Squeeze();
+    }
+
+private:
+    static std::uint64_t Rotate(std::uint64_t x, int n) noexcept {
+        return (x << n) | (x >> (64 - n));
+    }
+
+    std::uint64_t Squeeze() noexcept {
+        Round();
+        Round();
+        Round();
+        Round();
+        return v_[0] ^ v_[1] ^ v_[2] ^ v_[3];
+    }
+};
+
+
+}
+
+
+/**
+ * @brief   SipHash-2-4 with the key set once: the fast path for keyed hash tables.
+ *
+ * The algorithms "hcs-siphash-2-4" and "hcs-siphash-2-4-128" take the key via
+ * Algorithm::Initialize() and the bytes of the message via Add(). For short keys of a hash
+ * table (8 to 64 bytes) the virtual calls and the argument maps of the runtime algorithm
+ * cost more than the hash itself. This class is inlined completely: no virtual dispatch, no
+ * heap allocation, no argument map. The outputs are the very same.
+ *
+ * The 64 bit hash is returned as number: this is the little endian value of the 8 bytes of
+ * the SipHash reference (and of Finalize() of "hcs-siphash-2-4").
+ *
+ * @code
+ * headcode::crypt::SipHash24 siphash;
+ * if (siphash.SetKey(key) != 0) {                           // 16 bytes, e.g. random at startup
+ *     // a wrong key: do not hash with the all zero key
+ * }
+ * auto bucket = siphash.Hash(name) % bucket_count;
+ * @endcode
+ */
+class SipHash24 {
+
+    std::uint64_t k0_ = 0;        //!< @brief The first key word.
+    std::uint64_t k1_ = 0;        //!< @brief The second key word.
+
+public:
+    static constexpr std::uint64_t kKeySize = 16;        //!< @brief Size of the key.
+
+    /**
+     * @brief   The 128 bit output.
+     */
+    using Digest128 = std::array<std::byte, 16>;
+
+    /**
+     * @brief   Constructor. The key is all zeros until SetKey().
+     * There is no constructor taking the key: a wrong key must not go unnoticed.
+     */
+    SipHash24() noexcept = default;
+
+    /**
+     * @brief   Hashes a message to 64 bit.
+     * @param   data        the message.
+     * @return  The hash.
+     */
+    std::uint64_t Hash(ByteView data) const noexcept {
+        detail::SipHashState state;
+        state.Start(k0_, k1_, false);
+        auto done = state.CompressWords(data.data(), data.size());
+        return state.Finish(detail::SipHashState::LoadLast(data.data() + done, data.size() - done, data.size()),
+                            false);
+    }
+
+    /**
+     * @brief   Hashes a message to 128 bit.
+     * @param   data        the message.
+     * @return  The 16 bytes of the hash as of the SipHash reference (and "hcs-siphash-2-4-128").
+     */
+    Digest128 Hash128(ByteView data) const noexcept {
+        detail::SipHashState state;
+        state.Start(k0_, k1_, true);
+        auto done = state.CompressWords(data.data(), data.size());
+        std::uint64_t words[2];
+        words[0] = state.Finish(detail::SipHashState::LoadLast(data.data() + done, data.size() - done, data.size()),
+                                true);
+        words[1] = state.FinishHigh();
+
+        Digest128 digest;
+        for (std::size_t i = 0; i < digest.size(); ++i) {
+            digest[i] = static_cast<std::byte>(words[i / 8] >> (8 * (i % 8)));
+        }
+        return digest;
+    }
+
+    /**
+     * @brief   Sets the key.
+     * A key of the wrong size is refused and the previous key is kept.
+     * @param   key         the key (16 bytes).
+     * @return  Error enum value if negative (0 == ok).
+     */
+    int SetKey(ByteView key) noexcept {
+        if ((key.size() != kKeySize) || (key.data() == nullptr)) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        k0_ = detail::SipHashState::Load(key.data());
+        k1_ = detail::SipHashState::Load(key.data() + 8);
+        return static_cast<int>(Error::kNoError);
+    }
+};
+
+
+}
+
+
+#endif
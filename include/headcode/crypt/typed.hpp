@@ -0,0 +1,620 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_TYPED_HPP
+#define HEADCODE_SPACE_CRYPT_TYPED_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "byte_view.hpp"
+#include "error.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The library providing the algorithm of a typed Hash or Cipher.
+ */
+enum class Provider {
+    kLTC,            //!< @brief libtomcrypt
+    kOpenSSL         //!< @brief OpenSSL (only if the library has been built with OpenSSL)
+};
+
+
+/**
+ * @brief   MD5 hash tag for the typed Hash.
+ */
+struct Md5 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 16;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   RIPEMD128 hash tag for the typed Hash (libtomcrypt only).
+ */
+struct Ripemd128 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 16;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   RIPEMD160 hash tag for the typed Hash.
+ */
+struct Ripemd160 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 20;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   RIPEMD256 hash tag for the typed Hash (libtomcrypt only).
+ */
+struct Ripemd256 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 32;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   RIPEMD320 hash tag for the typed Hash (libtomcrypt only).
+ */
+struct Ripemd320 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 40;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   SHA1 hash tag for the typed Hash.
+ */
+struct Sha1 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 20;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   SHA224 hash tag for the typed Hash.
+ */
+struct Sha224 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 28;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   SHA256 hash tag for the typed Hash.
+ */
+struct Sha256 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 32;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   SHA384 hash tag for the typed Hash.
+ */
+struct Sha384 {
+    static constexpr std::uint64_t kBlockSize = 128;        //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 48;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   SHA512 hash tag for the typed Hash.
+ */
+struct Sha512 {
+    static constexpr std::uint64_t kBlockSize = 128;        //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 64;        //!< @brief Size of the digest.
+};
+
+/**
+ * @brief   Tiger192 hash tag for the typed Hash (libtomcrypt only).
+ */
+struct Tiger192 {
+    static constexpr std::uint64_t kBlockSize = 64;         //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = 24;        //!< @brief Size of the digest.
+};
+
+
+/**
+ * @brief   AES-128 in CBC mode tag for the typed Cipher.
+ */
+struct Aes128Cbc {
+    static constexpr std::uint64_t kBlockSize = 16;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = 16;          //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = 16;           //!< @brief Size of the IV.
+};
+
+/**
+ * @brief   AES-192 in CBC mode tag for the typed Cipher.
+ */
+struct Aes192Cbc {
+    static constexpr std::uint64_t kBlockSize = 16;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = 24;          //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = 16;           //!< @brief Size of the IV.
+};
+
+/**
+ * @brief   AES-256 in CBC mode tag for the typed Cipher.
+ */
+struct Aes256Cbc {
+    static constexpr std::uint64_t kBlockSize = 16;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = 32;          //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = 16;           //!< @brief Size of the IV.
+};
+
+/**
+ * @brief   AES-128 in ECB mode tag for the typed Cipher.
+ */
+struct Aes128Ecb {
+    static constexpr std::uint64_t kBlockSize = 16;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = 16;          //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = 0;            //!< @brief Size of the IV.
+};
+
+/**
+ * @brief   AES-192 in ECB mode tag for the typed Cipher.
+ */
+struct Aes192Ecb {
+    static constexpr std::uint64_t kBlockSize = 16;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = 24;          //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = 0;            //!< @brief Size of the IV.
+};
+
+/**
+ * @brief   AES-256 in ECB mode tag for the typed Cipher.
+ */
+struct Aes256Ecb {
+    static constexpr std::uint64_t kBlockSize = 16;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = 32;          //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = 0;            //!< @brief Size of the IV.
+};
+
+
+/**
+ * @brief   Encryption direction tag for the typed Cipher.
+ */
+struct Encryption {};
+
+/**
+ * @brief   Decryption direction tag for the typed Cipher.
+ */
+struct Decryption {};
+
+
+namespace detail {
+
+
+/**
+ * @brief   The libtomcrypt functions behind a typed Hash.
+ * The state is opaque here, so the public headers do not depend on libtomcrypt.
+ */
+template <typename HashAlgorithm>
+struct LTCHashBackend {
+    static constexpr std::size_t kStateSize = 512;        //!< @brief Room for the libtomcrypt hash_state.
+    static int Init(void * state) noexcept;
+    static int Process(void * state, unsigned char const * data, std::uint64_t size) noexcept;
+    static int Done(void * state, unsigned char * result) noexcept;
+};
+
+
+/**
+ * @brief   The OpenSSL functions behind a typed Hash.
+ * The state is opaque here, so the public headers do not depend on OpenSSL.
+ */
+template <typename HashAlgorithm>
+struct OpenSSLHashBackend {
+    static constexpr std::size_t kStateSize = 256;        //!< @brief Room for the OpenSSL hash context.
+    static int Init(void * state) noexcept;
+    static int Process(void * state, unsigned char const * data, std::uint64_t size) noexcept;
+    static int Done(void * state, unsigned char * result) noexcept;
+};
+
+
+/**
+ * @brief   The libtomcrypt AES block functions behind a typed Cipher.
+ * The key schedule is opaque here, so the public headers do not depend on libtomcrypt.
+ */
+struct LTCAESBackend {
+    static constexpr std::size_t kStateSize = 5120;        //!< @brief Room for the libtomcrypt symmetric_key.
+    static int Setup(void * state, unsigned char const * key, std::uint64_t key_size) noexcept;
+    static int EncryptBlock(void const * state, unsigned char const * in, unsigned char * out) noexcept;
+    static int DecryptBlock(void const * state, unsigned char const * in, unsigned char * out) noexcept;
+    static void Done(void * state) noexcept;
+};
+
+
+}
+
+
+/**
+ * @brief   A hash algorithm known at compile time.
+ *
+ * This is the fast path for callers which know the algorithm at compile time: no virtual
+ * dispatch, no factory lookup, no heap allocation. The state lives inside the object and
+ * the digest is returned as a fixed-size std::array.
+ *
+ * The bytes produced are the very same as the ones of the runtime Algorithm of the same
+ * provider (e.g. Hash<Sha256, Provider::kLTC> and "ltc-sha256"), i.e. an incomplete last
+ * block is padded with the default padding strategy (PKCS#5/7) before finalization.
+ *
+ * @code
+ * auto digest = headcode::crypt::Hash<headcode::crypt::Sha256>::Compute("The quick brown fox.");
+ *
+ * headcode::crypt::Hash<headcode::crypt::Sha256, headcode::crypt::Provider::kOpenSSL> sha256;
+ * sha256.Add(part_1);
+ * sha256.Add(part_2);
+ * digest = sha256.Finalize();     // <-- sha256 is ready for the next message
+ * @endcode
+ *
+ * @tparam  HashAlgorithm   the hash algorithm tag, e.g. Sha256.
+ * @tparam  provider        the library providing the hash algorithm.
+ */
+template <typename HashAlgorithm, Provider provider = Provider::kLTC>
+class Hash {
+
+    using Backend = std::conditional_t<provider == Provider::kLTC,
+                                       detail::LTCHashBackend<HashAlgorithm>,
+                                       detail::OpenSSLHashBackend<HashAlgorithm>>;
+
+    alignas(16) unsigned char state_[Backend::kStateSize];        //!< @brief The opaque provider state.
+    std::uint64_t size_ = 0;                                      //!< @brief Bytes added to the current message.
+
+public:
+    static constexpr std::uint64_t kBlockSize = HashAlgorithm::kBlockSize;          //!< @brief Input block size.
+    static constexpr std::uint64_t kResultSize = HashAlgorithm::kResultSize;        //!< @brief Size of the digest.
+
+    static_assert(kBlockSize <= 255, "Padding needs a block size below 256 bytes.");
+
+    /**
+     * @brief   The digest.
+     */
+    using Digest = std::array<std::byte, kResultSize>;
+
+    /**
+     * @brief   Constructor. The hash is ready to take data.
+     */
+    Hash() noexcept {
+        Backend::Init(state_);
+    }
+
+    /**
+     * @brief   Adds data to the current message.
+     * @param   data        the data to add.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add(ByteView data) noexcept {
+        size_ += data.size();
+        return Backend::Process(state_, data.data(), data.size());
+    }
+
+    /**
+     * @brief   Computes the digest of a single message.
+     * @param   data        the message.
+     * @return  The digest.
+     */
+    static Digest Compute(ByteView data) noexcept {
+        Hash hash;
+        hash.Add(data);
+        return hash.Finalize();
+    }
+
+    /**
+     * @brief   Finalizes the current message. The hash is reset and ready for the next message.
+     * @param   digest      receives the digest.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize(Digest & digest) noexcept {
+
+        auto res = static_cast<int>(Error::kNoError);
+
+        auto padding_size = (kBlockSize - size_ % kBlockSize) % kBlockSize;
+        if (padding_size > 0) {
+            unsigned char padding[kBlockSize];
+            std::memset(padding, static_cast<int>(padding_size), padding_size);
+            res = Backend::Process(state_, padding, padding_size);
+        }
+        if (res == 0) {
+            res = Backend::Done(state_, reinterpret_cast<unsigned char *>(digest.data()));
+        }
+
+        auto res_reset = Reset();
+        return res != 0 ? res : res_reset;
+    }
+
+    /**
+     * @brief   Finalizes the current message. The hash is reset and ready for the next message.
+     * @return  The digest.
+     */
+    Digest Finalize() noexcept {
+        Digest digest{};
+        Finalize(digest);
+        return digest;
+    }
+
+    /**
+     * @brief   Drops the current message and starts over.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset() noexcept {
+        size_ = 0;
+        return Backend::Init(state_);
+    }
+};
+
+
+/**
+ * @brief   A symmetric cipher known at compile time.
+ *
+ * This is the fast path for callers which know the cipher at compile time: no virtual
+ * dispatch, no factory lookup, no heap allocation. The key schedule lives inside the object.
+ * Ciphers are provided by libtomcrypt.
+ *
+ * The bytes produced are the very same as the ones of the runtime Algorithm (e.g.
+ * Cipher<Aes128Cbc, Encryption> and "ltc-aes-128-cbc-encryptor"): incomplete blocks are
+ * carried over to the next Add() and the last one is padded (PKCS#5/7) at Finalize().
+ *
+ * @code
+ * headcode::crypt::Cipher<headcode::crypt::Aes128Cbc, headcode::crypt::Encryption> aes;
+ * aes.Initialize(key, iv);
+ * aes.Add(plain, cipher, cipher_size);
+ * @endcode
+ *
+ * @tparam  CipherAlgorithm     the cipher algorithm tag, e.g. Aes128Cbc.
+ * @tparam  Direction           either Encryption or Decryption.
+ * @tparam  provider            the library providing the cipher algorithm.
+ */
+template <typename CipherAlgorithm, typename Direction, Provider provider = Provider::kLTC>
+class Cipher {
+
+    static_assert(provider == Provider::kLTC, "Typed ciphers are provided by libtomcrypt only.");
+    static_assert(std::is_same_v<Direction, Encryption> || std::is_same_v<Direction, Decryption>,
+                  "Direction must be either Encryption or Decryption.");
+
+public:
+    static constexpr std::uint64_t kBlockSize = CipherAlgorithm::kBlockSize;        //!< @brief Cipher block size.
+    static constexpr std::uint64_t kKeySize = CipherAlgorithm::kKeySize;            //!< @brief Size of the key.
+    static constexpr std::uint64_t kIVSize = CipherAlgorithm::kIVSize;              //!< @brief Size of the IV.
+
+private:
+    using Backend = detail::LTCAESBackend;
+
+    alignas(16) unsigned char state_[Backend::kStateSize];        //!< @brief The opaque key schedule.
+    std::array<unsigned char, kBlockSize> iv_{};                  //!< @brief The current chaining value.
+    std::array<unsigned char, kBlockSize> initial_iv_{};          //!< @brief The IV as initialized.
+    std::array<unsigned char, kBlockSize> carry_{};               //!< @brief Incomplete block of the last Add().
+    std::uint64_t carry_size_ = 0;                                //!< @brief Number of bytes in carry_.
+    bool initialized_ = false;                                    //!< @brief Initialized flag.
+
+public:
+    /**
+     * @brief   Constructor.
+     */
+    Cipher() noexcept = default;
+
+    /**
+     * @brief   Copy Constructor.
+     */
+    Cipher(Cipher const &) = delete;
+
+    /**
+     * @brief   Move Constructor.
+     */
+    Cipher(Cipher &&) = delete;
+
+    /**
+     * @brief   Destructor.
+     */
+    ~Cipher() noexcept {
+        if (initialized_) {
+            Backend::Done(state_);
+        }
+    }
+
+    /**
+     * @brief   Assignment.
+     * @return  this.
+     */
+    Cipher & operator=(Cipher const &) = delete;
+
+    /**
+     * @brief   Move Assignment.
+     * @return  this.
+     */
+    Cipher & operator=(Cipher &&) = delete;
+
+    /**
+     * @brief   Adds data. Only whole blocks are processed, the rest is carried over to the next call.
+     * @param   block_incoming      incoming data.
+     * @param   block_outgoing      outgoing memory, must hold at least GetOutgoingSize() bytes.
+     * @param   size_outgoing       receives the number of bytes written to block_outgoing.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add(ByteView block_incoming, MutableByteView block_outgoing, std::uint64_t & size_outgoing) noexcept {
+
+        size_outgoing = 0;
+        if (!initialized_) {
+            return static_cast<int>(Error::kInvalidOperation);
+        }
+        if (block_outgoing.size() < GetOutgoingSize(block_incoming.size())) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+
+        auto in = block_incoming.data();
+        auto in_size = block_incoming.size();
+        auto out = block_outgoing.data();
+
+        // complete the carried block first
+        if (carry_size_ > 0) {
+            auto fill = std::min(kBlockSize - carry_size_, in_size);
+            std::memcpy(carry_.data() + carry_size_, in, fill);
+            carry_size_ += fill;
+            in += fill;
+            in_size -= fill;
+            if (carry_size_ < kBlockSize) {
+                return static_cast<int>(Error::kNoError);
+            }
+            auto res = ProcessBlock(carry_.data(), out);
+            if (res != 0) {
+                return res;
+            }
+            carry_size_ = 0;
+            out += kBlockSize;
+            size_outgoing += kBlockSize;
+        }
+
+        // whole blocks straight from the caller's memory
+        while (in_size >= kBlockSize) {
+            auto res = ProcessBlock(in, out);
+            if (res != 0) {
+                return res;
+            }
+            in += kBlockSize;
+            in_size -= kBlockSize;
+            out += kBlockSize;
+            size_outgoing += kBlockSize;
+        }
+
+        if (in_size > 0) {
+            std::memcpy(carry_.data(), in, in_size);
+            carry_size_ = in_size;
+        }
+
+        return static_cast<int>(Error::kNoError);
+    }
+
+    /**
+     * @brief   Finalizes the current message. A carried incomplete block is padded and processed.
+     * The cipher is reset and ready for the next message afterwards.
+     * @param   block_outgoing      outgoing memory, must hold at least kBlockSize bytes.
+     * @param   size_outgoing       receives the number of bytes written to block_outgoing.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize(MutableByteView block_outgoing, std::uint64_t & size_outgoing) noexcept {
+
+        size_outgoing = 0;
+        if (!initialized_) {
+            return static_cast<int>(Error::kInvalidOperation);
+        }
+
+        auto res = static_cast<int>(Error::kNoError);
+        if (carry_size_ > 0) {
+            if (block_outgoing.size() < kBlockSize) {
+                return static_cast<int>(Error::kInvalidArgument);
+            }
+            auto padding_size = kBlockSize - carry_size_;
+            std::memset(carry_.data() + carry_size_, static_cast<int>(padding_size), padding_size);
+            res = ProcessBlock(carry_.data(), block_outgoing.data());
+            if (res == 0) {
+                size_outgoing = kBlockSize;
+            }
+        }
+
+        Reset();
+        return res;
+    }
+
+    /**
+     * @brief   Returns the number of bytes the next Add() will produce.
+     * @param   size_incoming       the number of bytes to add.
+     * @return  The number of bytes the next Add() will produce.
+     */
+    std::uint64_t GetOutgoingSize(std::uint64_t size_incoming) const noexcept {
+        auto total_size = carry_size_ + size_incoming;
+        return total_size - (total_size % kBlockSize);
+    }
+
+    /**
+     * @brief   Sets up the key (and IV).
+     * @param   key     the key, must be kKeySize bytes.
+     * @param   iv      the IV, must be kIVSize bytes.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize(ByteView key, ByteView iv = ByteView{}) noexcept {
+
+        if ((key.size() != kKeySize) || (iv.size() != kIVSize)) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+
+        if (initialized_) {
+            Backend::Done(state_);
+            initialized_ = false;
+        }
+
+        auto res = Backend::Setup(state_, key.data(), key.size());
+        if (res != 0) {
+            return res;
+        }
+
+        if (kIVSize > 0) {
+            std::memcpy(initial_iv_.data(), iv.data(), kIVSize);
+        }
+        initialized_ = true;
+        Reset();
+
+        return static_cast<int>(Error::kNoError);
+    }
+
+    /**
+     * @brief   Checks if this cipher has been initialized.
+     * @return  true, if the key has been set.
+     */
+    bool IsInitialized() const noexcept {
+        return initialized_;
+    }
+
+    /**
+     * @brief   Drops the current message and starts over with the initial IV. The key is kept.
+     */
+    void Reset() noexcept {
+        iv_ = initial_iv_;
+        carry_size_ = 0;
+    }
+
+private:
+    /**
+     * @brief   Processes a single block. In and out may be the same memory.
+     * @param   in      the incoming block.
+     * @param   out     the outgoing block.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int ProcessBlock(unsigned char const * in, unsigned char * out) noexcept {
+
+        if constexpr (kIVSize == 0) {
+            if constexpr (std::is_same_v<Direction, Encryption>) {
+                return Backend::EncryptBlock(state_, in, out);
+            } else {
+                return Backend::DecryptBlock(state_, in, out);
+            }
+        } else {
+            unsigned char block[kBlockSize];
+            if constexpr (std::is_same_v<Direction, Encryption>) {
+                for (std::uint64_t i = 0; i < kBlockSize; ++i) {
+                    block[i] = in[i] ^ iv_[i];
+                }
+                auto res = Backend::EncryptBlock(state_, block, out);
+                std::memcpy(iv_.data(), out, kBlockSize);
+                return res;
+            } else {
+                std::memcpy(block, in, kBlockSize);
+                auto res = Backend::DecryptBlock(state_, block, out);
+                for (std::uint64_t i = 0; i < kBlockSize; ++i) {
+                    out[i] ^= iv_[i];
+                }
+                std::memcpy(iv_.data(), block, kBlockSize);
+                return res;
+            }
+        }
+    }
+};
+
+
+}
+
+
+#endif
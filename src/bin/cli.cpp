@@ -114,9 +114,9 @@ bool VerifyAlgorithm(std::string const & algorithm) {
         return false;
     }
 
-    auto const & known_algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
-    auto iter = known_algorithms.find(algorithm);
-    if (iter != known_algorithms.end()) {
+    auto known_algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
+    auto iter = known_algorithms->find(algorithm);
+    if (iter != known_algorithms->end()) {
         return true;
     }
 
@@ -16,11 +16,15 @@
 
 void ListAlgorithms(std::ostream & out) {
 
-    for (auto family : {headcode::crypt::Family::kSymmetricCipher, headcode::crypt::Family::kHash}) {
+    for (auto family : {headcode::crypt::Family::kSymmetricCipher,
+                        headcode::crypt::Family::kHash,
+                        headcode::crypt::Family::kChecksum,
+                        headcode::crypt::Family::kNonCryptographicHash,
+                        headcode::crypt::Family::kMessageAuthenticationCode}) {
 
         out << headcode::crypt::GetFamilyText(family) << "\n";
         auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
-        for (auto const & [name, description] : algorithms) {
+        for (auto const & [name, description] : *algorithms) {
             if (description.family_ == family) {
                 out << "    " << name << "\n";
             }
@@ -76,7 +76,12 @@ int Finalize(std::vector<std::byte> & result,
              CryptoClientArguments const &,
              std::unique_ptr<headcode::crypt::Algorithm> & algorithm) {
     // TODO: check on finalize data
-    return algorithm->Finalize(result);
+    std::vector<std::byte> final_result;
+    auto res = algorithm->Finalize(final_result);
+    if (res == 0) {
+        result.insert(result.end(), final_result.begin(), final_result.end());
+    }
+    return res;
 }
 
 
@@ -87,6 +92,11 @@ int Finalize(std::vector<std::byte> & result,
  * @return  exit code (0 == success).
  */
 int Initialize(CryptoClientArguments const &, std::unique_ptr<headcode::crypt::Algorithm> & algorithm) {
+    if (algorithm->IsInitialized()) {
+        // reused instance: Reset() already brought it back to the initialized state
+        return 0;
+    }
+
     // TODO: check on initialize data
     return algorithm->Initialize();
 }
@@ -207,8 +217,11 @@ int Run(CryptoClientArguments const & config) {
                 break;
             }
 
-            // use a new algorithm instance next time
-            algorithm = headcode::crypt::Factory::Create(config.algorithm_);
+            // reuse the very same algorithm instance next time
+            res = algorithm->Reset();
+            if (res != 0) {
+                break;
+            }
         }
     }
 
@@ -9,7 +9,6 @@
 #include <cstring>
 
 #include <headcode/logger/logger.hpp>
-#include <headcode/mem/mem.hpp>
 #include <headcode/crypt/algorithm.hpp>
 #include <headcode/crypt/error.hpp>
 
@@ -17,62 +16,155 @@
 using namespace headcode::crypt;
 
 
-int Algorithm::Add(const std::string & text) {
-    std::vector<std::byte> ignored_outgoing;
-    return Add(text, ignored_outgoing);
+/**
+ * @brief   Sizes the outgoing memory for a number of incoming bytes processed.
+ * @param   block_outgoing      the outgoing memory block.
+ * @param   description         the description of the algorithm.
+ * @param   size_processed      the number of incoming bytes the algorithm will process.
+ */
+static void ResizeOutgoing(std::vector<std::byte> & block_outgoing,
+                           Algorithm::Description const & description,
+                           std::uint64_t size_processed) {
+
+    switch (description.processing_block_size) {
+
+        case ProcessingBlockSize::kEmpty:
+            block_outgoing.clear();
+            break;
+
+        case ProcessingBlockSize::kSame:
+            block_outgoing.resize(size_processed);
+            break;
+
+        default:
+            block_outgoing.resize(description.block_size_outgoing_);
+    }
 }
 
 
-int Algorithm::Add(std::string const & text, std::vector<std::byte> & block_outgoing) {
-    auto block_incoming = headcode::mem::StringToMemory(text);
-    return Add(block_incoming, block_outgoing);
+/**
+ * @brief   Empty set of initialization or finalization data.
+ */
+static std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const kNoArguments;
+
+
+/**
+ * @brief   Appends bytes to the carry buffer.
+ * @param   carry       the carry buffer.
+ * @param   data        the data to append.
+ * @param   size        number of bytes to append.
+ */
+static void AppendCarry(std::vector<std::byte> & carry, unsigned char const * data, std::uint64_t size) {
+    auto begin = reinterpret_cast<std::byte const *>(data);
+    carry.insert(carry.end(), begin, begin + size);
+}
+
+
+int Algorithm::Add(std::string_view text) {
+    return Add(ByteView{text});
+}
+
+
+int Algorithm::Add(std::string_view text, std::vector<std::byte> & block_outgoing) {
+    return Add(ByteView{text}, block_outgoing);
 }
 
 
 int Algorithm::Add(std::vector<std::byte> const & block_incoming) {
+    return Add(ByteView{block_incoming});
+}
+
+
+int Algorithm::Add(std::vector<std::byte> const & block_incoming, std::vector<std::byte> & block_outgoing) {
+    return Add(ByteView{block_incoming}, block_outgoing);
+}
+
+
+int Algorithm::Add(ByteView block_incoming) {
+    // algorithms without output (hashes) leave this vector unallocated
     std::vector<std::byte> ignored_outgoing;
     return Add(block_incoming, ignored_outgoing);
 }
 
 
-int Algorithm::Add(std::vector<std::byte> const & block_incoming, std::vector<std::byte> & block_outgoing) {
+int Algorithm::Add(ByteView block_incoming, std::vector<std::byte> & block_outgoing) {
+    block_outgoing.resize(GetOutgoingSize(block_incoming.size()));
+    std::uint64_t size_outgoing = 0;
+    return Add(block_incoming, MutableByteView{block_outgoing}, size_outgoing);
+}
+
+
+int Algorithm::Add(ByteView block_incoming, MutableByteView block_outgoing, std::uint64_t & size_outgoing) {
+
+    // In here we cut the incoming data into whole blocks. These are handed to the algorithm
+    // directly from the caller's memory. Any trailing partial block is kept in the carry buffer
+    // and completed with the next call. Padding is applied only once: at Finalize().
 
-    // In here we do the padding of the incoming (and outgoing) data.
+    size_outgoing = 0;
+    auto size_needed = GetOutgoingSize(block_incoming.size());
+    if (block_outgoing.size() < size_needed) {
+        headcode::logger::Warning{"headcode.crypt"} << "Outgoing memory too small for the data to add.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
 
-    auto block_incoming_data = reinterpret_cast<unsigned char const *>(block_incoming.data());
+    auto block_incoming_data = block_incoming.data();
     auto block_incoming_data_size = block_incoming.size();
+    auto block_outgoing_data = block_outgoing.data();
 
-    std::vector<std::byte> padded_block_incoming;
     auto const & description = GetDescription();
-    if ((GetBlockPaddingStrategy() != PaddingStrategy::PADDING_NONE) && (description.block_size_incoming_ != 0) &&
-        ((block_incoming_data_size % description.block_size_incoming_) != 0ul)) {
-
-        // This line below is expensive.
-        padded_block_incoming = block_incoming;
-        Pad(padded_block_incoming, description.block_size_incoming_, GetBlockPaddingStrategy());
+    auto block_size = description.block_size_incoming_;
+    if (block_size == 0) {
+        auto block_outgoing_data_size = size_needed;
+        auto res = Add(block_incoming_data, block_incoming_data_size, block_outgoing_data, block_outgoing_data_size);
+        if (res == 0) {
+            size_outgoing = size_needed;
+        }
+        return res;
+    }
 
-        block_incoming_data = reinterpret_cast<unsigned char const *>(padded_block_incoming.data());
-        block_incoming_data_size = padded_block_incoming.size();
+    if (carry_.size() + block_incoming_data_size < block_size) {
+        AppendCarry(carry_, block_incoming_data, block_incoming_data_size);
+        return static_cast<int>(Error::kNoError);
     }
 
-    switch (description.processing_block_size) {
+    bool same_size = description.processing_block_size == ProcessingBlockSize::kSame;
+    auto block_outgoing_data_size = size_needed;
 
-        case ProcessingBlockSize::kEmpty:
-            block_outgoing.clear();
-            break;
+    int res = static_cast<int>(Error::kNoError);
+    if (!carry_.empty()) {
 
-        case ProcessingBlockSize::kSame:
-            block_outgoing.resize(block_incoming_data_size);
-            break;
+        // complete the pending block first
+        auto missing = block_size - carry_.size();
+        AppendCarry(carry_, block_incoming_data, missing);
+        block_incoming_data += missing;
+        block_incoming_data_size -= missing;
 
-        default:
-            block_outgoing.resize(description.block_size_outgoing_);
+        auto size = same_size ? block_size : block_outgoing_data_size;
+        res = Add(reinterpret_cast<unsigned char const *>(carry_.data()), block_size, block_outgoing_data, size);
+        carry_.clear();
+        if (res != 0) {
+            return res;
+        }
+
+        if (same_size) {
+            block_outgoing_data += block_size;
+            block_outgoing_data_size -= block_size;
+        }
     }
 
-    auto block_outgoing_data = reinterpret_cast<unsigned char *>(block_outgoing.data());
-    auto block_outgoing_data_size = block_outgoing.size();
+    auto whole_blocks_size = block_incoming_data_size - (block_incoming_data_size % block_size);
+    if (whole_blocks_size > 0) {
+        auto size = same_size ? whole_blocks_size : block_outgoing_data_size;
+        res = Add(block_incoming_data, whole_blocks_size, block_outgoing_data, size);
+        if (res != 0) {
+            return res;
+        }
+    }
+
+    AppendCarry(carry_, block_incoming_data + whole_blocks_size, block_incoming_data_size - whole_blocks_size);
+    size_outgoing = size_needed;
 
-    return Add(block_incoming_data, block_incoming_data_size, block_outgoing_data, block_outgoing_data_size);
+    return res;
 }
 
 
@@ -96,6 +188,16 @@ int Algorithm::Add(unsigned char const * block_incoming,
 }
 
 
+int Algorithm::Finalize(std::vector<std::byte> & result) {
+    return Finalize(result, kNoArguments);
+}
+
+
+int Algorithm::Finalize(MutableByteView result) {
+    return Finalize(result.data(), result.size(), kNoArguments);
+}
+
+
 int Algorithm::Finalize(std::vector<std::byte> & result,
                         std::map<std::string, std::vector<std::byte>> const & finalization_data) {
 
@@ -114,9 +216,23 @@ int Algorithm::Finalize(
         std::vector<std::byte> & result,
         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) {
 
+    // Any pending partial block is padded and processed first. Output produced by this
+    // is placed in front of the final result.
+
+    std::vector<std::byte> carry_outgoing;
+    if (!IsFinalized()) {
+        auto res = FlushCarry(carry_outgoing);
+        if (res != 0) {
+            return res;
+        }
+    }
+
     auto result_size = GetDescription().result_size_;
-    if (result_size > 0) {
-        result.resize(result_size);
+    if ((result_size > 0) || !carry_outgoing.empty()) {
+        result.resize(carry_outgoing.size() + result_size);
+        if (!carry_outgoing.empty()) {
+            std::memcpy(result.data(), carry_outgoing.data(), carry_outgoing.size());
+        }
     }
 
     // In here we do the padding of the finalization data.
@@ -152,7 +268,8 @@ int Algorithm::Finalize(
         padded_data[name] = std::make_tuple(data, size);
     }
 
-    return Finalize(reinterpret_cast<unsigned char *>(result.data()), result.size(), padded_data);
+    auto result_data = reinterpret_cast<unsigned char *>(result.data()) + carry_outgoing.size();
+    return Finalize(result_data, result.size() - carry_outgoing.size(), padded_data);
 }
 
 
@@ -177,6 +294,27 @@ int Algorithm::Finalize(
 
     int res;
     if (!IsFinalized()) {
+
+        // the output of a pending incomplete block goes in front of the result
+        std::vector<std::byte> carry_outgoing;
+        if (!carry_.empty()) {
+            auto size_needed = GetFinalizeSize() - GetDescription().result_size_;
+            if (result_size < size_needed) {
+                headcode::logger::Warning{"headcode.crypt"}
+                        << "Result memory too small for the output of the pending block.";
+                return static_cast<int>(Error::kInvalidArgument);
+            }
+            res = FlushCarry(carry_outgoing);
+            if (res != 0) {
+                return res;
+            }
+            if (!carry_outgoing.empty()) {
+                std::memcpy(result, carry_outgoing.data(), carry_outgoing.size());
+                result += carry_outgoing.size();
+                result_size -= carry_outgoing.size();
+            }
+        }
+
         res = Finalize_(result, result_size, finalization_data);
         if (res == 0) {
             finalized_ = true;
@@ -190,11 +328,77 @@ int Algorithm::Finalize(
 }
 
 
+int Algorithm::FlushCarry(std::vector<std::byte> & block_outgoing) {
+
+    auto const & description = GetDescription();
+    if (carry_.empty()) {
+        ResizeOutgoing(block_outgoing, description, 0);
+        return static_cast<int>(Error::kNoError);
+    }
+
+    Pad(carry_, description.block_size_incoming_, GetBlockPaddingStrategy());
+    ResizeOutgoing(block_outgoing, description, carry_.size());
+
+    auto block_outgoing_data = reinterpret_cast<unsigned char *>(block_outgoing.data());
+    auto block_outgoing_data_size = block_outgoing.size();
+    auto res = Add(reinterpret_cast<unsigned char const *>(carry_.data()),
+                   carry_.size(),
+                   block_outgoing_data,
+                   block_outgoing_data_size);
+    carry_.clear();
+
+    return res;
+}
+
+
 Algorithm::Description const & Algorithm::GetDescription() const {
     return GetDescription_();
 }
 
 
+std::uint64_t Algorithm::GetFinalizeSize() const {
+
+    auto const & description = GetDescription();
+    if (carry_.empty() || IsFinalized()) {
+        return description.result_size_;
+    }
+
+    std::vector<std::byte> padded_carry{carry_};
+    Pad(padded_carry, description.block_size_incoming_, GetBlockPaddingStrategy());
+    std::vector<std::byte> carry_outgoing;
+    ResizeOutgoing(carry_outgoing, description, padded_carry.size());
+
+    return carry_outgoing.size() + description.result_size_;
+}
+
+
+std::uint64_t Algorithm::GetOutgoingSize(std::uint64_t size_incoming) const {
+
+    auto const & description = GetDescription();
+    switch (description.processing_block_size) {
+
+        case ProcessingBlockSize::kEmpty:
+            return 0;
+
+        case ProcessingBlockSize::kSame:
+            if (description.block_size_incoming_ == 0) {
+                return size_incoming;
+            } else {
+                auto total_size = carry_.size() + size_incoming;
+                return total_size - (total_size % description.block_size_incoming_);
+            }
+
+        default:
+            return description.block_size_outgoing_;
+    }
+}
+
+
+int Algorithm::Initialize() {
+    return Initialize(kNoArguments);
+}
+
+
 int Algorithm::Initialize(std::map<std::string, std::vector<std::byte>> const & initialization_data) {
 
     // In here we do the padding of the finalization data.
@@ -261,3 +465,63 @@ int Algorithm::Initialize(
 
     return res;
 }
+
+
+int Algorithm::Reinitialize(std::map<std::string, std::vector<std::byte>> const & initialization_data) {
+    carry_.clear();
+    initialized_ = false;
+    finalized_ = false;
+    return Initialize(initialization_data);
+}
+
+
+int Algorithm::Reinitialize(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+    carry_.clear();
+    initialized_ = false;
+    finalized_ = false;
+    return Initialize(initialization_data);
+}
+
+
+int Algorithm::Reset() {
+
+    // a refused reset leaves the instance untouched
+    auto res = Reset_();
+    if (res == 0) {
+        carry_.clear();
+        finalized_ = false;
+    }
+
+    return res;
+}
+
+
+int Algorithm::Reset_() {
+    return static_cast<int>(Error::kInvalidOperation);
+}
+
+
+int Algorithm::Squeeze(MutableByteView output) {
+    return Squeeze(output.data(), output.size());
+}
+
+
+int Algorithm::Squeeze(unsigned char * output, std::uint64_t size) {
+
+    if ((size > 0) && (output == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying output data which is NULL/nullptr while size is > 0.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    if (!IsFinalized()) {
+        headcode::logger::Warning{"headcode.crypt"} << "Not finalized yet; refusing to squeeze.";
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+
+    return Squeeze_(output, size);
+}
+
+
+int Algorithm::Squeeze_(unsigned char *, std::uint64_t) {
+    return static_cast<int>(Error::kInvalidOperation);
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/batch_hasher.hpp>
+#include <headcode/crypt/error.hpp>
+
+using namespace headcode::crypt;
+
+
+Algorithm::Description const & BatchHasher::GetDescription() const {
+    return GetDescription_();
+}
+
+
+std::uint64_t BatchHasher::GetLanes() const {
+    return GetLanes_();
+}
+
+
+int BatchHasher::Hash(std::vector<ByteView> const & messages, std::vector<std::byte> & digests) {
+    digests.resize(messages.size() * GetDescription().result_size_);
+    return Hash(messages.data(), messages.size(), MutableByteView{digests});
+}
+
+
+int BatchHasher::Hash(ByteView const * messages, std::uint64_t count, MutableByteView digests) {
+
+    if (count == 0) {
+        return static_cast<int>(Error::kNoError);
+    }
+    if (messages == nullptr) {
+        headcode::logger::Warning{"headcode.crypt"} << "No messages to hash.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    if (digests.size() < count * GetDescription().result_size_) {
+        headcode::logger::Warning{"headcode.crypt"} << "Memory too small for the digests of the batch.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    return Hash_(messages, count, digests.data());
+}
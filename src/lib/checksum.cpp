@@ -0,0 +1,32 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/checksum.hpp>
+
+#include "checksum/crc/crc_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+// Start and end of the register cancel out, as both invert all bits: shifting the checksum
+// of a over the size of b and adding the checksum of b is the checksum of both.
+
+
+std::uint32_t headcode::crypt::CombineCRC32C(std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t size_b) {
+    return crc::ShiftCRC32C(crc_a, size_b) ^ crc_b;
+}
+
+
+std::uint32_t headcode::crypt::CombineCRC32(std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t size_b) {
+    return crc::ShiftCRC32(crc_a, size_b) ^ crc_b;
+}
+
+
+std::uint64_t headcode::crypt::CombineCRC64(std::uint64_t crc_a, std::uint64_t crc_b, std::uint64_t size_b) {
+    return crc::ShiftCRC64(crc_a, size_b) ^ crc_b;
+}
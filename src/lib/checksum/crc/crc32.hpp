@@ -0,0 +1,68 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CHECKSUM_CRC32_HPP
+#define HEADCODE_SPACE_CRYPT_CHECKSUM_CRC32_HPP
+
+#include <cstdint>
+
+#include "crc_checksum.hpp"
+#include "crc_kernel.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The CRC-32 (IEEE 802.3) checksum.
+ */
+class CRC32 : public CRCChecksum {
+
+    crc::Update32 const update_;        //!< @brief The kernel for this CPU.
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    CRC32();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+
+    /**
+     * @brief   Gets the register after zero bytes.
+     * @param   crc         the register.
+     * @param   size        number of zero bytes.
+     * @return  The register after the zero bytes.
+     */
+    std::uint64_t Shift(std::uint64_t crc, std::uint64_t size) const override;
+
+    /**
+     * @brief   Runs data through the register with the kernel for this CPU.
+     * @param   crc         the register.
+     * @param   data        the data.
+     * @param   size        size of the data.
+     * @return  The register after the data.
+     */
+    std::uint64_t Update(std::uint64_t crc, unsigned char const * data, std::uint64_t size) const override;
+};
+
+
+}
+
+
+#endif
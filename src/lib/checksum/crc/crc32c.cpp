@@ -0,0 +1,103 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "crc32c.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Names the provider and the kernel in use.
+ * @return  The provider of the algorithm.
+ */
+static std::string GetProvider() {
+    return std::string{"hcs-crypt v"} + VERSION + " (" + crc::SelectKernels().crc32c_name_ + ")";
+}
+
+
+/**
+ * @brief   The CRC-32C algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-crc32c",                // name
+            Family::kChecksum,           // family
+            "CRC-32C (Castagnoli).",     // description (short/left and long/below)
+
+            "This is the CRC-32C checksum (Castagnoli polynomial 0x1edc6f41, reflected) as used by iSCSI, "
+            "SCTP, ext4 and many storage formats. It is no cryptographic hash: it detects accidental "
+            "corruption only. The SSE4.2 crc32 instruction is used if the CPU has it, with three streams "
+            "interleaved. The checksum is written big endian.",
+
+            GetProvider(),                              // provider
+            0ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                // output block size behaviour
+            0ul,                                        // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,              // default padding strategy
+            4ul,                                        // result size
+
+            // initial data
+            {},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class CRC32CProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<CRC32C>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+CRC32C::CRC32C() : CRCChecksum{4}, update_{crc::SelectKernels().crc32c_} {
+}
+
+
+Algorithm::Description const & CRC32C::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+std::uint64_t CRC32C::Shift(std::uint64_t crc, std::uint64_t size) const {
+    return crc::ShiftCRC32C(static_cast<std::uint32_t>(crc), size);
+}
+
+
+std::uint64_t CRC32C::Update(std::uint64_t crc, unsigned char const * data, std::uint64_t size) const {
+    return update_(static_cast<std::uint32_t>(crc), data, size);
+}
+
+
+void CRC32C::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<CRC32CProducer>());
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "crc64.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Names the provider and the kernel in use.
+ * @return  The provider of the algorithm.
+ */
+static std::string GetProvider() {
+    return std::string{"hcs-crypt v"} + VERSION + " (" + crc::SelectKernels().crc64_name_ + ")";
+}
+
+
+/**
+ * @brief   The CRC-64 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-crc64",                 // name
+            Family::kChecksum,           // family
+            "CRC-64 (xz).",              // description (short/left and long/below)
+
+            "This is the CRC-64 checksum of xz (ECMA-182 polynomial 0x42f0e1eba9ea3693, reflected, also known "
+            "as CRC-64/XZ or CRC-64/GO-ECMA). It is no cryptographic hash: it detects accidental corruption only. "
+            "With carry-less multiplies (PCLMULQDQ) on the CPU, 64 bytes are folded at a time. The checksum is "
+            "written big endian.",
+
+            GetProvider(),                              // provider
+            0ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                // output block size behaviour
+            0ul,                                        // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,              // default padding strategy
+            8ul,                                        // result size
+
+            // initial data
+            {},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class CRC64Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<CRC64>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+CRC64::CRC64() : CRCChecksum{8}, update_{crc::SelectKernels().crc64_} {
+}
+
+
+Algorithm::Description const & CRC64::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+std::uint64_t CRC64::Shift(std::uint64_t crc, std::uint64_t size) const {
+    return crc::ShiftCRC64(crc, size);
+}
+
+
+std::uint64_t CRC64::Update(std::uint64_t crc, unsigned char const * data, std::uint64_t size) const {
+    return update_(crc, data, size);
+}
+
+
+void CRC64::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<CRC64Producer>());
+}
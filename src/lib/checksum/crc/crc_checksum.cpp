@@ -0,0 +1,86 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <vector>
+
+#include <headcode/crypt/error.hpp>
+
+#include "crc_checksum.hpp"
+#include "worker_pool.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Smallest slice run through a register on a thread of its own.
+ */
+static std::uint64_t const kMinSliceSize = 256ul * 1024ul;
+
+
+CRCChecksum::CRCChecksum(std::uint64_t size)
+    : size_{size}, mask_{size < 8 ? (1ul << (8 * size)) - 1 : ~0ul}, crc_{mask_} {
+}
+
+
+int CRCChecksum::Add_(unsigned char const * block_incoming,
+                      std::uint64_t size_incoming,
+                      unsigned char *,
+                      std::uint64_t & size_outgoing) {
+
+    size_outgoing = 0;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    if (slices <= 1) {
+        crc_ = Update(crc_, block_incoming, size_incoming);
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // each slice starts with a register of 0: shifted over the slices after it, the xor of them is the register
+    auto const slice_size = size_incoming / slices;
+    std::vector<std::uint64_t> crcs(slices);
+    WorkerPool::GetInstance().Run(slices, [&](std::uint64_t slice) {
+        auto size = slice + 1 == slices ? size_incoming - slice * slice_size : slice_size;
+        crcs[slice] = Update(0, block_incoming + slice * slice_size, size);
+    });
+
+    for (std::uint64_t slice = 0; slice < slices; ++slice) {
+        auto size = slice + 1 == slices ? size_incoming - slice * slice_size : slice_size;
+        crc_ = Shift(crc_, size) ^ crcs[slice];
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int CRCChecksum::Finalize_(unsigned char * result,
+                           std::uint64_t result_size,
+                           std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (result_size < size_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    auto crc = crc_ ^ mask_;
+    for (std::uint64_t i = 0; i < size_; ++i) {
+        result[i] = static_cast<unsigned char>(crc >> (8 * (size_ - 1 - i)));
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int CRCChecksum::Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    crc_ = mask_;
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int CRCChecksum::Reset_() {
+    crc_ = mask_;
+    return static_cast<int>(Error::kNoError);
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CHECKSUM_CRC_CHECKSUM_HPP
+#define HEADCODE_SPACE_CRYPT_CHECKSUM_CRC_CHECKSUM_HPP
+
+#include <cstdint>
+
+#include <headcode/crypt/algorithm.hpp>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of the CRC checksums (CRC-32C, CRC-32 and CRC-64).
+ * The register starts with all bits set and is inverted at the end, the checksum is written
+ * big endian (as the check values are usually printed). A large buffer handed to a single
+ * Add() is cut into slices run through registers of their own on the worker pool: the
+ * registers are put together by shifting each over the size of the next slice.
+ */
+class CRCChecksum : public Algorithm {
+
+    std::uint64_t const size_;          //!< @brief Size of the checksum in bytes.
+    std::uint64_t const mask_;          //!< @brief All bits of the register set.
+    std::uint64_t crc_;                 //!< @brief The register.
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   size        size of the checksum in bytes (4 or 8).
+     */
+    explicit CRCChecksum(std::uint64_t size);
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Gets the register after zero bytes.
+     * @param   crc         the register.
+     * @param   size        number of zero bytes.
+     * @return  The register after the zero bytes.
+     */
+    virtual std::uint64_t Shift(std::uint64_t crc, std::uint64_t size) const = 0;
+
+    /**
+     * @brief   Runs data through the register with the kernel for this CPU.
+     * @param   crc         the register.
+     * @param   data        the data.
+     * @param   size        size of the data.
+     * @return  The register after the data.
+     */
+    virtual std::uint64_t Update(std::uint64_t crc, unsigned char const * data, std::uint64_t size) const = 0;
+};
+
+
+}
+
+
+#endif
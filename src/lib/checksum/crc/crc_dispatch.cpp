@@ -0,0 +1,35 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "crc_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+crc::Kernels const & headcode::crypt::crc::SelectKernels() {
+
+    static Kernels const kernels = []() -> Kernels {
+        Kernels kernels{UpdateCRC32CScalar, "portable", UpdateCRC32Scalar, "portable", UpdateCRC64Scalar, "portable"};
+#ifdef HCS_CRC_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse4.2")) {
+            kernels.crc32c_ = UpdateCRC32CSSE42;
+            kernels.crc32c_name_ = "SSE4.2";
+        }
+        if (__builtin_cpu_supports("pclmul")) {
+            kernels.crc32_ = UpdateCRC32PCLMUL;
+            kernels.crc32_name_ = "PCLMUL";
+            kernels.crc64_ = UpdateCRC64PCLMUL;
+            kernels.crc64_name_ = "PCLMUL";
+        }
+#endif
+        return kernels;
+    }();
+
+    return kernels;
+}
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CHECKSUM_CRC_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_CHECKSUM_CRC_KERNEL_HPP
+
+#include <cstdint>
+
+// Like the BLAKE3 chunk kernels, the SIMD kernels live in translation units of their
+// own compiled with -msse4.2 and -mpclmul. Keep this header free of inline code.
+//
+// All the CRCs here are reflected (least significant bit first). The kernels work on the
+// bare register: the algorithms invert it before the first and after the last byte.
+
+
+namespace headcode::crypt::crc {
+
+
+/**
+ * @brief   The CRC-32C (Castagnoli) polynomial, reflected.
+ */
+constexpr std::uint32_t kCRC32CPolynomial = 0x82f63b78u;
+
+
+/**
+ * @brief   The CRC-32 (IEEE 802.3) polynomial, reflected.
+ */
+constexpr std::uint32_t kCRC32Polynomial = 0xedb88320u;
+
+
+/**
+ * @brief   The CRC-64 (ECMA-182, as used by xz) polynomial, reflected.
+ */
+constexpr std::uint64_t kCRC64Polynomial = 0xc96c5795d7870f42ul;
+
+
+/**
+ * @brief   Runs data through a 32 bit CRC register.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+using Update32 = std::uint32_t (*)(std::uint32_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Runs data through a 64 bit CRC register.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+using Update64 = std::uint64_t (*)(std::uint64_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   The kernels for this CPU.
+ */
+struct Kernels {
+    Update32 crc32c_;                   //!< @brief Updates a CRC-32C register.
+    char const * crc32c_name_;          //!< @brief A human readable name of the CRC-32C kernel.
+    Update32 crc32_;                    //!< @brief Updates a CRC-32 register.
+    char const * crc32_name_;           //!< @brief A human readable name of the CRC-32 kernel.
+    Update64 crc64_;                    //!< @brief Updates a CRC-64 register.
+    char const * crc64_name_;           //!< @brief A human readable name of the CRC-64 kernel.
+};
+
+
+/**
+ * @brief   Picks the kernels for this CPU.
+ * @return  The SSE4.2 and carry-less multiply kernels if supported, the portable code else.
+ */
+Kernels const & SelectKernels();
+
+
+/**
+ * @brief   Runs data through a CRC-32C register, slicing by 8.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+std::uint32_t UpdateCRC32CScalar(std::uint32_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Runs data through a CRC-32 register, slicing by 8.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+std::uint32_t UpdateCRC32Scalar(std::uint32_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Runs data through a CRC-64 register, slicing by 8.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+std::uint64_t UpdateCRC64Scalar(std::uint64_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Gets a CRC-32C register after zero bytes: what the register of a piece of data is worth
+ * in front of size more bytes.
+ * @param   crc         the register.
+ * @param   size        number of zero bytes.
+ * @return  The register after the zero bytes.
+ */
+std::uint32_t ShiftCRC32C(std::uint32_t crc, std::uint64_t size);
+
+
+/**
+ * @brief   Gets a CRC-32 register after zero bytes.
+ * @param   crc         the register.
+ * @param   size        number of zero bytes.
+ * @return  The register after the zero bytes.
+ */
+std::uint32_t ShiftCRC32(std::uint32_t crc, std::uint64_t size);
+
+
+/**
+ * @brief   Gets a CRC-64 register after zero bytes.
+ * @param   crc         the register.
+ * @param   size        number of zero bytes.
+ * @return  The register after the zero bytes.
+ */
+std::uint64_t ShiftCRC64(std::uint64_t crc, std::uint64_t size);
+
+
+#ifdef HCS_CRC_SIMD
+
+/**
+ * @brief   Runs data through a CRC-32C register with the SSE4.2 crc32 instruction.
+ * Three streams are interleaved to hide the latency of the instruction.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+std::uint32_t UpdateCRC32CSSE42(std::uint32_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Runs data through a CRC-32 register, folding 64 bytes at a time with carry-less multiplies.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+std::uint32_t UpdateCRC32PCLMUL(std::uint32_t crc, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Runs data through a CRC-64 register, folding 64 bytes at a time with carry-less multiplies.
+ * @param   crc         the register.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The register after the data.
+ */
+std::uint64_t UpdateCRC64PCLMUL(std::uint64_t crc, unsigned char const * data, std::uint64_t size);
+
+#endif
+
+
+}
+
+
+#endif
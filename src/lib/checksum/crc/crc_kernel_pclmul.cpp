@@ -0,0 +1,139 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -mpclmul. It is only called after
+// a runtime check of the CPU (see crc_dispatch.cpp).
+
+#include <cstdint>
+
+#include <wmmintrin.h>
+
+#include "crc_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+// Folding: a 128 bit block of the message is worth the same modulo the polynomial as the
+// block times x^D one D bits further down the message. The block is split into its two 64 bit
+// halves, each carry-less multiplied with x^n mod P (a number of the width of the CRC): the
+// 128 bit sum is folded onto the data D bits on. Four blocks are folded at once over 512 bits,
+// then onto each other and the 16 byte blocks left. The last block and the bytes after it are
+// run through the portable code.
+
+using V = __m128i;
+
+inline V Load(unsigned char const * p) {
+    return _mm_loadu_si128(reinterpret_cast<V const *>(p));
+}
+
+inline V Fold(V x, V k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+
+/**
+ * @brief   Gets x^n modulo the polynomial, reflected and left aligned in 64 bits.
+ */
+template <typename T>
+std::uint64_t GetPower(std::uint64_t n, T polynomial) {
+    T p = T{1} << (8 * sizeof(T) - 1);
+    for (; n > 0; --n) {
+        p = (p & 1) ? (p >> 1) ^ polynomial : p >> 1;
+    }
+    return static_cast<std::uint64_t>(p) << (64 - 8 * sizeof(T));
+}
+
+
+/**
+ * @brief   Gets the constants folding a block D bits on.
+ * The low half of a block holds the higher powers of x: it is multiplied with x^(D + 64), the high half with
+ * x^D. Both are one less, as the product of two reflected 64 bit numbers comes out shifted by one bit.
+ */
+template <typename T>
+V GetFoldConstants(std::uint64_t distance, T polynomial) {
+    return _mm_set_epi64x(static_cast<long long>(GetPower(distance - 1, polynomial)),
+                          static_cast<long long>(GetPower(distance + 63, polynomial)));
+}
+
+
+template <typename T>
+struct Constants {
+    V fold_4_;      // 512 bits
+    V fold_1_;      // 128 bits
+
+    explicit Constants(T polynomial)
+        : fold_4_{GetFoldConstants(512, polynomial)}, fold_1_{GetFoldConstants(128, polynomial)} {
+    }
+};
+
+
+template <typename T>
+T Update(T crc,
+         unsigned char const * data,
+         std::uint64_t size,
+         Constants<T> const & constants,
+         T (*scalar)(T, unsigned char const *, std::uint64_t)) {
+
+    if (size < 64) {
+        return scalar(crc, data, size);
+    }
+
+    // the register goes onto the first bytes of the message
+    V x0 = _mm_xor_si128(Load(data), _mm_set_epi64x(0, static_cast<long long>(crc)));
+    V x1 = Load(data + 16);
+    V x2 = Load(data + 32);
+    V x3 = Load(data + 48);
+    data += 64;
+    size -= 64;
+
+    while (size >= 64) {
+        x0 = _mm_xor_si128(Fold(x0, constants.fold_4_), Load(data));
+        x1 = _mm_xor_si128(Fold(x1, constants.fold_4_), Load(data + 16));
+        x2 = _mm_xor_si128(Fold(x2, constants.fold_4_), Load(data + 32));
+        x3 = _mm_xor_si128(Fold(x3, constants.fold_4_), Load(data + 48));
+        data += 64;
+        size -= 64;
+    }
+
+    x1 = _mm_xor_si128(Fold(x0, constants.fold_1_), x1);
+    x2 = _mm_xor_si128(Fold(x1, constants.fold_1_), x2);
+    x3 = _mm_xor_si128(Fold(x2, constants.fold_1_), x3);
+    while (size >= 16) {
+        x3 = _mm_xor_si128(Fold(x3, constants.fold_1_), Load(data));
+        data += 16;
+        size -= 16;
+    }
+
+    // the remainder is the message so far: its register starts at 0
+    alignas(16) unsigned char block[16];
+    _mm_store_si128(reinterpret_cast<V *>(block), x3);
+    crc = scalar(0, block, sizeof(block));
+    return scalar(crc, data, size);
+}
+
+
+}
+
+
+std::uint32_t headcode::crypt::crc::UpdateCRC32PCLMUL(std::uint32_t crc,
+                                                      unsigned char const * data,
+                                                      std::uint64_t size) {
+    static Constants<std::uint32_t> const constants{kCRC32Polynomial};
+    return Update(crc, data, size, constants, UpdateCRC32Scalar);
+}
+
+
+std::uint64_t headcode::crypt::crc::UpdateCRC64PCLMUL(std::uint64_t crc,
+                                                      unsigned char const * data,
+                                                      std::uint64_t size) {
+    static Constants<std::uint64_t> const constants{kCRC64Polynomial};
+    return Update(crc, data, size, constants, UpdateCRC64Scalar);
+}
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <array>
+
+#include "crc_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+/**
+ * @brief   The tables of slicing by 8: table k holds the register of a byte followed by k zero bytes.
+ */
+template <typename T>
+using Tables = std::array<std::array<T, 256>, 8>;
+
+
+/**
+ * @brief   Builds the tables of slicing by 8.
+ * @param   polynomial      the reflected polynomial.
+ * @return  The tables.
+ */
+template <typename T>
+constexpr Tables<T> MakeTables(T polynomial) {
+
+    Tables<T> tables{};
+    for (std::uint64_t n = 0; n < 256; ++n) {
+        auto crc = static_cast<T>(n);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+        }
+        tables[0][n] = crc;
+    }
+    for (std::uint64_t k = 1; k < 8; ++k) {
+        for (std::uint64_t n = 0; n < 256; ++n) {
+            auto crc = tables[k - 1][n];
+            tables[k][n] = (crc >> 8) ^ tables[0][crc & 0xff];
+        }
+    }
+    return tables;
+}
+
+
+constexpr auto kCRC32CTables = MakeTables(crc::kCRC32CPolynomial);
+constexpr auto kCRC32Tables = MakeTables(crc::kCRC32Polynomial);
+constexpr auto kCRC64Tables = MakeTables(crc::kCRC64Polynomial);
+
+
+inline std::uint64_t Load64(unsigned char const * p) {
+    std::uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+
+/**
+ * @brief   Runs data through a register 8 bytes at a time.
+ * The register is xored onto the next 8 bytes: a 32 bit register leaves 4 of them as they are.
+ */
+template <typename T>
+T Update(Tables<T> const & tables, T crc, unsigned char const * data, std::uint64_t size) {
+
+    while (size >= 8) {
+        auto v = Load64(data) ^ crc;
+        crc = tables[7][v & 0xff] ^ tables[6][(v >> 8) & 0xff] ^ tables[5][(v >> 16) & 0xff] ^
+              tables[4][(v >> 24) & 0xff] ^ tables[3][(v >> 32) & 0xff] ^ tables[2][(v >> 40) & 0xff] ^
+              tables[1][(v >> 48) & 0xff] ^ tables[0][v >> 56];
+        data += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        crc = tables[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+        ++data;
+        --size;
+    }
+    return crc;
+}
+
+
+/**
+ * @brief   Multiplies two polynomials modulo the CRC polynomial (all reflected).
+ */
+template <typename T>
+T Multiply(T a, T b, T polynomial) {
+
+    T product = 0;
+    for (T m = T{1} << (8 * sizeof(T) - 1); m != 0; m >>= 1) {
+        if (a & m) {
+            product ^= b;
+        }
+        b = (b & 1) ? (b >> 1) ^ polynomial : b >> 1;
+    }
+    return product;
+}
+
+
+/**
+ * @brief   Multiplies the register by x^(8 * size) modulo the CRC polynomial: the register after size zero bytes.
+ */
+template <typename T>
+T Shift(T crc, std::uint64_t size, T polynomial) {
+
+    // square and multiply, starting at x^8 for a byte
+    T power = T{1} << (8 * sizeof(T) - 1);
+    T square = power >> 8;
+    for (; size > 0; size >>= 1) {
+        if (size & 1) {
+            power = Multiply(square, power, polynomial);
+        }
+        square = Multiply(square, square, polynomial);
+    }
+    return Multiply(power, crc, polynomial);
+}
+
+
+}
+
+
+std::uint32_t headcode::crypt::crc::UpdateCRC32CScalar(std::uint32_t crc,
+                                                       unsigned char const * data,
+                                                       std::uint64_t size) {
+    return Update(kCRC32CTables, crc, data, size);
+}
+
+
+std::uint32_t headcode::crypt::crc::UpdateCRC32Scalar(std::uint32_t crc,
+                                                      unsigned char const * data,
+                                                      std::uint64_t size) {
+    return Update(kCRC32Tables, crc, data, size);
+}
+
+
+std::uint64_t headcode::crypt::crc::UpdateCRC64Scalar(std::uint64_t crc,
+                                                      unsigned char const * data,
+                                                      std::uint64_t size) {
+    return Update(kCRC64Tables, crc, data, size);
+}
+
+
+std::uint32_t headcode::crypt::crc::ShiftCRC32C(std::uint32_t crc, std::uint64_t size) {
+    return Shift(crc, size, kCRC32CPolynomial);
+}
+
+
+std::uint32_t headcode::crypt::crc::ShiftCRC32(std::uint32_t crc, std::uint64_t size) {
+    return Shift(crc, size, kCRC32Polynomial);
+}
+
+
+std::uint64_t headcode::crypt::crc::ShiftCRC64(std::uint64_t crc, std::uint64_t size) {
+    return Shift(crc, size, kCRC64Polynomial);
+}
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -msse4.2. It is only called after
+// a runtime check of the CPU (see crc_dispatch.cpp).
+
+#include <cstdint>
+#include <cstring>
+
+#include <nmmintrin.h>
+
+#include "crc_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+// The crc32 instruction has a latency of 3 cycles but a throughput of 1: three streams
+// of data run through three registers side by side, which are then put together by
+// shifting the first over the length of the others.
+
+constexpr std::uint64_t kLong = 8192;
+constexpr std::uint64_t kShort = 256;
+
+
+/**
+ * @brief   Shifts a register over a fixed number of zero bytes, a table per byte of the register.
+ */
+struct ShiftTable {
+
+    std::uint32_t table_[4][256];
+
+    explicit ShiftTable(std::uint64_t size) {
+        for (std::uint32_t k = 0; k < 4; ++k) {
+            for (std::uint32_t n = 0; n < 256; ++n) {
+                table_[k][n] = crc::ShiftCRC32C(n << (8 * k), size);
+            }
+        }
+    }
+
+    std::uint64_t Shift(std::uint64_t crc) const {
+        return table_[0][crc & 0xff] ^ table_[1][(crc >> 8) & 0xff] ^ table_[2][(crc >> 16) & 0xff] ^
+               table_[3][(crc >> 24) & 0xff];
+    }
+};
+
+
+#if defined(__x86_64__)
+
+using Word = std::uint64_t;
+
+inline std::uint64_t Step(std::uint64_t crc, unsigned char const * p) {
+    Word w;
+    std::memcpy(&w, p, sizeof(w));
+    return _mm_crc32_u64(crc, w);
+}
+
+#else
+
+using Word = std::uint32_t;
+
+inline std::uint64_t Step(std::uint64_t crc, unsigned char const * p) {
+    Word w;
+    std::memcpy(&w, p, sizeof(w));
+    return _mm_crc32_u32(static_cast<std::uint32_t>(crc), w);
+}
+
+#endif
+
+
+/**
+ * @brief   Runs three streams of size bytes each through the registers and puts them together.
+ */
+inline std::uint64_t Interleave(std::uint64_t crc0,
+                                unsigned char const * data,
+                                std::uint64_t size,
+                                ShiftTable const & shift) {
+
+    std::uint64_t crc1 = 0;
+    std::uint64_t crc2 = 0;
+    for (auto end = data + size; data < end; data += sizeof(Word)) {
+        crc0 = Step(crc0, data);
+        crc1 = Step(crc1, data + size);
+        crc2 = Step(crc2, data + 2 * size);
+    }
+    crc0 = shift.Shift(crc0) ^ crc1;
+    return shift.Shift(crc0) ^ crc2;
+}
+
+
+}
+
+
+std::uint32_t headcode::crypt::crc::UpdateCRC32CSSE42(std::uint32_t crc,
+                                                      unsigned char const * data,
+                                                      std::uint64_t size) {
+
+    static ShiftTable const shift_long{kLong};
+    static ShiftTable const shift_short{kShort};
+
+    std::uint64_t crc0 = crc;
+    while ((size > 0) && ((reinterpret_cast<std::uintptr_t>(data) % sizeof(Word)) != 0)) {
+        crc0 = _mm_crc32_u8(static_cast<std::uint32_t>(crc0), *data);
+        ++data;
+        --size;
+    }
+
+    while (size >= 3 * kLong) {
+        crc0 = Interleave(crc0, data, kLong, shift_long);
+        data += 3 * kLong;
+        size -= 3 * kLong;
+    }
+    while (size >= 3 * kShort) {
+        crc0 = Interleave(crc0, data, kShort, shift_short);
+        data += 3 * kShort;
+        size -= 3 * kShort;
+    }
+
+    while (size >= sizeof(Word)) {
+        crc0 = Step(crc0, data);
+        data += sizeof(Word);
+        size -= sizeof(Word);
+    }
+    while (size > 0) {
+        crc0 = _mm_crc32_u8(static_cast<std::uint32_t>(crc0), *data);
+        ++data;
+        --size;
+    }
+
+    return static_cast<std::uint32_t>(crc0);
+}
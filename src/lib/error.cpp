@@ -17,7 +17,8 @@ std::string const & headcode::crypt::GetErrorText(headcode::crypt::Error error)
     static std::map<headcode::crypt::Error, std::string> const known_error_texts = {
             {headcode::crypt::Error::kNoError, "No error"},
             {headcode::crypt::Error::kInvalidArgument, "An argument provided by the user is invalid"},
-            {headcode::crypt::Error::kInvalidOperation, "Cannot execute operation in current state"}};
+            {headcode::crypt::Error::kInvalidOperation, "Cannot execute operation in current state"},
+            {headcode::crypt::Error::kAuthenticationFailed, "Data does not match the authentication tag"}};
 
     auto iter = known_error_texts.find(error);
     if (iter == known_error_texts.end()) {
@@ -10,11 +10,15 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <headcode/logger/logger.hpp>
 #include <headcode/crypt/factory.hpp>
 
+#include "pool.hpp"
 #include "register.hpp"
+#include "serial_batch_hasher.hpp"
 
 using namespace headcode::crypt;
 
@@ -22,36 +26,101 @@ using namespace headcode::crypt;
 namespace headcode::crypt {
 
 
+/**
+ * @brief   An immutable view of all registered algorithms.
+ * A snapshot is never changed once published. Register() publishes a modified copy
+ * (the known algorithms are collected in a single snapshot, published once).
+ */
+struct RegistrySnapshot {
+
+    /**
+     * @brief   A single registered algorithm.
+     */
+    struct Entry {
+        std::string name_;                                  //!< @brief Name of the algorithm.
+        Family family_;                                     //!< @brief Family of the algorithm.
+        std::shared_ptr<Factory::Producer> producer_;        //!< @brief Creates the algorithm instances.
+        std::shared_ptr<Pool> pool_;                        //!< @brief Recycled algorithm instances.
+    };
+
+    /**
+     * @brief   All known algorithms, indexed by AlgorithmId.
+     */
+    std::vector<Entry> entries_;
+
+    /**
+     * @brief   Name to AlgorithmId lookup.
+     */
+    std::unordered_map<std::string, AlgorithmId> ids_;
+
+    /**
+     * @brief   The descriptions of all known algorithms.
+     */
+    std::map<std::string, Algorithm::Description> descriptions_;
+
+    /**
+     * @brief   Number of Register() calls which led to this snapshot.
+     */
+    std::uint64_t version_ = 0;
+};
+
+
 /**
  * @brief   Our algorithm registry.
  * The is the "database" of all known algorithm producers.
+ *
+ * Readers never lock: each thread holds on to the snapshot it used last and compares
+ * its version with the current one (a single atomic load). Only if the registry changed
+ * in between the thread fetches the new snapshot.
+ *
+ * Writers (Register()) are serialized, copy the current snapshot, modify the copy and
+ * publish it. Replaced snapshots die as soon as no thread holds on to them anymore.
+ *
+ * Loading the known algorithms does not publish a snapshot per algorithm: all of them
+ * are registered into a staging snapshot, which is published once at the end.
  */
 class Registry {
 public:
     /**
-     * @brief   Initialized flag. If false, no algorithms have been loaded.
+     * @brief   Loaded flag. If false, the known algorithms have not been registered yet.
+     */
+    std::atomic<bool> loaded_ = false;
+
+    /**
+     * @brief   Set while the known algorithms are registered (guarded by load_mutex_).
+     */
+    bool loading_ = false;
+
+    /**
+     * @brief   Serializes loading the known algorithms. This is recursive, since loading
+     * calls Register() which in turn checks for the registry being loaded.
      */
-    std::atomic<bool> initialized_ = false;
+    std::recursive_mutex load_mutex_;
 
     /**
-     * @brief   Prevent race conditions.
+     * @brief   Serializes writers.
      */
     std::mutex mutex_;
 
     /**
-     * @brief   All known algorithm producers.
+     * @brief   The current snapshot (accessed via std::atomic_load() and std::atomic_store() only).
      */
-    std::map<std::string, std::tuple<Family, std::shared_ptr<Factory::Producer>>> producer_registry_;
+    std::shared_ptr<RegistrySnapshot const> snapshot_;
 
     /**
-     * @brief   Modification counter.
+     * @brief   The version of the current snapshot.
      */
-    std::uint64_t mod_counter_{0};
+    std::atomic<std::uint64_t> version_ = 0;
+
+    /**
+     * @brief   Collects the known algorithms while loading (guarded by mutex_).
+     */
+    std::unique_ptr<RegistrySnapshot> staging_;
 
     /**
      * @brief   Constructor.
      */
-    Registry() {
+    Registry() : snapshot_{std::make_shared<RegistrySnapshot>()} {
         auto logger = headcode::logger::Logger::GetLogger("headcode.crypt");
         logger->SetBarrier(headcode::logger::Level::kWarning);
     }
@@ -82,6 +151,39 @@ public:
      * @return  this
      */
     Registry & operator=(Registry &&) = delete;
+
+    /**
+     * @brief   Registers all known algorithms, once.
+     */
+    void Load() {
+        std::lock_guard<std::recursive_mutex> lock(load_mutex_);
+        if (loaded_ || loading_) {
+            return;
+        }
+        loading_ = true;
+        {
+            std::lock_guard<std::mutex> staging_lock(mutex_);
+            staging_ = std::make_unique<RegistrySnapshot>(*std::atomic_load(&snapshot_));
+        }
+        RegisterKnownAlgorithms();
+        {
+            std::lock_guard<std::mutex> staging_lock(mutex_);
+            Publish(std::move(staging_));
+        }
+        loading_ = false;
+        loaded_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief   Makes a snapshot the current one (mutex_ must be held).
+     * @param   snapshot    the new snapshot.
+     */
+    void Publish(std::unique_ptr<RegistrySnapshot> snapshot) {
+        auto version = snapshot->version_;
+        std::atomic_store_explicit(
+                &snapshot_, std::shared_ptr<RegistrySnapshot const>{std::move(snapshot)}, std::memory_order_release);
+        version_.store(version, std::memory_order_release);
+    }
 };
 
 
@@ -96,82 +198,265 @@ static Registry & GetRegistryInstance() {
 
     static headcode::crypt::Registry registry;
 
-    // Double Check Locking Pattern not on singleton instance
-    // (since due to C++11 static standard behavior this is thread-safe)
-    // ... but on loading the registry with all known algorithms.
-    // TODO: Think of a lock-free alternative to this.
-    if (!registry.initialized_) {
-        static std::mutex initialize_mutex;
-        std::lock_guard<std::mutex> lock(initialize_mutex);
-        if (!registry.initialized_) {
-            registry.initialized_ = true;
-            RegisterKnownAlgorithms();
-        }
+    // The singleton itself is thread-safe due to C++11 static standard behavior.
+    // Once loaded, this is a single atomic load: no lock on the hot path.
+    if (!registry.loaded_.load(std::memory_order_acquire)) {
+        registry.Load();
     }
     return registry;
 }
 
 
-std::unique_ptr<Algorithm> Factory::Create(std::string const & name) {
+/**
+ * @brief   Returns the current registry snapshot.
+ * The snapshot is held by the calling thread until it calls again after a Register().
+ * @return  The current registry snapshot.
+ */
+static RegistrySnapshot const & GetSnapshot() {
 
     auto & registry = GetRegistryInstance();
-    std::shared_ptr<Factory::Producer> producer;
 
-    {
-        std::lock_guard<std::mutex> lock(registry.mutex_);
+    // the snapshot is published before its version: a new version always finds its snapshot
+    thread_local std::shared_ptr<RegistrySnapshot const> snapshot;
+    if ((snapshot == nullptr) || (snapshot->version_ != registry.version_.load(std::memory_order_acquire))) {
+        snapshot = std::atomic_load_explicit(&registry.snapshot_, std::memory_order_acquire);
+    }
+    return *snapshot;
+}
 
-        auto iter = registry.producer_registry_.find(name);
-        if (iter == registry.producer_registry_.end()) {
-            return nullptr;
-        }
 
-        producer = std::get<1>(iter->second);
+/**
+ * @brief   Finds the entry of an algorithm in a snapshot.
+ * @param   snapshot    the snapshot to search.
+ * @param   name        the name of the algorithm.
+ * @return  The entry of the algorithm (or nullptr if the algorithm is unknown).
+ */
+static RegistrySnapshot::Entry const * FindEntry(RegistrySnapshot const & snapshot, std::string const & name) {
+    auto iter = snapshot.ids_.find(name);
+    if (iter == snapshot.ids_.end()) {
+        return nullptr;
     }
+    return &snapshot.entries_[iter->second];
+}
+
 
-    if (producer == nullptr) {
+/**
+ * @brief   Finds the entry of an algorithm in a snapshot.
+ * @param   snapshot    the snapshot to search.
+ * @param   id          the id of the algorithm.
+ * @return  The entry of the algorithm (or nullptr if the algorithm is unknown).
+ */
+static RegistrySnapshot::Entry const * FindEntry(RegistrySnapshot const & snapshot, AlgorithmId id) {
+    if (id >= snapshot.entries_.size()) {
         return nullptr;
     }
+    return &snapshot.entries_[id];
+}
+
+
+/**
+ * @brief   Borrows an instance from the pool of an entry.
+ * @param   entry                   the entry of the algorithm (may be nullptr).
+ * @param   initialization_data     the initialization arguments.
+ * @return  A handle to an initialized instance (which is empty in case of failure).
+ */
+static Factory::Handle Acquire(RegistrySnapshot::Entry const * entry,
+                               std::map<std::string, std::vector<std::byte>> const & initialization_data) {
+
+    if ((entry == nullptr) || (entry->pool_ == nullptr)) {
+        return Factory::Handle{};
+    }
+
+    // the producer may call the factory, which drops the snapshot of the entry after a Register()
+    auto pool = entry->pool_;
+    auto algorithm = pool->Acquire(initialization_data);
+    if (algorithm == nullptr) {
+        return Factory::Handle{};
+    }
+
+    return Factory::Handle{std::move(algorithm), std::move(pool)};
+}
+
+
+/**
+ * @brief   Creates a new instance of the algorithm of an entry.
+ * @param   entry       the entry of the algorithm (may be nullptr).
+ * @return  A new algorithm instance (or nullptr in case of failure).
+ */
+static std::unique_ptr<Algorithm> Create(RegistrySnapshot::Entry const * entry) {
+    if ((entry == nullptr) || (entry->producer_ == nullptr)) {
+        return nullptr;
+    }
+
+    // the producer may call the factory, which drops the snapshot of the entry after a Register()
+    auto producer = entry->producer_;
     return (*producer)();
 }
 
 
-std::map<std::string, Algorithm::Description> const & Factory::GetAlgorithmDescriptions() {
+/**
+ * @brief   The empty initialization arguments.
+ */
+static std::map<std::string, std::vector<std::byte>> const kNoArguments;
 
-    auto & registry = GetRegistryInstance();
 
-    // We try to not enumerate all known algorithms anew each time this
-    // method is invoked. Instead, we check, if something has changed in
-    // the registry. If not, we return the data we fetched in the past.
-    // If some new algorithms have been added (or removed, or something)
-    // then the mod_counter_ is different, thus enforcing us to
-    // re-fetch the data from the registry.
-
-    static struct {
-        std::uint64_t mod_counter_{0};
-        std::map<std::string, Algorithm::Description> description_;
-    } __attribute__((aligned(64))) cache;
-
-    {
-        std::lock_guard<std::mutex> lock(registry.mutex_);
-        if (cache.mod_counter_ != registry.mod_counter_) {
-            // re-cache algorithm data
-            cache.description_.clear();
-            for (auto const & p : registry.producer_registry_) {
-                std::shared_ptr<Factory::Producer> const & producer = std::get<1>(p.second);
-                cache.description_.emplace(p.first, producer->GetDescription());
-            }
-            cache.mod_counter_ = registry.mod_counter_;
-        }
+Factory::Handle::Handle(std::unique_ptr<Algorithm> algorithm, std::shared_ptr<Pool> pool)
+        : algorithm_{std::move(algorithm)}, pool_{std::move(pool)} {
+}
+
+
+Factory::Handle::~Handle() {
+    Release();
+}
+
+
+Factory::Handle & Factory::Handle::operator=(Factory::Handle && rhs) noexcept {
+    if (this != &rhs) {
+        Release();
+        algorithm_ = std::move(rhs.algorithm_);
+        pool_ = std::move(rhs.pool_);
+    }
+    return *this;
+}
+
+
+void Factory::Handle::Release() {
+    if ((algorithm_ != nullptr) && (pool_ != nullptr)) {
+        pool_->Release(std::move(algorithm_));
+    }
+    algorithm_.reset();
+    pool_.reset();
+}
+
+
+Factory::Handle Factory::Acquire(std::string const & name) {
+    return Acquire(name, kNoArguments);
+}
+
+
+Factory::Handle Factory::Acquire(std::string const & name,
+                                 std::map<std::string, std::vector<std::byte>> const & initialization_data) {
+    return ::Acquire(FindEntry(GetSnapshot(), name), initialization_data);
+}
+
+
+Factory::Handle Factory::Acquire(AlgorithmId id) {
+    return Acquire(id, kNoArguments);
+}
+
+
+Factory::Handle Factory::Acquire(AlgorithmId id,
+                                 std::map<std::string, std::vector<std::byte>> const & initialization_data) {
+    return ::Acquire(FindEntry(GetSnapshot(), id), initialization_data);
+}
+
+
+std::unique_ptr<Algorithm> Factory::Create(std::string const & name) {
+    return ::Create(FindEntry(GetSnapshot(), name));
+}
+
+
+std::unique_ptr<Algorithm> Factory::Create(AlgorithmId id) {
+    return ::Create(FindEntry(GetSnapshot(), id));
+}
+
+
+std::unique_ptr<BatchHasher> Factory::CreateBatchHasher(std::string const & name, std::uint64_t max_lanes) {
+
+    auto entry = FindEntry(GetSnapshot(), name);
+    if ((entry == nullptr) || (entry->producer_ == nullptr)) {
+        return nullptr;
+    }
+
+    // the producer may call the factory, which drops the snapshot of the entry after a Register()
+    auto producer = entry->producer_;
+    if (producer->GetDescription().family_ != Family::kHash) {
+        return nullptr;
+    }
+
+    auto batch_hasher = producer->CreateBatchHasher(max_lanes);
+    if (batch_hasher == nullptr) {
+        batch_hasher = std::make_unique<SerialBatchHasher>(std::move(producer));
     }
+    return batch_hasher;
+}
+
 
-    return cache.description_;
+std::shared_ptr<std::map<std::string, Algorithm::Description> const> Factory::GetAlgorithmDescriptions() {
+
+    // snapshots are immutable: no need to copy, the returned list shares the ownership of its snapshot
+    auto snapshot = std::atomic_load_explicit(&GetRegistryInstance().snapshot_, std::memory_order_acquire);
+    return std::shared_ptr<std::map<std::string, Algorithm::Description> const>{snapshot, &snapshot->descriptions_};
+}
+
+
+Factory::PoolStatistics Factory::GetPoolStatistics(std::string const & name) {
+    auto entry = FindEntry(GetSnapshot(), name);
+    if ((entry == nullptr) || (entry->pool_ == nullptr)) {
+        return PoolStatistics{};
+    }
+    return entry->pool_->GetStatistics();
 }
 
 
 void Factory::Register(std::string const & name, Family family, std::shared_ptr<Factory::Producer> producer) {
+
     auto & registry = GetRegistryInstance();
     std::lock_guard<std::mutex> lock(registry.mutex_);
-    registry.producer_registry_[name] = std::make_tuple(family, std::move(producer));
-    registry.mod_counter_++;
+
+    // while loading the known algorithms all go into the staging snapshot, published once at the end
+    // else copy-on-write: readers keep on using the current snapshot until the new one is published
+    std::unique_ptr<RegistrySnapshot> copy;
+    auto snapshot = registry.staging_.get();
+    if (snapshot == nullptr) {
+        copy = std::make_unique<RegistrySnapshot>(*std::atomic_load(&registry.snapshot_));
+        snapshot = copy.get();
+    }
+    ++snapshot->version_;
+
+    RegistrySnapshot::Entry entry{name, family, producer, std::make_shared<Pool>(producer)};
+    auto iter = snapshot->ids_.find(name);
+    if (iter != snapshot->ids_.end()) {
+        // a re-registered algorithm keeps its id
+        snapshot->entries_[iter->second] = std::move(entry);
+    } else {
+        snapshot->ids_.emplace(name, static_cast<AlgorithmId>(snapshot->entries_.size()));
+        snapshot->entries_.push_back(std::move(entry));
+    }
+    if (producer != nullptr) {
+        snapshot->descriptions_.insert_or_assign(name, producer->GetDescription());
+    } else {
+        snapshot->descriptions_.erase(name);
+    }
+
+    if (copy != nullptr) {
+        registry.Publish(std::move(copy));
+    }
+
     headcode::logger::Debug{"headcode.crypt"} << "Registered algorithm: " << name;
 }
+
+
+std::uint64_t Factory::GetRegistryVersion() {
+    return GetSnapshot().version_;
+}
+
+
+AlgorithmId Factory::Resolve(std::string const & name) {
+    auto const & snapshot = GetSnapshot();
+    auto iter = snapshot.ids_.find(name);
+    if (iter == snapshot.ids_.end()) {
+        return kUnknownAlgorithmId;
+    }
+    return iter->second;
+}
+
+
+bool Factory::SetPoolLimit(std::string const & name, std::uint64_t limit) {
+    auto entry = FindEntry(GetSnapshot(), name);
+    if ((entry == nullptr) || (entry->pool_ == nullptr)) {
+        return false;
+    }
+    entry->pool_->SetLimit(limit);
+    return true;
+}
@@ -17,6 +17,9 @@ std::string const & headcode::crypt::GetFamilyText(headcode::crypt::Family famil
     static std::map<headcode::crypt::Family, std::string> const known_family_texts = {
             {headcode::crypt::Family::kSymmetricCipher, "Symmetric Ciphers"},
             {headcode::crypt::Family::kHash, "Hashes"},
+            {headcode::crypt::Family::kChecksum, "Checksums"},
+            {headcode::crypt::Family::kNonCryptographicHash, "Non-Cryptographic Hashes"},
+            {headcode::crypt::Family::kMessageAuthenticationCode, "Message Authentication Codes"},
             {headcode::crypt::Family::kUnknown, "Unknown Family"}};
 
     auto iter = known_family_texts.find(family);
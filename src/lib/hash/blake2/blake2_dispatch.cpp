@@ -0,0 +1,56 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "blake2_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Checks if the CPU (and the OS) supports AVX2.
+ * @return  true, if the AVX2 kernels may run.
+ */
+static bool HasAVX2() {
+#ifdef HCS_BLAKE2_SIMD
+    static bool const avx2 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return avx2;
+#else
+    return false;
+#endif
+}
+
+
+blake2::KernelB headcode::crypt::blake2::SelectKernelB() {
+#ifdef HCS_BLAKE2_SIMD
+    if (HasAVX2()) {
+        return StripesBAVX2;
+    }
+#endif
+    return StripesBScalar;
+}
+
+
+blake2::KernelS headcode::crypt::blake2::SelectKernelS() {
+#ifdef HCS_BLAKE2_SIMD
+    if (HasAVX2()) {
+        return StripesSAVX2;
+    }
+#endif
+    return StripesSScalar;
+}
+
+
+char const * headcode::crypt::blake2::GetKernelName() {
+    if (HasAVX2()) {
+        return "AVX2 lanes";
+    }
+    return "portable lanes";
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_BLAKE2_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_BLAKE2_KERNEL_HPP
+
+#include <cstdint>
+
+// Like the multi-buffer hash kernels, the SIMD lane kernels live in a translation unit
+// of their own compiled with -mavx2. Keep this header free of inline code.
+
+
+namespace headcode::crypt::blake2 {
+
+
+/**
+ * @brief   Size of a stripe: one block for each lane of BLAKE2bp and BLAKE2sp.
+ */
+constexpr std::uint64_t kStripeSize = 512;
+
+
+/**
+ * @brief   The BLAKE2b initialization vector.
+ */
+extern std::uint64_t const kIVB[8];
+
+
+/**
+ * @brief   The BLAKE2s initialization vector.
+ */
+extern std::uint32_t const kIVS[8];
+
+
+/**
+ * @brief   The message word permutations of the rounds (BLAKE2b runs rows 0 and 1 twice).
+ */
+extern unsigned char const kSigma[10][16];
+
+
+/**
+ * @brief   Compresses whole stripes into the lanes of a tree hash.
+ * The state is stored word by word: h[i][lane] is word i of the lane. Lane j takes block j of
+ * each stripe. None of these blocks is the last one of its lane: the caller keeps these back.
+ * @param   h           the lane states.
+ * @param   stripes     the incoming stripes.
+ * @param   count       number of stripes.
+ * @param   counter     number of bytes compressed by each lane so far.
+ */
+using KernelB = void (*)(std::uint64_t h[8][4],
+                         unsigned char const * stripes,
+                         std::uint64_t count,
+                         std::uint64_t counter);
+
+/**
+ * @brief   Compresses whole stripes into the 8 lanes of BLAKE2sp (see KernelB).
+ */
+using KernelS = void (*)(std::uint32_t h[8][8],
+                         unsigned char const * stripes,
+                         std::uint64_t count,
+                         std::uint64_t counter);
+
+
+/**
+ * @brief   Picks the 4 lane BLAKE2b kernel for this CPU.
+ * @return  The AVX2 kernel if supported, the portable code else.
+ */
+KernelB SelectKernelB();
+
+
+/**
+ * @brief   Picks the 8 lane BLAKE2s kernel for this CPU.
+ * @return  The AVX2 kernel if supported, the portable code else.
+ */
+KernelS SelectKernelS();
+
+
+/**
+ * @brief   Names the kernels picked by SelectKernelB() and SelectKernelS().
+ * @return  A human readable name of the lane kernels.
+ */
+char const * GetKernelName();
+
+
+/**
+ * @brief   Runs the BLAKE2b compression function on a single block.
+ * @param   h           the state.
+ * @param   block       the block (128 bytes).
+ * @param   counter     number of bytes hashed including this block.
+ * @param   last        last block of the message.
+ * @param   last_node   last node of its level in a tree.
+ */
+void CompressB(std::uint64_t h[8], unsigned char const * block, std::uint64_t counter, bool last, bool last_node);
+
+
+/**
+ * @brief   Runs the BLAKE2s compression function on a single block.
+ * @param   h           the state.
+ * @param   block       the block (64 bytes).
+ * @param   counter     number of bytes hashed including this block.
+ * @param   last        last block of the message.
+ * @param   last_node   last node of its level in a tree.
+ */
+void CompressS(std::uint32_t h[8], unsigned char const * block, std::uint64_t counter, bool last, bool last_node);
+
+
+void StripesBScalar(std::uint64_t h[8][4], unsigned char const * stripes, std::uint64_t count, std::uint64_t counter);
+
+void StripesSScalar(std::uint32_t h[8][8], unsigned char const * stripes, std::uint64_t count, std::uint64_t counter);
+
+#ifdef HCS_BLAKE2_SIMD
+
+void StripesBAVX2(std::uint64_t h[8][4], unsigned char const * stripes, std::uint64_t count, std::uint64_t counter);
+
+void StripesSAVX2(std::uint32_t h[8][8], unsigned char const * stripes, std::uint64_t count, std::uint64_t counter);
+
+#endif
+
+
+}
+
+
+#endif
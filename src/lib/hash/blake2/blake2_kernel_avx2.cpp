@@ -0,0 +1,249 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -mavx2. It is only called after
+// a runtime check of the CPU (see blake2_dispatch.cpp).
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "blake2_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+// Word i of all lanes in one AVX2 register: 4 lanes of BLAKE2b or 8 lanes of BLAKE2s.
+
+using V = __m256i;
+
+inline V Load(void const * p) {
+    return _mm256_loadu_si256(static_cast<V const *>(p));
+}
+
+inline void Store(void * p, V a) {
+    _mm256_storeu_si256(static_cast<V *>(p), a);
+}
+
+// BLAKE2b: rotations by whole bytes are a single byte shuffle
+
+inline V Rotr64By32(V a) {
+    return _mm256_shuffle_epi32(a, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+inline V Rotr64By24(V a) {
+    auto const shuffle = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                          3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline V Rotr64By16(V a) {
+    auto const shuffle = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                          2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline V Rotr64By63(V a) {
+    return _mm256_or_si256(_mm256_srli_epi64(a, 63), _mm256_add_epi64(a, a));
+}
+
+inline void GB(V * v, int a, int b, int c, int d, V x, V y) {
+    v[a] = _mm256_add_epi64(_mm256_add_epi64(v[a], v[b]), x);
+    v[d] = Rotr64By32(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi64(v[c], v[d]);
+    v[b] = Rotr64By24(_mm256_xor_si256(v[b], v[c]));
+    v[a] = _mm256_add_epi64(_mm256_add_epi64(v[a], v[b]), y);
+    v[d] = Rotr64By16(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi64(v[c], v[d]);
+    v[b] = Rotr64By63(_mm256_xor_si256(v[b], v[c]));
+}
+
+/**
+ * @brief   Loads the message words of 4 BLAKE2b blocks: m[i] holds word i of each block.
+ * @param   m           the message words.
+ * @param   stripe      the 4 blocks.
+ */
+inline void TransposeB(V * m, unsigned char const * stripe) {
+    for (int g = 0; g < 4; ++g) {
+        auto r0 = Load(stripe + 0 * 128 + g * 32);
+        auto r1 = Load(stripe + 1 * 128 + g * 32);
+        auto r2 = Load(stripe + 2 * 128 + g * 32);
+        auto r3 = Load(stripe + 3 * 128 + g * 32);
+        auto t0 = _mm256_unpacklo_epi64(r0, r1);
+        auto t1 = _mm256_unpackhi_epi64(r0, r1);
+        auto t2 = _mm256_unpacklo_epi64(r2, r3);
+        auto t3 = _mm256_unpackhi_epi64(r2, r3);
+        m[g * 4 + 0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+        m[g * 4 + 1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+        m[g * 4 + 2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+        m[g * 4 + 3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+    }
+}
+
+// BLAKE2s
+
+inline V Rotr32By16(V a) {
+    auto const shuffle = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline V Rotr32By8(V a) {
+    auto const shuffle = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+                                          1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+template <int n>
+inline V Rotr32(V a) {
+    return _mm256_or_si256(_mm256_srli_epi32(a, n), _mm256_slli_epi32(a, 32 - n));
+}
+
+inline void GS(V * v, int a, int b, int c, int d, V x, V y) {
+    v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), x);
+    v[d] = Rotr32By16(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi32(v[c], v[d]);
+    v[b] = Rotr32<12>(_mm256_xor_si256(v[b], v[c]));
+    v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), y);
+    v[d] = Rotr32By8(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi32(v[c], v[d]);
+    v[b] = Rotr32<7>(_mm256_xor_si256(v[b], v[c]));
+}
+
+/**
+ * @brief   Loads the message words of 8 BLAKE2s blocks: m[i] holds word i of each block.
+ * @param   m           the message words.
+ * @param   stripe      the 8 blocks.
+ */
+inline void TransposeS(V * m, unsigned char const * stripe) {
+    for (int g = 0; g < 2; ++g) {
+        V r[8];
+        for (int i = 0; i < 8; ++i) {
+            r[i] = Load(stripe + i * 64 + g * 32);
+        }
+        V t[8];
+        for (int i = 0; i < 8; i += 2) {
+            t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+            t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+        }
+        V u[8];
+        for (int i = 0; i < 8; i += 4) {
+            u[i + 0] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+            u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+            u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+            u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+        }
+        for (int i = 0; i < 4; ++i) {
+            m[g * 8 + i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+            m[g * 8 + i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+        }
+    }
+}
+
+/**
+ * @brief   Runs the rounds of BLAKE2b or BLAKE2s on all lanes.
+ * @param   v           the working vector.
+ * @param   m           the message words.
+ * @param   rounds      the number of rounds.
+ * @tparam  g           the mixing function.
+ */
+template <void (*g)(V *, int, int, int, int, V, V)>
+inline void Rounds(V * v, V const * m, unsigned int rounds) {
+    for (unsigned int round = 0; round < rounds; ++round) {
+        auto const * s = blake2::kSigma[round % 10];
+        g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+}
+
+
+}
+
+
+void headcode::crypt::blake2::StripesBAVX2(std::uint64_t h[8][4],
+                                           unsigned char const * stripes,
+                                           std::uint64_t count,
+                                           std::uint64_t counter) {
+
+    V state[8];
+    for (int i = 0; i < 8; ++i) {
+        state[i] = Load(h[i]);
+    }
+
+    for (; count > 0; --count, stripes += kStripeSize) {
+
+        counter += kStripeSize / 4;
+
+        V m[16];
+        TransposeB(m, stripes);
+
+        V v[16];
+        for (int i = 0; i < 8; ++i) {
+            v[i] = state[i];
+            v[i + 8] = _mm256_set1_epi64x(static_cast<long long>(kIVB[i]));
+        }
+        v[12] = _mm256_set1_epi64x(static_cast<long long>(kIVB[4] ^ counter));
+
+        Rounds<GB>(v, m, 12);
+
+        for (int i = 0; i < 8; ++i) {
+            state[i] = _mm256_xor_si256(state[i], _mm256_xor_si256(v[i], v[i + 8]));
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        Store(h[i], state[i]);
+    }
+}
+
+
+void headcode::crypt::blake2::StripesSAVX2(std::uint32_t h[8][8],
+                                           unsigned char const * stripes,
+                                           std::uint64_t count,
+                                           std::uint64_t counter) {
+
+    V state[8];
+    for (int i = 0; i < 8; ++i) {
+        state[i] = Load(h[i]);
+    }
+
+    for (; count > 0; --count, stripes += kStripeSize) {
+
+        counter += kStripeSize / 8;
+
+        V m[16];
+        TransposeS(m, stripes);
+
+        V v[16];
+        for (int i = 0; i < 8; ++i) {
+            v[i] = state[i];
+            v[i + 8] = _mm256_set1_epi32(static_cast<int>(kIVS[i]));
+        }
+        v[12] = _mm256_set1_epi32(static_cast<int>(kIVS[4] ^ static_cast<std::uint32_t>(counter)));
+        v[13] = _mm256_set1_epi32(static_cast<int>(kIVS[5] ^ static_cast<std::uint32_t>(counter >> 32)));
+
+        Rounds<GS>(v, m, 10);
+
+        for (int i = 0; i < 8; ++i) {
+            state[i] = _mm256_xor_si256(state[i], _mm256_xor_si256(v[i], v[i + 8]));
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        Store(h[i], state[i]);
+    }
+}
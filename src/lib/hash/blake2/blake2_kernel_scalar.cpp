@@ -0,0 +1,192 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstdint>
+
+#include "blake2_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+std::uint64_t const blake2::kIVB[8] = {0x6a09e667f3bcc908ull,
+                                       0xbb67ae8584caa73bull,
+                                       0x3c6ef372fe94f82bull,
+                                       0xa54ff53a5f1d36f1ull,
+                                       0x510e527fade682d1ull,
+                                       0x9b05688c2b3e6c1full,
+                                       0x1f83d9abfb41bd6bull,
+                                       0x5be0cd19137e2179ull};
+
+std::uint32_t const blake2::kIVS[8] = {0x6a09e667u,
+                                       0xbb67ae85u,
+                                       0x3c6ef372u,
+                                       0xa54ff53au,
+                                       0x510e527fu,
+                                       0x9b05688cu,
+                                       0x1f83d9abu,
+                                       0x5be0cd19u};
+
+unsigned char const blake2::kSigma[10][16] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                                              {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+                                              {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+                                              {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+                                              {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+                                              {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+                                              {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+                                              {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+                                              {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+                                              {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0}};
+
+
+namespace {
+
+
+template <typename Word>
+inline Word Rotr(Word a, int n) {
+    return (a >> n) | (a << (sizeof(Word) * 8 - n));
+}
+
+template <typename Word>
+inline Word Load(unsigned char const * p) {
+    Word w = 0;
+    for (unsigned int i = 0; i < sizeof(Word); ++i) {
+        w |= static_cast<Word>(p[i]) << (8 * i);
+    }
+    return w;
+}
+
+/**
+ * @brief   The rotations and rounds of BLAKE2b and BLAKE2s.
+ */
+template <typename Word>
+struct Traits;
+
+template <>
+struct Traits<std::uint64_t> {
+    static constexpr int kR1 = 32, kR2 = 24, kR3 = 16, kR4 = 63;
+    static constexpr unsigned int kRounds = 12;
+    static std::uint64_t const * IV() {
+        return blake2::kIVB;
+    }
+};
+
+template <>
+struct Traits<std::uint32_t> {
+    static constexpr int kR1 = 16, kR2 = 12, kR3 = 8, kR4 = 7;
+    static constexpr unsigned int kRounds = 10;
+    static std::uint32_t const * IV() {
+        return blake2::kIVS;
+    }
+};
+
+template <typename Word>
+inline void G(Word * v, int a, int b, int c, int d, Word x, Word y) {
+    using T = Traits<Word>;
+    v[a] = v[a] + v[b] + x;
+    v[d] = Rotr<Word>(v[d] ^ v[a], T::kR1);
+    v[c] = v[c] + v[d];
+    v[b] = Rotr<Word>(v[b] ^ v[c], T::kR2);
+    v[a] = v[a] + v[b] + y;
+    v[d] = Rotr<Word>(v[d] ^ v[a], T::kR3);
+    v[c] = v[c] + v[d];
+    v[b] = Rotr<Word>(v[b] ^ v[c], T::kR4);
+}
+
+template <typename Word>
+void Compress(Word * h, unsigned char const * block, std::uint64_t counter, bool last, bool last_node) {
+
+    using T = Traits<Word>;
+
+    Word m[16];
+    for (int i = 0; i < 16; ++i) {
+        m[i] = Load<Word>(block + i * sizeof(Word));
+    }
+
+    Word v[16];
+    for (int i = 0; i < 8; ++i) {
+        v[i] = h[i];
+        v[i + 8] = T::IV()[i];
+    }
+    v[12] ^= static_cast<Word>(counter);
+    v[13] ^= static_cast<Word>(sizeof(Word) == 4 ? counter >> 32 : 0);
+    v[14] ^= last ? static_cast<Word>(~Word{0}) : Word{0};
+    v[15] ^= last_node ? static_cast<Word>(~Word{0}) : Word{0};
+
+    for (unsigned int round = 0; round < T::kRounds; ++round) {
+        auto const * s = blake2::kSigma[round % 10];
+        G<Word>(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        G<Word>(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        G<Word>(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        G<Word>(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        G<Word>(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        G<Word>(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        G<Word>(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        G<Word>(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+template <typename Word, unsigned int kLanes>
+void Stripes(Word h[8][kLanes], unsigned char const * stripes, std::uint64_t count, std::uint64_t counter) {
+
+    auto const block_size = blake2::kStripeSize / kLanes;
+    for (; count > 0; --count) {
+        counter += block_size;
+        for (unsigned int lane = 0; lane < kLanes; ++lane) {
+            Word lane_state[8];
+            for (int i = 0; i < 8; ++i) {
+                lane_state[i] = h[i][lane];
+            }
+            Compress<Word>(lane_state, stripes, counter, false, false);
+            for (int i = 0; i < 8; ++i) {
+                h[i][lane] = lane_state[i];
+            }
+            stripes += block_size;
+        }
+    }
+}
+
+
+}
+
+
+void headcode::crypt::blake2::CompressB(std::uint64_t h[8],
+                                        unsigned char const * block,
+                                        std::uint64_t counter,
+                                        bool last,
+                                        bool last_node) {
+    Compress<std::uint64_t>(h, block, counter, last, last_node);
+}
+
+
+void headcode::crypt::blake2::CompressS(std::uint32_t h[8],
+                                        unsigned char const * block,
+                                        std::uint64_t counter,
+                                        bool last,
+                                        bool last_node) {
+    Compress<std::uint32_t>(h, block, counter, last, last_node);
+}
+
+
+void headcode::crypt::blake2::StripesBScalar(std::uint64_t h[8][4],
+                                             unsigned char const * stripes,
+                                             std::uint64_t count,
+                                             std::uint64_t counter) {
+    Stripes<std::uint64_t, 4>(h, stripes, count, counter);
+}
+
+
+void headcode::crypt::blake2::StripesSScalar(std::uint32_t h[8][8],
+                                             unsigned char const * stripes,
+                                             std::uint64_t count,
+                                             std::uint64_t counter) {
+    Stripes<std::uint32_t, 8>(h, stripes, count, counter);
+}
@@ -0,0 +1,181 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "blake2_tree_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+BLAKE2TreeHash::BLAKE2TreeHash(unsigned int lanes, std::uint64_t max_key_size)
+        : lanes_{lanes}, max_key_size_{max_key_size} {
+}
+
+
+BLAKE2TreeHash::~BLAKE2TreeHash() {
+    std::fill(key_.begin(), key_.end(), 0);
+    std::fill(std::begin(buffer_), std::end(buffer_), 0);
+}
+
+
+int BLAKE2TreeHash::Add_(unsigned char const * block_incoming,
+                         std::uint64_t size_incoming,
+                         unsigned char *,
+                         std::uint64_t & size_outgoing) {
+
+    // A stripe is compressed only if more than a whole stripe follows. So each lane
+    // finds its last block (and maybe one more) in the buffer at Finalize().
+
+    size_outgoing = GetDescription().block_size_outgoing_;
+    auto const stripe_size = blake2::kStripeSize;
+
+    if (buffer_size_ > 0) {
+
+        auto fill = std::min(2 * stripe_size - buffer_size_, size_incoming);
+        std::memcpy(buffer_ + buffer_size_, block_incoming, fill);
+        buffer_size_ += fill;
+        block_incoming += fill;
+        size_incoming -= fill;
+        if (size_incoming == 0) {
+            return static_cast<int>(Error::kNoError);
+        }
+
+        Compress(buffer_, 1);
+        std::memcpy(buffer_, buffer_ + stripe_size, stripe_size);
+        buffer_size_ = stripe_size;
+        if (size_incoming <= stripe_size) {
+            std::memcpy(buffer_ + buffer_size_, block_incoming, size_incoming);
+            buffer_size_ += size_incoming;
+            return static_cast<int>(Error::kNoError);
+        }
+
+        Compress(buffer_, 1);
+        buffer_size_ = 0;
+    }
+
+    if (size_incoming > stripe_size) {
+        auto count = (size_incoming - stripe_size - 1) / stripe_size;
+        Compress(block_incoming, count);
+        block_incoming += count * stripe_size;
+        size_incoming -= count * stripe_size;
+    }
+
+    std::memcpy(buffer_, block_incoming, size_incoming);
+    buffer_size_ = size_incoming;
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void BLAKE2TreeHash::Compress(unsigned char const * stripes, std::uint64_t count) {
+
+    auto const block_size = blake2::kStripeSize / lanes_;
+    if (key_pending_) {
+        unsigned char key_stripe[blake2::kStripeSize] = {};
+        for (unsigned int lane = 0; lane < lanes_; ++lane) {
+            std::memcpy(key_stripe + lane * block_size, key_.data(), key_.size());
+        }
+        CompressStripes(key_stripe, 1, counter_);
+        counter_ += block_size;
+        key_pending_ = false;
+        std::fill(std::begin(key_stripe), std::end(key_stripe), 0);
+    }
+
+    if (count > 0) {
+        CompressStripes(stripes, count, counter_);
+        counter_ += count * block_size;
+    }
+}
+
+
+int BLAKE2TreeHash::Finalize_(unsigned char * result,
+                              std::uint64_t result_size,
+                              std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (result_size < GetDescription().result_size_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    auto const block_size = blake2::kStripeSize / lanes_;
+    for (unsigned int lane = 0; lane < lanes_; ++lane) {
+
+        // the blocks left for this lane: the key block (if pending) and up to 2 blocks held back
+        unsigned char const * blocks[3];
+        std::uint64_t sizes[3];
+        unsigned int count = 0;
+        if (key_pending_) {
+            blocks[count] = nullptr;
+            sizes[count++] = block_size;
+        }
+        for (auto offset = lane * block_size; offset < buffer_size_; offset += blake2::kStripeSize) {
+            blocks[count] = buffer_ + offset;
+            sizes[count++] = std::min(block_size, buffer_size_ - offset);
+        }
+
+        auto counter = counter_;
+        unsigned char block[blake2::kStripeSize / 4] = {};
+        if (count == 0) {
+            CompressLane(lane, block, counter, true);
+        }
+        for (unsigned int i = 0; i < count; ++i) {
+            std::fill(block, block + block_size, 0);
+            if (blocks[i] == nullptr) {
+                std::memcpy(block, key_.data(), key_.size());
+            } else {
+                std::memcpy(block, blocks[i], sizes[i]);
+            }
+            counter += sizes[i];
+            CompressLane(lane, block, counter, i + 1 == count);
+        }
+        std::fill(std::begin(block), std::end(block), 0);
+    }
+
+    FinishRoot(result);
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int BLAKE2TreeHash::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    std::fill(key_.begin(), key_.end(), 0);
+    key_.clear();
+
+    auto iter = initialization_data.find("key");
+    if (iter != initialization_data.end()) {
+        auto [key_data, key_size] = (*iter).second;
+        if (key_size > max_key_size_) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key of invalid size.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        key_.assign(key_data, key_data + key_size);
+    }
+
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int BLAKE2TreeHash::Reset_() {
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void BLAKE2TreeHash::Start() {
+    StartLanes();
+    key_pending_ = !key_.empty();
+    buffer_size_ = 0;
+    counter_ = 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_BLAKE2_TREE_HASH_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_BLAKE2_TREE_HASH_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "blake2_kernel.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of the parallel BLAKE2 tree hashes (BLAKE2bp and BLAKE2sp).
+ * The message is cut into stripes of 512 bytes. Block i of each stripe goes to lane i: the
+ * lanes are independent leaf hashes running side by side in the SIMD registers. The root
+ * hashes the digests of the leaves. An optional "key" turns the hash into a MAC: each leaf
+ * takes the key as its very first block.
+ *
+ * The last block of a leaf is compressed differently, hence the last stripes are held back
+ * in the buffer until Finalize().
+ */
+class BLAKE2TreeHash : public Algorithm {
+
+    unsigned int const lanes_;                                //!< @brief Number of leaves.
+    std::uint64_t const max_key_size_;                        //!< @brief Largest key accepted.
+    std::vector<unsigned char> key_;                          //!< @brief The key (if any).
+    bool key_pending_ = false;                                //!< @brief The key block is not compressed yet.
+    unsigned char buffer_[2 * blake2::kStripeSize];           //!< @brief Stripes held back.
+    std::uint64_t buffer_size_ = 0;                           //!< @brief Number of bytes held back.
+    std::uint64_t counter_ = 0;                               //!< @brief Number of bytes compressed by each lane.
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   lanes           number of leaves.
+     * @param   max_key_size    largest key accepted.
+     */
+    BLAKE2TreeHash(unsigned int lanes, std::uint64_t max_key_size);
+
+    /**
+     * @brief   Destructor.
+     */
+    ~BLAKE2TreeHash() override;
+
+    /**
+     * @brief   Gets the size of the key in use.
+     * @return  The size of the key (0 if not keyed).
+     */
+    std::uint64_t GetKeySize() const {
+        return key_.size();
+    }
+
+    /**
+     * @brief   Sets up the lanes for a new message.
+     */
+    void Start();
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Compresses whole stripes on all lanes (the key block first, if pending).
+     * @param   stripes     the stripes.
+     * @param   count       number of stripes.
+     */
+    void Compress(unsigned char const * stripes, std::uint64_t count);
+
+    /**
+     * @brief   Compresses a single block on a single lane.
+     * @param   lane        the lane.
+     * @param   block       the block (zero padded).
+     * @param   counter     number of bytes hashed by the lane including this block.
+     * @param   last        last block of the lane.
+     */
+    virtual void CompressLane(unsigned int lane, unsigned char const * block, std::uint64_t counter, bool last) = 0;
+
+    /**
+     * @brief   Compresses whole stripes on all lanes.
+     * @param   stripes     the stripes.
+     * @param   count       number of stripes.
+     * @param   counter     number of bytes compressed by each lane so far.
+     */
+    virtual void CompressStripes(unsigned char const * stripes, std::uint64_t count, std::uint64_t counter) = 0;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Hashes the digests of the leaves.
+     * @param   result      the digest.
+     */
+    virtual void FinishRoot(unsigned char * result) = 0;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Sets the initial state of the lanes.
+     */
+    virtual void StartLanes() = 0;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_BLAKE2BP_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_BLAKE2BP_HPP
+
+#include <cstdint>
+
+#include "blake2_tree_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The parallel BLAKE2bp tree hash: 4 BLAKE2b leaves side by side.
+ */
+class BLAKE2bp : public BLAKE2TreeHash {
+
+    blake2::KernelB const kernel_;         //!< @brief The lane kernel for this CPU.
+    std::uint64_t h_[8][4];          //!< @brief The lane states, word by word.
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    BLAKE2bp();
+
+private:
+    /**
+     * @brief   Compresses a single block on a single lane.
+     * @param   lane        the lane.
+     * @param   block       the block (zero padded).
+     * @param   counter     number of bytes hashed by the lane including this block.
+     * @param   last        last block of the lane.
+     */
+    void CompressLane(unsigned int lane, unsigned char const * block, std::uint64_t counter, bool last) override;
+
+    /**
+     * @brief   Compresses whole stripes on all lanes.
+     * @param   stripes     the stripes.
+     * @param   count       number of stripes.
+     * @param   counter     number of bytes compressed by each lane so far.
+     */
+    void CompressStripes(unsigned char const * stripes, std::uint64_t count, std::uint64_t counter) override;
+
+    /**
+     * @brief   Hashes the digests of the leaves.
+     * @param   result      the digest.
+     */
+    void FinishRoot(unsigned char * result) override;
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+
+    /**
+     * @brief   Sets the initial state of the lanes.
+     */
+    void StartLanes() override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,205 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include <headcode/crypt/factory.hpp>
+
+#include "blake2sp.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Number of leaves.
+ */
+static unsigned int const kLanes = 8;
+
+
+/**
+ * @brief   Size of a BLAKE2s block.
+ */
+static std::uint64_t const kBlockSize = 64;
+
+
+/**
+ * @brief   Size of the digest of the leaves and of the root.
+ */
+static std::uint64_t const kDigestSize = 32;
+
+
+/**
+ * @brief   Names the provider and the lane kernel in use.
+ * @return  The provider of the algorithm.
+ */
+static std::string GetProvider() {
+    return std::string{"hcs-crypt v"} + VERSION + " (" + blake2::GetKernelName() + ")";
+}
+
+
+/**
+ * @brief   The BLAKE2sp algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-blake2sp",              // name
+            Family::kHash,               // family
+            "Parallel BLAKE2sp.",        // description (short/left and long/below)
+
+            "This is BLAKE2sp as defined by the BLAKE2 authors: 8 BLAKE2s leaves hash the message "
+            "64 byte block by block side by side, a BLAKE2s root hashes their digests. The leaves run in "
+            "the SIMD lanes of the CPU. The digest differs from BLAKE2s. Pass an optional \"key\" (up to "
+            "32 bytes) at initialization for keyed hashing (a MAC). See: https://www.blake2.net.",
+
+            GetProvider(),                              // provider
+            0ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                // output block size behaviour
+            0ul,                                        // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,              // default padding strategy
+            32ul,                                       // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_NONE, "Optional secret key (up to 32 bytes).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class BLAKE2spProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<BLAKE2sp>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+/**
+ * @brief   Sets the state of a BLAKE2s node from the parameter block.
+ * @param   h               the state.
+ * @param   key_size        size of the key.
+ * @param   node_offset     the leaf.
+ * @param   node_depth      0 for the leaves, 1 for the root.
+ */
+static void InitNode(std::uint32_t h[8], std::uint64_t key_size, unsigned int node_offset, unsigned int node_depth) {
+
+    // digest length, key length, fanout, depth, leaf length 0, node offset, node depth, inner length
+    auto const word_0 = kDigestSize | (key_size << 8) | (kLanes << 16) | (2ul << 24);
+    auto const word_3 = (node_depth << 16) | (kDigestSize << 24);
+    std::uint32_t const parameter[8] = {static_cast<std::uint32_t>(word_0),
+                                        0,
+                                        node_offset,
+                                        static_cast<std::uint32_t>(word_3),
+                                        0,
+                                        0,
+                                        0,
+                                        0};
+    for (int i = 0; i < 8; ++i) {
+        h[i] = blake2::kIVS[i] ^ parameter[i];
+    }
+}
+
+
+/**
+ * @brief   Writes a state as digest.
+ * @param   h           the state.
+ * @param   digest      the digest.
+ */
+static void Encode(std::uint32_t const h[8], unsigned char * digest) {
+    for (std::uint64_t i = 0; i < kDigestSize; ++i) {
+        digest[i] = static_cast<unsigned char>(h[i / 4] >> (8 * (i % 4)));
+    }
+}
+
+
+BLAKE2sp::BLAKE2sp() : BLAKE2TreeHash{kLanes, kDigestSize}, kernel_{blake2::SelectKernelS()} {
+    Start();
+}
+
+
+void BLAKE2sp::CompressLane(unsigned int lane, unsigned char const * block, std::uint64_t counter, bool last) {
+
+    std::uint32_t h[8];
+    for (int i = 0; i < 8; ++i) {
+        h[i] = h_[i][lane];
+    }
+    blake2::CompressS(h, block, counter, last, last && (lane + 1 == kLanes));
+    for (int i = 0; i < 8; ++i) {
+        h_[i][lane] = h[i];
+    }
+}
+
+
+void BLAKE2sp::CompressStripes(unsigned char const * stripes, std::uint64_t count, std::uint64_t counter) {
+    kernel_(h_, stripes, count, counter);
+}
+
+
+void BLAKE2sp::FinishRoot(unsigned char * result) {
+
+    unsigned char leaves[kLanes * kDigestSize];
+    for (unsigned int lane = 0; lane < kLanes; ++lane) {
+        std::uint32_t h[8];
+        for (int i = 0; i < 8; ++i) {
+            h[i] = h_[i][lane];
+        }
+        Encode(h, leaves + lane * kDigestSize);
+    }
+
+    std::uint32_t root[8];
+    InitNode(root, GetKeySize(), 0, 1);
+    for (std::uint64_t offset = 0; offset < sizeof(leaves); offset += kBlockSize) {
+        auto last = offset + kBlockSize == sizeof(leaves);
+        blake2::CompressS(root, leaves + offset, offset + kBlockSize, last, last);
+    }
+    Encode(root, result);
+
+    std::fill(std::begin(leaves), std::end(leaves), 0);
+}
+
+
+Algorithm::Description const & BLAKE2sp::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void BLAKE2sp::StartLanes() {
+    for (unsigned int lane = 0; lane < kLanes; ++lane) {
+        std::uint32_t h[8];
+        InitNode(h, GetKeySize(), lane, 0);
+        for (int i = 0; i < 8; ++i) {
+            h_[i][lane] = h[i];
+        }
+    }
+}
+
+
+void BLAKE2sp::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<BLAKE2spProducer>());
+}
@@ -0,0 +1,361 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+#include <headcode/crypt/factory.hpp>
+
+#include "blake3.hpp"
+#include "worker_pool.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Names the provider and the kernel in use.
+ * @return  The provider of the algorithm.
+ */
+static std::string GetProvider() {
+    return std::string{"hcs-crypt v"} + VERSION + " (" + blake3::SelectKernel().name_ + ")";
+}
+
+
+/**
+ * @brief   The BLAKE3 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-blake3",                // name
+            Family::kHash,               // family
+            "BLAKE3.",                   // description (short/left and long/below)
+
+            "This is BLAKE3: a binary tree of 1 KiB chunks hashed with a 7 round BLAKE2s compression. "
+            "Chunks run side by side in the SIMD lanes of the CPU and large data is hashed on many threads. "
+            "Pass an optional \"key\" (32 bytes) at initialization for keyed hashing (a MAC) or an optional "
+            "\"context\" string to derive a key from the data added. Finalize() writes any number of bytes "
+            "(extendable output). See: https://github.com/BLAKE3-team/BLAKE3.",
+
+            GetProvider(),                              // provider
+            0ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                // output block size behaviour
+            0ul,                                        // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,              // default padding strategy
+            32ul,                                       // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_NONE, "Optional secret key (32 bytes).", true}},
+             {"context", {0ul, PaddingStrategy::PADDING_NONE, "Optional context of a key derivation.", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class BLAKE3Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<BLAKE3>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+/**
+ * @brief   Gets the largest power of 2 not above a value.
+ * @param   x       the value (not 0).
+ * @return  The largest power of 2 not above x.
+ */
+static std::uint64_t RoundDownToPowerOf2(std::uint64_t x) {
+    std::uint64_t power = 1;
+    while (power <= x / 2) {
+        power *= 2;
+    }
+    return power;
+}
+
+
+/**
+ * @brief   Reads key words from bytes.
+ * @param   key         the key words.
+ * @param   bytes       the key (32 bytes).
+ */
+static void LoadKey(std::uint32_t key[8], unsigned char const * bytes) {
+    for (int i = 0; i < 8; ++i) {
+        key[i] = static_cast<std::uint32_t>(bytes[4 * i]) | (static_cast<std::uint32_t>(bytes[4 * i + 1]) << 8) |
+                 (static_cast<std::uint32_t>(bytes[4 * i + 2]) << 16) |
+                 (static_cast<std::uint32_t>(bytes[4 * i + 3]) << 24);
+    }
+}
+
+
+BLAKE3::BLAKE3() : kernel_{blake3::SelectKernel()} {
+    std::copy(blake3::kIV, blake3::kIV + 8, key_);
+    Start();
+}
+
+
+BLAKE3::~BLAKE3() {
+    std::fill(std::begin(key_), std::end(key_), 0);
+    std::fill(std::begin(cv_stack_), std::end(cv_stack_), 0);
+    blake3::StartChunk(chunk_, key_, 0, 0);
+    root_ = blake3::GetChunkOutput(chunk_);
+}
+
+
+int BLAKE3::Add_(unsigned char const * block_incoming,
+                 std::uint64_t size_incoming,
+                 unsigned char *,
+                 std::uint64_t & size_outgoing) {
+
+    size_outgoing = GetDescription().block_size_outgoing_;
+    if (size_incoming == 0) {
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // finish the chunk started by the last Add() first
+    if (blake3::GetChunkSize(chunk_) > 0) {
+        auto take = std::min(blake3::kChunkSize - blake3::GetChunkSize(chunk_), size_incoming);
+        blake3::AddToChunk(chunk_, block_incoming, take);
+        block_incoming += take;
+        size_incoming -= take;
+        if (size_incoming == 0) {
+            return static_cast<int>(Error::kNoError);
+        }
+
+        unsigned char cv[blake3::kKeySize];
+        blake3::GetChainingValue(blake3::GetChunkOutput(chunk_), cv);
+        PushStack(cv, chunk_.counter_);
+        blake3::StartChunk(chunk_, key_, flags_, chunk_.counter_ + 1);
+    }
+
+    // Hash the largest subtrees fitting in, as long as more than a chunk is left:
+    // the last chunk might be the root and stays in the chunk state.
+    while (size_incoming > blake3::kChunkSize) {
+
+        auto subtree_size = RoundDownToPowerOf2(size_incoming);
+        auto const hashed = chunk_.counter_ * blake3::kChunkSize;
+        while (((subtree_size - 1) & hashed) != 0) {
+            subtree_size /= 2;
+        }
+        auto const subtree_chunks = subtree_size / blake3::kChunkSize;
+
+        if (subtree_size <= blake3::kChunkSize) {
+            blake3::ChunkState chunk;
+            blake3::StartChunk(chunk, key_, flags_, chunk_.counter_);
+            blake3::AddToChunk(chunk, block_incoming, subtree_size);
+            unsigned char cv[blake3::kKeySize];
+            blake3::GetChainingValue(blake3::GetChunkOutput(chunk), cv);
+            PushStack(cv, chunk.counter_);
+        } else {
+            unsigned char children[2 * blake3::kKeySize];
+            CompressSubtree(block_incoming, subtree_size, children);
+            PushStack(children, chunk_.counter_);
+            PushStack(children + blake3::kKeySize, chunk_.counter_ + subtree_chunks / 2);
+        }
+
+        chunk_.counter_ += subtree_chunks;
+        block_incoming += subtree_size;
+        size_incoming -= subtree_size;
+    }
+
+    if (size_incoming > 0) {
+        blake3::AddToChunk(chunk_, block_incoming, size_incoming);
+        MergeStack(chunk_.counter_);
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void BLAKE3::CompressSubtree(unsigned char const * data, std::uint64_t size, unsigned char * children) const {
+
+    auto slices = GetSliceCount(size, blake3::kMinSubtreeSize);
+    if (slices <= 1) {
+        blake3::CompressSubtreeToParent(kernel_, data, size, key_, chunk_.counter_, flags_, children);
+        return;
+    }
+
+    // The pieces are subtrees of their own: a power of 2 of them. More pieces than
+    // threads even out the load if the number of threads is no power of 2.
+    std::uint64_t pieces = 2;
+    while ((pieces < 4 * slices) && (size / pieces >= 2 * blake3::kMinSubtreeSize)) {
+        pieces *= 2;
+    }
+
+    auto const piece_size = size / pieces;
+    auto const counter = chunk_.counter_;
+    std::vector<unsigned char> cvs(pieces * blake3::kKeySize);
+    WorkerPool::GetInstance().Run(pieces, [&](std::uint64_t piece) {
+        blake3::CompressSubtree(kernel_,
+                                data + piece * piece_size,
+                                piece_size,
+                                key_,
+                                counter + piece * piece_size / blake3::kChunkSize,
+                                flags_,
+                                cvs.data() + piece * blake3::kKeySize);
+    });
+
+    // merge the pieces level by level up to the children of the subtree
+    std::vector<unsigned char> parents(pieces / 2 * blake3::kKeySize);
+    for (; pieces > 2; pieces /= 2) {
+        blake3::CompressParents(kernel_, cvs.data(), pieces, key_, flags_, parents.data());
+        std::swap(cvs, parents);
+    }
+    std::memcpy(children, cvs.data(), 2 * blake3::kKeySize);
+}
+
+
+int BLAKE3::Finalize_(unsigned char * result,
+                      std::uint64_t result_size,
+                      std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (result_size == 0) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // roll up the right edge of the tree: the last node compressed is the root
+    std::uint64_t cvs_left = cv_stack_size_;
+    if ((blake3::GetChunkSize(chunk_) > 0) || (cvs_left == 0)) {
+        root_ = blake3::GetChunkOutput(chunk_);
+    } else {
+        cvs_left -= 2;
+        root_ = blake3::GetParentOutput(cv_stack_ + cvs_left * blake3::kKeySize, key_, flags_);
+    }
+    while (cvs_left > 0) {
+        --cvs_left;
+        unsigned char children[2 * blake3::kKeySize];
+        std::memcpy(children, cv_stack_ + cvs_left * blake3::kKeySize, blake3::kKeySize);
+        blake3::GetChainingValue(root_, children + blake3::kKeySize);
+        root_ = blake3::GetParentOutput(children, key_, flags_);
+    }
+
+    blake3::GetRootBytes(root_, 0, result, result_size);
+    squeezed_ = result_size;
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+Algorithm::Description const & BLAKE3::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+int BLAKE3::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    auto key_iter = initialization_data.find("key");
+    auto context_iter = initialization_data.find("context");
+    if ((key_iter != initialization_data.end()) && (context_iter != initialization_data.end())) {
+        headcode::logger::Warning{"headcode.crypt"} << "BLAKE3 takes either a key or a context.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    std::copy(blake3::kIV, blake3::kIV + 8, key_);
+    flags_ = 0;
+
+    if (key_iter != initialization_data.end()) {
+        auto [key_data, key_size] = (*key_iter).second;
+        if ((key_data == nullptr) || (key_size != blake3::kKeySize)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key of invalid size.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        LoadKey(key_, key_data);
+        flags_ = blake3::kKeyedHash;
+    }
+
+    if (context_iter != initialization_data.end()) {
+
+        // the context is hashed on its own: the digest is the key of the key material
+        auto [context_data, context_size] = (*context_iter).second;
+        flags_ = blake3::kDeriveKeyContext;
+        Start();
+        std::uint64_t size_outgoing = 0;
+        Add_(context_data, context_size, nullptr, size_outgoing);
+        unsigned char context_key[blake3::kKeySize];
+        Finalize_(context_key, blake3::kKeySize, {});
+
+        LoadKey(key_, context_key);
+        std::fill(std::begin(context_key), std::end(context_key), 0);
+        flags_ = blake3::kDeriveKeyMaterial;
+    }
+
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void BLAKE3::MergeStack(std::uint64_t chunks) {
+
+    // A complete subtree leaves a single chaining value, so after n chunks there are as
+    // many subtrees as bits set in n. The ones beyond are merged into their parents.
+    auto const subtrees = std::bitset<64>{chunks}.count();
+    while (cv_stack_size_ > subtrees) {
+        auto children = cv_stack_ + (cv_stack_size_ - 2) * blake3::kKeySize;
+        blake3::GetChainingValue(blake3::GetParentOutput(children, key_, flags_), children);
+        --cv_stack_size_;
+    }
+}
+
+
+void BLAKE3::PushStack(unsigned char const * cv, std::uint64_t counter) {
+    MergeStack(counter);
+    std::memcpy(cv_stack_ + cv_stack_size_ * blake3::kKeySize, cv, blake3::kKeySize);
+    ++cv_stack_size_;
+}
+
+
+int BLAKE3::Reset_() {
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int BLAKE3::Squeeze_(unsigned char * output, std::uint64_t size) {
+    blake3::GetRootBytes(root_, squeezed_, output, size);
+    squeezed_ += size;
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void BLAKE3::Start() {
+    blake3::StartChunk(chunk_, key_, flags_, 0);
+    cv_stack_size_ = 0;
+    root_ = blake3::GetChunkOutput(chunk_);
+    squeezed_ = 0;
+}
+
+
+void BLAKE3::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<BLAKE3Producer>());
+}
@@ -0,0 +1,151 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_BLAKE3_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_BLAKE3_HPP
+
+#include <cstdint>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "blake3_tree.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The BLAKE3 hash.
+ * The message is cut into chunks of 1 KiB, the leaves of a binary tree. The kernel hashes up
+ * to 8 chunks side by side in the SIMD lanes, large subtrees of a single Add() run on the
+ * worker pool. Chaining values of finished subtrees wait on a stack until the next Add() shows
+ * they are not the root.
+ *
+ * An optional "key" selects the keyed hash, an optional "context" the key derivation: the data
+ * added is the key material then. Finalize() writes as many bytes as asked for (the extendable
+ * output), 32 bytes are the default. Squeeze() continues the output.
+ */
+class BLAKE3 : public Algorithm {
+
+    /**
+     * @brief   Number of chaining values on the stack of a tree of 2^64 bytes.
+     */
+    static constexpr std::uint64_t kMaxDepth = 54;
+
+    blake3::Kernel const & kernel_;                             //!< @brief The kernel for this CPU.
+    std::uint32_t key_[8];                                      //!< @brief The key words of the mode.
+    std::uint8_t flags_ = 0;                                    //!< @brief The flags of the mode.
+    blake3::ChunkState chunk_;                                  //!< @brief The chunk hashed right now.
+    unsigned char cv_stack_[kMaxDepth * blake3::kKeySize];      //!< @brief The stack of chaining values.
+    std::uint64_t cv_stack_size_ = 0;                           //!< @brief Number of chaining values on the stack.
+    blake3::Output root_;                                       //!< @brief The root after Finalize().
+    std::uint64_t squeezed_ = 0;                                //!< @brief Number of output bytes written.
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    BLAKE3();
+
+    /**
+     * @brief   Destructor.
+     */
+    ~BLAKE3() override;
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Hashes a whole subtree into the chaining values of its children.
+     * Large subtrees are split into pieces hashed on the worker pool.
+     * @param   data        the data.
+     * @param   size        size of the subtree.
+     * @param   children    the chaining values of the children (64 bytes).
+     */
+    void CompressSubtree(unsigned char const * data, std::uint64_t size, unsigned char * children) const;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization (any size: extendable output).
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Merges the chaining values on the stack which are known not to be on the right edge of the tree.
+     * @param   chunks      number of chunks hashed so far.
+     */
+    void MergeStack(std::uint64_t chunks);
+
+    /**
+     * @brief   Pushes the chaining value of a finished subtree.
+     * @param   cv          the chaining value.
+     * @param   counter     the number of the first chunk of the subtree.
+     */
+    void PushStack(unsigned char const * cv, std::uint64_t counter);
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Squeezes more output after Finalize().
+     * @param   output      the memory receiving the next output bytes.
+     * @param   size        number of bytes to squeeze.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Squeeze_(unsigned char * output, std::uint64_t size) override;
+
+    /**
+     * @brief   Starts a new message.
+     */
+    void Start();
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,30 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "blake3_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+blake3::Kernel const & headcode::crypt::blake3::SelectKernel() {
+
+    static Kernel const kernel = []() -> Kernel {
+#ifdef HCS_BLAKE3_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return {HashManyAVX2, 8, "AVX2"};
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return {HashManySSE41, 4, "SSE4.1"};
+        }
+#endif
+        return {HashManyScalar, 1, "portable"};
+    }();
+
+    return kernel;
+}
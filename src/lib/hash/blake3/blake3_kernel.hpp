@@ -0,0 +1,189 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_BLAKE3_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_BLAKE3_KERNEL_HPP
+
+#include <cstdint>
+
+// Like the BLAKE2 lane kernels, the SIMD kernels live in translation units of their
+// own compiled with -msse4.1 and -mavx2. Keep this header free of inline code.
+
+
+namespace headcode::crypt::blake3 {
+
+
+/**
+ * @brief   Size of a block.
+ */
+constexpr std::uint64_t kBlockSize = 64;
+
+
+/**
+ * @brief   Size of a chunk: a leaf of the tree.
+ */
+constexpr std::uint64_t kChunkSize = 1024;
+
+
+/**
+ * @brief   Size of a key and of a chaining value.
+ */
+constexpr std::uint64_t kKeySize = 32;
+
+
+/**
+ * @brief   Most inputs hashed side by side by a kernel.
+ */
+constexpr std::uint64_t kMaxDegree = 8;
+
+
+/**
+ * @brief   The domain separation flags.
+ */
+enum Flags : std::uint8_t {
+    kChunkStart = 1u << 0,
+    kChunkEnd = 1u << 1,
+    kParent = 1u << 2,
+    kRoot = 1u << 3,
+    kKeyedHash = 1u << 4,
+    kDeriveKeyContext = 1u << 5,
+    kDeriveKeyMaterial = 1u << 6
+};
+
+
+/**
+ * @brief   The BLAKE3 initialization vector (the one of SHA-256 and BLAKE2s).
+ */
+extern std::uint32_t const kIV[8];
+
+
+/**
+ * @brief   The message word order of the 7 rounds.
+ */
+extern unsigned char const kSchedule[7][16];
+
+
+/**
+ * @brief   Hashes whole inputs side by side (chunks or parent nodes).
+ * Input i runs the blocks through a state starting at the key and writes its chaining value
+ * (32 bytes) at out + i * 32. The first block takes flags_start, the last one flags_end on
+ * top of flags. The counter of input i is counter + i if increment_counter is set.
+ * @param   inputs              the inputs.
+ * @param   count               number of inputs.
+ * @param   blocks              number of blocks of each input.
+ * @param   key                 the key words.
+ * @param   counter             the counter of the first input.
+ * @param   increment_counter   increment the counter from input to input (chunks, not parents).
+ * @param   flags               the flags of all blocks.
+ * @param   flags_start         the flags added to the first block.
+ * @param   flags_end           the flags added to the last block.
+ * @param   out                 the chaining values.
+ */
+using HashMany = void (*)(unsigned char const * const * inputs,
+                          std::uint64_t count,
+                          std::uint64_t blocks,
+                          std::uint32_t const key[8],
+                          std::uint64_t counter,
+                          bool increment_counter,
+                          std::uint8_t flags,
+                          std::uint8_t flags_start,
+                          std::uint8_t flags_end,
+                          unsigned char * out);
+
+
+/**
+ * @brief   A kernel for the CPU.
+ */
+struct Kernel {
+    HashMany hash_many_;            //!< @brief Hashes many inputs side by side.
+    std::uint64_t degree_;          //!< @brief Number of inputs worth passing at once.
+    char const * name_;             //!< @brief A human readable name.
+};
+
+
+/**
+ * @brief   Picks the kernel for this CPU.
+ * @return  The AVX2 or the SSE4.1 kernel if supported, the portable code else.
+ */
+Kernel const & SelectKernel();
+
+
+/**
+ * @brief   Runs the compression function on a single block and keeps the chaining value.
+ * @param   cv              the chaining value.
+ * @param   block           the block (zero padded).
+ * @param   block_size      number of bytes in the block.
+ * @param   counter         the counter.
+ * @param   flags           the flags.
+ */
+void Compress(std::uint32_t cv[8],
+              unsigned char const * block,
+              std::uint8_t block_size,
+              std::uint64_t counter,
+              std::uint8_t flags);
+
+
+/**
+ * @brief   Runs the compression function on a single block and writes the whole state (output bytes).
+ * @param   cv              the chaining value.
+ * @param   block           the block (zero padded).
+ * @param   block_size      number of bytes in the block.
+ * @param   counter         the counter.
+ * @param   flags           the flags.
+ * @param   out             the 64 output bytes.
+ */
+void CompressXOF(std::uint32_t const cv[8],
+                 unsigned char const * block,
+                 std::uint8_t block_size,
+                 std::uint64_t counter,
+                 std::uint8_t flags,
+                 unsigned char * out);
+
+
+void HashManyScalar(unsigned char const * const * inputs,
+                    std::uint64_t count,
+                    std::uint64_t blocks,
+                    std::uint32_t const key[8],
+                    std::uint64_t counter,
+                    bool increment_counter,
+                    std::uint8_t flags,
+                    std::uint8_t flags_start,
+                    std::uint8_t flags_end,
+                    unsigned char * out);
+
+#ifdef HCS_BLAKE3_SIMD
+
+void HashManySSE41(unsigned char const * const * inputs,
+                   std::uint64_t count,
+                   std::uint64_t blocks,
+                   std::uint32_t const key[8],
+                   std::uint64_t counter,
+                   bool increment_counter,
+                   std::uint8_t flags,
+                   std::uint8_t flags_start,
+                   std::uint8_t flags_end,
+                   unsigned char * out);
+
+void HashManyAVX2(unsigned char const * const * inputs,
+                  std::uint64_t count,
+                  std::uint64_t blocks,
+                  std::uint32_t const key[8],
+                  std::uint64_t counter,
+                  bool increment_counter,
+                  std::uint8_t flags,
+                  std::uint8_t flags_start,
+                  std::uint8_t flags_end,
+                  unsigned char * out);
+
+#endif
+
+
+}
+
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -mavx2. It is only called after
+// a runtime check of the CPU (see blake3_dispatch.cpp).
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "blake3_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+// Word i of 8 inputs in one AVX2 register.
+
+using V = __m256i;
+
+constexpr std::uint64_t kDegree = 8;
+
+inline V Load(void const * p) {
+    return _mm256_loadu_si256(static_cast<V const *>(p));
+}
+
+inline void Store(void * p, V a) {
+    _mm256_storeu_si256(static_cast<V *>(p), a);
+}
+
+inline V Set1(std::uint32_t a) {
+    return _mm256_set1_epi32(static_cast<int>(a));
+}
+
+inline V Rotr16(V a) {
+    auto const shuffle = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline V Rotr8(V a) {
+    auto const shuffle = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+                                          1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+template <int n>
+inline V Rotr(V a) {
+    return _mm256_or_si256(_mm256_srli_epi32(a, n), _mm256_slli_epi32(a, 32 - n));
+}
+
+inline void G(V * v, int a, int b, int c, int d, V x, V y) {
+    v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), x);
+    v[d] = Rotr16(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi32(v[c], v[d]);
+    v[b] = Rotr<12>(_mm256_xor_si256(v[b], v[c]));
+    v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), y);
+    v[d] = Rotr8(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi32(v[c], v[d]);
+    v[b] = Rotr<7>(_mm256_xor_si256(v[b], v[c]));
+}
+
+/**
+ * @brief   Transposes an 8x8 matrix of words in place.
+ * @param   r           the rows.
+ */
+inline void Transpose(V * r) {
+    V t[8];
+    for (int i = 0; i < 8; i += 2) {
+        t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    V u[8];
+    for (int i = 0; i < 8; i += 4) {
+        u[i + 0] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        r[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+        r[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+    }
+}
+
+/**
+ * @brief   Hashes 8 inputs side by side.
+ * @param   inputs              the inputs.
+ * @param   blocks              number of blocks of each input.
+ * @param   key                 the key words.
+ * @param   counter             the counter of the first input.
+ * @param   increment_counter   increment the counter from input to input.
+ * @param   flags               the flags of all blocks.
+ * @param   flags_start         the flags added to the first block.
+ * @param   flags_end           the flags added to the last block.
+ * @param   out                 the chaining values.
+ */
+void Hash8(unsigned char const * const * inputs,
+           std::uint64_t blocks,
+           std::uint32_t const key[8],
+           std::uint64_t counter,
+           bool increment_counter,
+           std::uint8_t flags,
+           std::uint8_t flags_start,
+           std::uint8_t flags_end,
+           unsigned char * out) {
+
+    std::uint32_t counter_low[kDegree];
+    std::uint32_t counter_high[kDegree];
+    for (std::uint64_t i = 0; i < kDegree; ++i) {
+        auto c = counter + (increment_counter ? i : 0);
+        counter_low[i] = static_cast<std::uint32_t>(c);
+        counter_high[i] = static_cast<std::uint32_t>(c >> 32);
+    }
+
+    V h[8];
+    for (int i = 0; i < 8; ++i) {
+        h[i] = Set1(key[i]);
+    }
+
+    auto block_flags = static_cast<std::uint8_t>(flags | flags_start);
+    for (std::uint64_t block = 0; block < blocks; ++block) {
+
+        if (block + 1 == blocks) {
+            block_flags |= flags_end;
+        }
+
+        V m[16];
+        for (int g = 0; g < 2; ++g) {
+            for (std::uint64_t i = 0; i < kDegree; ++i) {
+                m[g * 8 + i] = Load(inputs[i] + block * blake3::kBlockSize + g * 32);
+            }
+            Transpose(m + g * 8);
+        }
+
+        V v[16];
+        for (int i = 0; i < 8; ++i) {
+            v[i] = h[i];
+        }
+        for (int i = 0; i < 4; ++i) {
+            v[i + 8] = Set1(blake3::kIV[i]);
+        }
+        v[12] = Load(counter_low);
+        v[13] = Load(counter_high);
+        v[14] = Set1(blake3::kBlockSize);
+        v[15] = Set1(block_flags);
+
+        for (auto const * s : blake3::kSchedule) {
+            G(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+            G(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+            G(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+            G(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+            G(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+            G(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+            G(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+            G(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            h[i] = _mm256_xor_si256(v[i], v[i + 8]);
+        }
+        block_flags = flags;
+    }
+
+    Transpose(h);
+    for (std::uint64_t i = 0; i < kDegree; ++i) {
+        Store(out + i * blake3::kKeySize, h[i]);
+    }
+}
+
+
+}
+
+
+void headcode::crypt::blake3::HashManyAVX2(unsigned char const * const * inputs,
+                                           std::uint64_t count,
+                                           std::uint64_t blocks,
+                                           std::uint32_t const key[8],
+                                           std::uint64_t counter,
+                                           bool increment_counter,
+                                           std::uint8_t flags,
+                                           std::uint8_t flags_start,
+                                           std::uint8_t flags_end,
+                                           unsigned char * out) {
+
+    for (; count >= kDegree; count -= kDegree, inputs += kDegree, out += kDegree * kKeySize) {
+        Hash8(inputs, blocks, key, counter, increment_counter, flags, flags_start, flags_end, out);
+        if (increment_counter) {
+            counter += kDegree;
+        }
+    }
+
+    // every CPU with AVX2 runs SSE4.1 as well
+    HashManySSE41(inputs, count, blocks, key, counter, increment_counter, flags, flags_start, flags_end, out);
+}
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstdint>
+
+#include "blake3_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+std::uint32_t const blake3::kIV[8] = {0x6a09e667u,
+                                      0xbb67ae85u,
+                                      0x3c6ef372u,
+                                      0xa54ff53au,
+                                      0x510e527fu,
+                                      0x9b05688cu,
+                                      0x1f83d9abu,
+                                      0x5be0cd19u};
+
+unsigned char const blake3::kSchedule[7][16] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                                                {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+                                                {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+                                                {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+                                                {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+                                                {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+                                                {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13}};
+
+
+namespace {
+
+
+inline std::uint32_t Rotr(std::uint32_t a, int n) {
+    return (a >> n) | (a << (32 - n));
+}
+
+inline std::uint32_t Load(unsigned char const * p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+inline void Store(unsigned char * p, std::uint32_t w) {
+    p[0] = static_cast<unsigned char>(w);
+    p[1] = static_cast<unsigned char>(w >> 8);
+    p[2] = static_cast<unsigned char>(w >> 16);
+    p[3] = static_cast<unsigned char>(w >> 24);
+}
+
+inline void G(std::uint32_t * v, int a, int b, int c, int d, std::uint32_t x, std::uint32_t y) {
+    v[a] = v[a] + v[b] + x;
+    v[d] = Rotr(v[d] ^ v[a], 16);
+    v[c] = v[c] + v[d];
+    v[b] = Rotr(v[b] ^ v[c], 12);
+    v[a] = v[a] + v[b] + y;
+    v[d] = Rotr(v[d] ^ v[a], 8);
+    v[c] = v[c] + v[d];
+    v[b] = Rotr(v[b] ^ v[c], 7);
+}
+
+/**
+ * @brief   Runs the 7 rounds on a block.
+ * @param   v               the working vector (written).
+ * @param   cv              the chaining value.
+ * @param   block           the block.
+ * @param   block_size      number of bytes in the block.
+ * @param   counter         the counter.
+ * @param   flags           the flags.
+ */
+void Rounds(std::uint32_t v[16],
+            std::uint32_t const cv[8],
+            unsigned char const * block,
+            std::uint8_t block_size,
+            std::uint64_t counter,
+            std::uint8_t flags) {
+
+    std::uint32_t m[16];
+    for (int i = 0; i < 16; ++i) {
+        m[i] = Load(block + 4 * i);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        v[i] = cv[i];
+    }
+    for (int i = 0; i < 4; ++i) {
+        v[i + 8] = blake3::kIV[i];
+    }
+    v[12] = static_cast<std::uint32_t>(counter);
+    v[13] = static_cast<std::uint32_t>(counter >> 32);
+    v[14] = block_size;
+    v[15] = flags;
+
+    for (auto const * s : blake3::kSchedule) {
+        G(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        G(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        G(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        G(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        G(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        G(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        G(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        G(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+}
+
+
+}
+
+
+void headcode::crypt::blake3::Compress(std::uint32_t cv[8],
+                                       unsigned char const * block,
+                                       std::uint8_t block_size,
+                                       std::uint64_t counter,
+                                       std::uint8_t flags) {
+    std::uint32_t v[16];
+    Rounds(v, cv, block, block_size, counter, flags);
+    for (int i = 0; i < 8; ++i) {
+        cv[i] = v[i] ^ v[i + 8];
+    }
+}
+
+
+void headcode::crypt::blake3::CompressXOF(std::uint32_t const cv[8],
+                                          unsigned char const * block,
+                                          std::uint8_t block_size,
+                                          std::uint64_t counter,
+                                          std::uint8_t flags,
+                                          unsigned char * out) {
+    std::uint32_t v[16];
+    Rounds(v, cv, block, block_size, counter, flags);
+    for (int i = 0; i < 8; ++i) {
+        Store(out + 4 * i, v[i] ^ v[i + 8]);
+        Store(out + 4 * (i + 8), v[i + 8] ^ cv[i]);
+    }
+}
+
+
+void headcode::crypt::blake3::HashManyScalar(unsigned char const * const * inputs,
+                                             std::uint64_t count,
+                                             std::uint64_t blocks,
+                                             std::uint32_t const key[8],
+                                             std::uint64_t counter,
+                                             bool increment_counter,
+                                             std::uint8_t flags,
+                                             std::uint8_t flags_start,
+                                             std::uint8_t flags_end,
+                                             unsigned char * out) {
+
+    for (std::uint64_t i = 0; i < count; ++i, out += kKeySize) {
+
+        std::uint32_t cv[8];
+        for (int j = 0; j < 8; ++j) {
+            cv[j] = key[j];
+        }
+
+        auto block_flags = static_cast<std::uint8_t>(flags | flags_start);
+        for (std::uint64_t block = 0; block < blocks; ++block) {
+            if (block + 1 == blocks) {
+                block_flags |= flags_end;
+            }
+            Compress(cv, inputs[i] + block * kBlockSize, kBlockSize, counter, block_flags);
+            block_flags = flags;
+        }
+
+        for (int j = 0; j < 8; ++j) {
+            Store(out + 4 * j, cv[j]);
+        }
+        if (increment_counter) {
+            ++counter;
+        }
+    }
+}
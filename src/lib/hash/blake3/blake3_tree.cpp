@@ -0,0 +1,310 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "blake3_tree.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+/**
+ * @brief   Most chaining values a wide subtree compression hands back.
+ */
+constexpr std::uint64_t kMaxDegreeOr2 = std::max<std::uint64_t>(blake3::kMaxDegree, 2);
+
+
+inline std::uint64_t RoundDownToPowerOf2(std::uint64_t x) {
+    std::uint64_t power = 1;
+    while (power <= x / 2) {
+        power *= 2;
+    }
+    return power;
+}
+
+/**
+ * @brief   Gets the size of the left subtree: the largest power of 2 chunks leaving at least a byte on the right.
+ * @param   size        size of the data (more than a chunk).
+ * @return  The size of the left subtree.
+ */
+inline std::uint64_t GetLeftSize(std::uint64_t size) {
+    return RoundDownToPowerOf2((size - 1) / blake3::kChunkSize) * blake3::kChunkSize;
+}
+
+/**
+ * @brief   Hashes up to degree chunks side by side (the last one may be partial).
+ * @return  The number of chaining values written.
+ */
+std::uint64_t CompressChunks(blake3::Kernel const & kernel,
+                             unsigned char const * data,
+                             std::uint64_t size,
+                             std::uint32_t const key[8],
+                             std::uint64_t counter,
+                             std::uint8_t flags,
+                             unsigned char * out) {
+
+    unsigned char const * chunks[blake3::kMaxDegree];
+    std::uint64_t count = 0;
+    std::uint64_t position = 0;
+    while (size - position >= blake3::kChunkSize) {
+        chunks[count++] = data + position;
+        position += blake3::kChunkSize;
+    }
+    kernel.hash_many_(chunks,
+                      count,
+                      blake3::kChunkSize / blake3::kBlockSize,
+                      key,
+                      counter,
+                      true,
+                      flags,
+                      blake3::kChunkStart,
+                      blake3::kChunkEnd,
+                      out);
+
+    if (size > position) {
+        blake3::ChunkState chunk;
+        blake3::StartChunk(chunk, key, flags, counter + count);
+        blake3::AddToChunk(chunk, data + position, size - position);
+        blake3::GetChainingValue(blake3::GetChunkOutput(chunk), out + count * blake3::kKeySize);
+        ++count;
+    }
+
+    return count;
+}
+
+/**
+ * @brief   Hashes pairs of chaining values side by side, an odd one is passed on.
+ * @return  The number of chaining values written.
+ */
+std::uint64_t CompressParentsWide(blake3::Kernel const & kernel,
+                                  unsigned char const * cvs,
+                                  std::uint64_t count,
+                                  std::uint32_t const key[8],
+                                  std::uint8_t flags,
+                                  unsigned char * out) {
+
+    unsigned char const * parents[kMaxDegreeOr2];
+    std::uint64_t parent_count = 0;
+    while (count - 2 * parent_count >= 2) {
+        parents[parent_count] = cvs + 2 * parent_count * blake3::kKeySize;
+        ++parent_count;
+    }
+    kernel.hash_many_(parents, parent_count, 1, key, 0, false, flags | blake3::kParent, 0, 0, out);
+
+    if (count > 2 * parent_count) {
+        std::memcpy(out + parent_count * blake3::kKeySize,
+                    cvs + 2 * parent_count * blake3::kKeySize,
+                    blake3::kKeySize);
+        return parent_count + 1;
+    }
+    return parent_count;
+}
+
+/**
+ * @brief   Hashes a subtree down to at most kernel.degree_ (or 2) chaining values.
+ * The recursion stops as soon as the chunks fit into the kernel, so all the lanes are busy.
+ * @return  The number of chaining values written.
+ */
+std::uint64_t CompressSubtreeWide(blake3::Kernel const & kernel,
+                                  unsigned char const * data,
+                                  std::uint64_t size,
+                                  std::uint32_t const key[8],
+                                  std::uint64_t counter,
+                                  std::uint8_t flags,
+                                  unsigned char * out) {
+
+    if (size <= kernel.degree_ * blake3::kChunkSize) {
+        return CompressChunks(kernel, data, size, key, counter, flags, out);
+    }
+
+    auto left_size = GetLeftSize(size);
+    auto degree = kernel.degree_;
+    if ((left_size > blake3::kChunkSize) && (degree == 1)) {
+        // the portable kernel still needs pairs to build parents of
+        degree = 2;
+    }
+
+    unsigned char cvs[2 * kMaxDegreeOr2 * blake3::kKeySize];
+    auto left_count = CompressSubtreeWide(kernel, data, left_size, key, counter, flags, cvs);
+    auto right_count = CompressSubtreeWide(kernel,
+                                           data + left_size,
+                                           size - left_size,
+                                           key,
+                                           counter + left_size / blake3::kChunkSize,
+                                           flags,
+                                           cvs + degree * blake3::kKeySize);
+
+    if (left_count == 1) {
+        // only 2 chaining values: these are the children of the subtree
+        std::memcpy(out, cvs, 2 * blake3::kKeySize);
+        return 2;
+    }
+
+    return CompressParentsWide(kernel, cvs, left_count + right_count, key, flags, out);
+}
+
+
+}
+
+
+void headcode::crypt::blake3::StartChunk(ChunkState & chunk,
+                                         std::uint32_t const key[8],
+                                         std::uint8_t flags,
+                                         std::uint64_t counter) {
+    std::copy(key, key + 8, chunk.cv_);
+    chunk.counter_ = counter;
+    std::fill(std::begin(chunk.buffer_), std::end(chunk.buffer_), 0);
+    chunk.buffer_size_ = 0;
+    chunk.blocks_compressed_ = 0;
+    chunk.flags_ = flags;
+}
+
+
+std::uint64_t headcode::crypt::blake3::GetChunkSize(ChunkState const & chunk) {
+    return kBlockSize * chunk.blocks_compressed_ + chunk.buffer_size_;
+}
+
+
+void headcode::crypt::blake3::AddToChunk(ChunkState & chunk, unsigned char const * data, std::uint64_t size) {
+
+    // the last block of the chunk is compressed as part of the output: keep a block back
+    while (size > 0) {
+        if (chunk.buffer_size_ == kBlockSize) {
+            auto start = chunk.blocks_compressed_ == 0 ? kChunkStart : 0;
+            Compress(chunk.cv_, chunk.buffer_, kBlockSize, chunk.counter_, chunk.flags_ | start);
+            ++chunk.blocks_compressed_;
+            std::fill(std::begin(chunk.buffer_), std::end(chunk.buffer_), 0);
+            chunk.buffer_size_ = 0;
+        }
+        auto take = std::min<std::uint64_t>(size, kBlockSize - chunk.buffer_size_);
+        std::memcpy(chunk.buffer_ + chunk.buffer_size_, data, take);
+        chunk.buffer_size_ += static_cast<std::uint8_t>(take);
+        data += take;
+        size -= take;
+    }
+}
+
+
+blake3::Output headcode::crypt::blake3::GetChunkOutput(ChunkState const & chunk) {
+
+    Output output;
+    std::copy(chunk.cv_, chunk.cv_ + 8, output.cv_);
+    std::copy(std::begin(chunk.buffer_), std::end(chunk.buffer_), output.block_);
+    output.block_size_ = chunk.buffer_size_;
+    output.counter_ = chunk.counter_;
+    output.flags_ = chunk.flags_ | kChunkEnd | (chunk.blocks_compressed_ == 0 ? kChunkStart : 0);
+    return output;
+}
+
+
+blake3::Output headcode::crypt::blake3::GetParentOutput(unsigned char const * children,
+                                                        std::uint32_t const key[8],
+                                                        std::uint8_t flags) {
+    Output output;
+    std::copy(key, key + 8, output.cv_);
+    std::copy(children, children + kBlockSize, output.block_);
+    output.block_size_ = kBlockSize;
+    output.counter_ = 0;
+    output.flags_ = flags | kParent;
+    return output;
+}
+
+
+void headcode::crypt::blake3::GetChainingValue(Output const & output, unsigned char * cv) {
+
+    std::uint32_t words[8];
+    std::copy(output.cv_, output.cv_ + 8, words);
+    Compress(words, output.block_, output.block_size_, output.counter_, output.flags_);
+    for (std::uint64_t i = 0; i < kKeySize; ++i) {
+        cv[i] = static_cast<unsigned char>(words[i / 4] >> (8 * (i % 4)));
+    }
+}
+
+
+void headcode::crypt::blake3::GetRootBytes(Output const & output,
+                                           std::uint64_t position,
+                                           unsigned char * result,
+                                           std::uint64_t size) {
+
+    // the root block is compressed over and over with a rising counter: 64 output bytes each
+    auto offset = position % kBlockSize;
+    unsigned char block[kBlockSize];
+    for (auto counter = position / kBlockSize; size > 0; ++counter) {
+        CompressXOF(output.cv_, output.block_, output.block_size_, counter, output.flags_ | kRoot, block);
+        auto take = std::min(size, kBlockSize - offset);
+        std::memcpy(result, block + offset, take);
+        result += take;
+        size -= take;
+        offset = 0;
+    }
+}
+
+
+void headcode::crypt::blake3::CompressSubtreeToParent(Kernel const & kernel,
+                                                      unsigned char const * data,
+                                                      std::uint64_t size,
+                                                      std::uint32_t const key[8],
+                                                      std::uint64_t counter,
+                                                      std::uint8_t flags,
+                                                      unsigned char * children) {
+
+    unsigned char cvs[kMaxDegreeOr2 * kKeySize];
+    auto count = CompressSubtreeWide(kernel, data, size, key, counter, flags, cvs);
+
+    unsigned char parents[kMaxDegreeOr2 * kKeySize / 2];
+    while (count > 2) {
+        count = CompressParentsWide(kernel, cvs, count, key, flags, parents);
+        std::memcpy(cvs, parents, count * kKeySize);
+    }
+    std::memcpy(children, cvs, 2 * kKeySize);
+}
+
+
+void headcode::crypt::blake3::CompressSubtree(Kernel const & kernel,
+                                              unsigned char const * data,
+                                              std::uint64_t size,
+                                              std::uint32_t const key[8],
+                                              std::uint64_t counter,
+                                              std::uint8_t flags,
+                                              unsigned char * cv) {
+
+    if (size <= kChunkSize) {
+        CompressChunks(kernel, data, size, key, counter, flags, cv);
+        return;
+    }
+
+    unsigned char children[2 * kKeySize];
+    CompressSubtreeToParent(kernel, data, size, key, counter, flags, children);
+    GetChainingValue(GetParentOutput(children, key, flags), cv);
+}
+
+
+void headcode::crypt::blake3::CompressParents(Kernel const & kernel,
+                                              unsigned char const * cvs,
+                                              std::uint64_t count,
+                                              std::uint32_t const key[8],
+                                              std::uint8_t flags,
+                                              unsigned char * parents) {
+
+    unsigned char const * children[kMaxDegree];
+    while (count > 0) {
+        std::uint64_t parent_count = 0;
+        for (; (parent_count < kMaxDegree) && (2 * parent_count < count); ++parent_count) {
+            children[parent_count] = cvs + 2 * parent_count * kKeySize;
+        }
+        kernel.hash_many_(children, parent_count, 1, key, 0, false, flags | kParent, 0, 0, parents);
+        cvs += 2 * parent_count * kKeySize;
+        parents += parent_count * kKeySize;
+        count -= 2 * parent_count;
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_BLAKE3_TREE_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_BLAKE3_TREE_HPP
+
+#include <cstdint>
+
+#include "blake3_kernel.hpp"
+
+
+namespace headcode::crypt::blake3 {
+
+
+/**
+ * @brief   Smallest subtree hashed on a thread of its own.
+ */
+constexpr std::uint64_t kMinSubtreeSize = 64ul * 1024ul;
+
+
+/**
+ * @brief   The last compression of a node, kept back until it is known if the node is the root.
+ */
+struct Output {
+    std::uint32_t cv_[8];                   //!< @brief The chaining value going in.
+    unsigned char block_[kBlockSize];       //!< @brief The block (zero padded).
+    std::uint8_t block_size_;               //!< @brief Number of bytes in the block.
+    std::uint64_t counter_;                 //!< @brief The counter.
+    std::uint8_t flags_;                    //!< @brief The flags.
+};
+
+
+/**
+ * @brief   The chunk (leaf) hashed right now.
+ */
+struct ChunkState {
+    std::uint32_t cv_[8];                   //!< @brief The chaining value.
+    std::uint64_t counter_;                 //!< @brief The number of the chunk.
+    unsigned char buffer_[kBlockSize];      //!< @brief The block not compressed yet.
+    std::uint8_t buffer_size_;              //!< @brief Number of bytes in the buffer.
+    std::uint8_t blocks_compressed_;        //!< @brief Number of blocks compressed.
+    std::uint8_t flags_;                    //!< @brief The flags of the mode.
+};
+
+
+/**
+ * @brief   Starts a chunk.
+ * @param   chunk       the chunk.
+ * @param   key         the key words.
+ * @param   flags       the flags of the mode.
+ * @param   counter     the number of the chunk.
+ */
+void StartChunk(ChunkState & chunk, std::uint32_t const key[8], std::uint8_t flags, std::uint64_t counter);
+
+
+/**
+ * @brief   Gets the number of bytes added to a chunk.
+ * @param   chunk       the chunk.
+ * @return  The number of bytes in the chunk so far.
+ */
+std::uint64_t GetChunkSize(ChunkState const & chunk);
+
+
+/**
+ * @brief   Adds data to a chunk (up to the size of a chunk).
+ * @param   chunk       the chunk.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ */
+void AddToChunk(ChunkState & chunk, unsigned char const * data, std::uint64_t size);
+
+
+/**
+ * @brief   Gets the output of a chunk.
+ * @param   chunk       the chunk.
+ * @return  The last compression of the chunk.
+ */
+Output GetChunkOutput(ChunkState const & chunk);
+
+
+/**
+ * @brief   Gets the output of a parent node.
+ * @param   children    the chaining values of the children (64 bytes).
+ * @param   key         the key words.
+ * @param   flags       the flags of the mode.
+ * @return  The compression of the parent.
+ */
+Output GetParentOutput(unsigned char const * children, std::uint32_t const key[8], std::uint8_t flags);
+
+
+/**
+ * @brief   Gets the chaining value of a node which is not the root.
+ * @param   output      the output of the node.
+ * @param   cv          the chaining value (32 bytes).
+ */
+void GetChainingValue(Output const & output, unsigned char * cv);
+
+
+/**
+ * @brief   Writes the output bytes of the root (the extendable output).
+ * @param   output      the output of the root.
+ * @param   position    the first output byte to write.
+ * @param   result      the result.
+ * @param   size        number of bytes to write.
+ */
+void GetRootBytes(Output const & output, std::uint64_t position, unsigned char * result, std::uint64_t size);
+
+
+/**
+ * @brief   Hashes a whole subtree into the chaining values of its two children.
+ * The subtree is a power of 2 chunks (at least 2) starting at a multiple of its size.
+ * @param   kernel      the kernel.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @param   key         the key words.
+ * @param   counter     the number of the first chunk.
+ * @param   flags       the flags of the mode.
+ * @param   children    the chaining values of the children (64 bytes).
+ */
+void CompressSubtreeToParent(Kernel const & kernel,
+                             unsigned char const * data,
+                             std::uint64_t size,
+                             std::uint32_t const key[8],
+                             std::uint64_t counter,
+                             std::uint8_t flags,
+                             unsigned char * children);
+
+
+/**
+ * @brief   Hashes a whole subtree into its chaining value.
+ * The subtree is a power of 2 chunks starting at a multiple of its size and is not the whole message.
+ * @param   kernel      the kernel.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @param   key         the key words.
+ * @param   counter     the number of the first chunk.
+ * @param   flags       the flags of the mode.
+ * @param   cv          the chaining value (32 bytes).
+ */
+void CompressSubtree(Kernel const & kernel,
+                     unsigned char const * data,
+                     std::uint64_t size,
+                     std::uint32_t const key[8],
+                     std::uint64_t counter,
+                     std::uint8_t flags,
+                     unsigned char * cv);
+
+
+/**
+ * @brief   Hashes pairs of chaining values into their parents side by side.
+ * @param   kernel      the kernel.
+ * @param   cvs         the chaining values (an even number).
+ * @param   count       number of chaining values.
+ * @param   key         the key words.
+ * @param   flags       the flags of the mode.
+ * @param   parents     the chaining values of the parents (count / 2).
+ */
+void CompressParents(Kernel const & kernel,
+                     unsigned char const * cvs,
+                     std::uint64_t count,
+                     std::uint32_t const key[8],
+                     std::uint8_t flags,
+                     unsigned char * parents);
+
+
+}
+
+
+#endif
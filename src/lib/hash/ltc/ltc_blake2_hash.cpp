@@ -0,0 +1,88 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "ltc_blake2_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCBLAKE2Hash::LTCBLAKE2Hash(bool wide, std::uint64_t digest_size) : wide_{wide}, digest_size_{digest_size} {
+    Start();
+}
+
+
+LTCBLAKE2Hash::~LTCBLAKE2Hash() {
+    std::fill(key_.begin(), key_.end(), 0);
+    zeromem(&GetState(), sizeof(hash_state));
+}
+
+
+int LTCBLAKE2Hash::Add_(unsigned char const * block_incoming,
+                        std::uint64_t size_incoming,
+                        unsigned char *,
+                        std::uint64_t & size_outgoing) {
+    size_outgoing = GetDescription().block_size_outgoing_;
+    if (wide_) {
+        return blake2b_process(&GetState(), block_incoming, size_incoming);
+    }
+    return blake2s_process(&GetState(), block_incoming, size_incoming);
+}
+
+
+int LTCBLAKE2Hash::Finalize_(unsigned char * result,
+                             std::uint64_t result_size,
+                             std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (result_size < digest_size_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    if (wide_) {
+        return blake2b_done(&GetState(), result);
+    }
+    return blake2s_done(&GetState(), result);
+}
+
+
+int LTCBLAKE2Hash::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    std::fill(key_.begin(), key_.end(), 0);
+    key_.clear();
+
+    auto iter = initialization_data.find("key");
+    if (iter != initialization_data.end()) {
+        auto [key_data, key_size] = (*iter).second;
+        if (key_size > (wide_ ? 64ul : 32ul)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key of invalid size.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        key_.assign(key_data, key_data + key_size);
+    }
+
+    return Start();
+}
+
+
+int LTCBLAKE2Hash::Reset_() {
+    return Start();
+}
+
+
+int LTCBLAKE2Hash::Start() {
+
+    auto key_data = key_.empty() ? nullptr : key_.data();
+    if (wide_) {
+        return blake2b_init(&GetState(), digest_size_, key_data, key_.size());
+    }
+    return blake2s_init(&GetState(), digest_size_, key_data, key_.size());
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_BLAKE2_HASH_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_LTC_BLAKE2_HASH_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "ltc_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of the libtomcrypt BLAKE2b and BLAKE2s hashes.
+ * An optional "key" given at initialization turns the hash into a MAC (keyed BLAKE2).
+ */
+class LTCBLAKE2Hash : public LTCHash {
+
+    bool const wide_;                           //!< @brief BLAKE2b (else BLAKE2s).
+    std::uint64_t const digest_size_;           //!< @brief Size of the digest.
+    std::vector<unsigned char> key_;            //!< @brief The key (if any).
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   wide            BLAKE2b (64 bit words) or BLAKE2s (32 bit words).
+     * @param   digest_size     size of the digest.
+     */
+    LTCBLAKE2Hash(bool wide, std::uint64_t digest_size);
+
+    /**
+     * @brief   Destructor.
+     */
+    ~LTCBLAKE2Hash() override;
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Sets up the libtomcrypt state with the key (if any).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Start();
+};
+
+
+}
+
+
+#endif
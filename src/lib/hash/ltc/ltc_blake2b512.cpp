@@ -0,0 +1,86 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include <tomcrypt.h>
+
+#include "ltc_blake2b512.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt BLAKE2b-512 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-blake2b-512",                 // name
+            Family::kHash,                     // family
+            "LibTomCrypt BLAKE2b-512.",        // description (short/left and long/below)
+
+            "This is BLAKE2b with a 64 byte digest as defined in RFC 7693. BLAKE2b is faster than SHA-2 in "
+            "software and at least as secure as SHA-3. Pass an optional \"key\" (up to 64 bytes) at "
+            "initialization for keyed hashing (a MAC). See: https://www.blake2.net.",
+
+            std::string{"libtomcrypt v"} + SCRYPT,        // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kEmpty,                  // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            64ul,                                         // result size
+
+            // initial data
+            {{"key", {64ul, PaddingStrategy::PADDING_NONE, "Optional secret key (up to 64 bytes).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCBLAKE2b512Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCBLAKE2b512>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+LTCBLAKE2b512::LTCBLAKE2b512() : LTCBLAKE2Hash{true, 64ul} {
+}
+
+
+Algorithm::Description const & LTCBLAKE2b512::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCBLAKE2b512::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCBLAKE2b512Producer>());
+}
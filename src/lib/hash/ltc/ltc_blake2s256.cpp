@@ -0,0 +1,86 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include <tomcrypt.h>
+
+#include "ltc_blake2s256.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt BLAKE2s-256 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-blake2s-256",                 // name
+            Family::kHash,                     // family
+            "LibTomCrypt BLAKE2s-256.",        // description (short/left and long/below)
+
+            "This is BLAKE2s with a 32 byte digest as defined in RFC 7693. BLAKE2s is faster than SHA-2 in "
+            "software and at least as secure as SHA-3. Pass an optional \"key\" (up to 32 bytes) at "
+            "initialization for keyed hashing (a MAC). See: https://www.blake2.net.",
+
+            std::string{"libtomcrypt v"} + SCRYPT,        // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kEmpty,                  // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            32ul,                                         // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_NONE, "Optional secret key (up to 32 bytes).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCBLAKE2s256Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCBLAKE2s256>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+LTCBLAKE2s256::LTCBLAKE2s256() : LTCBLAKE2Hash{false, 32ul} {
+}
+
+
+Algorithm::Description const & LTCBLAKE2s256::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCBLAKE2s256::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCBLAKE2s256Producer>());
+}
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_BLAKE2S256_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_LTC_BLAKE2S256_HPP
+
+#include "ltc_blake2_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The libtomcrypt BLAKE2s-256 algorithm.
+ */
+class LTCBLAKE2s256 : public LTCBLAKE2Hash {
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    LTCBLAKE2s256();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
@@ -99,6 +99,11 @@ int LTCMD5::Initialize_(std::map<std::string, std::tuple<unsigned char const *,
 }
 
 
+int LTCMD5::Reset_() {
+    return md5_init(&GetState());
+}
+
+
 void LTCMD5::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCMD5Producer>());
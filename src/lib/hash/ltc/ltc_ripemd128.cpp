@@ -99,6 +99,11 @@ int LTCRIPEMD128::Initialize_(std::map<std::string, std::tuple<unsigned char con
 }
 
 
+int LTCRIPEMD128::Reset_() {
+    return rmd128_init(&GetState());
+}
+
+
 void LTCRIPEMD128::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCRIPEMD128Producer>());
@@ -98,6 +98,11 @@ int LTCRIPEMD160::Initialize_(std::map<std::string, std::tuple<unsigned char con
 }
 
 
+int LTCRIPEMD160::Reset_() {
+    return rmd160_init(&GetState());
+}
+
+
 void LTCRIPEMD160::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCRIPEMD160Producer>());
@@ -98,6 +98,11 @@ int LTCRIPEMD256::Initialize_(std::map<std::string, std::tuple<unsigned char con
 }
 
 
+int LTCRIPEMD256::Reset_() {
+    return rmd256_init(&GetState());
+}
+
+
 void LTCRIPEMD256::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCRIPEMD256Producer>());
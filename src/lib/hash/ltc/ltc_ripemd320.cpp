@@ -98,6 +98,11 @@ int LTCRIPEMD320::Initialize_(std::map<std::string, std::tuple<unsigned char con
 }
 
 
+int LTCRIPEMD320::Reset_() {
+    return rmd320_init(&GetState());
+}
+
+
 void LTCRIPEMD320::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCRIPEMD320Producer>());
@@ -98,6 +98,11 @@ int LTCSHA1::Initialize_(std::map<std::string, std::tuple<unsigned char const *,
 }
 
 
+int LTCSHA1::Reset_() {
+    return sha1_init(&GetState());
+}
+
+
 void LTCSHA1::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCSHA1Producer>());
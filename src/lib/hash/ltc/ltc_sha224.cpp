@@ -98,6 +98,11 @@ int LTCSHA224::Initialize_(std::map<std::string, std::tuple<unsigned char const
 }
 
 
+int LTCSHA224::Reset_() {
+    return sha224_init(&GetState());
+}
+
+
 void LTCSHA224::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCSHA224Producer>());
@@ -98,6 +98,11 @@ int LTCSHA256::Initialize_(std::map<std::string, std::tuple<unsigned char const
 }
 
 
+int LTCSHA256::Reset_() {
+    return sha256_init(&GetState());
+}
+
+
 void LTCSHA256::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCSHA256Producer>());
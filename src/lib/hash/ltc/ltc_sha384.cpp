@@ -98,6 +98,11 @@ int LTCSHA384::Initialize_(std::map<std::string, std::tuple<unsigned char const
 }
 
 
+int LTCSHA384::Reset_() {
+    return sha384_init(&GetState());
+}
+
+
 void LTCSHA384::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCSHA384Producer>());
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include <tomcrypt.h>
+
+#include "ltc_sha3_512.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt SHA3-512 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-sha3-512",                 // name
+            Family::kHash,                  // family
+            "LibTomCrypt SHA3-512.",        // description (short/left and long/below)
+
+            "This is the Secure Hash Algorithm 3 variant 512 as defined in FIPS 202. SHA-3 is the Keccak "
+            "sponge, a design entirely different to SHA-2. See: https://en.wikipedia.org/wiki/SHA-3.",
+
+            std::string{"libtomcrypt v"} + SCRYPT,        // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kEmpty,                  // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            64ul,                                         // result size
+            {},                                           // initial data
+            {}                                            // finalization data
+    };
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCSHA3512Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCSHA3512>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+LTCSHA3512::LTCSHA3512() : LTCSHA3Hash{64ul, false} {
+}
+
+
+Algorithm::Description const & LTCSHA3512::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCSHA3512::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCSHA3512Producer>());
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/error.hpp>
+
+#include "ltc_sha3_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCSHA3Hash::LTCSHA3Hash(std::uint64_t digest_size, bool extendable)
+    : digest_size_{digest_size}, extendable_{extendable} {
+    Start();
+}
+
+
+LTCSHA3Hash::~LTCSHA3Hash() {
+    zeromem(&GetState(), sizeof(hash_state));
+}
+
+
+int LTCSHA3Hash::Add_(unsigned char const * block_incoming,
+                      std::uint64_t size_incoming,
+                      unsigned char *,
+                      std::uint64_t & size_outgoing) {
+    size_outgoing = GetDescription().block_size_outgoing_;
+    return sha3_process(&GetState(), block_incoming, size_incoming);
+}
+
+
+int LTCSHA3Hash::Finalize_(unsigned char * result,
+                           std::uint64_t result_size,
+                           std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (extendable_) {
+        if (result_size == 0) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        return sha3_shake_done(&GetState(), result, result_size);
+    }
+
+    if (result_size < digest_size_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    return sha3_done(&GetState(), result);
+}
+
+
+int LTCSHA3Hash::Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    return Start();
+}
+
+
+int LTCSHA3Hash::Reset_() {
+    return Start();
+}
+
+
+int LTCSHA3Hash::Squeeze_(unsigned char * output, std::uint64_t size) {
+
+    if (!extendable_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    if (size == 0) {
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // libtomcrypt keeps squeezing where the last call stopped
+    return sha3_shake_done(&GetState(), output, size);
+}
+
+
+int LTCSHA3Hash::Start() {
+
+    if (extendable_) {
+        return sha3_shake_init(&GetState(), static_cast<int>(digest_size_ * 8));
+    }
+
+    switch (digest_size_) {
+        case 28:
+            return sha3_224_init(&GetState());
+        case 32:
+            return sha3_256_init(&GetState());
+        case 48:
+            return sha3_384_init(&GetState());
+        default:
+            return sha3_512_init(&GetState());
+    }
+}
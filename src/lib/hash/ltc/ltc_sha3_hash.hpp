@@ -0,0 +1,102 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_SHA3_HASH_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_LTC_SHA3_HASH_HPP
+
+#include <cstdint>
+
+#include "ltc_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of the libtomcrypt SHA-3 hashes and SHAKE extendable output functions.
+ * All of them share the Keccak sponge and differ in the capacity only. The SHAKE functions
+ * write as many bytes as asked for at Finalize() and continue the output with Squeeze().
+ */
+class LTCSHA3Hash : public LTCHash {
+
+    std::uint64_t const digest_size_;           //!< @brief Size of the digest (security level for SHAKE).
+    bool const extendable_;                     //!< @brief SHAKE (else SHA-3).
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   digest_size     size of the digest (SHAKE: 16 for SHAKE128, 32 for SHAKE256).
+     * @param   extendable      SHAKE (extendable output) or SHA-3.
+     */
+    LTCSHA3Hash(std::uint64_t digest_size, bool extendable);
+
+    /**
+     * @brief   Destructor.
+     */
+    ~LTCSHA3Hash() override;
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization (SHAKE: any size but 0).
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Squeezes more output after Finalize() (SHAKE only).
+     * @param   output      the memory receiving the next output bytes.
+     * @param   size        number of bytes to squeeze.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Squeeze_(unsigned char * output, std::uint64_t size) override;
+
+    /**
+     * @brief   Sets up the libtomcrypt state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Start();
+};
+
+
+}
+
+
+#endif
@@ -98,6 +98,11 @@ int LTCSHA512::Initialize_(std::map<std::string, std::tuple<unsigned char const
 }
 
 
+int LTCSHA512::Reset_() {
+    return sha512_init(&GetState());
+}
+
+
 void LTCSHA512::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCSHA512Producer>());
@@ -98,6 +98,11 @@ int LTCTIGER192::Initialize_(std::map<std::string, std::tuple<unsigned char cons
 }
 
 
+int LTCTIGER192::Reset_() {
+    return tiger_init(&GetState());
+}
+
+
 void LTCTIGER192::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<LTCTIGER192Producer>());
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/typed.hpp>
+
+#include <tomcrypt.h>
+
+using namespace headcode::crypt;
+
+
+static_assert(sizeof(hash_state) <= detail::LTCHashBackend<Sha256>::kStateSize,
+              "The opaque state of the typed hash is too small for the libtomcrypt hash_state.");
+static_assert(alignof(hash_state) <= 16, "The opaque state of the typed hash is not aligned for hash_state.");
+
+
+namespace {
+
+
+/**
+ * @brief   The libtomcrypt functions of a hash algorithm.
+ */
+template <typename HashAlgorithm>
+struct LTCHashFunctions;
+
+
+#define LTC_HASH_FUNCTIONS(HASH_ALGORITHM, LTC_NAME)                                                                 \
+    template <>                                                                                                       \
+    struct LTCHashFunctions<HASH_ALGORITHM> {                                                                         \
+        static int Init(hash_state * state) {                                                                         \
+            return LTC_NAME##_init(state);                                                                            \
+        }                                                                                                             \
+        static int Process(hash_state * state, unsigned char const * data, unsigned long size) {                      \
+            return LTC_NAME##_process(state, data, size);                                                             \
+        }                                                                                                             \
+        static int Done(hash_state * state, unsigned char * result) {                                                 \
+            return LTC_NAME##_done(state, result);                                                                    \
+        }                                                                                                             \
+    };
+
+LTC_HASH_FUNCTIONS(Md5, md5)
+LTC_HASH_FUNCTIONS(Ripemd128, rmd128)
+LTC_HASH_FUNCTIONS(Ripemd160, rmd160)
+LTC_HASH_FUNCTIONS(Ripemd256, rmd256)
+LTC_HASH_FUNCTIONS(Ripemd320, rmd320)
+LTC_HASH_FUNCTIONS(Sha1, sha1)
+LTC_HASH_FUNCTIONS(Sha224, sha224)
+LTC_HASH_FUNCTIONS(Sha256, sha256)
+LTC_HASH_FUNCTIONS(Sha384, sha384)
+LTC_HASH_FUNCTIONS(Sha512, sha512)
+LTC_HASH_FUNCTIONS(Tiger192, tiger)
+
+#undef LTC_HASH_FUNCTIONS
+
+
+}
+
+
+template <typename HashAlgorithm>
+int detail::LTCHashBackend<HashAlgorithm>::Init(void * state) noexcept {
+    return LTCHashFunctions<HashAlgorithm>::Init(static_cast<hash_state *>(state));
+}
+
+
+template <typename HashAlgorithm>
+int detail::LTCHashBackend<HashAlgorithm>::Process(void * state,
+                                                   unsigned char const * data,
+                                                   std::uint64_t size) noexcept {
+    return LTCHashFunctions<HashAlgorithm>::Process(static_cast<hash_state *>(state), data, size);
+}
+
+
+template <typename HashAlgorithm>
+int detail::LTCHashBackend<HashAlgorithm>::Done(void * state, unsigned char * result) noexcept {
+    return LTCHashFunctions<HashAlgorithm>::Done(static_cast<hash_state *>(state), result);
+}
+
+
+template struct headcode::crypt::detail::LTCHashBackend<Md5>;
+template struct headcode::crypt::detail::LTCHashBackend<Ripemd128>;
+template struct headcode::crypt::detail::LTCHashBackend<Ripemd160>;
+template struct headcode::crypt::detail::LTCHashBackend<Ripemd256>;
+template struct headcode::crypt::detail::LTCHashBackend<Ripemd320>;
+template struct headcode::crypt::detail::LTCHashBackend<Sha1>;
+template struct headcode::crypt::detail::LTCHashBackend<Sha224>;
+template struct headcode::crypt::detail::LTCHashBackend<Sha256>;
+template struct headcode::crypt::detail::LTCHashBackend<Sha384>;
+template struct headcode::crypt::detail::LTCHashBackend<Sha512>;
+template struct headcode::crypt::detail::LTCHashBackend<Tiger192>;
@@ -0,0 +1,36 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/error.hpp>
+
+#include "mb_batch_hasher.hpp"
+
+using namespace headcode::crypt;
+
+
+MBBatchHasher::MBBatchHasher(mb::Function const & function,
+                             Algorithm::Description const & description,
+                             std::uint64_t max_lanes)
+    : function_{function}, engine_{mb::SelectEngine(function, max_lanes)}, description_{description} {
+}
+
+
+Algorithm::Description const & MBBatchHasher::GetDescription_() const {
+    return description_;
+}
+
+
+std::uint64_t MBBatchHasher::GetLanes_() const {
+    return engine_.lanes_;
+}
+
+
+int MBBatchHasher::Hash_(ByteView const * messages, std::uint64_t count, unsigned char * digests) {
+    mb::HashBatch(function_, engine_, description_.block_padding_strategy_, messages, count, digests);
+    return static_cast<int>(Error::kNoError);
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_MB_BATCH_HASHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_MB_BATCH_HASHER_HPP
+
+#include <headcode/crypt/batch_hasher.hpp>
+
+#include "mb_engine.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Hashes batches of messages side by side in the SIMD lanes of the CPU.
+ */
+class MBBatchHasher : public BatchHasher {
+
+    mb::Function const & function_;                   //!< @brief The hash function.
+    mb::Engine engine_;                               //!< @brief The kernel picked for this CPU.
+    Algorithm::Description const & description_;      //!< @brief The description of the hash.
+
+public:
+    /**
+     * @brief   Constructor.
+     * @param   function        the hash function.
+     * @param   description     the description of the hash.
+     * @param   max_lanes       max number of lanes to use (0 for no limit).
+     */
+    MBBatchHasher(mb::Function const & function, Algorithm::Description const & description, std::uint64_t max_lanes);
+
+private:
+    /**
+     * @brief   Gets the description of the hash.
+     * @return  A structure describing the hash.
+     */
+    Algorithm::Description const & GetDescription_() const override;
+
+    /**
+     * @brief   Gets the number of messages hashed side by side.
+     * @return  The number of lanes.
+     */
+    std::uint64_t GetLanes_() const override;
+
+    /**
+     * @brief   Hashes a batch of messages.
+     * @param   messages        the messages.
+     * @param   count           the number of messages.
+     * @param   digests         receives the digests (count * result size bytes).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Hash_(ByteView const * messages, std::uint64_t count, unsigned char * digests) override;
+};
+
+
+}
+
+
+#endif
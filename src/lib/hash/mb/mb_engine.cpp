@@ -0,0 +1,276 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+
+#include "mb_engine.hpp"
+
+using namespace headcode::crypt;
+using namespace headcode::crypt::mb;
+
+
+#ifdef HCS_MB_SIMD
+
+Function const headcode::crypt::mb::kMD5 = {
+        4, false, {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476}, MD5Scalar, MD5SSE41, MD5AVX2};
+
+Function const headcode::crypt::mb::kSHA1 = {
+        5, true, {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0}, SHA1Scalar, SHA1SSE41, SHA1AVX2};
+
+Function const headcode::crypt::mb::kSHA256 = {
+        8,
+        true,
+        {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19},
+        SHA256Scalar,
+        SHA256SSE41,
+        SHA256AVX2};
+
+#else
+
+Function const headcode::crypt::mb::kMD5 = {
+        4, false, {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476}, MD5Scalar, nullptr, nullptr};
+
+Function const headcode::crypt::mb::kSHA1 = {
+        5, true, {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0}, SHA1Scalar, nullptr, nullptr};
+
+Function const headcode::crypt::mb::kSHA256 = {
+        8,
+        true,
+        {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19},
+        SHA256Scalar,
+        nullptr,
+        nullptr};
+
+#endif
+
+
+/**
+ * @brief   Checks if the CPU (and the OS) supports AVX2.
+ * @return  true, if the AVX2 kernels may run.
+ */
+static bool HasAVX2() {
+#ifdef HCS_MB_SIMD
+    static bool const avx2 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return avx2;
+#else
+    return false;
+#endif
+}
+
+
+/**
+ * @brief   Checks if the CPU supports SSE4.1.
+ * @return  true, if the SSE4.1 kernels may run.
+ */
+static bool HasSSE41() {
+#ifdef HCS_MB_SIMD
+    static bool const sse41 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.1") != 0;
+    }();
+    return sse41;
+#else
+    return false;
+#endif
+}
+
+
+namespace {
+
+
+/**
+ * @brief   A message in work in a lane.
+ */
+struct Lane {
+    std::uint64_t message_;                      //!< @brief Index of the message.
+    unsigned char const * data_;                 //!< @brief The message data.
+    std::uint64_t full_blocks_;                  //!< @brief Number of whole blocks in the message data.
+    std::uint64_t blocks_;                       //!< @brief Total number of blocks incl. padding.
+    std::uint64_t next_;                         //!< @brief Index of the next block to process.
+    alignas(16) unsigned char tail_[192];        //!< @brief The padded last block and the final block(s).
+};
+
+
+}
+
+
+/**
+ * @brief   Returns a block of a message in a lane.
+ * @param   lane        the lane.
+ * @param   block       the index of the block.
+ * @return  The block.
+ */
+static unsigned char const * GetBlock(Lane const & lane, std::uint64_t block) {
+    if (block < lane.full_blocks_) {
+        return lane.data_ + block * 64;
+    }
+    return lane.tail_ + (block - lane.full_blocks_) * 64;
+}
+
+
+/**
+ * @brief   Puts a message into a lane.
+ * @param   function        the hash function.
+ * @param   padding         the padding of the last block.
+ * @param   lane            the lane.
+ * @param   message         the message.
+ * @param   index           the index of the message.
+ * @param   state           the state of the lane.
+ * @param   stride          distance of the state words in state (== the number of lanes).
+ */
+static void Start(Function const & function,
+                  PaddingStrategy padding,
+                  Lane & lane,
+                  ByteView message,
+                  std::uint64_t index,
+                  std::uint32_t * state,
+                  unsigned int stride) {
+
+    lane.message_ = index;
+    lane.data_ = message.data();
+    lane.full_blocks_ = message.size() / 64;
+    lane.next_ = 0;
+
+    // the last partial block is padded to a whole block, like Algorithm::Finalize() does
+    auto rest = message.size() % 64;
+    std::memcpy(lane.tail_, lane.data_ + lane.full_blocks_ * 64, rest);
+    if ((rest > 0) && (padding != PaddingStrategy::PADDING_NONE)) {
+        Pad(lane.tail_, 64, rest, 64, padding);
+        auto final_blocks = Finish(function, lane.tail_ + 64, 0, lane.full_blocks_ * 64 + 64);
+        lane.blocks_ = lane.full_blocks_ + 1 + final_blocks;
+    } else {
+        lane.blocks_ = lane.full_blocks_ + Finish(function, lane.tail_, rest, message.size());
+    }
+
+    for (unsigned int i = 0; i < function.words_; ++i) {
+        state[i * stride] = function.initial_[i];
+    }
+}
+
+
+unsigned int headcode::crypt::mb::Finish(Function const & function,
+                                         unsigned char * block,
+                                         std::uint64_t pending,
+                                         std::uint64_t length) {
+
+    auto blocks = (pending < 56) ? 1u : 2u;
+    block[pending] = 0x80;
+    std::memset(block + pending + 1, 0, blocks * 64 - pending - 1);
+
+    auto bits = length * 8;
+    auto length_field = block + blocks * 64 - 8;
+    for (int i = 0; i < 8; ++i) {
+        auto shift = function.big_endian_ ? (56 - 8 * i) : (8 * i);
+        length_field[i] = static_cast<unsigned char>(bits >> shift);
+    }
+
+    return blocks;
+}
+
+
+void headcode::crypt::mb::Encode(Function const & function,
+                                 std::uint32_t const * state,
+                                 unsigned int stride,
+                                 unsigned char * digest) {
+    for (unsigned int i = 0; i < function.words_; ++i, digest += 4) {
+        auto word = state[i * stride];
+        for (int j = 0; j < 4; ++j) {
+            auto shift = function.big_endian_ ? (24 - 8 * j) : (8 * j);
+            digest[j] = static_cast<unsigned char>(word >> shift);
+        }
+    }
+}
+
+
+void headcode::crypt::mb::HashBatch(Function const & function,
+                                    Engine const & engine,
+                                    PaddingStrategy padding,
+                                    ByteView const * messages,
+                                    std::uint64_t count,
+                                    unsigned char * digests) {
+
+    // Each lane works on a message of its own. A lane done with its message picks
+    // up the next one. Idle lanes crunch on a dummy block until all lanes are idle.
+    // The very last message is finished on the scalar kernel.
+
+    static unsigned char const kIdleBlock[64] = {};
+
+    auto lanes = engine.lanes_;
+    auto digest_size = function.words_ * 4ul;
+
+    Lane lane[kMaxLanes];
+    bool active[kMaxLanes] = {};
+    alignas(32) std::uint32_t state[8 * kMaxLanes];
+    unsigned char const * blocks[kMaxLanes];
+
+    std::uint64_t next_message = 0;
+    unsigned int active_lanes = 0;
+    for (unsigned int l = 0; (l < lanes) && (next_message < count); ++l) {
+        Start(function, padding, lane[l], messages[next_message], next_message, state + l, lanes);
+        ++next_message;
+        active[l] = true;
+        ++active_lanes;
+    }
+
+    while (active_lanes > 0) {
+
+        if ((active_lanes == 1) && (next_message == count) && (lanes > 1)) {
+            unsigned int l = 0;
+            while (!active[l]) {
+                ++l;
+            }
+            std::uint32_t single_state[8];
+            for (unsigned int i = 0; i < function.words_; ++i) {
+                single_state[i] = state[i * lanes + l];
+            }
+            for (; lane[l].next_ < lane[l].blocks_; ++lane[l].next_) {
+                auto block = GetBlock(lane[l], lane[l].next_);
+                function.scalar_(single_state, &block);
+            }
+            Encode(function, single_state, 1, digests + lane[l].message_ * digest_size);
+            break;
+        }
+
+        for (unsigned int l = 0; l < lanes; ++l) {
+            blocks[l] = active[l] ? GetBlock(lane[l], lane[l].next_) : kIdleBlock;
+        }
+        engine.kernel_(state, blocks);
+
+        for (unsigned int l = 0; l < lanes; ++l) {
+            if (!active[l] || (++lane[l].next_ < lane[l].blocks_)) {
+                continue;
+            }
+            Encode(function, state + l, lanes, digests + lane[l].message_ * digest_size);
+            if (next_message < count) {
+                Start(function, padding, lane[l], messages[next_message], next_message, state + l, lanes);
+                ++next_message;
+            } else {
+                active[l] = false;
+                --active_lanes;
+            }
+        }
+    }
+}
+
+
+Engine headcode::crypt::mb::SelectEngine(Function const & function, std::uint64_t max_lanes) {
+
+    if (max_lanes == 0) {
+        max_lanes = kMaxLanes;
+    }
+    if ((max_lanes >= 8) && (function.avx2_ != nullptr) && HasAVX2()) {
+        return Engine{8, function.avx2_};
+    }
+    if ((max_lanes >= 4) && (function.sse41_ != nullptr) && HasSSE41()) {
+        return Engine{4, function.sse41_};
+    }
+    return Engine{1, function.scalar_};
+}
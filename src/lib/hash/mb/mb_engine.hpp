@@ -0,0 +1,101 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_MB_ENGINE_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_MB_ENGINE_HPP
+
+#include <cstdint>
+
+#include <headcode/crypt/byte_view.hpp>
+#include <headcode/crypt/padding.hpp>
+
+#include "mb_kernel.hpp"
+
+
+namespace headcode::crypt::mb {
+
+
+/**
+ * @brief   A hash function of the multi-buffer engine (a Merkle-Damgard hash on 64 byte blocks).
+ */
+struct Function {
+    unsigned int words_;               //!< @brief Number of 32 bit state words.
+    bool big_endian_;                  //!< @brief Byte order of the message words, the length and the digest.
+    std::uint32_t initial_[8];         //!< @brief The initial state.
+    Kernel scalar_;                    //!< @brief The single lane kernel.
+    Kernel sse41_;                     //!< @brief The 4 lane kernel (or nullptr).
+    Kernel avx2_;                      //!< @brief The 8 lane kernel (or nullptr).
+};
+
+
+extern Function const kMD5;             //!< @brief MD5.
+extern Function const kSHA1;            //!< @brief SHA-1.
+extern Function const kSHA256;          //!< @brief SHA-256.
+
+
+/**
+ * @brief   A kernel picked for the current CPU.
+ */
+struct Engine {
+    unsigned int lanes_;        //!< @brief Number of lanes of the kernel.
+    Kernel kernel_;             //!< @brief The kernel.
+};
+
+
+/**
+ * @brief   Writes the final block(s) of a message: the 0x80 byte, zeros and the length in bits.
+ * @param   function        the hash function.
+ * @param   block           128 bytes of memory holding the pending message bytes at the start.
+ * @param   pending         number of pending message bytes in block (below 64).
+ * @param   length          total length of the message in bytes.
+ * @return  The number of final blocks (1 or 2).
+ */
+unsigned int Finish(Function const & function, unsigned char * block, std::uint64_t pending, std::uint64_t length);
+
+
+/**
+ * @brief   Writes the digest of an (interleaved) state.
+ * @param   function        the hash function.
+ * @param   state           the state of the lane.
+ * @param   stride          distance of the state words in state (== the number of lanes).
+ * @param   digest          receives the digest (4 bytes per state word).
+ */
+void Encode(Function const & function, std::uint32_t const * state, unsigned int stride, unsigned char * digest);
+
+
+/**
+ * @brief   Hashes a batch of messages.
+ * The last block of each message is padded first, like Algorithm::Finalize() does.
+ * @param   function        the hash function.
+ * @param   engine          the kernel used.
+ * @param   padding         the padding of the last block of the messages.
+ * @param   messages        the messages.
+ * @param   count           the number of messages.
+ * @param   digests         receives the digests.
+ */
+void HashBatch(Function const & function,
+               Engine const & engine,
+               PaddingStrategy padding,
+               ByteView const * messages,
+               std::uint64_t count,
+               unsigned char * digests);
+
+
+/**
+ * @brief   Picks the kernel with the most lanes supported by the CPU.
+ * @param   function        the hash function.
+ * @param   max_lanes       max number of lanes (0 for no limit).
+ * @return  The engine for the hash function.
+ */
+Engine SelectEngine(Function const & function, std::uint64_t max_lanes);
+
+
+}
+
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <headcode/crypt/error.hpp>
+
+#include "mb_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+MBHash::MBHash(mb::Function const & function) : function_{function} {
+    Start();
+}
+
+
+int MBHash::Add_(unsigned char const * block_incoming,
+                 std::uint64_t size_incoming,
+                 unsigned char *,
+                 std::uint64_t & size_outgoing) {
+
+    size_outgoing = GetDescription().block_size_outgoing_;
+    length_ += size_incoming;
+
+    if (buffer_size_ > 0) {
+        auto fill = std::min<std::uint64_t>(64 - buffer_size_, size_incoming);
+        std::memcpy(buffer_ + buffer_size_, block_incoming, fill);
+        buffer_size_ += fill;
+        block_incoming += fill;
+        size_incoming -= fill;
+        if (buffer_size_ < 64) {
+            return 0;
+        }
+        unsigned char const * block = buffer_;
+        function_.scalar_(state_, &block);
+        buffer_size_ = 0;
+    }
+
+    for (; size_incoming >= 64; size_incoming -= 64, block_incoming += 64) {
+        function_.scalar_(state_, &block_incoming);
+    }
+
+    std::memcpy(buffer_, block_incoming, size_incoming);
+    buffer_size_ = size_incoming;
+
+    return 0;
+}
+
+
+int MBHash::Finalize_(unsigned char * result,
+                      std::uint64_t result_size,
+                      std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (result_size < function_.words_ * 4ul) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    unsigned char final_blocks[128];
+    std::memcpy(final_blocks, buffer_, buffer_size_);
+    auto blocks = mb::Finish(function_, final_blocks, buffer_size_, length_);
+    for (unsigned int i = 0; i < blocks; ++i) {
+        unsigned char const * block = final_blocks + i * 64;
+        function_.scalar_(state_, &block);
+    }
+    mb::Encode(function_, state_, 1, result);
+
+    return 0;
+}
+
+
+int MBHash::Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    Start();
+    return 0;
+}
+
+
+int MBHash::Reset_() {
+    Start();
+    return 0;
+}
+
+
+void MBHash::Start() {
+    std::memcpy(state_, function_.initial_, sizeof(state_));
+    buffer_size_ = 0;
+    length_ = 0;
+}
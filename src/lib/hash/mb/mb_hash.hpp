@@ -0,0 +1,92 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_MB_HASH_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_MB_HASH_HPP
+
+#include <cstdint>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "mb_engine.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all multi-buffer hash algorithms.
+ * A single instance hashes a single message on the scalar kernel. Batches of messages
+ * are hashed side by side via the batch hasher of the algorithm (see MBBatchHasher).
+ */
+class MBHash : public Algorithm {
+
+    mb::Function const & function_;          //!< @brief The hash function.
+    std::uint32_t state_[8];                 //!< @brief The current state.
+    unsigned char buffer_[64];               //!< @brief Pending bytes not yet forming a whole block.
+    std::uint64_t buffer_size_ = 0;          //!< @brief Number of pending bytes.
+    std::uint64_t length_ = 0;               //!< @brief Total number of bytes added.
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   function        the hash function.
+     */
+    explicit MBHash(mb::Function const & function);
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Sets the initial state.
+     */
+    void Start();
+};
+
+
+}
+
+
+#endif
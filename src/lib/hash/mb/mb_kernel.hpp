@@ -0,0 +1,58 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_MB_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_MB_KERNEL_HPP
+
+#include <cstdint>
+
+// This header is included by the kernel translation units which are compiled with
+// special instruction set flags (e.g. -mavx2). Keep it free of anything which emits
+// inline code, like the standard containers: the linker might pick the AVX2 flavour
+// of such code for the whole program.
+
+
+namespace headcode::crypt::mb {
+
+
+/**
+ * @brief   Max number of lanes (messages processed at once) of all kernels.
+ */
+constexpr unsigned int kMaxLanes = 8;
+
+
+/**
+ * @brief   A compression kernel. This processes a single 64 byte block for each lane.
+ * The state is interleaved: word i of lane l is at state[i * lanes + l].
+ * @param   state       the interleaved state of all lanes.
+ * @param   blocks      the block to process for each lane.
+ */
+using Kernel = void (*)(std::uint32_t * state, unsigned char const * const * blocks);
+
+
+void MD5Scalar(std::uint32_t * state, unsigned char const * const * blocks);
+void SHA1Scalar(std::uint32_t * state, unsigned char const * const * blocks);
+void SHA256Scalar(std::uint32_t * state, unsigned char const * const * blocks);
+
+#ifdef HCS_MB_SIMD
+
+void MD5SSE41(std::uint32_t * state, unsigned char const * const * blocks);
+void SHA1SSE41(std::uint32_t * state, unsigned char const * const * blocks);
+void SHA256SSE41(std::uint32_t * state, unsigned char const * const * blocks);
+
+void MD5AVX2(std::uint32_t * state, unsigned char const * const * blocks);
+void SHA1AVX2(std::uint32_t * state, unsigned char const * const * blocks);
+void SHA256AVX2(std::uint32_t * state, unsigned char const * const * blocks);
+
+#endif
+
+
+}
+
+
+#endif
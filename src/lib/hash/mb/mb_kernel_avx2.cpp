@@ -0,0 +1,167 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -mavx2. It is only called after
+// a runtime check of the CPU (see mb_engine.cpp).
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "mb_kernel.hpp"
+
+
+namespace {
+
+
+// 8 lanes: one 32 bit word of each lane in an AVX2 register.
+
+using V = __m256i;
+
+constexpr int kLanes = 8;
+
+inline V Add(V a, V b) {
+    return _mm256_add_epi32(a, b);
+}
+
+inline V And(V a, V b) {
+    return _mm256_and_si256(a, b);
+}
+
+inline V AndNot(V a, V b) {
+    return _mm256_andnot_si256(a, b);
+}
+
+inline V Not(V a) {
+    return _mm256_xor_si256(a, _mm256_set1_epi32(-1));
+}
+
+inline V Or(V a, V b) {
+    return _mm256_or_si256(a, b);
+}
+
+inline V Rotl(V a, int n) {
+    return _mm256_or_si256(_mm256_sll_epi32(a, _mm_cvtsi32_si128(n)),
+                           _mm256_srl_epi32(a, _mm_cvtsi32_si128(32 - n)));
+}
+
+inline V Set1(std::uint32_t a) {
+    return _mm256_set1_epi32(static_cast<int>(a));
+}
+
+inline V Shr(V a, int n) {
+    return _mm256_srl_epi32(a, _mm_cvtsi32_si128(n));
+}
+
+inline V Xor(V a, V b) {
+    return _mm256_xor_si256(a, b);
+}
+
+
+/**
+ * @brief   Transposes 8 rows of 8 words each.
+ * @param   r       the rows; row i receives the words i of all rows afterwards.
+ */
+inline void Transpose(V * r) {
+    V t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    V t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    V t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    V t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    V t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    V t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    V t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    V t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+    V u0 = _mm256_unpacklo_epi64(t0, t2);
+    V u1 = _mm256_unpackhi_epi64(t0, t2);
+    V u2 = _mm256_unpacklo_epi64(t1, t3);
+    V u3 = _mm256_unpackhi_epi64(t1, t3);
+    V u4 = _mm256_unpacklo_epi64(t4, t6);
+    V u5 = _mm256_unpackhi_epi64(t4, t6);
+    V u6 = _mm256_unpacklo_epi64(t5, t7);
+    V u7 = _mm256_unpackhi_epi64(t5, t7);
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+
+/**
+ * @brief   Loads the blocks of all lanes as 16 words each, interleaved.
+ * Each 8x8 word tile of the blocks is transposed.
+ * @param   blocks          the blocks of the lanes.
+ * @param   w               receives the words.
+ * @param   big_endian      if true, the words are big endian.
+ */
+inline void Load(unsigned char const * const * blocks, V * w, bool big_endian) {
+
+    V const swap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    for (int i = 0; i < 16; i += 8) {
+        for (int lane = 0; lane < kLanes; ++lane) {
+            w[i + lane] = _mm256_loadu_si256(reinterpret_cast<V const *>(blocks[lane] + i * 4));
+        }
+        Transpose(w + i);
+    }
+
+    if (big_endian) {
+        for (int i = 0; i < 16; ++i) {
+            w[i] = _mm256_shuffle_epi8(w[i], swap);
+        }
+    }
+}
+
+
+/**
+ * @brief   Runs the rounds of a hash on the interleaved state.
+ * @param   state           the interleaved state.
+ * @param   blocks          the blocks of the lanes.
+ * @param   words           number of state words.
+ * @param   big_endian      if true, the message words are big endian.
+ * @param   rounds          the rounds of the hash.
+ */
+template <typename Rounds>
+inline void Compress(
+        std::uint32_t * state, unsigned char const * const * blocks, int words, bool big_endian, Rounds rounds) {
+    V s[8];
+    for (int i = 0; i < words; ++i) {
+        s[i] = _mm256_loadu_si256(reinterpret_cast<V const *>(state + i * kLanes));
+    }
+    V w[16];
+    Load(blocks, w, big_endian);
+    rounds(s, w);
+    for (int i = 0; i < words; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<V *>(state + i * kLanes), s[i]);
+    }
+}
+
+
+}
+
+
+#include "mb_rounds.hpp"
+
+
+void headcode::crypt::mb::MD5AVX2(std::uint32_t * state, unsigned char const * const * blocks) {
+    Compress(state, blocks, 4, false, [](V * s, V * w) { MD5Rounds(s, w); });
+}
+
+
+void headcode::crypt::mb::SHA1AVX2(std::uint32_t * state, unsigned char const * const * blocks) {
+    Compress(state, blocks, 5, true, [](V * s, V * w) { SHA1Rounds(s, w); });
+}
+
+
+void headcode::crypt::mb::SHA256AVX2(std::uint32_t * state, unsigned char const * const * blocks) {
+    Compress(state, blocks, 8, true, [](V * s, V * w) { SHA256Rounds(s, w); });
+}
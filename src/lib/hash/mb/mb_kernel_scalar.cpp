@@ -0,0 +1,108 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstdint>
+
+#include "mb_kernel.hpp"
+
+
+namespace {
+
+
+// A single lane: the "vector" is a plain 32 bit word.
+
+using V = std::uint32_t;
+
+inline V Add(V a, V b) {
+    return a + b;
+}
+
+inline V And(V a, V b) {
+    return a & b;
+}
+
+inline V AndNot(V a, V b) {
+    return ~a & b;
+}
+
+inline V Not(V a) {
+    return ~a;
+}
+
+inline V Or(V a, V b) {
+    return a | b;
+}
+
+inline V Rotl(V a, int n) {
+    return (a << n) | (a >> (32 - n));
+}
+
+inline V Set1(std::uint32_t a) {
+    return a;
+}
+
+inline V Shr(V a, int n) {
+    return a >> n;
+}
+
+inline V Xor(V a, V b) {
+    return a ^ b;
+}
+
+
+/**
+ * @brief   Loads a block as 16 big endian words.
+ * @param   block       the block.
+ * @param   w           receives the words.
+ */
+inline void LoadBigEndian(unsigned char const * block, V * w) {
+    for (int i = 0; i < 16; ++i, block += 4) {
+        w[i] = (static_cast<V>(block[0]) << 24) | (static_cast<V>(block[1]) << 16) |
+               (static_cast<V>(block[2]) << 8) | static_cast<V>(block[3]);
+    }
+}
+
+
+/**
+ * @brief   Loads a block as 16 little endian words.
+ * @param   block       the block.
+ * @param   w           receives the words.
+ */
+inline void LoadLittleEndian(unsigned char const * block, V * w) {
+    for (int i = 0; i < 16; ++i, block += 4) {
+        w[i] = (static_cast<V>(block[3]) << 24) | (static_cast<V>(block[2]) << 16) |
+               (static_cast<V>(block[1]) << 8) | static_cast<V>(block[0]);
+    }
+}
+
+
+}
+
+
+#include "mb_rounds.hpp"
+
+
+void headcode::crypt::mb::MD5Scalar(std::uint32_t * state, unsigned char const * const * blocks) {
+    V w[16];
+    LoadLittleEndian(blocks[0], w);
+    MD5Rounds(state, w);
+}
+
+
+void headcode::crypt::mb::SHA1Scalar(std::uint32_t * state, unsigned char const * const * blocks) {
+    V w[16];
+    LoadBigEndian(blocks[0], w);
+    SHA1Rounds(state, w);
+}
+
+
+void headcode::crypt::mb::SHA256Scalar(std::uint32_t * state, unsigned char const * const * blocks) {
+    V w[16];
+    LoadBigEndian(blocks[0], w);
+    SHA256Rounds(state, w);
+}
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -msse4.1. It is only called after
+// a runtime check of the CPU (see mb_engine.cpp).
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "mb_kernel.hpp"
+
+
+namespace {
+
+
+// 4 lanes: one 32 bit word of each lane in a SSE register.
+
+using V = __m128i;
+
+constexpr int kLanes = 4;
+
+inline V Add(V a, V b) {
+    return _mm_add_epi32(a, b);
+}
+
+inline V And(V a, V b) {
+    return _mm_and_si128(a, b);
+}
+
+inline V AndNot(V a, V b) {
+    return _mm_andnot_si128(a, b);
+}
+
+inline V Not(V a) {
+    return _mm_xor_si128(a, _mm_set1_epi32(-1));
+}
+
+inline V Or(V a, V b) {
+    return _mm_or_si128(a, b);
+}
+
+inline V Rotl(V a, int n) {
+    return _mm_or_si128(_mm_sll_epi32(a, _mm_cvtsi32_si128(n)), _mm_srl_epi32(a, _mm_cvtsi32_si128(32 - n)));
+}
+
+inline V Set1(std::uint32_t a) {
+    return _mm_set1_epi32(static_cast<int>(a));
+}
+
+inline V Shr(V a, int n) {
+    return _mm_srl_epi32(a, _mm_cvtsi32_si128(n));
+}
+
+inline V Xor(V a, V b) {
+    return _mm_xor_si128(a, b);
+}
+
+
+/**
+ * @brief   Loads the blocks of all lanes as 16 words each, interleaved.
+ * Each 4x4 word tile of the blocks is transposed.
+ * @param   blocks          the blocks of the lanes.
+ * @param   w               receives the words.
+ * @param   big_endian      if true, the words are big endian.
+ */
+inline void Load(unsigned char const * const * blocks, V * w, bool big_endian) {
+
+    V const swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    for (int i = 0; i < 16; i += 4) {
+        V r0 = _mm_loadu_si128(reinterpret_cast<V const *>(blocks[0] + i * 4));
+        V r1 = _mm_loadu_si128(reinterpret_cast<V const *>(blocks[1] + i * 4));
+        V r2 = _mm_loadu_si128(reinterpret_cast<V const *>(blocks[2] + i * 4));
+        V r3 = _mm_loadu_si128(reinterpret_cast<V const *>(blocks[3] + i * 4));
+        V t0 = _mm_unpacklo_epi32(r0, r1);
+        V t1 = _mm_unpackhi_epi32(r0, r1);
+        V t2 = _mm_unpacklo_epi32(r2, r3);
+        V t3 = _mm_unpackhi_epi32(r2, r3);
+        w[i + 0] = _mm_unpacklo_epi64(t0, t2);
+        w[i + 1] = _mm_unpackhi_epi64(t0, t2);
+        w[i + 2] = _mm_unpacklo_epi64(t1, t3);
+        w[i + 3] = _mm_unpackhi_epi64(t1, t3);
+    }
+
+    if (big_endian) {
+        for (int i = 0; i < 16; ++i) {
+            w[i] = _mm_shuffle_epi8(w[i], swap);
+        }
+    }
+}
+
+
+/**
+ * @brief   Runs the rounds of a hash on the interleaved state.
+ * @param   state           the interleaved state.
+ * @param   blocks          the blocks of the lanes.
+ * @param   words           number of state words.
+ * @param   big_endian      if true, the message words are big endian.
+ * @param   rounds          the rounds of the hash.
+ */
+template <typename Rounds>
+inline void Compress(
+        std::uint32_t * state, unsigned char const * const * blocks, int words, bool big_endian, Rounds rounds) {
+    V s[8];
+    for (int i = 0; i < words; ++i) {
+        s[i] = _mm_loadu_si128(reinterpret_cast<V const *>(state + i * kLanes));
+    }
+    V w[16];
+    Load(blocks, w, big_endian);
+    rounds(s, w);
+    for (int i = 0; i < words; ++i) {
+        _mm_storeu_si128(reinterpret_cast<V *>(state + i * kLanes), s[i]);
+    }
+}
+
+
+}
+
+
+#include "mb_rounds.hpp"
+
+
+void headcode::crypt::mb::MD5SSE41(std::uint32_t * state, unsigned char const * const * blocks) {
+    Compress(state, blocks, 4, false, [](V * s, V * w) { MD5Rounds(s, w); });
+}
+
+
+void headcode::crypt::mb::SHA1SSE41(std::uint32_t * state, unsigned char const * const * blocks) {
+    Compress(state, blocks, 5, true, [](V * s, V * w) { SHA1Rounds(s, w); });
+}
+
+
+void headcode::crypt::mb::SHA256SSE41(std::uint32_t * state, unsigned char const * const * blocks) {
+    Compress(state, blocks, 8, true, [](V * s, V * w) { SHA256Rounds(s, w); });
+}
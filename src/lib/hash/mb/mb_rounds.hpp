@@ -0,0 +1,210 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_MB_ROUNDS_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_MB_ROUNDS_HPP
+
+#include <cstdint>
+
+// The rounds of MD5, SHA-1 and SHA-256 written once for any "vector" type V, holding one
+// 32 bit word of each lane. A kernel translation unit defines V and these operations on it
+// before including this header:
+//
+//      V Add(V, V), V And(V, V), V AndNot(V a, V b) [== ~a & b], V Or(V, V), V Xor(V, V),
+//      V Not(V), V Rotl(V, int), V Shr(V, int), V Set1(std::uint32_t)
+//
+// Everything in here has internal linkage: each kernel translation unit gets its own copy.
+
+
+namespace {
+
+
+/**
+ * @brief   The MD5 round constants.
+ */
+constexpr std::uint32_t kMD5K[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+
+/**
+ * @brief   The MD5 rotations per round.
+ */
+constexpr int kMD5R[64] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 5, 9,  14, 20, 5, 9,
+                           14, 20, 5, 9,  14, 20, 5, 9,  14, 20, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+                           4,  11, 16, 23, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+
+
+/**
+ * @brief   The SHA-256 round constants.
+ */
+constexpr std::uint32_t kSHA256K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+
+/**
+ * @brief   Runs the 64 MD5 rounds on a block and adds the outcome to the state.
+ * @param   s       the state (4 words).
+ * @param   w       the message block (16 little endian words).
+ */
+template <typename V>
+inline void MD5Rounds(V * s, V const * w) {
+
+    V a = s[0];
+    V b = s[1];
+    V c = s[2];
+    V d = s[3];
+
+    for (int i = 0; i < 64; ++i) {
+        V f;
+        int g;
+        if (i < 16) {
+            f = Or(And(b, c), AndNot(b, d));
+            g = i;
+        } else if (i < 32) {
+            f = Or(And(d, b), AndNot(d, c));
+            g = (5 * i + 1) % 16;
+        } else if (i < 48) {
+            f = Xor(Xor(b, c), d);
+            g = (3 * i + 5) % 16;
+        } else {
+            f = Xor(c, Or(b, Not(d)));
+            g = (7 * i) % 16;
+        }
+        f = Add(Add(f, a), Add(Set1(kMD5K[i]), w[g]));
+        a = d;
+        d = c;
+        c = b;
+        b = Add(b, Rotl(f, kMD5R[i]));
+    }
+
+    s[0] = Add(s[0], a);
+    s[1] = Add(s[1], b);
+    s[2] = Add(s[2], c);
+    s[3] = Add(s[3], d);
+}
+
+
+/**
+ * @brief   Runs the 80 SHA-1 rounds on a block and adds the outcome to the state.
+ * @param   s       the state (5 words).
+ * @param   w       the message block (16 big endian words), used as message schedule.
+ */
+template <typename V>
+inline void SHA1Rounds(V * s, V * w) {
+
+    V a = s[0];
+    V b = s[1];
+    V c = s[2];
+    V d = s[3];
+    V e = s[4];
+
+    for (int i = 0; i < 80; ++i) {
+        if (i >= 16) {
+            w[i & 15] = Rotl(Xor(Xor(w[(i - 3) & 15], w[(i - 8) & 15]), Xor(w[(i - 14) & 15], w[i & 15])), 1);
+        }
+        V f;
+        std::uint32_t k;
+        if (i < 20) {
+            f = Or(And(b, c), AndNot(b, d));
+            k = 0x5a827999;
+        } else if (i < 40) {
+            f = Xor(Xor(b, c), d);
+            k = 0x6ed9eba1;
+        } else if (i < 60) {
+            f = Or(And(b, c), And(d, Or(b, c)));
+            k = 0x8f1bbcdc;
+        } else {
+            f = Xor(Xor(b, c), d);
+            k = 0xca62c1d6;
+        }
+        V t = Add(Add(Rotl(a, 5), f), Add(Add(e, Set1(k)), w[i & 15]));
+        e = d;
+        d = c;
+        c = Rotl(b, 30);
+        b = a;
+        a = t;
+    }
+
+    s[0] = Add(s[0], a);
+    s[1] = Add(s[1], b);
+    s[2] = Add(s[2], c);
+    s[3] = Add(s[3], d);
+    s[4] = Add(s[4], e);
+}
+
+
+/**
+ * @brief   Runs the 64 SHA-256 rounds on a block and adds the outcome to the state.
+ * @param   s       the state (8 words).
+ * @param   w       the message block (16 big endian words), used as message schedule.
+ */
+template <typename V>
+inline void SHA256Rounds(V * s, V * w) {
+
+    V a = s[0];
+    V b = s[1];
+    V c = s[2];
+    V d = s[3];
+    V e = s[4];
+    V f = s[5];
+    V g = s[6];
+    V h = s[7];
+
+    for (int i = 0; i < 64; ++i) {
+        if (i >= 16) {
+            V w15 = w[(i - 15) & 15];
+            V w2 = w[(i - 2) & 15];
+            V s0 = Xor(Xor(Rotl(w15, 25), Rotl(w15, 14)), Shr(w15, 3));
+            V s1 = Xor(Xor(Rotl(w2, 15), Rotl(w2, 13)), Shr(w2, 10));
+            w[i & 15] = Add(Add(w[i & 15], s0), Add(w[(i - 7) & 15], s1));
+        }
+        V sigma1 = Xor(Xor(Rotl(e, 26), Rotl(e, 21)), Rotl(e, 7));
+        V ch = Xor(And(e, f), AndNot(e, g));
+        V t1 = Add(Add(h, sigma1), Add(ch, Add(Set1(kSHA256K[i]), w[i & 15])));
+        V sigma0 = Xor(Xor(Rotl(a, 30), Rotl(a, 19)), Rotl(a, 10));
+        V maj = Or(And(a, b), And(c, Or(a, b)));
+        V t2 = Add(sigma0, maj);
+        h = g;
+        g = f;
+        f = e;
+        e = Add(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = Add(t1, t2);
+    }
+
+    s[0] = Add(s[0], a);
+    s[1] = Add(s[1], b);
+    s[2] = Add(s[2], c);
+    s[3] = Add(s[3], d);
+    s[4] = Add(s[4], e);
+    s[5] = Add(s[5], f);
+    s[6] = Add(s[6], g);
+    s[7] = Add(s[7], h);
+}
+
+
+}
+
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "mb_batch_hasher.hpp"
+#include "mb_sha256.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The multi-buffer SHA256 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-mb-sha256",               // name
+            Family::kHash,                 // family
+            "Multi-buffer SHA256.",        // description (short/left and long/below)
+
+            "This is the Secure Hash Algorithm 2 variant 256 as defined by the NSA, hashing batches of messages "
+            "side by side in the SIMD lanes of the CPU (see Factory::CreateBatchHasher). "
+            "See: https://en.wikipedia.org/wiki/SHA-2.",
+
+            std::string{"hcs-crypt v"} + VERSION,        // provider
+            64ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                 // output block size behaviour
+            0ul,                                         // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,           // default padding strategy
+            32ul,                                        // result size
+            {},                                          // initial data
+            {}                                           // finalization data
+    };
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class MBSHA256Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<MBSHA256>();
+    }
+
+    /**
+     * @brief   Creates a batch hasher hashing messages side by side.
+     * @param   max_lanes       max number of messages hashed side by side (0 for the best available).
+     * @return  A new batch hasher.
+     */
+    std::unique_ptr<BatchHasher> CreateBatchHasher(std::uint64_t max_lanes) const override {
+        return std::make_unique<MBBatchHasher>(mb::kSHA256, ::GetDescription(), max_lanes);
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+MBSHA256::MBSHA256() : MBHash{mb::kSHA256} {
+}
+
+
+Algorithm::Description const & MBSHA256::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void MBSHA256::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<MBSHA256Producer>());
+}
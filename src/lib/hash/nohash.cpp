@@ -90,6 +90,11 @@ int NoHash::Initialize_(std::map<std::string, std::tuple<unsigned char const *,
 }
 
 
+int NoHash::Reset_() {
+    return 0;
+}
+
+
 void NoHash::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<NoHashProducer>());
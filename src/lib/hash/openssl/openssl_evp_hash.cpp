@@ -0,0 +1,47 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "openssl_evp_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+OpenSSLEVPHash::OpenSSLEVPHash(EVP_MD const * md) : md_{md}, ctx_{EVP_MD_CTX_new()} {
+    EVP_DigestInit_ex(ctx_, md_, nullptr);
+}
+
+
+OpenSSLEVPHash::~OpenSSLEVPHash() noexcept {
+    EVP_MD_CTX_free(ctx_);
+}
+
+
+int OpenSSLEVPHash::Add_(unsigned char const * block_incoming,
+                         std::uint64_t size_incoming,
+                         unsigned char *,
+                         std::uint64_t & size_outgoing) {
+    size_outgoing = GetDescription().block_size_outgoing_;
+    return EVP_DigestUpdate(ctx_, block_incoming, size_incoming) == 1 ? 0 : 1;
+}
+
+
+int OpenSSLEVPHash::Finalize_(unsigned char * result,
+                              std::uint64_t,
+                              std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    return EVP_DigestFinal_ex(ctx_, result, nullptr) == 1 ? 0 : 1;
+}
+
+
+int OpenSSLEVPHash::Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    return EVP_DigestInit_ex(ctx_, md_, nullptr) == 1 ? 0 : 1;
+}
+
+
+int OpenSSLEVPHash::Reset_() {
+    return EVP_DigestInit_ex(ctx_, md_, nullptr) == 1 ? 0 : 1;
+}
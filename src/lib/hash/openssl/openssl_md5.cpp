@@ -99,6 +99,11 @@ int OpenSSLMD5::Initialize_(std::map<std::string, std::tuple<unsigned char const
 }
 
 
+int OpenSSLMD5::Reset_() {
+    return MD5_Init(&md5_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLMD5::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLMD5Producer>());
@@ -98,6 +98,11 @@ int OpenSSLRIPEMD160::Initialize_(std::map<std::string, std::tuple<unsigned char
 }
 
 
+int OpenSSLRIPEMD160::Reset_() {
+    return RIPEMD160_Init(&ripemd160_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLRIPEMD160::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLRIPEMD160Producer>());
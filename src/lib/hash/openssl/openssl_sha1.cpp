@@ -99,6 +99,11 @@ int OpenSSLSHA1::Initialize_(std::map<std::string, std::tuple<unsigned char cons
 }
 
 
+int OpenSSLSHA1::Reset_() {
+    return SHA1_Init(&sha_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLSHA1::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLSHA1Producer>());
@@ -99,6 +99,11 @@ int OpenSSLSHA224::Initialize_(std::map<std::string, std::tuple<unsigned char co
 }
 
 
+int OpenSSLSHA224::Reset_() {
+    return SHA224_Init(&sha_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLSHA224::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLSHA224Producer>());
@@ -99,6 +99,11 @@ int OpenSSLSHA256::Initialize_(std::map<std::string, std::tuple<unsigned char co
 }
 
 
+int OpenSSLSHA256::Reset_() {
+    return SHA256_Init(&sha_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLSHA256::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLSHA256Producer>());
@@ -99,6 +99,11 @@ int OpenSSLSHA384::Initialize_(std::map<std::string, std::tuple<unsigned char co
 }
 
 
+int OpenSSLSHA384::Reset_() {
+    return SHA384_Init(&sha_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLSHA384::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLSHA384Producer>());
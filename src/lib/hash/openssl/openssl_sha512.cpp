@@ -99,6 +99,11 @@ int OpenSSLSHA512::Initialize_(std::map<std::string, std::tuple<unsigned char co
 }
 
 
+int OpenSSLSHA512::Reset_() {
+    return SHA512_Init(&sha_ctx_) == 1 ? 0 : 1;
+}
+
+
 void OpenSSLSHA512::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLSHA512Producer>());
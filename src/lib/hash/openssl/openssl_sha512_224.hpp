@@ -0,0 +1,46 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SHA512_224_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SHA512_224_HPP
+
+#include "openssl_evp_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The OpenSSL SHA512/224 hash.
+ */
+class OpenSSLSHA512224 : public OpenSSLEVPHash {
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    OpenSSLSHA512224();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
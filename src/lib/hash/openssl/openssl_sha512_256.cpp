@@ -0,0 +1,84 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+
+#include "openssl_sha512_256.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The OpenSSL SHA512/256 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "openssl-sha512-256",         // name
+            Family::kHash,                // family
+            "OpenSSL SHA512/256.",        // description (short/left and long/below)
+
+            "This is the Secure Hash Algorithm 2 variant 512/256 as defined in FIPS 180-4: SHA512 with its own "
+            "initial values, truncated to 32 bytes. On 64 bit CPUs it is faster than SHA256 for large inputs. "
+            "See: https://en.wikipedia.org/wiki/SHA-2.",
+
+            OPENSSL_VERSION_TEXT,                     // provider
+            128ul,                                    // input block size
+            ProcessingBlockSize::kEmpty,              // output block size behaviour
+            0ul,                                      // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,        // default padding strategy
+            32ul,                                     // result size
+            {},                                       // initial data
+            {}                                        // finalization data
+    };
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class OpenSSLSHA512256Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<OpenSSLSHA512256>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+OpenSSLSHA512256::OpenSSLSHA512256() : OpenSSLEVPHash{EVP_sha512_256()} {
+}
+
+
+Algorithm::Description const & OpenSSLSHA512256::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void OpenSSLSHA512256::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLSHA512256Producer>());
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/typed.hpp>
+
+#include <openssl/md5.h>
+#include <openssl/ripemd.h>
+#include <openssl/sha.h>
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+/**
+ * @brief   The OpenSSL functions of a hash algorithm.
+ */
+template <typename HashAlgorithm>
+struct OpenSSLHashFunctions;
+
+
+#define OPENSSL_HASH_FUNCTIONS(HASH_ALGORITHM, CONTEXT, OPENSSL_NAME)                                                \
+    template <>                                                                                                       \
+    struct OpenSSLHashFunctions<HASH_ALGORITHM> {                                                                     \
+        static_assert(sizeof(CONTEXT) <= detail::OpenSSLHashBackend<HASH_ALGORITHM>::kStateSize,                      \
+                      "The opaque state of the typed hash is too small for the OpenSSL context.");                    \
+        static int Init(void * state) {                                                                               \
+            return OPENSSL_NAME##_Init(static_cast<CONTEXT *>(state)) == 1 ? 0 : 1;                                   \
+        }                                                                                                             \
+        static int Process(void * state, unsigned char const * data, std::uint64_t size) {                            \
+            return OPENSSL_NAME##_Update(static_cast<CONTEXT *>(state), data, size) == 1 ? 0 : 1;                     \
+        }                                                                                                             \
+        static int Done(void * state, unsigned char * result) {                                                       \
+            return OPENSSL_NAME##_Final(result, static_cast<CONTEXT *>(state)) == 1 ? 0 : 1;                          \
+        }                                                                                                             \
+    };
+
+OPENSSL_HASH_FUNCTIONS(Md5, MD5_CTX, MD5)
+OPENSSL_HASH_FUNCTIONS(Ripemd160, RIPEMD160_CTX, RIPEMD160)
+OPENSSL_HASH_FUNCTIONS(Sha1, SHA_CTX, SHA1)
+OPENSSL_HASH_FUNCTIONS(Sha224, SHA256_CTX, SHA224)
+OPENSSL_HASH_FUNCTIONS(Sha256, SHA256_CTX, SHA256)
+OPENSSL_HASH_FUNCTIONS(Sha384, SHA512_CTX, SHA384)
+OPENSSL_HASH_FUNCTIONS(Sha512, SHA512_CTX, SHA512)
+
+#undef OPENSSL_HASH_FUNCTIONS
+
+
+}
+
+
+template <typename HashAlgorithm>
+int detail::OpenSSLHashBackend<HashAlgorithm>::Init(void * state) noexcept {
+    return OpenSSLHashFunctions<HashAlgorithm>::Init(state);
+}
+
+
+template <typename HashAlgorithm>
+int detail::OpenSSLHashBackend<HashAlgorithm>::Process(void * state,
+                                                       unsigned char const * data,
+                                                       std::uint64_t size) noexcept {
+    return OpenSSLHashFunctions<HashAlgorithm>::Process(state, data, size);
+}
+
+
+template <typename HashAlgorithm>
+int detail::OpenSSLHashBackend<HashAlgorithm>::Done(void * state, unsigned char * result) noexcept {
+    return OpenSSLHashFunctions<HashAlgorithm>::Done(state, result);
+}
+
+
+template struct headcode::crypt::detail::OpenSSLHashBackend<Md5>;
+template struct headcode::crypt::detail::OpenSSLHashBackend<Ripemd160>;
+template struct headcode::crypt::detail::OpenSSLHashBackend<Sha1>;
+template struct headcode::crypt::detail::OpenSSLHashBackend<Sha224>;
+template struct headcode::crypt::detail::OpenSSLHashBackend<Sha256>;
+template struct headcode::crypt::detail::OpenSSLHashBackend<Sha384>;
+template struct headcode::crypt::detail::OpenSSLHashBackend<Sha512>;
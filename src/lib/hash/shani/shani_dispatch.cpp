@@ -0,0 +1,84 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifdef HCS_SHANI
+#include <cpuid.h>
+#endif
+
+#include "../mb/mb_kernel.hpp"
+#include "shani_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The portable SHA-1 compression.
+ * @param   state       the state.
+ * @param   data        the blocks.
+ * @param   blocks      number of blocks in data.
+ */
+static void SHA1Portable(std::uint32_t * state, unsigned char const * data, std::uint64_t blocks) {
+    for (; blocks > 0; --blocks, data += 64) {
+        mb::SHA1Scalar(state, &data);
+    }
+}
+
+
+/**
+ * @brief   The portable SHA-256 compression.
+ * @param   state       the state.
+ * @param   data        the blocks.
+ * @param   blocks      number of blocks in data.
+ */
+static void SHA256Portable(std::uint32_t * state, unsigned char const * data, std::uint64_t blocks) {
+    for (; blocks > 0; --blocks, data += 64) {
+        mb::SHA256Scalar(state, &data);
+    }
+}
+
+
+bool headcode::crypt::shani::HasSHAExtensions() {
+#ifdef HCS_SHANI
+    static bool const sha = []() {
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) || ((ecx & bit_SSE4_1) == 0)) {
+            return false;
+        }
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+            return false;
+        }
+        return (ebx & bit_SHA) != 0;
+    }();
+    return sha;
+#else
+    return false;
+#endif
+}
+
+
+shani::Compress headcode::crypt::shani::SelectSHA1() {
+#ifdef HCS_SHANI
+    if (HasSHAExtensions()) {
+        return SHA1Extensions;
+    }
+#endif
+    return SHA1Portable;
+}
+
+
+shani::Compress headcode::crypt::shani::SelectSHA256() {
+#ifdef HCS_SHANI
+    if (HasSHAExtensions()) {
+        return SHA256Extensions;
+    }
+#endif
+    return SHA256Portable;
+}
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <headcode/crypt/error.hpp>
+
+#include "shani_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+SHANIHash::SHANIHash(shani::Compress compress, std::uint32_t const * initial, unsigned int words)
+    : compress_{compress}, initial_{initial}, words_{words} {
+    Start();
+}
+
+
+int SHANIHash::Add_(unsigned char const * block_incoming,
+                    std::uint64_t size_incoming,
+                    unsigned char *,
+                    std::uint64_t & size_outgoing) {
+
+    size_outgoing = GetDescription().block_size_outgoing_;
+    length_ += size_incoming;
+
+    if (buffer_size_ > 0) {
+        auto fill = std::min<std::uint64_t>(64 - buffer_size_, size_incoming);
+        std::memcpy(buffer_ + buffer_size_, block_incoming, fill);
+        buffer_size_ += fill;
+        block_incoming += fill;
+        size_incoming -= fill;
+        if (buffer_size_ < 64) {
+            return 0;
+        }
+        compress_(state_, buffer_, 1);
+        buffer_size_ = 0;
+    }
+
+    auto blocks = size_incoming / 64;
+    if (blocks > 0) {
+        compress_(state_, block_incoming, blocks);
+        block_incoming += blocks * 64;
+        size_incoming -= blocks * 64;
+    }
+
+    std::memcpy(buffer_, block_incoming, size_incoming);
+    buffer_size_ = size_incoming;
+
+    return 0;
+}
+
+
+int SHANIHash::Finalize_(unsigned char * result,
+                         std::uint64_t result_size,
+                         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    auto digest_size = GetDescription().result_size_;
+    if (result_size < digest_size) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // 0x80, zeros and the big endian length in bits
+    unsigned char final_blocks[128] = {};
+    std::memcpy(final_blocks, buffer_, buffer_size_);
+    final_blocks[buffer_size_] = 0x80;
+    auto blocks = (buffer_size_ < 56) ? 1u : 2u;
+    auto bits = length_ * 8;
+    for (int i = 0; i < 8; ++i) {
+        final_blocks[blocks * 64 - 1 - i] = static_cast<unsigned char>(bits >> (8 * i));
+    }
+    compress_(state_, final_blocks, blocks);
+
+    for (std::uint64_t i = 0; i < digest_size; ++i) {
+        result[i] = static_cast<unsigned char>(state_[i / 4] >> (24 - 8 * (i % 4)));
+    }
+
+    return 0;
+}
+
+
+int SHANIHash::Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    Start();
+    return 0;
+}
+
+
+int SHANIHash::Reset_() {
+    Start();
+    return 0;
+}
+
+
+void SHANIHash::Start() {
+    std::memcpy(state_, initial_, words_ * sizeof(std::uint32_t));
+    buffer_size_ = 0;
+    length_ = 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_SHANI_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_SHANI_KERNEL_HPP
+
+#include <cstdint>
+
+// Like the multi-buffer kernels, the SHA extension kernels live in a translation unit
+// of their own compiled with -msha. Keep this header free of inline code.
+
+
+namespace headcode::crypt::shani {
+
+
+/**
+ * @brief   Compresses whole 64 byte blocks into a SHA-1 (5 words) or SHA-256 (8 words) state.
+ * @param   state       the state.
+ * @param   data        the blocks.
+ * @param   blocks      number of blocks in data.
+ */
+using Compress = void (*)(std::uint32_t * state, unsigned char const * data, std::uint64_t blocks);
+
+
+/**
+ * @brief   Checks if the CPU has the SHA extensions (and SSE4.1).
+ * @return  true, if the SHA extension kernels may run.
+ */
+bool HasSHAExtensions();
+
+
+/**
+ * @brief   Picks the SHA-1 compression for this CPU.
+ * @return  The SHA extension kernel if supported, the portable code else.
+ */
+Compress SelectSHA1();
+
+
+/**
+ * @brief   Picks the SHA-256 compression for this CPU.
+ * @return  The SHA extension kernel if supported, the portable code else.
+ */
+Compress SelectSHA256();
+
+
+#ifdef HCS_SHANI
+
+void SHA1Extensions(std::uint32_t * state, unsigned char const * data, std::uint64_t blocks);
+void SHA256Extensions(std::uint32_t * state, unsigned char const * data, std::uint64_t blocks);
+
+#endif
+
+
+}
+
+
+#endif
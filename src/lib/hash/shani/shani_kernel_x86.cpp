@@ -0,0 +1,161 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "shani_kernel.hpp"
+
+
+namespace {
+
+
+/**
+ * @brief   The SHA-256 round constants.
+ */
+alignas(16) constexpr std::uint32_t kSHA256K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+
+/**
+ * @brief   Runs the 4 SHA-1 rounds of group G (rounds 4 * G to 4 * G + 3).
+ * The message words of the groups rotate through msg[G % 4], the schedule of the groups
+ * to come is computed along the way. The templates are unrolled into straight code.
+ * @param   abcd        the state words a, b, c and d.
+ * @param   e           the e word alternating between e[0] and e[1].
+ * @param   msg         the message words of 4 groups.
+ */
+template <int G>
+inline void SHA1Group(__m128i & abcd, __m128i (&e)[2], __m128i (&msg)[4]) {
+
+    constexpr int current = G & 1;
+    if constexpr (G == 0) {
+        e[0] = _mm_add_epi32(e[0], msg[0]);
+    } else {
+        e[current] = _mm_sha1nexte_epu32(e[current], msg[G % 4]);
+    }
+    e[1 - current] = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e[current], G / 5);
+
+    if constexpr ((G >= 3) && (G <= 18)) {
+        msg[(G + 1) % 4] = _mm_sha1msg2_epu32(msg[(G + 1) % 4], msg[G % 4]);
+    }
+    if constexpr ((G >= 1) && (G <= 16)) {
+        msg[(G + 3) % 4] = _mm_sha1msg1_epu32(msg[(G + 3) % 4], msg[G % 4]);
+    }
+    if constexpr ((G >= 2) && (G <= 17)) {
+        msg[(G + 2) % 4] = _mm_xor_si128(msg[(G + 2) % 4], msg[G % 4]);
+    }
+
+    if constexpr (G < 19) {
+        SHA1Group<G + 1>(abcd, e, msg);
+    }
+}
+
+
+/**
+ * @brief   Runs the 4 SHA-256 rounds of group G (rounds 4 * G to 4 * G + 3).
+ * @param   state0      the state words a, b, e and f.
+ * @param   state1      the state words c, d, g and h.
+ * @param   msg         the message words of 4 groups.
+ */
+template <int G>
+inline void SHA256Group(__m128i & state0, __m128i & state1, __m128i (&msg)[4]) {
+
+    auto k = _mm_load_si128(reinterpret_cast<__m128i const *>(kSHA256K + 4 * G));
+    auto w = _mm_add_epi32(msg[G % 4], k);
+    state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0e));
+
+    if constexpr (G < 12) {
+        auto next = _mm_sha256msg1_epu32(msg[G % 4], msg[(G + 1) % 4]);
+        next = _mm_add_epi32(next, _mm_alignr_epi8(msg[(G + 3) % 4], msg[(G + 2) % 4], 4));
+        msg[G % 4] = _mm_sha256msg2_epu32(next, msg[(G + 3) % 4]);
+    }
+
+    if constexpr (G < 15) {
+        SHA256Group<G + 1>(state0, state1, msg);
+    }
+}
+
+
+}
+
+
+void headcode::crypt::shani::SHA1Extensions(std::uint32_t * state, unsigned char const * data, std::uint64_t blocks) {
+
+    auto const byte_swap = _mm_set_epi64x(0x0001020304050607ull, 0x08090a0b0c0d0e0full);
+
+    auto abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state)), 0x1b);
+    auto e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+    for (; blocks > 0; --blocks, data += 64) {
+
+        auto abcd_save = abcd;
+        auto e0_save = e0;
+
+        __m128i msg[4];
+        for (int i = 0; i < 4; ++i) {
+            auto words = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 16 * i));
+            msg[i] = _mm_shuffle_epi8(words, byte_swap);
+        }
+
+        __m128i e[2] = {e0, _mm_setzero_si128()};
+        SHA1Group<0>(abcd, e, msg);
+
+        e0 = _mm_sha1nexte_epu32(e[0], e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_shuffle_epi32(abcd, 0x1b));
+    state[4] = static_cast<std::uint32_t>(_mm_extract_epi32(e0, 3));
+}
+
+
+void headcode::crypt::shani::SHA256Extensions(std::uint32_t * state,
+                                              unsigned char const * data,
+                                              std::uint64_t blocks) {
+
+    auto const byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+
+    // the SHA extensions keep the state as ABEF and CDGH
+    auto dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state)), 0xb1);
+    auto efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state + 4)), 0x1b);
+    auto state0 = _mm_alignr_epi8(dcba, efgh, 8);
+    auto state1 = _mm_blend_epi16(efgh, dcba, 0xf0);
+
+    for (; blocks > 0; --blocks, data += 64) {
+
+        auto state0_save = state0;
+        auto state1_save = state1;
+
+        __m128i msg[4];
+        for (int i = 0; i < 4; ++i) {
+            auto words = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 16 * i));
+            msg[i] = _mm_shuffle_epi8(words, byte_swap);
+        }
+
+        SHA256Group<0>(state0, state1, msg);
+
+        state0 = _mm_add_epi32(state0, state0_save);
+        state1 = _mm_add_epi32(state1, state1_save);
+    }
+
+    auto feba = _mm_shuffle_epi32(state0, 0x1b);
+    auto dchg = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), _mm_alignr_epi8(dchg, feba, 8));
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "shani_sha1.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The SHA1 on SHA extensions algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-shani-sha1",              // name
+            Family::kHash,                 // family
+            "SHA extensions SHA1.",        // description (short/left and long/below)
+
+            "This is the Secure Hash Algorithm 1 as defined by the NSA, running on the SHA extensions of x86 "
+            "CPUs (portable code else). The NIST formaly deprecated the use of this algorithms due to discovered "
+            "weaknesses. See: https://en.wikipedia.org/wiki/SHA-1.",
+
+            std::string{"hcs-crypt v"} + VERSION,        // provider
+            64ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                 // output block size behaviour
+            0ul,                                         // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,           // default padding strategy
+            20ul,                                        // result size
+            {},                                          // initial data
+            {}                                           // finalization data
+    };
+
+    return description;
+}
+
+
+/**
+ * @brief   The initial state.
+ */
+static std::uint32_t const kInitial[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class SHANISHA1Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<SHANISHA1>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+SHANISHA1::SHANISHA1() : SHANIHash{shani::SelectSHA1(), kInitial, 5} {
+}
+
+
+Algorithm::Description const & SHANISHA1::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void SHANISHA1::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<SHANISHA1Producer>());
+}
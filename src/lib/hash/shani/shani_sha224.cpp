@@ -0,0 +1,87 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "shani_sha224.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The SHA224 on SHA extensions algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-shani-sha224",              // name
+            Family::kHash,                   // family
+            "SHA extensions SHA224.",        // description (short/left and long/below)
+
+            "This is the Secure Hash Algorithm 2 variant 224 as defined by the NSA, running on the SHA extensions "
+            "of x86 CPUs (portable code else). See: https://en.wikipedia.org/wiki/SHA-2.",
+
+            std::string{"hcs-crypt v"} + VERSION,        // provider
+            64ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                 // output block size behaviour
+            0ul,                                         // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,           // default padding strategy
+            28ul,                                        // result size
+            {},                                          // initial data
+            {}                                           // finalization data
+    };
+
+    return description;
+}
+
+
+/**
+ * @brief   The initial state.
+ */
+static std::uint32_t const kInitial[8] = {
+        0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939, 0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4};
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class SHANISHA224Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<SHANISHA224>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+SHANISHA224::SHANISHA224() : SHANIHash{shani::SelectSHA256(), kInitial, 8} {
+}
+
+
+Algorithm::Description const & SHANISHA224::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void SHANISHA224::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<SHANISHA224Producer>());
+}
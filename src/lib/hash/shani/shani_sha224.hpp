@@ -0,0 +1,46 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_SHANI_SHA224_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_SHANI_SHA224_HPP
+
+#include "shani_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The SHA224 algorithm on the x86 SHA extensions.
+ */
+class SHANISHA224 : public SHANIHash {
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    SHANISHA224();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "shani_sha256.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The SHA256 on SHA extensions algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-shani-sha256",              // name
+            Family::kHash,                   // family
+            "SHA extensions SHA256.",        // description (short/left and long/below)
+
+            "This is the Secure Hash Algorithm 2 variant 256 as defined by the NSA, running on the SHA extensions "
+            "of x86 CPUs (portable code else). See: https://en.wikipedia.org/wiki/SHA-2.",
+
+            std::string{"hcs-crypt v"} + VERSION,        // provider
+            64ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                 // output block size behaviour
+            0ul,                                         // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,           // default padding strategy
+            32ul,                                        // result size
+            {},                                          // initial data
+            {}                                           // finalization data
+    };
+
+    return description;
+}
+
+
+/**
+ * @brief   The initial state.
+ */
+static std::uint32_t const kInitial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class SHANISHA256Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<SHANISHA256>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+SHANISHA256::SHANISHA256() : SHANIHash{shani::SelectSHA256(), kInitial, 8} {
+}
+
+
+Algorithm::Description const & SHANISHA256::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void SHANISHA256::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<SHANISHA256Producer>());
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "siphash24_128.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The SipHash-2-4 128 bit algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-siphash-2-4-128",      // name
+            Family::kHash,              // family
+            "SipHash-2-4 128 bit.",     // description (short/left and long/below)
+
+            "This is SipHash-2-4 by Aumasson and Bernstein with the 128 bit output: a keyed hash (a PRF) fast on "
+            "short inputs. Pass the \"key\" (16 bytes) at initialization. The digest is the 16 bytes of the "
+            "reference. For short inputs use SipHash24::Hash128() of <headcode/crypt/siphash.hpp>: the same hash "
+            "inlined. See: https://www.aumasson.jp/siphash/siphash.pdf.",
+
+            std::string{"hcs-crypt v"} + VERSION,       // provider
+            0ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                // output block size behaviour
+            0ul,                                        // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,              // default padding strategy
+            16ul,                                       // result size
+
+            // initial data
+            {{"key", {16ul, PaddingStrategy::PADDING_NONE, "The key (16 bytes).", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class SipHash24_128Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<SipHash24_128>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+SipHash24_128::SipHash24_128() : SipHash24Hash{true} {
+}
+
+
+Algorithm::Description const & SipHash24_128::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void SipHash24_128::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<SipHash24_128Producer>());
+}
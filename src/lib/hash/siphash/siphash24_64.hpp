@@ -0,0 +1,46 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_SipHash24_64_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_SipHash24_64_HPP
+
+#include "siphash24_hash.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The SipHash-2-4 keyed hash with a 64 bit output.
+ */
+class SipHash24_64 : public SipHash24Hash {
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    SipHash24_64();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "siphash24_hash.hpp"
+
+using namespace headcode::crypt;
+
+
+SipHash24Hash::SipHash24Hash(bool wide) : wide_{wide} {
+    Start();
+}
+
+
+int SipHash24Hash::Add_(unsigned char const * block_incoming,
+                        std::uint64_t size_incoming,
+                        unsigned char *,
+                        std::uint64_t & size_outgoing) {
+
+    size_outgoing = 0;
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+
+    total_size_ += size_incoming;
+
+    if (tail_size_ > 0) {
+        auto take = std::min(size_incoming, 8 - tail_size_);
+        std::memcpy(tail_ + tail_size_, block_incoming, take);
+        tail_size_ += take;
+        block_incoming += take;
+        size_incoming -= take;
+        if (tail_size_ < 8) {
+            return static_cast<int>(Error::kNoError);
+        }
+        state_.Compress(detail::SipHashState::Load(tail_));
+        tail_size_ = 0;
+    }
+
+    auto done = state_.CompressWords(block_incoming, size_incoming);
+    tail_size_ = size_incoming - done;
+    std::memcpy(tail_, block_incoming + done, tail_size_);
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int SipHash24Hash::Finalize_(unsigned char * result,
+                             std::uint64_t result_size,
+                             std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    if (result_size < (wide_ ? 16ul : 8ul)) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // work on a copy: more data may be added after Finalize()
+    auto state = state_;
+    std::uint64_t words[2];
+    words[0] = state.Finish(detail::SipHashState::LoadLast(tail_, tail_size_, total_size_), wide_);
+    if (wide_) {
+        words[1] = state.FinishHigh();
+    }
+
+    for (std::uint64_t i = 0; i < (wide_ ? 16ul : 8ul); ++i) {
+        result[i] = static_cast<unsigned char>(words[i / 8] >> (8 * (i % 8)));
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int SipHash24Hash::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    keyed_ = false;
+
+    auto iter = initialization_data.find("key");
+    if (iter == initialization_data.end()) {
+        headcode::logger::Warning{"headcode.crypt"} << "SipHash needs a key.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [key_data, key_size] = (*iter).second;
+    if ((key_data == nullptr) || (key_size != SipHash24::kKeySize)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying key of invalid size (16 bytes).";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    k0_ = detail::SipHashState::Load(key_data);
+    k1_ = detail::SipHashState::Load(key_data + 8);
+    keyed_ = true;
+    Start();
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int SipHash24Hash::Reset_() {
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void SipHash24Hash::Start() {
+    state_.Start(k0_, k1_, wide_);
+    tail_size_ = 0;
+    total_size_ = 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_SIPHASH24_HASH_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_SIPHASH24_HASH_HPP
+
+#include <cstdint>
+
+#include <headcode/crypt/algorithm.hpp>
+#include <headcode/crypt/siphash.hpp>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of the SipHash-2-4 keyed hashes (64 and 128 bit).
+ * The "key" (16 bytes) is mandatory at initialization. Whole words of 8 bytes are compressed
+ * as they come in, up to 7 bytes wait for the next Add(). The state is the one of the inlined
+ * SipHash24 (see <headcode/crypt/siphash.hpp>), so both give the same digest.
+ */
+class SipHash24Hash : public Algorithm {
+
+    bool const wide_;                       //!< @brief 128 bit output.
+    bool keyed_ = false;                    //!< @brief A key has been set.
+    std::uint64_t k0_ = 0;                  //!< @brief The first key word.
+    std::uint64_t k1_ = 0;                  //!< @brief The second key word.
+    detail::SipHashState state_;            //!< @brief The state.
+    unsigned char tail_[8];                 //!< @brief The bytes of a word not complete yet.
+    std::uint64_t tail_size_ = 0;           //!< @brief Number of bytes in the tail.
+    std::uint64_t total_size_ = 0;          //!< @brief Number of bytes added.
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   wide        128 bit output.
+     */
+    explicit SipHash24Hash(bool wide);
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Starts a new message.
+     */
+    void Start();
+};
+
+
+}
+
+
+#endif
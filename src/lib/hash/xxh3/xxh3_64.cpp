@@ -0,0 +1,94 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "xxh3_64.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Names the provider and the kernel in use.
+ * @return  The provider of the algorithm.
+ */
+static std::string GetProvider() {
+    return std::string{"hcs-crypt v"} + VERSION + " (" + xxh3::SelectKernel().name_ + ")";
+}
+
+
+/**
+ * @brief   The XXH3 64 bit algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "hcs-xxh3-64",               // name
+            Family::kNonCryptographicHash, // family
+            "XXH3 64 bit.",              // description (short/left and long/below)
+
+            "This is XXH3 with a 64 bit digest: a fast non-cryptographic hash of xxHash for hash tables, dedup "
+            "and cache keys. Never use it where an attacker chooses the data. Up to 240 bytes take a short path, "
+            "beyond the data runs through 8 accumulators, with SSE2 or AVX2 on the CPU. Pass an optional "
+            "\"seed\" (8 bytes, big endian) at initialization. The digest is written big endian (canonical). "
+            "See: https://github.com/Cyan4973/xxHash.",
+
+            GetProvider(),                              // provider
+            0ul,                                        // input block size
+            ProcessingBlockSize::kEmpty,                // output block size behaviour
+            0ul,                                        // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,              // default padding strategy
+            8ul,                                        // result size
+
+            // initial data
+            {{"seed", {8ul, PaddingStrategy::PADDING_NONE, "Optional seed (8 bytes, big endian).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class XXH3_64Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<XXH3_64>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+XXH3_64::XXH3_64() : XXH3Hash{8} {
+}
+
+
+Algorithm::Description const & XXH3_64::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void XXH3_64::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<XXH3_64Producer>());
+}
@@ -0,0 +1,30 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "xxh3_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+xxh3::Kernel const & headcode::crypt::xxh3::SelectKernel() {
+
+    static Kernel const kernel = []() -> Kernel {
+#ifdef HCS_XXH3_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return {AccumulateAVX2, ScrambleAVX2, "AVX2"};
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return {AccumulateSSE2, ScrambleSSE2, "SSE2"};
+        }
+#endif
+        return {AccumulateScalar, ScrambleScalar, "portable"};
+    }();
+
+    return kernel;
+}
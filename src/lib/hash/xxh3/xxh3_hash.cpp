@@ -0,0 +1,521 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "xxh3_hash.hpp"
+
+using namespace headcode::crypt;
+using namespace headcode::crypt::xxh3;
+
+
+namespace {
+
+
+/**
+ * @brief   Largest message hashed with the short paths.
+ */
+constexpr std::uint64_t kMidSizeMax = 240;
+
+/**
+ * @brief   Smallest secret of XXH3: the short paths stay within.
+ */
+constexpr std::uint64_t kSecretSizeMin = 136;
+
+/**
+ * @brief   Offset of the secret merging the accumulators.
+ */
+constexpr std::uint64_t kSecretMergeStart = 11;
+
+/**
+ * @brief   Offset of the secret of the last stripe (counted from the last stripe of the secret).
+ */
+constexpr std::uint64_t kSecretLastStripeStart = 7;
+
+
+inline std::uint32_t Load32(unsigned char const * p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+inline std::uint64_t Load64(unsigned char const * p) {
+    return static_cast<std::uint64_t>(Load32(p)) | (static_cast<std::uint64_t>(Load32(p + 4)) << 32);
+}
+
+inline void Store64(unsigned char * p, std::uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        p[i] = static_cast<unsigned char>(v >> (8 * (7 - i)));
+    }
+}
+
+inline std::uint32_t Swap32(std::uint32_t x) {
+    return __builtin_bswap32(x);
+}
+
+inline std::uint64_t Swap64(std::uint64_t x) {
+    return __builtin_bswap64(x);
+}
+
+inline std::uint32_t RotateLeft32(std::uint32_t x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+inline std::uint64_t RotateLeft64(std::uint64_t x, int n) {
+    return (x << n) | (x >> (64 - n));
+}
+
+#ifdef __SIZEOF_INT128__
+__extension__ using UInt128 = unsigned __int128;
+#endif
+
+/**
+ * @brief   The full 128 bit product of two 64 bit values.
+ */
+inline void Multiply(std::uint64_t a, std::uint64_t b, std::uint64_t & low, std::uint64_t & high) {
+#ifdef __SIZEOF_INT128__
+    auto product = static_cast<UInt128>(a) * b;
+    low = static_cast<std::uint64_t>(product);
+    high = static_cast<std::uint64_t>(product >> 64);
+#else
+    auto lo_lo = (a & 0xffffffffu) * (b & 0xffffffffu);
+    auto hi_lo = (a >> 32) * (b & 0xffffffffu);
+    auto lo_hi = (a & 0xffffffffu) * (b >> 32);
+    auto hi_hi = (a >> 32) * (b >> 32);
+    auto cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+    low = (cross << 32) | (lo_lo & 0xffffffffu);
+    high = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+}
+
+inline std::uint64_t MultiplyFold(std::uint64_t a, std::uint64_t b) {
+    std::uint64_t low;
+    std::uint64_t high;
+    Multiply(a, b, low, high);
+    return low ^ high;
+}
+
+inline std::uint64_t XorShift(std::uint64_t x, int n) {
+    return x ^ (x >> n);
+}
+
+/**
+ * @brief   The final mix of XXH64.
+ */
+inline std::uint64_t AvalancheXXH64(std::uint64_t h) {
+    h = XorShift(h, 33) * kPrime64_2;
+    h = XorShift(h, 29) * kPrime64_3;
+    return XorShift(h, 32);
+}
+
+inline std::uint64_t Avalanche(std::uint64_t h) {
+    h = XorShift(h, 37) * 0x165667919e3779f9ul;
+    return XorShift(h, 32);
+}
+
+inline std::uint64_t StrongAvalanche(std::uint64_t h, std::uint64_t size) {
+    h ^= RotateLeft64(h, 49) ^ RotateLeft64(h, 24);
+    h *= 0x9fb21c651e98df25ul;
+    h ^= (h >> 35) + size;
+    h *= 0x9fb21c651e98df25ul;
+    return XorShift(h, 28);
+}
+
+inline std::uint64_t Mix16(unsigned char const * data, unsigned char const * secret, std::uint64_t seed) {
+    return MultiplyFold(Load64(data) ^ (Load64(secret) + seed), Load64(data + 8) ^ (Load64(secret + 8) - seed));
+}
+
+inline void Mix32(std::uint64_t & low,
+                  std::uint64_t & high,
+                  unsigned char const * data_1,
+                  unsigned char const * data_2,
+                  unsigned char const * secret,
+                  std::uint64_t seed) {
+    low += Mix16(data_1, secret, seed);
+    low ^= Load64(data_2) + Load64(data_2 + 8);
+    high += Mix16(data_2, secret + 16, seed);
+    high ^= Load64(data_1) + Load64(data_1 + 8);
+}
+
+std::uint64_t MergeAccumulators(std::uint64_t const * acc, unsigned char const * secret, std::uint64_t start) {
+    auto result = start;
+    for (int i = 0; i < 4; ++i) {
+        result += MultiplyFold(acc[2 * i] ^ Load64(secret + 16 * i), acc[2 * i + 1] ^ Load64(secret + 16 * i + 8));
+    }
+    return Avalanche(result);
+}
+
+std::uint64_t Hash64Up16(unsigned char const * data, std::uint64_t size, std::uint64_t seed) {
+
+    auto secret = kDefaultSecret;
+    if (size > 8) {
+        auto low = Load64(data) ^ ((Load64(secret + 24) ^ Load64(secret + 32)) + seed);
+        auto high = Load64(data + size - 8) ^ ((Load64(secret + 40) ^ Load64(secret + 48)) - seed);
+        return Avalanche(size + Swap64(low) + high + MultiplyFold(low, high));
+    }
+    if (size >= 4) {
+        seed ^= static_cast<std::uint64_t>(Swap32(static_cast<std::uint32_t>(seed))) << 32;
+        auto input = static_cast<std::uint64_t>(Load32(data + size - 4)) +
+                     (static_cast<std::uint64_t>(Load32(data)) << 32);
+        auto flip = (Load64(secret + 8) ^ Load64(secret + 16)) - seed;
+        return StrongAvalanche(input ^ flip, size);
+    }
+    if (size > 0) {
+        auto combined = (static_cast<std::uint32_t>(data[0]) << 16) |
+                        (static_cast<std::uint32_t>(data[size >> 1]) << 24) |
+                        static_cast<std::uint32_t>(data[size - 1]) | (static_cast<std::uint32_t>(size) << 8);
+        auto flip = static_cast<std::uint64_t>(Load32(secret) ^ Load32(secret + 4)) + seed;
+        return AvalancheXXH64(combined ^ flip);
+    }
+    return AvalancheXXH64(seed ^ Load64(secret + 56) ^ Load64(secret + 64));
+}
+
+std::uint64_t Hash64Up128(unsigned char const * data, std::uint64_t size, std::uint64_t seed) {
+
+    // pairs from both ends, working inwards
+    auto secret = kDefaultSecret;
+    auto acc = size * kPrime64_1;
+    if (size > 32) {
+        if (size > 64) {
+            if (size > 96) {
+                acc += Mix16(data + 48, secret + 96, seed);
+                acc += Mix16(data + size - 64, secret + 112, seed);
+            }
+            acc += Mix16(data + 32, secret + 64, seed);
+            acc += Mix16(data + size - 48, secret + 80, seed);
+        }
+        acc += Mix16(data + 16, secret + 32, seed);
+        acc += Mix16(data + size - 32, secret + 48, seed);
+    }
+    acc += Mix16(data, secret, seed);
+    acc += Mix16(data + size - 16, secret + 16, seed);
+    return Avalanche(acc);
+}
+
+std::uint64_t Hash64Up240(unsigned char const * data, std::uint64_t size, std::uint64_t seed) {
+
+    auto secret = kDefaultSecret;
+    auto acc = size * kPrime64_1;
+    std::uint64_t round = 0;
+    for (; round < 8; ++round) {
+        acc += Mix16(data + 16 * round, secret + 16 * round, seed);
+    }
+    acc = Avalanche(acc);
+    for (; round < size / 16; ++round) {
+        acc += Mix16(data + 16 * round, secret + 16 * (round - 8) + 3, seed);
+    }
+    acc += Mix16(data + size - 16, secret + kSecretSizeMin - 17, seed);
+    return Avalanche(acc);
+}
+
+std::uint64_t Hash64Short(unsigned char const * data, std::uint64_t size, std::uint64_t seed) {
+    if (size <= 16) {
+        return Hash64Up16(data, size, seed);
+    }
+    if (size <= 128) {
+        return Hash64Up128(data, size, seed);
+    }
+    return Hash64Up240(data, size, seed);
+}
+
+void Hash128Up16(unsigned char const * data,
+                 std::uint64_t size,
+                 std::uint64_t seed,
+                 std::uint64_t & low,
+                 std::uint64_t & high) {
+
+    auto secret = kDefaultSecret;
+    if (size > 8) {
+        auto input_low = Load64(data);
+        auto input_high = Load64(data + size - 8);
+        std::uint64_t product_low;
+        std::uint64_t product_high;
+        Multiply(input_low ^ input_high ^ ((Load64(secret + 32) ^ Load64(secret + 40)) - seed),
+                 kPrime64_1,
+                 product_low,
+                 product_high);
+        product_low += (size - 1) << 54;
+        input_high ^= (Load64(secret + 48) ^ Load64(secret + 56)) + seed;
+        product_high += input_high + (input_high & 0xffffffffu) * (kPrime32_2 - 1);
+        product_low ^= Swap64(product_high);
+        Multiply(product_low, kPrime64_2, low, high);
+        high += product_high * kPrime64_2;
+        low = Avalanche(low);
+        high = Avalanche(high);
+        return;
+    }
+    if (size >= 4) {
+        seed ^= static_cast<std::uint64_t>(Swap32(static_cast<std::uint32_t>(seed))) << 32;
+        auto input = static_cast<std::uint64_t>(Load32(data)) +
+                     (static_cast<std::uint64_t>(Load32(data + size - 4)) << 32);
+        auto keyed = input ^ ((Load64(secret + 16) ^ Load64(secret + 24)) + seed);
+        Multiply(keyed, kPrime64_1 + (size << 2), low, high);
+        high += low << 1;
+        low ^= high >> 3;
+        low = XorShift(XorShift(low, 35) * 0x9fb21c651e98df25ul, 28);
+        high = Avalanche(high);
+        return;
+    }
+    if (size > 0) {
+        auto combined = (static_cast<std::uint32_t>(data[0]) << 16) |
+                        (static_cast<std::uint32_t>(data[size >> 1]) << 24) |
+                        static_cast<std::uint32_t>(data[size - 1]) | (static_cast<std::uint32_t>(size) << 8);
+        auto combined_high = RotateLeft32(Swap32(combined), 13);
+        low = AvalancheXXH64(combined ^ (static_cast<std::uint64_t>(Load32(secret) ^ Load32(secret + 4)) + seed));
+        high = AvalancheXXH64(combined_high ^
+                              (static_cast<std::uint64_t>(Load32(secret + 8) ^ Load32(secret + 12)) - seed));
+        return;
+    }
+    low = AvalancheXXH64(seed ^ Load64(secret + 64) ^ Load64(secret + 72));
+    high = AvalancheXXH64(seed ^ Load64(secret + 80) ^ Load64(secret + 88));
+}
+
+void Hash128Finish(std::uint64_t size, std::uint64_t seed, std::uint64_t & low, std::uint64_t & high) {
+    auto sum = low + high;
+    high = 0 - Avalanche(low * kPrime64_1 + high * kPrime64_4 + (size - seed) * kPrime64_2);
+    low = Avalanche(sum);
+}
+
+void Hash128Up128(unsigned char const * data,
+                  std::uint64_t size,
+                  std::uint64_t seed,
+                  std::uint64_t & low,
+                  std::uint64_t & high) {
+
+    // pairs from both ends, working inwards
+    auto secret = kDefaultSecret;
+    low = size * kPrime64_1;
+    high = 0;
+    if (size > 32) {
+        if (size > 64) {
+            if (size > 96) {
+                Mix32(low, high, data + 48, data + size - 64, secret + 96, seed);
+            }
+            Mix32(low, high, data + 32, data + size - 48, secret + 64, seed);
+        }
+        Mix32(low, high, data + 16, data + size - 32, secret + 32, seed);
+    }
+    Mix32(low, high, data, data + size - 16, secret, seed);
+    Hash128Finish(size, seed, low, high);
+}
+
+void Hash128Up240(unsigned char const * data,
+                  std::uint64_t size,
+                  std::uint64_t seed,
+                  std::uint64_t & low,
+                  std::uint64_t & high) {
+
+    auto secret = kDefaultSecret;
+    low = size * kPrime64_1;
+    high = 0;
+    std::uint64_t round = 0;
+    for (; round < 4; ++round) {
+        Mix32(low, high, data + 32 * round, data + 32 * round + 16, secret + 32 * round, seed);
+    }
+    low = Avalanche(low);
+    high = Avalanche(high);
+    for (; round < size / 32; ++round) {
+        Mix32(low, high, data + 32 * round, data + 32 * round + 16, secret + 32 * (round - 4) + 3, seed);
+    }
+    Mix32(low, high, data + size - 16, data + size - 32, secret + kSecretSizeMin - 17 - 16, 0 - seed);
+    Hash128Finish(size, seed, low, high);
+}
+
+void Hash128Short(unsigned char const * data,
+                  std::uint64_t size,
+                  std::uint64_t seed,
+                  std::uint64_t & low,
+                  std::uint64_t & high) {
+    if (size <= 16) {
+        Hash128Up16(data, size, seed, low, high);
+    } else if (size <= 128) {
+        Hash128Up128(data, size, seed, low, high);
+    } else {
+        Hash128Up240(data, size, seed, low, high);
+    }
+}
+
+
+}
+
+
+XXH3Hash::XXH3Hash(std::uint64_t digest_size) : kernel_{SelectKernel()}, digest_size_{digest_size} {
+    std::copy(kDefaultSecret, kDefaultSecret + kSecretSize, secret_);
+    Start();
+}
+
+
+int XXH3Hash::Add_(unsigned char const * block_incoming,
+                   std::uint64_t size_incoming,
+                   unsigned char *,
+                   std::uint64_t & size_outgoing) {
+
+    size_outgoing = 0;
+    total_size_ += size_incoming;
+
+    if (buffer_size_ + size_incoming <= kBufferSize) {
+        std::memcpy(buffer_ + buffer_size_, block_incoming, size_incoming);
+        buffer_size_ += size_incoming;
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // the last stripe is special: at least a byte stays in the buffer
+    if (buffer_size_ > 0) {
+        auto fill = kBufferSize - buffer_size_;
+        std::memcpy(buffer_ + buffer_size_, block_incoming, fill);
+        Consume(acc_, block_stripes_, buffer_, kBufferSize / kStripeSize);
+        block_incoming += fill;
+        size_incoming -= fill;
+        buffer_size_ = 0;
+    }
+
+    if (size_incoming > kBufferSize) {
+        auto stripes = (size_incoming - 1) / kStripeSize;
+        Consume(acc_, block_stripes_, block_incoming, stripes);
+        block_incoming += stripes * kStripeSize;
+        size_incoming -= stripes * kStripeSize;
+
+        // Finalize() may need the end of the data consumed to make up the last stripe
+        std::memcpy(buffer_ + kBufferSize - kStripeSize, block_incoming - kStripeSize, kStripeSize);
+    }
+
+    std::memcpy(buffer_, block_incoming, size_incoming);
+    buffer_size_ = size_incoming;
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void XXH3Hash::Consume(std::uint64_t * acc,
+                       std::uint64_t & block_stripes,
+                       unsigned char const * data,
+                       std::uint64_t stripes) const {
+
+    while (stripes > 0) {
+        auto take = std::min(stripes, kStripesPerBlock - block_stripes);
+        kernel_.accumulate_(acc, data, secret_ + block_stripes * kSecretConsumeRate, take);
+        block_stripes += take;
+        data += take * kStripeSize;
+        stripes -= take;
+        if (block_stripes == kStripesPerBlock) {
+            kernel_.scramble_(acc, secret_ + kSecretSize - kStripeSize);
+            block_stripes = 0;
+        }
+    }
+}
+
+
+int XXH3Hash::Finalize_(unsigned char * result,
+                        std::uint64_t result_size,
+                        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (result_size < digest_size_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+
+    if (total_size_ <= kMidSizeMax) {
+        if (digest_size_ == 8) {
+            low = Hash64Short(buffer_, total_size_, seed_);
+        } else {
+            Hash128Short(buffer_, total_size_, seed_, low, high);
+        }
+    } else {
+
+        // work on a copy: more data may be added after Finalize()
+        alignas(64) std::uint64_t acc[8];
+        std::copy(std::begin(acc_), std::end(acc_), acc);
+        auto block_stripes = block_stripes_;
+
+        unsigned char last_stripe[kStripeSize];
+        unsigned char const * last = last_stripe;
+        if (buffer_size_ >= kStripeSize) {
+            Consume(acc, block_stripes, buffer_, (buffer_size_ - 1) / kStripeSize);
+            last = buffer_ + buffer_size_ - kStripeSize;
+        } else {
+            auto catch_up = kStripeSize - buffer_size_;
+            std::memcpy(last_stripe, buffer_ + kBufferSize - catch_up, catch_up);
+            std::memcpy(last_stripe + catch_up, buffer_, buffer_size_);
+        }
+        kernel_.accumulate_(acc, last, secret_ + kSecretSize - kStripeSize - kSecretLastStripeStart, 1);
+
+        low = MergeAccumulators(acc, secret_ + kSecretMergeStart, total_size_ * kPrime64_1);
+        if (digest_size_ == 16) {
+            high = MergeAccumulators(acc,
+                                     secret_ + kSecretSize - sizeof(acc) - kSecretMergeStart,
+                                     ~(total_size_ * kPrime64_2));
+        }
+    }
+
+    if (digest_size_ == 8) {
+        Store64(result, low);
+    } else {
+        Store64(result, high);
+        Store64(result + 8, low);
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int XXH3Hash::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    seed_ = 0;
+    auto iter = initialization_data.find("seed");
+    if (iter != initialization_data.end()) {
+        auto [seed_data, seed_size] = (*iter).second;
+        if ((seed_data == nullptr) || (seed_size != 8)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying seed of invalid size.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        for (int i = 0; i < 8; ++i) {
+            seed_ = (seed_ << 8) | seed_data[i];
+        }
+    }
+
+    // the seed is added to the low and taken from the high half of each 16 bytes of the secret
+    for (std::uint64_t i = 0; i < kSecretSize; i += 16) {
+        auto low = Load64(kDefaultSecret + i) + seed_;
+        auto high = Load64(kDefaultSecret + i + 8) - seed_;
+        for (int j = 0; j < 8; ++j) {
+            secret_[i + j] = static_cast<unsigned char>(low >> (8 * j));
+            secret_[i + 8 + j] = static_cast<unsigned char>(high >> (8 * j));
+        }
+    }
+
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int XXH3Hash::Reset_() {
+    Start();
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void XXH3Hash::Start() {
+    acc_[0] = kPrime32_3;
+    acc_[1] = kPrime64_1;
+    acc_[2] = kPrime64_2;
+    acc_[3] = kPrime64_3;
+    acc_[4] = kPrime64_4;
+    acc_[5] = kPrime32_2;
+    acc_[6] = kPrime64_5;
+    acc_[7] = kPrime32_1;
+    buffer_size_ = 0;
+    block_stripes_ = 0;
+    total_size_ = 0;
+}
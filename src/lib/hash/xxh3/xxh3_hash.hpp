@@ -0,0 +1,115 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_XXH3_HASH_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_XXH3_HASH_HPP
+
+#include <cstdint>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "xxh3_kernel.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of the XXH3 non-cryptographic hashes (64 and 128 bit).
+ * Up to 240 bytes are held back and hashed in one go at Finalize() with the short paths. Beyond
+ * that the data runs through 8 accumulators stripe by stripe (64 bytes), the kernel for this CPU
+ * works on all of them at once. An optional "seed" at initialization derives a secret of its own.
+ * The digest is written big endian (the canonical form of xxHash).
+ */
+class XXH3Hash : public Algorithm {
+
+    /**
+     * @brief   Size of the buffer: data is held back until there is more.
+     */
+    static constexpr std::uint64_t kBufferSize = 256;
+
+    xxh3::Kernel const & kernel_;                           //!< @brief The kernel for this CPU.
+    std::uint64_t const digest_size_;                       //!< @brief Size of the digest (8 or 16).
+    std::uint64_t seed_ = 0;                                //!< @brief The seed.
+    alignas(64) unsigned char secret_[xxh3::kSecretSize];   //!< @brief The secret derived from the seed.
+    alignas(64) std::uint64_t acc_[8];                      //!< @brief The accumulators.
+    alignas(64) unsigned char buffer_[kBufferSize];         //!< @brief The data not consumed yet.
+    std::uint64_t buffer_size_ = 0;                         //!< @brief Number of bytes in the buffer.
+    std::uint64_t block_stripes_ = 0;                       //!< @brief Number of stripes of the current block.
+    std::uint64_t total_size_ = 0;                          //!< @brief Number of bytes added.
+
+protected:
+    /**
+     * @brief   Constructor.
+     * @param   digest_size     size of the digest (8 or 16).
+     */
+    explicit XXH3Hash(std::uint64_t digest_size);
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Runs stripes through the accumulators, scrambling them at the end of each block.
+     * @param   acc             the accumulators.
+     * @param   block_stripes   number of stripes of the current block (will be adjusted).
+     * @param   data            the stripes.
+     * @param   stripes         number of stripes.
+     */
+    void Consume(std::uint64_t * acc,
+                 std::uint64_t & block_stripes,
+                 unsigned char const * data,
+                 std::uint64_t stripes) const;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Starts a new message.
+     */
+    void Start();
+};
+
+
+}
+
+
+#endif
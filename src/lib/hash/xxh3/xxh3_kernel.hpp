@@ -0,0 +1,123 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_XXH3_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_XXH3_KERNEL_HPP
+
+#include <cstdint>
+
+// Like the BLAKE3 chunk kernels, the SIMD accumulator kernels live in translation units of
+// their own compiled with -msse2 and -mavx2. Keep this header free of inline code.
+
+
+namespace headcode::crypt::xxh3 {
+
+
+/**
+ * @brief   Size of a stripe: the input of a single round on the 8 accumulators.
+ */
+constexpr std::uint64_t kStripeSize = 64;
+
+
+/**
+ * @brief   Size of the secret.
+ */
+constexpr std::uint64_t kSecretSize = 192;
+
+
+/**
+ * @brief   Number of secret bytes the next stripe is moved on by.
+ */
+constexpr std::uint64_t kSecretConsumeRate = 8;
+
+
+/**
+ * @brief   Number of stripes of a block: the accumulators are scrambled after each block.
+ */
+constexpr std::uint64_t kStripesPerBlock = (kSecretSize - kStripeSize) / kSecretConsumeRate;
+
+
+constexpr std::uint32_t kPrime32_1 = 0x9e3779b1u;
+constexpr std::uint32_t kPrime32_2 = 0x85ebca77u;
+constexpr std::uint32_t kPrime32_3 = 0xc2b2ae3du;
+constexpr std::uint64_t kPrime64_1 = 0x9e3779b185ebca87ul;
+constexpr std::uint64_t kPrime64_2 = 0xc2b2ae3d27d4eb4ful;
+constexpr std::uint64_t kPrime64_3 = 0x165667b19e3779f9ul;
+constexpr std::uint64_t kPrime64_4 = 0x85ebca77c2b2ae63ul;
+constexpr std::uint64_t kPrime64_5 = 0x27d4eb2f165667c5ul;
+
+
+/**
+ * @brief   The default secret of XXH3 (the seed 0).
+ */
+extern unsigned char const kDefaultSecret[kSecretSize];
+
+
+/**
+ * @brief   Runs stripes through the 8 accumulators.
+ * Stripe i is keyed with the secret moved on by i * kSecretConsumeRate bytes.
+ * @param   acc         the accumulators.
+ * @param   input       the stripes.
+ * @param   secret      the secret of the first stripe.
+ * @param   stripes     number of stripes.
+ */
+using Accumulate = void (*)(std::uint64_t * acc,
+                            unsigned char const * input,
+                            unsigned char const * secret,
+                            std::uint64_t stripes);
+
+
+/**
+ * @brief   Scrambles the accumulators at the end of a block.
+ * @param   acc         the accumulators.
+ * @param   secret      the last 64 bytes of the secret.
+ */
+using Scramble = void (*)(std::uint64_t * acc, unsigned char const * secret);
+
+
+/**
+ * @brief   An accumulator kernel.
+ */
+struct Kernel {
+    Accumulate accumulate_;         //!< @brief Runs stripes through the accumulators.
+    Scramble scramble_;             //!< @brief Scrambles the accumulators.
+    char const * name_;             //!< @brief A human readable name of the kernel.
+};
+
+
+/**
+ * @brief   Picks the accumulator kernel for this CPU.
+ * @return  The AVX2 or SSE2 kernel if supported, the portable code else.
+ */
+Kernel const & SelectKernel();
+
+
+void AccumulateScalar(std::uint64_t * acc,
+                      unsigned char const * input,
+                      unsigned char const * secret,
+                      std::uint64_t stripes);
+
+void ScrambleScalar(std::uint64_t * acc, unsigned char const * secret);
+
+#ifdef HCS_XXH3_SIMD
+
+void AccumulateSSE2(std::uint64_t * acc, unsigned char const * input, unsigned char const * secret, std::uint64_t stripes);
+
+void ScrambleSSE2(std::uint64_t * acc, unsigned char const * secret);
+
+void AccumulateAVX2(std::uint64_t * acc, unsigned char const * input, unsigned char const * secret, std::uint64_t stripes);
+
+void ScrambleAVX2(std::uint64_t * acc, unsigned char const * secret);
+
+#endif
+
+
+}
+
+
+#endif
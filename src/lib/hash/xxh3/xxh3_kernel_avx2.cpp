@@ -0,0 +1,75 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -mavx2. It is only called after
+// a runtime check of the CPU (see xxh3_dispatch.cpp).
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "xxh3_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+// 4 accumulators in one AVX register: 2 registers for all 8.
+
+using V = __m256i;
+
+inline V Load(void const * p) {
+    return _mm256_loadu_si256(static_cast<V const *>(p));
+}
+
+inline void Store(void * p, V a) {
+    _mm256_storeu_si256(static_cast<V *>(p), a);
+}
+
+
+}
+
+
+void headcode::crypt::xxh3::AccumulateAVX2(std::uint64_t * acc,
+                                           unsigned char const * input,
+                                           unsigned char const * secret,
+                                           std::uint64_t stripes) {
+
+    V a[2] = {Load(acc), Load(acc + 4)};
+
+    for (; stripes > 0; --stripes) {
+        for (int i = 0; i < 2; ++i) {
+            auto data = Load(input + 32 * i);
+            auto key = _mm256_xor_si256(data, Load(secret + 32 * i));
+            // low times high half of each 64 bit lane, plus the data of the neighbouring lane
+            auto product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+            auto swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            a[i] = _mm256_add_epi64(a[i], _mm256_add_epi64(product, swapped));
+        }
+        input += kStripeSize;
+        secret += kSecretConsumeRate;
+    }
+
+    Store(acc, a[0]);
+    Store(acc + 4, a[1]);
+}
+
+
+void headcode::crypt::xxh3::ScrambleAVX2(std::uint64_t * acc, unsigned char const * secret) {
+
+    auto const prime = _mm256_set1_epi32(static_cast<int>(kPrime32_1));
+    for (int i = 0; i < 2; ++i) {
+        auto a = Load(acc + 4 * i);
+        auto key = _mm256_xor_si256(_mm256_xor_si256(a, _mm256_srli_epi64(a, 47)), Load(secret + 32 * i));
+        auto low = _mm256_mul_epu32(key, prime);
+        auto high = _mm256_mul_epu32(_mm256_srli_epi64(key, 32), prime);
+        Store(acc + 4 * i, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+    }
+}
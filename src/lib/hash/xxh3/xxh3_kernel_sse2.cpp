@@ -0,0 +1,79 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -msse2. It is only called after
+// a runtime check of the CPU (see xxh3_dispatch.cpp).
+
+#include <cstdint>
+
+#include <emmintrin.h>
+
+#include "xxh3_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+// 2 accumulators in one SSE register: 4 registers for all 8.
+
+using V = __m128i;
+
+inline V Load(void const * p) {
+    return _mm_loadu_si128(static_cast<V const *>(p));
+}
+
+inline void Store(void * p, V a) {
+    _mm_storeu_si128(static_cast<V *>(p), a);
+}
+
+
+}
+
+
+void headcode::crypt::xxh3::AccumulateSSE2(std::uint64_t * acc,
+                                           unsigned char const * input,
+                                           unsigned char const * secret,
+                                           std::uint64_t stripes) {
+
+    V a[4];
+    for (int i = 0; i < 4; ++i) {
+        a[i] = Load(acc + 2 * i);
+    }
+
+    for (; stripes > 0; --stripes) {
+        for (int i = 0; i < 4; ++i) {
+            auto data = Load(input + 16 * i);
+            auto key = _mm_xor_si128(data, Load(secret + 16 * i));
+            // low times high half of each 64 bit lane, plus the data of the neighbouring lane
+            auto product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+            auto swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            a[i] = _mm_add_epi64(a[i], _mm_add_epi64(product, swapped));
+        }
+        input += kStripeSize;
+        secret += kSecretConsumeRate;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        Store(acc + 2 * i, a[i]);
+    }
+}
+
+
+void headcode::crypt::xxh3::ScrambleSSE2(std::uint64_t * acc, unsigned char const * secret) {
+
+    auto const prime = _mm_set1_epi32(static_cast<int>(kPrime32_1));
+    for (int i = 0; i < 4; ++i) {
+        auto a = Load(acc + 2 * i);
+        auto key = _mm_xor_si128(_mm_xor_si128(a, _mm_srli_epi64(a, 47)), Load(secret + 16 * i));
+        auto low = _mm_mul_epu32(key, prime);
+        auto high = _mm_mul_epu32(_mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        Store(acc + 2 * i, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+    }
+}
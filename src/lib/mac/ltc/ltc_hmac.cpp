@@ -0,0 +1,149 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "ltc_hmac.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCHMAC::LTCHMAC(ltc_hash_descriptor const & descriptor) : descriptor_{descriptor} {
+    zeromem(&inner_start_, sizeof(hash_state));
+    zeromem(&outer_start_, sizeof(hash_state));
+    zeromem(&state_, sizeof(hash_state));
+}
+
+
+LTCHMAC::~LTCHMAC() {
+    zeromem(&inner_start_, sizeof(hash_state));
+    zeromem(&outer_start_, sizeof(hash_state));
+    zeromem(&state_, sizeof(hash_state));
+}
+
+
+int LTCHMAC::Add_(unsigned char const * block_incoming,
+                  std::uint64_t size_incoming,
+                  unsigned char *,
+                  std::uint64_t & size_outgoing) {
+
+    size_outgoing = 0;
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    return descriptor_.process(&state_, block_incoming, size_incoming);
+}
+
+
+int LTCHMAC::Finalize_(unsigned char * result,
+                       std::uint64_t result_size,
+                       std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    if (result_size < descriptor_.hashsize) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    unsigned char inner_digest[MAXBLOCKSIZE];
+    auto res = descriptor_.done(&state_, inner_digest);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    hash_state outer = outer_start_;
+    res = descriptor_.process(&outer, inner_digest, descriptor_.hashsize);
+    if (res == CRYPT_OK) {
+        res = descriptor_.done(&outer, result);
+    }
+
+    zeromem(inner_digest, sizeof(inner_digest));
+    zeromem(&outer, sizeof(hash_state));
+
+    return res;
+}
+
+
+int LTCHMAC::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    keyed_ = false;
+
+    auto iter = initialization_data.find("key");
+    if (iter == initialization_data.end()) {
+        headcode::logger::Warning{"headcode.crypt"} << "HMAC needs a key.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [key_data, key_size] = (*iter).second;
+
+    // keys longer than a block are hashed first, shorter ones are padded with zeros
+    unsigned char key_block[MAXBLOCKSIZE] = {0};
+    int res = CRYPT_OK;
+    if (key_size > descriptor_.blocksize) {
+        hash_state key_state;
+        res = descriptor_.init(&key_state);
+        if (res == CRYPT_OK) {
+            res = descriptor_.process(&key_state, key_data, key_size);
+        }
+        if (res == CRYPT_OK) {
+            res = descriptor_.done(&key_state, key_block);
+        }
+        zeromem(&key_state, sizeof(hash_state));
+    } else if (key_size > 0) {
+        std::memcpy(key_block, key_data, key_size);
+    }
+
+    // the two key blocks are compressed here once and never again for this key
+    unsigned char pad[MAXBLOCKSIZE];
+    for (std::uint64_t i = 0; i < descriptor_.blocksize; ++i) {
+        pad[i] = key_block[i] ^ 0x36u;
+    }
+    if (res == CRYPT_OK) {
+        res = descriptor_.init(&inner_start_);
+    }
+    if (res == CRYPT_OK) {
+        res = descriptor_.process(&inner_start_, pad, descriptor_.blocksize);
+    }
+    for (std::uint64_t i = 0; i < descriptor_.blocksize; ++i) {
+        pad[i] = key_block[i] ^ 0x5cu;
+    }
+    if (res == CRYPT_OK) {
+        res = descriptor_.init(&outer_start_);
+    }
+    if (res == CRYPT_OK) {
+        res = descriptor_.process(&outer_start_, pad, descriptor_.blocksize);
+    }
+
+    zeromem(key_block, sizeof(key_block));
+    zeromem(pad, sizeof(pad));
+
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    state_ = inner_start_;
+    keyed_ = true;
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int LTCHMAC::Reset_() {
+
+    if (!keyed_) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    state_ = inner_start_;
+    return static_cast<int>(Error::kNoError);
+}
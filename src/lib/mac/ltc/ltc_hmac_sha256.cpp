@@ -0,0 +1,87 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include <tomcrypt.h>
+
+#include "ltc_hmac_sha256.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt HMAC-SHA256 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-hmac-sha256",                  // name
+            Family::kMessageAuthenticationCode, // family
+            "LibTomCrypt HMAC-SHA256.",         // description (short/left and long/below)
+
+            "This is HMAC (RFC 2104) on SHA-256: a message authentication code with a 32 byte tag. Pass "
+            "the \"key\" (any size, 64 bytes suggested) at initialization. The inner and outer key "
+            "blocks are hashed once per key: Reset() starts the next message without rehashing them. "
+            "See: https://tools.ietf.org/html/rfc2104.",
+
+            std::string{"libtomcrypt v"} + SCRYPT,        // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kEmpty,                  // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            32ul,                                         // result size
+
+            // initial data
+            {{"key", {64ul, PaddingStrategy::PADDING_NONE, "The secret key (any size).", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCHMACSHA256Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCHMACSHA256>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+LTCHMACSHA256::LTCHMACSHA256() : LTCHMAC{sha256_desc} {
+}
+
+
+Algorithm::Description const & LTCHMACSHA256::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCHMACSHA256::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCHMACSHA256Producer>());
+}
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+
+#include <openssl/crypto.h>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "openssl_hmac.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Largest block of the digests (SHA3-224).
+ */
+static std::uint64_t const kMaxBlockSize = 144;
+
+
+OpenSSLHMAC::OpenSSLHMAC(EVP_MD const * md)
+        : md_{md},
+          inner_start_{EVP_MD_CTX_new()},
+          outer_start_{EVP_MD_CTX_new()},
+          ctx_{EVP_MD_CTX_new()},
+          outer_{EVP_MD_CTX_new()} {
+}
+
+
+OpenSSLHMAC::~OpenSSLHMAC() noexcept {
+    EVP_MD_CTX_free(outer_);
+    EVP_MD_CTX_free(ctx_);
+    EVP_MD_CTX_free(outer_start_);
+    EVP_MD_CTX_free(inner_start_);
+}
+
+
+int OpenSSLHMAC::Add_(unsigned char const * block_incoming,
+                      std::uint64_t size_incoming,
+                      unsigned char *,
+                      std::uint64_t & size_outgoing) {
+
+    size_outgoing = 0;
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    return EVP_DigestUpdate(ctx_, block_incoming, size_incoming) == 1 ? 0 : 1;
+}
+
+
+int OpenSSLHMAC::Finalize_(unsigned char * result,
+                           std::uint64_t result_size,
+                           std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    if (result_size < static_cast<std::uint64_t>(EVP_MD_size(md_))) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    unsigned char inner_digest[EVP_MAX_MD_SIZE];
+    unsigned int inner_size = 0;
+    auto ok = (EVP_DigestFinal_ex(ctx_, inner_digest, &inner_size) == 1) &&
+              (EVP_MD_CTX_copy_ex(outer_, outer_start_) == 1) &&
+              (EVP_DigestUpdate(outer_, inner_digest, inner_size) == 1) &&
+              (EVP_DigestFinal_ex(outer_, result, nullptr) == 1);
+    OPENSSL_cleanse(inner_digest, sizeof(inner_digest));
+
+    return ok ? 0 : 1;
+}
+
+
+int OpenSSLHMAC::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    keyed_ = false;
+
+    auto iter = initialization_data.find("key");
+    if (iter == initialization_data.end()) {
+        headcode::logger::Warning{"headcode.crypt"} << "HMAC needs a key.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [key_data, key_size] = (*iter).second;
+
+    auto block_size = static_cast<std::uint64_t>(EVP_MD_block_size(md_));
+    unsigned char key_block[kMaxBlockSize] = {0};
+    if (block_size > kMaxBlockSize) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // keys longer than a block are hashed first, shorter ones are padded with zeros
+    auto ok = true;
+    if (key_size > block_size) {
+        ok = (EVP_DigestInit_ex(ctx_, md_, nullptr) == 1) && (EVP_DigestUpdate(ctx_, key_data, key_size) == 1) &&
+             (EVP_DigestFinal_ex(ctx_, key_block, nullptr) == 1);
+    } else if (key_size > 0) {
+        std::memcpy(key_block, key_data, key_size);
+    }
+
+    // the two key blocks are hashed here once and never again for this key
+    unsigned char pad[kMaxBlockSize];
+    for (std::uint64_t i = 0; i < block_size; ++i) {
+        pad[i] = key_block[i] ^ 0x36u;
+    }
+    ok = ok && (EVP_DigestInit_ex(inner_start_, md_, nullptr) == 1) &&
+         (EVP_DigestUpdate(inner_start_, pad, block_size) == 1);
+    for (std::uint64_t i = 0; i < block_size; ++i) {
+        pad[i] = key_block[i] ^ 0x5cu;
+    }
+    ok = ok && (EVP_DigestInit_ex(outer_start_, md_, nullptr) == 1) &&
+         (EVP_DigestUpdate(outer_start_, pad, block_size) == 1);
+
+    OPENSSL_cleanse(key_block, sizeof(key_block));
+    OPENSSL_cleanse(pad, sizeof(pad));
+
+    if (!ok || (EVP_MD_CTX_copy_ex(ctx_, inner_start_) != 1)) {
+        return 1;
+    }
+    keyed_ = true;
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int OpenSSLHMAC::Reset_() {
+
+    if (!keyed_) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    return EVP_MD_CTX_copy_ex(ctx_, inner_start_) == 1 ? 0 : 1;
+}
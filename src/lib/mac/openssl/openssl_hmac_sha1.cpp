@@ -0,0 +1,88 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+
+#include "openssl_hmac_sha1.hpp"
+
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The OpenSSL HMAC-SHA1 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "openssl-hmac-sha1",                // name
+            Family::kMessageAuthenticationCode, // family
+            "OpenSSL HMAC-SHA1.",               // description (short/left and long/below)
+
+            "This is HMAC (RFC 2104) on SHA-1: a message authentication code with a 20 byte tag. Pass "
+            "the \"key\" (any size, 64 bytes suggested) at initialization. The inner and outer key "
+            "blocks are hashed once per key: Reset() starts the next message without rehashing them. "
+            "See: https://tools.ietf.org/html/rfc2104.",
+
+            OPENSSL_VERSION_TEXT,                 // provider
+            0ul,                                  // input block size
+            ProcessingBlockSize::kEmpty,          // output block size behaviour
+            0ul,                                  // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,        // default padding strategy
+            20ul,                                 // result size
+
+            // initial data
+            {{"key", {64ul, PaddingStrategy::PADDING_NONE, "The secret key (any size).", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class OpenSSLHMACSHA1Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<OpenSSLHMACSHA1>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+OpenSSLHMACSHA1::OpenSSLHMACSHA1() : OpenSSLHMAC{EVP_sha1()} {
+}
+
+
+Algorithm::Description const & OpenSSLHMACSHA1::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void OpenSSLHMACSHA1::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLHMACSHA1Producer>());
+}
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_MAC_OPENSSL_HMAC_SHA1_HPP
+#define HEADCODE_SPACE_CRYPT_MAC_OPENSSL_HMAC_SHA1_HPP
+
+#include "openssl_hmac.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The OpenSSL HMAC-SHA1 algorithm.
+ */
+class OpenSSLHMACSHA1 : public OpenSSLHMAC {
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+    /**
+     * @brief   Constructor.
+     */
+    OpenSSLHMACSHA1();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,288 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+#include <headcode/crypt/oneshot.hpp>
+
+using namespace headcode::crypt;
+
+
+namespace {
+
+
+/**
+ * @brief   A cached algorithm instance of a thread.
+ */
+struct Slot {
+    std::unique_ptr<Algorithm> algorithm_;        //!< @brief The instance (initialized and reset, if keyed_).
+    std::vector<std::byte> key_;                  //!< @brief Key the instance has been initialized with.
+    std::vector<std::byte> iv_;                   //!< @brief IV the instance has been initialized with.
+    std::vector<std::byte> tail_;                 //!< @brief Reused memory for the output of Finalize().
+    bool keyed_ = false;                          //!< @brief If true, key_ and iv_ are in use by the instance.
+};
+
+
+/**
+ * @brief   All cached algorithm instances of a thread, indexed by AlgorithmId.
+ */
+struct ThreadCache {
+    std::uint64_t version_ = 0;        //!< @brief The registry version the instances stem from.
+    std::vector<Slot> slots_;          //!< @brief The cached instances.
+};
+
+
+}
+
+
+/**
+ * @brief   Drops the cached instance of a slot, e.g. after a failure left it in an unknown state.
+ * @param   slot        the slot.
+ */
+static void Drop(Slot & slot) {
+    slot.algorithm_.reset();
+    slot.keyed_ = false;
+}
+
+
+/**
+ * @brief   Returns the slot of the current thread holding an instance of an algorithm.
+ * A new instance is created on the first call for an algorithm on a thread. If the registry
+ * changed in between, all instances of the thread are dropped.
+ * @param   id          the id of the algorithm.
+ * @return  The slot with an (uninitialized or reset) instance or nullptr if the algorithm is unknown.
+ */
+static Slot * GetSlot(AlgorithmId id) {
+
+    thread_local ThreadCache cache;
+
+    auto version = Factory::GetRegistryVersion();
+    if (cache.version_ != version) {
+        cache.slots_.clear();
+        cache.version_ = version;
+    }
+
+    if ((id < cache.slots_.size()) && (cache.slots_[id].algorithm_ != nullptr)) {
+        return &cache.slots_[id];
+    }
+
+    // unknown ids fail here, before the cache grows
+    auto algorithm = Factory::Create(id);
+    if (algorithm == nullptr) {
+        return nullptr;
+    }
+    if (id >= cache.slots_.size()) {
+        cache.slots_.resize(id + 1);
+    }
+
+    auto & slot = cache.slots_[id];
+    slot.algorithm_ = std::move(algorithm);
+    slot.keyed_ = false;
+    return &slot;
+}
+
+
+/**
+ * @brief   Checks if two memory areas hold the same bytes.
+ * @param   lhs         left hand side.
+ * @param   rhs         right hand side.
+ * @return  true, if both are equal.
+ */
+static bool IsEqual(ByteView lhs, std::vector<std::byte> const & rhs) {
+    return (lhs.size() == rhs.size()) && ((lhs.size() == 0) || (std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0));
+}
+
+
+/**
+ * @brief   Checks if a name ends with a suffix.
+ * @param   name        the name.
+ * @param   suffix      the suffix.
+ * @return  true, if the name ends with the suffix.
+ */
+static bool EndsWith(std::string const & name, std::string const & suffix) {
+    return (name.size() >= suffix.size()) && (name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+
+/**
+ * @brief   Runs a whole message through a symmetric cipher.
+ * @param   id          the id of the cipher.
+ * @param   encrypt     encrypt (or decrypt) the message.
+ * @param   key         the key.
+ * @param   iv          the IV.
+ * @param   data        the message.
+ * @param   result      receives the processed message (cleared on failure).
+ * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+ */
+static int RunCipher(
+        AlgorithmId id, bool encrypt, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result) {
+
+    auto slot = GetSlot(id);
+    if (slot == nullptr) {
+        headcode::logger::Warning{"headcode.crypt"} << "Unknown algorithm for one-shot cipher.";
+        result.clear();
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    auto algorithm = slot->algorithm_.get();
+    auto const & description = algorithm->GetDescription();
+    if (description.family_ != Family::kSymmetricCipher) {
+        headcode::logger::Warning{"headcode.crypt"} << "Algorithm " << description.name_ << " is not a cipher.";
+        result.clear();
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // ciphers without "-encryptor" or "-decryptor" in their name (e.g. CTR) run in both directions
+    if (EndsWith(description.name_, encrypt ? "-decryptor" : "-encryptor")) {
+        headcode::logger::Warning{"headcode.crypt"}
+                << "Algorithm " << description.name_ << " does not " << (encrypt ? "encrypt." : "decrypt.");
+        result.clear();
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // authenticated ciphers need "aad" and "tag", which are not passed here
+    auto const & arguments = description.initialization_argument_;
+    if ((arguments.find("aad") != arguments.end()) || !description.finalization_argument_.empty()) {
+        headcode::logger::Warning{"headcode.crypt"}
+                << "Algorithm " << description.name_ << " is an authenticated cipher: not supported one-shot.";
+        result.clear();
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // re-key only if needed: Reset() brings back the previous key and IV
+    auto takes_key = arguments.find("key") != arguments.end();
+    auto takes_iv = arguments.find("iv") != arguments.end();
+    if (takes_key && !IsEqual(key, slot->key_)) {
+        slot->keyed_ = false;
+    }
+    if (takes_iv && !IsEqual(iv, slot->iv_)) {
+        slot->keyed_ = false;
+    }
+    if (!slot->keyed_) {
+
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> initialization_data;
+        if (takes_key) {
+            initialization_data["key"] = std::make_tuple(key.data(), key.size());
+        }
+        if (takes_iv) {
+            initialization_data["iv"] = std::make_tuple(iv.data(), iv.size());
+        }
+
+        auto res = algorithm->Reinitialize(initialization_data);
+        if (res != 0) {
+            result.clear();
+            return res;
+        }
+
+        auto key_data = reinterpret_cast<std::byte const *>(key.data());
+        slot->key_.assign(key_data, key_data + (takes_key ? key.size() : 0));
+        auto iv_data = reinterpret_cast<std::byte const *>(iv.data());
+        slot->iv_.assign(iv_data, iv_data + (takes_iv ? iv.size() : 0));
+        slot->keyed_ = true;
+    }
+
+    result.resize(algorithm->GetOutgoingSize(data.size()));
+    std::uint64_t size_outgoing = 0;
+    auto res = algorithm->Add(data, MutableByteView{result}, size_outgoing);
+    if (res == 0) {
+        result.resize(size_outgoing);
+        res = algorithm->Finalize(slot->tail_);
+        result.insert(result.end(), slot->tail_.begin(), slot->tail_.end());
+    }
+
+    // an encryptor refusing to reuse its IV is re-keyed on the next call
+    auto reset = algorithm->Reset();
+    if (reset == static_cast<int>(Error::kInvalidOperation)) {
+        slot->keyed_ = false;
+    } else if (reset != 0) {
+        Drop(*slot);
+    }
+
+    if (res != 0) {
+        result.clear();
+    }
+    return res;
+}
+
+
+int headcode::crypt::Decrypt(
+        std::string const & name, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result) {
+    return RunCipher(Factory::Resolve(name), false, key, iv, data, result);
+}
+
+
+int headcode::crypt::Decrypt(
+        AlgorithmId id, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result) {
+    return RunCipher(id, false, key, iv, data, result);
+}
+
+
+int headcode::crypt::Digest(std::string const & name, ByteView data, std::vector<std::byte> & result) {
+    return Digest(Factory::Resolve(name), data, result);
+}
+
+
+int headcode::crypt::Digest(AlgorithmId id, ByteView data, std::vector<std::byte> & result) {
+
+    auto slot = GetSlot(id);
+    if (slot == nullptr) {
+        headcode::logger::Warning{"headcode.crypt"} << "Unknown algorithm for one-shot digest.";
+        result.clear();
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    auto algorithm = slot->algorithm_.get();
+    auto const & description = algorithm->GetDescription();
+    if (description.family_ != Family::kHash) {
+        headcode::logger::Warning{"headcode.crypt"} << "Algorithm " << description.name_ << " is not a hash.";
+        result.clear();
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    if (!slot->keyed_) {
+        auto res = algorithm->Reinitialize(std::map<std::string, std::vector<std::byte>>{});
+        if (res != 0) {
+            result.clear();
+            return res;
+        }
+        slot->keyed_ = true;
+    }
+
+    auto res = algorithm->Add(data);
+    if (res == 0) {
+        res = algorithm->Finalize(result);
+    }
+
+    if (algorithm->Reset() != 0) {
+        Drop(*slot);
+    }
+
+    if (res != 0) {
+        result.clear();
+    }
+    return res;
+}
+
+
+int headcode::crypt::Encrypt(
+        std::string const & name, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result) {
+    return RunCipher(Factory::Resolve(name), true, key, iv, data, result);
+}
+
+
+int headcode::crypt::Encrypt(
+        AlgorithmId id, ByteView key, ByteView iv, ByteView data, std::vector<std::byte> & result) {
+    return RunCipher(id, true, key, iv, data, result);
+}
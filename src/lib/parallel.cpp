@@ -0,0 +1,57 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include <headcode/crypt/parallel.hpp>
+
+#include "worker_pool.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Minimum size of a buffer processed in parallel.
+ */
+static std::atomic<std::uint64_t> threshold{Parallelism::kDefaultThreshold};
+
+
+/**
+ * @brief   Max number of threads on a single buffer (0: all cores, 1: off).
+ */
+static std::atomic<unsigned int> threads{1};
+
+
+Parallelism headcode::crypt::GetParallelism() {
+    Parallelism parallelism;
+    parallelism.threshold_ = threshold;
+    parallelism.threads_ = threads;
+    return parallelism;
+}
+
+
+void headcode::crypt::SetParallelism(Parallelism const & parallelism) {
+    threshold = parallelism.threshold_;
+    threads = parallelism.threads_;
+}
+
+
+std::uint64_t headcode::crypt::GetSliceCount(std::uint64_t size, std::uint64_t min_slice) {
+
+    if ((size < threshold) || (threads == 1)) {
+        return 1;
+    }
+
+    std::uint64_t max_slices = threads;
+    if (max_slices == 0) {
+        max_slices = WorkerPool::GetInstance().GetThreads();
+    }
+
+    return std::max<std::uint64_t>(std::min(max_slices, size / std::max<std::uint64_t>(min_slice, 1)), 1);
+}
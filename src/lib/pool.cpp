@@ -0,0 +1,117 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "pool.hpp"
+
+using namespace headcode::crypt;
+
+
+Pool::Pool(std::shared_ptr<Factory::Producer> producer) : producer_{std::move(producer)}, limit_{kDefaultLimit} {
+}
+
+
+std::unique_ptr<Algorithm> Pool::Acquire(
+        std::map<std::string, std::vector<std::byte>> const & initialization_data) {
+
+    std::unique_ptr<Algorithm> algorithm;
+
+    // a cipher reinitialized without "key" keeps its key schedule: never the one of a previous user
+    auto recycle = true;
+    if (producer_ != nullptr) {
+        auto const & description = producer_->GetDescription();
+        if ((description.family_ == Family::kSymmetricCipher) &&
+            (description.initialization_argument_.find("key") != description.initialization_argument_.end())) {
+            recycle = initialization_data.find("key") != initialization_data.end();
+        }
+    }
+
+    auto & shard = GetShard();
+    if (recycle) {
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        if (!shard.idle_.empty()) {
+            algorithm = std::move(shard.idle_.back());
+            shard.idle_.pop_back();
+            size_--;
+        }
+    }
+
+    if (algorithm != nullptr) {
+        hits_++;
+        if (!algorithm->GetDescription().initialization_argument_.empty()) {
+            if (algorithm->Reinitialize(initialization_data) != 0) {
+                algorithm.reset();
+            }
+        }
+        return algorithm;
+    }
+
+    misses_++;
+    if (producer_ != nullptr) {
+        algorithm = (*producer_)();
+    }
+    if ((algorithm != nullptr) && (algorithm->Initialize(initialization_data) != 0)) {
+        algorithm.reset();
+    }
+
+    return algorithm;
+}
+
+
+Pool::Shard & Pool::GetShard() {
+
+    // each thread picks its shard once, round robin
+    static std::atomic<std::uint64_t> next_shard{0};
+    thread_local std::uint64_t shard_index = next_shard++ % kShards;
+
+    return shards_[shard_index];
+}
+
+
+Factory::PoolStatistics Pool::GetStatistics() const {
+    return Factory::PoolStatistics{hits_, misses_, size_, limit_};
+}
+
+
+void Pool::Release(std::unique_ptr<Algorithm> algorithm) {
+
+    if (algorithm == nullptr) {
+        return;
+    }
+
+    // an encryptor refuses to Reset() to its IV, but Acquire() initializes it anew anyway
+    if ((algorithm->Reset() != 0) && algorithm->GetDescription().initialization_argument_.empty()) {
+        return;
+    }
+
+    if (size_++ >= limit_) {
+        // pool is full: the instance is destroyed on return
+        size_--;
+        return;
+    }
+
+    auto & shard = GetShard();
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    shard.idle_.push_back(std::move(algorithm));
+}
+
+
+void Pool::SetLimit(std::uint64_t limit) {
+
+    limit_ = limit;
+
+    // surplus instances are destroyed outside of the shard locks
+    std::vector<std::unique_ptr<Algorithm>> surplus;
+    for (auto & shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        while (!shard.idle_.empty() && (size_ > limit_)) {
+            surplus.push_back(std::move(shard.idle_.back()));
+            shard.idle_.pop_back();
+            size_--;
+        }
+    }
+}
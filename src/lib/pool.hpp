@@ -0,0 +1,138 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_POOL_HPP
+#define HEADCODE_SPACE_CRYPT_POOL_HPP
+
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <headcode/crypt/algorithm.hpp>
+#include <headcode/crypt/factory.hpp>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   A pool of recycled instances of a single algorithm.
+ *
+ * The pool is sharded: each thread sticks to one shard, so threads on different
+ * shards never contend on the same mutex nor cache line. Instances given back
+ * are Reset() and parked in the shard of the releasing thread.
+ */
+class Pool {
+
+    /**
+     * @brief   Number of shards of a pool.
+     */
+    static constexpr std::uint64_t kShards = 16;
+
+    /**
+     * @brief   A single shard: a stack of idle instances guarded by its own mutex.
+     */
+    struct alignas(64) Shard {
+        std::mutex mutex_;                                    //!< @brief Guards the idle instances.
+        std::vector<std::unique_ptr<Algorithm>> idle_;        //!< @brief The idle instances.
+    };
+
+    std::shared_ptr<Factory::Producer> producer_;        //!< @brief Creates new instances on a miss.
+    std::array<Shard, kShards> shards_;                  //!< @brief The shards.
+
+    std::atomic<std::uint64_t> hits_{0};            //!< @brief Number of instances served from the pool.
+    std::atomic<std::uint64_t> misses_{0};          //!< @brief Number of instances created anew.
+    std::atomic<std::uint64_t> size_{0};            //!< @brief Number of idle instances in all shards.
+    std::atomic<std::uint64_t> limit_;              //!< @brief Max number of idle instances kept.
+
+public:
+    /**
+     * @brief   Default maximum number of idle instances kept per algorithm.
+     */
+    static constexpr std::uint64_t kDefaultLimit = 64;
+
+    /**
+     * @brief   Constructor.
+     * @param   producer        the producer of the algorithm pooled.
+     */
+    explicit Pool(std::shared_ptr<Factory::Producer> producer);
+
+    /**
+     * @brief   Copy Constructor.
+     */
+    Pool(Pool const &) = delete;
+
+    /**
+     * @brief   Move Constructor.
+     */
+    Pool(Pool &&) = delete;
+
+    /**
+     * @brief   Destructor.
+     */
+    ~Pool() = default;
+
+    /**
+     * @brief   Assignment.
+     * @return  this.
+     */
+    Pool & operator=(Pool const &) = delete;
+
+    /**
+     * @brief   Move Assignment.
+     * @return  this.
+     */
+    Pool & operator=(Pool &&) = delete;
+
+    /**
+     * @brief   Hands out an initialized instance.
+     * A recycled instance is Reinitialize()d only if the algorithm takes initialization
+     * arguments. Otherwise the state left by Reset() is already the initialized state.
+     * Ciphers are recycled only if a "key" is given: they keep the previous key otherwise.
+     * @param   initialization_data     the initialization arguments.
+     * @return  An initialized instance (or nullptr on failure).
+     */
+    std::unique_ptr<Algorithm> Acquire(std::map<std::string, std::vector<std::byte>> const & initialization_data);
+
+    /**
+     * @brief   Returns the pool statistics.
+     * @return  The current pool statistics.
+     */
+    Factory::PoolStatistics GetStatistics() const;
+
+    /**
+     * @brief   Takes back an instance.
+     * The instance is Reset() and kept if the pool is not full. Otherwise it is destroyed.
+     * An instance refusing Reset() is kept only if Acquire() reinitializes it.
+     * @param   algorithm       the instance to take back.
+     */
+    void Release(std::unique_ptr<Algorithm> algorithm);
+
+    /**
+     * @brief   Sets the maximum number of idle instances kept. Surplus idle instances are destroyed.
+     * @param   limit           the new limit (0 disables pooling).
+     */
+    void SetLimit(std::uint64_t limit);
+
+private:
+    /**
+     * @brief   Returns the shard of the calling thread.
+     * @return  The shard of the calling thread.
+     */
+    Shard & GetShard();
+};
+
+
+}
+
+
+#endif
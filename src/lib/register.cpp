@@ -8,7 +8,17 @@
 
 #include "register.hpp"
 
+#include "checksum/crc/crc32.hpp"
+#include "checksum/crc/crc32c.hpp"
+#include "checksum/crc/crc64.hpp"
+
 #include "hash/nohash.hpp"
+#include "hash/blake2/blake2bp.hpp"
+#include "hash/blake2/blake2sp.hpp"
+#include "hash/blake3/blake3.hpp"
+#include "hash/ltc/ltc_blake2b256.hpp"
+#include "hash/ltc/ltc_blake2b512.hpp"
+#include "hash/ltc/ltc_blake2s256.hpp"
 #include "hash/ltc/ltc_md5.hpp"
 #include "hash/ltc/ltc_ripemd128.hpp"
 #include "hash/ltc/ltc_ripemd160.hpp"
@@ -19,7 +29,25 @@
 #include "hash/ltc/ltc_sha256.hpp"
 #include "hash/ltc/ltc_sha384.hpp"
 #include "hash/ltc/ltc_sha512.hpp"
+#include "hash/ltc/ltc_sha512_224.hpp"
+#include "hash/ltc/ltc_sha512_256.hpp"
+#include "hash/ltc/ltc_sha3_224.hpp"
+#include "hash/ltc/ltc_sha3_256.hpp"
+#include "hash/ltc/ltc_sha3_384.hpp"
+#include "hash/ltc/ltc_sha3_512.hpp"
+#include "hash/ltc/ltc_shake128.hpp"
+#include "hash/ltc/ltc_shake256.hpp"
 #include "hash/ltc/ltc_tiger192.hpp"
+#include "hash/mb/mb_md5.hpp"
+#include "hash/mb/mb_sha1.hpp"
+#include "hash/mb/mb_sha256.hpp"
+#include "hash/shani/shani_sha1.hpp"
+#include "hash/shani/shani_sha224.hpp"
+#include "hash/shani/shani_sha256.hpp"
+#include "hash/siphash/siphash24_64.hpp"
+#include "hash/siphash/siphash24_128.hpp"
+#include "hash/xxh3/xxh3_64.hpp"
+#include "hash/xxh3/xxh3_128.hpp"
 
 #ifdef OPENSSL
 #include "hash/openssl/openssl_md5.hpp"
@@ -29,6 +57,18 @@
 #include "hash/openssl/openssl_sha256.hpp"
 #include "hash/openssl/openssl_sha384.hpp"
 #include "hash/openssl/openssl_sha512.hpp"
+#include "hash/openssl/openssl_sha512_224.hpp"
+#include "hash/openssl/openssl_sha512_256.hpp"
+#endif
+
+#include "mac/ltc/ltc_hmac_sha1.hpp"
+#include "mac/ltc/ltc_hmac_sha256.hpp"
+#include "mac/ltc/ltc_hmac_sha512.hpp"
+
+#ifdef OPENSSL
+#include "mac/openssl/openssl_hmac_sha1.hpp"
+#include "mac/openssl/openssl_hmac_sha256.hpp"
+#include "mac/openssl/openssl_hmac_sha512.hpp"
 #endif
 
 #include "symmetric_cipher/copy.hpp"
@@ -38,6 +78,20 @@
 #include "symmetric_cipher/ltc/aes/cbc/ltc_aes_192_cbc_encrypter.hpp"
 #include "symmetric_cipher/ltc/aes/cbc/ltc_aes_256_cbc_decrypter.hpp"
 #include "symmetric_cipher/ltc/aes/cbc/ltc_aes_256_cbc_encrypter.hpp"
+#include "symmetric_cipher/ltc/aes/ctr/ltc_aes_128_ctr.hpp"
+#include "symmetric_cipher/ltc/aes/ctr/ltc_aes_192_ctr.hpp"
+#include "symmetric_cipher/ltc/aes/ctr/ltc_aes_256_ctr.hpp"
+#include "symmetric_cipher/ltc/aes/gcm/ltc_aes_128_gcm_decrypter.hpp"
+#include "symmetric_cipher/ltc/aes/gcm/ltc_aes_128_gcm_encrypter.hpp"
+#include "symmetric_cipher/ltc/aes/gcm/ltc_aes_256_gcm_decrypter.hpp"
+#include "symmetric_cipher/ltc/aes/gcm/ltc_aes_256_gcm_encrypter.hpp"
+#include "symmetric_cipher/ltc/aes/xts/ltc_aes_128_xts_decrypter.hpp"
+#include "symmetric_cipher/ltc/aes/xts/ltc_aes_128_xts_encrypter.hpp"
+#include "symmetric_cipher/ltc/aes/xts/ltc_aes_256_xts_decrypter.hpp"
+#include "symmetric_cipher/ltc/aes/xts/ltc_aes_256_xts_encrypter.hpp"
+#include "symmetric_cipher/ltc/chacha/ltc_chacha20.hpp"
+#include "symmetric_cipher/ltc/chacha/ltc_chacha20_poly1305_decrypter.hpp"
+#include "symmetric_cipher/ltc/chacha/ltc_chacha20_poly1305_encrypter.hpp"
 #include "symmetric_cipher/ltc/aes/ecb/ltc_aes_128_ecb_decrypter.hpp"
 #include "symmetric_cipher/ltc/aes/ecb/ltc_aes_128_ecb_encrypter.hpp"
 #include "symmetric_cipher/ltc/aes/ecb/ltc_aes_192_ecb_decrypter.hpp"
@@ -58,6 +112,19 @@
 #include "symmetric_cipher/openssl/aes/cbc/openssl_aes_256_cbc_encryptor.hpp"
 #include "symmetric_cipher/openssl/aes/ecb/openssl_aes_256_ecb_decryptor.hpp"
 #include "symmetric_cipher/openssl/aes/ecb/openssl_aes_256_ecb_encryptor.hpp"
+#include "symmetric_cipher/openssl/aes/ctr/openssl_aes_128_ctr.hpp"
+#include "symmetric_cipher/openssl/aes/ctr/openssl_aes_192_ctr.hpp"
+#include "symmetric_cipher/openssl/aes/ctr/openssl_aes_256_ctr.hpp"
+#include "symmetric_cipher/openssl/aes/gcm/openssl_aes_128_gcm_decryptor.hpp"
+#include "symmetric_cipher/openssl/aes/gcm/openssl_aes_128_gcm_encryptor.hpp"
+#include "symmetric_cipher/openssl/aes/gcm/openssl_aes_256_gcm_decryptor.hpp"
+#include "symmetric_cipher/openssl/aes/gcm/openssl_aes_256_gcm_encryptor.hpp"
+#include "symmetric_cipher/openssl/aes/xts/openssl_aes_128_xts_decryptor.hpp"
+#include "symmetric_cipher/openssl/aes/xts/openssl_aes_128_xts_encryptor.hpp"
+#include "symmetric_cipher/openssl/aes/xts/openssl_aes_256_xts_decryptor.hpp"
+#include "symmetric_cipher/openssl/aes/xts/openssl_aes_256_xts_encryptor.hpp"
+#include "symmetric_cipher/openssl/chacha/openssl_chacha20_poly1305_decryptor.hpp"
+#include "symmetric_cipher/openssl/chacha/openssl_chacha20_poly1305_encryptor.hpp"
 #endif
 
 
@@ -65,6 +132,9 @@ void headcode::crypt::RegisterKnownAlgorithms() {
 
     NoHash::Register();
 
+    LTCBLAKE2b256::Register();
+    LTCBLAKE2b512::Register();
+    LTCBLAKE2s256::Register();
     LTCMD5::Register();
     LTCRIPEMD128::Register();
     LTCRIPEMD160::Register();
@@ -75,8 +145,42 @@ void headcode::crypt::RegisterKnownAlgorithms() {
     LTCSHA256::Register();
     LTCSHA384::Register();
     LTCSHA512::Register();
+    LTCSHA512224::Register();
+    LTCSHA512256::Register();
+    LTCSHA3224::Register();
+    LTCSHA3256::Register();
+    LTCSHA3384::Register();
+    LTCSHA3512::Register();
+    LTCSHAKE128::Register();
+    LTCSHAKE256::Register();
     LTCTIGER192::Register();
 
+    MBMD5::Register();
+    MBSHA1::Register();
+    MBSHA256::Register();
+
+    SHANISHA1::Register();
+    SHANISHA224::Register();
+    SHANISHA256::Register();
+
+    BLAKE2bp::Register();
+    BLAKE2sp::Register();
+    BLAKE3::Register();
+
+    XXH3_64::Register();
+    XXH3_128::Register();
+
+    SipHash24_64::Register();
+    SipHash24_128::Register();
+
+    CRC32::Register();
+    CRC32C::Register();
+    CRC64::Register();
+
+    LTCHMACSHA1::Register();
+    LTCHMACSHA256::Register();
+    LTCHMACSHA512::Register();
+
     Copy::Register();
 
     LTCAES128CBCDecrypter::Register();
@@ -91,6 +195,20 @@ void headcode::crypt::RegisterKnownAlgorithms() {
     LTCAES192ECBEncrypter::Register();
     LTCAES256ECBDecrypter::Register();
     LTCAES256ECBEncrypter::Register();
+    LTCAES128CTRCipher::Register();
+    LTCAES192CTRCipher::Register();
+    LTCAES256CTRCipher::Register();
+    LTCAES128GCMDecrypter::Register();
+    LTCAES128GCMEncrypter::Register();
+    LTCAES256GCMDecrypter::Register();
+    LTCAES256GCMEncrypter::Register();
+    LTCAES128XTSDecrypter::Register();
+    LTCAES128XTSEncrypter::Register();
+    LTCAES256XTSDecrypter::Register();
+    LTCAES256XTSEncrypter::Register();
+    LTCChaCha20Cipher::Register();
+    LTCChaCha20Poly1305Decrypter::Register();
+    LTCChaCha20Poly1305Encrypter::Register();
 
 #ifdef OPENSSL
 
@@ -101,6 +219,12 @@ void headcode::crypt::RegisterKnownAlgorithms() {
     OpenSSLSHA256::Register();
     OpenSSLSHA384::Register();
     OpenSSLSHA512::Register();
+    OpenSSLSHA512224::Register();
+    OpenSSLSHA512256::Register();
+
+    OpenSSLHMACSHA1::Register();
+    OpenSSLHMACSHA256::Register();
+    OpenSSLHMACSHA512::Register();
 
     OpenSSLAES128CBCDecrypter::Register();
     OpenSSLAES128CBCEncrypter::Register();
@@ -114,6 +238,19 @@ void headcode::crypt::RegisterKnownAlgorithms() {
     OpenSSLAES256CBCEncrypter::Register();
     OpenSSLAES256ECBDecrypter::Register();
     OpenSSLAES256ECBEncrypter::Register();
+    OpenSSLAES128CTRCipher::Register();
+    OpenSSLAES192CTRCipher::Register();
+    OpenSSLAES256CTRCipher::Register();
+    OpenSSLAES128GCMDecrypter::Register();
+    OpenSSLAES128GCMEncrypter::Register();
+    OpenSSLAES256GCMDecrypter::Register();
+    OpenSSLAES256GCMEncrypter::Register();
+    OpenSSLAES128XTSDecrypter::Register();
+    OpenSSLAES128XTSEncrypter::Register();
+    OpenSSLAES256XTSDecrypter::Register();
+    OpenSSLAES256XTSEncrypter::Register();
+    OpenSSLChaCha20Poly1305Decrypter::Register();
+    OpenSSLChaCha20Poly1305Encrypter::Register();
 
 #endif
 }
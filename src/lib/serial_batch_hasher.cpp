@@ -0,0 +1,61 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/error.hpp>
+
+#include "serial_batch_hasher.hpp"
+
+using namespace headcode::crypt;
+
+
+SerialBatchHasher::SerialBatchHasher(std::shared_ptr<Factory::Producer> producer) : producer_{std::move(producer)} {
+}
+
+
+Algorithm::Description const & SerialBatchHasher::GetDescription_() const {
+    return producer_->GetDescription();
+}
+
+
+std::uint64_t SerialBatchHasher::GetLanes_() const {
+    return 1;
+}
+
+
+int SerialBatchHasher::Hash_(ByteView const * messages, std::uint64_t count, unsigned char * digests) {
+
+    if (algorithm_ == nullptr) {
+        algorithm_ = (*producer_)();
+        if (algorithm_ == nullptr) {
+            return static_cast<int>(Error::kInvalidOperation);
+        }
+        auto res = algorithm_->Initialize();
+        if (res != 0) {
+            algorithm_.reset();
+            return res;
+        }
+    }
+
+    auto result_size = GetDescription().result_size_;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        auto res = algorithm_->Add(messages[i]);
+        if (res == 0) {
+            res = algorithm_->Finalize(MutableByteView{digests + i * result_size, result_size});
+        }
+        auto res_reset = algorithm_->Reset();
+        if (res != 0) {
+            return res;
+        }
+        if (res_reset != 0) {
+            algorithm_.reset();
+            return res_reset;
+        }
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
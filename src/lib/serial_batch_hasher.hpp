@@ -0,0 +1,64 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_SERIAL_BATCH_HASHER_HPP
+#define HEADCODE_SPACE_CRYPT_SERIAL_BATCH_HASHER_HPP
+
+#include <memory>
+
+#include <headcode/crypt/batch_hasher.hpp>
+#include <headcode/crypt/factory.hpp>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   A batch hasher for hashes without a multi-buffer implementation.
+ * The messages are hashed one after the other on a single, reused instance.
+ */
+class SerialBatchHasher : public BatchHasher {
+
+    std::shared_ptr<Factory::Producer> producer_;        //!< @brief Creates the hash instance.
+    std::unique_ptr<Algorithm> algorithm_;               //!< @brief The hash instance (created on first use).
+
+public:
+    /**
+     * @brief   Constructor.
+     * @param   producer        the producer of the hash.
+     */
+    explicit SerialBatchHasher(std::shared_ptr<Factory::Producer> producer);
+
+private:
+    /**
+     * @brief   Gets the description of the hash.
+     * @return  A structure describing the hash.
+     */
+    Algorithm::Description const & GetDescription_() const override;
+
+    /**
+     * @brief   Gets the number of messages hashed side by side.
+     * @return  The number of lanes.
+     */
+    std::uint64_t GetLanes_() const override;
+
+    /**
+     * @brief   Hashes a batch of messages.
+     * @param   messages        the messages.
+     * @param   count           the number of messages.
+     * @param   digests         receives the digests (count * result size bytes).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Hash_(ByteView const * messages, std::uint64_t count, unsigned char * digests) override;
+};
+
+
+}
+
+
+#endif
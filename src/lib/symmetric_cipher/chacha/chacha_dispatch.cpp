@@ -0,0 +1,69 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "chacha_kernel.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Checks if the CPU (and the OS) supports AVX2.
+ * @return  true, if the AVX2 kernel may run.
+ */
+static bool HasAVX2() {
+#ifdef HCS_CHACHA_SIMD
+    static bool const avx2 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return avx2;
+#else
+    return false;
+#endif
+}
+
+
+/**
+ * @brief   Checks if the CPU supports SSE2.
+ * @return  true, if the SSE2 kernel may run.
+ */
+static bool HasSSE2() {
+#ifdef HCS_CHACHA_SIMD
+    static bool const sse2 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2") != 0;
+    }();
+    return sse2;
+#else
+    return false;
+#endif
+}
+
+
+chacha::Kernel headcode::crypt::chacha::SelectKernel() {
+#ifdef HCS_CHACHA_SIMD
+    if (HasAVX2()) {
+        return XorAVX2;
+    }
+    if (HasSSE2()) {
+        return XorSSE2;
+    }
+#endif
+    return XorScalar;
+}
+
+
+char const * headcode::crypt::chacha::GetKernelName() {
+    if (HasAVX2()) {
+        return "AVX2 8 block keystream";
+    }
+    if (HasSSE2()) {
+        return "SSE2 4 block keystream";
+    }
+    return "portable keystream";
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_SYMMETRIC_CIPHER_CHACHA_KERNEL_HPP
+#define HEADCODE_SPACE_CRYPT_SYMMETRIC_CIPHER_CHACHA_KERNEL_HPP
+
+#include <cstdint>
+
+// Like the multi-buffer hash kernels, the SIMD keystream kernels live in translation units
+// of their own compiled with -msse2 and -mavx2. Keep this header free of inline code.
+
+
+namespace headcode::crypt::chacha {
+
+
+/**
+ * @brief   Size of a ChaCha block.
+ */
+constexpr std::uint64_t kBlockSize = 64;
+
+
+/**
+ * @brief   XORs whole blocks of keystream onto the data.
+ * The input are the 16 words of the ChaCha state: constants, key, the block counter in word 12
+ * and the nonce. Block i of the data is run with the counter word 12 increased by i. The caller
+ * keeps the counter from wrapping and advances it afterwards.
+ * @param   input       the ChaCha state (16 words).
+ * @param   rounds      number of rounds (20 for ChaCha20).
+ * @param   in          the incoming data.
+ * @param   out         the outgoing data (may be the incoming data).
+ * @param   blocks      number of blocks to process.
+ */
+using Kernel = void (*)(std::uint32_t const * input,
+                        unsigned int rounds,
+                        unsigned char const * in,
+                        unsigned char * out,
+                        std::uint64_t blocks);
+
+
+/**
+ * @brief   Picks the keystream kernel for this CPU.
+ * @return  The AVX2 (8 blocks) or SSE2 (4 blocks) kernel if supported, the portable code else.
+ */
+Kernel SelectKernel();
+
+
+/**
+ * @brief   Names the kernel picked by SelectKernel().
+ * @return  A human readable name of the keystream kernel.
+ */
+char const * GetKernelName();
+
+
+void XorScalar(std::uint32_t const * input,
+               unsigned int rounds,
+               unsigned char const * in,
+               unsigned char * out,
+               std::uint64_t blocks);
+
+#ifdef HCS_CHACHA_SIMD
+
+void XorSSE2(std::uint32_t const * input,
+             unsigned int rounds,
+             unsigned char const * in,
+             unsigned char * out,
+             std::uint64_t blocks);
+
+void XorAVX2(std::uint32_t const * input,
+             unsigned int rounds,
+             unsigned char const * in,
+             unsigned char * out,
+             std::uint64_t blocks);
+
+#endif
+
+
+}
+
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -mavx2. It is only called after
+// a runtime check of the CPU (see chacha_dispatch.cpp).
+
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "chacha_kernel.hpp"
+
+
+namespace {
+
+
+// 8 blocks: word i of each block in one AVX2 register.
+
+using V = __m256i;
+
+constexpr std::uint64_t kBlocks = 8;
+
+template <int n>
+inline V Rotl(V a) {
+    return _mm256_or_si256(_mm256_slli_epi32(a, n), _mm256_srli_epi32(a, 32 - n));
+}
+
+// rotations by whole bytes are a single byte shuffle
+inline V Rotl16(V a) {
+    auto const shuffle = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                          2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline V Rotl8(V a) {
+    auto const shuffle = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+                                          3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+    return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline void QuarterRound(V & a, V & b, V & c, V & d) {
+    a = _mm256_add_epi32(a, b);
+    d = Rotl16(_mm256_xor_si256(d, a));
+    c = _mm256_add_epi32(c, d);
+    b = Rotl<12>(_mm256_xor_si256(b, c));
+    a = _mm256_add_epi32(a, b);
+    d = Rotl8(_mm256_xor_si256(d, a));
+    c = _mm256_add_epi32(c, d);
+    b = Rotl<7>(_mm256_xor_si256(b, c));
+}
+
+/**
+ * @brief   XORs 16 bytes of keystream onto the data.
+ * @param   key         the keystream.
+ * @param   in          the incoming data.
+ * @param   out         the outgoing data.
+ */
+inline void Xor(__m128i key, unsigned char const * in, unsigned char * out) {
+    auto data = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_xor_si128(data, key));
+}
+
+/**
+ * @brief   Transposes 4 words of 8 blocks into 16 bytes of each block and XORs them onto the data.
+ * @param   x           words i to i + 3 of the 8 blocks.
+ * @param   in          the incoming data at word i of block 0.
+ * @param   out         the outgoing data at word i of block 0.
+ */
+inline void Store(V const * x, unsigned char const * in, unsigned char * out) {
+
+    // a 4x4 transpose in each 128 bit lane: blocks 0 to 3 low, blocks 4 to 7 high
+    auto t0 = _mm256_unpacklo_epi32(x[0], x[1]);
+    auto t1 = _mm256_unpacklo_epi32(x[2], x[3]);
+    auto t2 = _mm256_unpackhi_epi32(x[0], x[1]);
+    auto t3 = _mm256_unpackhi_epi32(x[2], x[3]);
+
+    V const rows[4] = {_mm256_unpacklo_epi64(t0, t1),
+                       _mm256_unpackhi_epi64(t0, t1),
+                       _mm256_unpacklo_epi64(t2, t3),
+                       _mm256_unpackhi_epi64(t2, t3)};
+
+    auto const block_size = headcode::crypt::chacha::kBlockSize;
+    for (std::uint64_t block = 0; block < 4; ++block) {
+        auto offset = block * block_size;
+        Xor(_mm256_castsi256_si128(rows[block]), in + offset, out + offset);
+        offset += 4 * block_size;
+        Xor(_mm256_extracti128_si256(rows[block], 1), in + offset, out + offset);
+    }
+}
+
+
+}
+
+
+void headcode::crypt::chacha::XorAVX2(std::uint32_t const * input,
+                                      unsigned int rounds,
+                                      unsigned char const * in,
+                                      unsigned char * out,
+                                      std::uint64_t blocks) {
+
+    V state[16];
+    for (int i = 0; i < 16; ++i) {
+        state[i] = _mm256_set1_epi32(static_cast<int>(input[i]));
+    }
+    state[12] = _mm256_add_epi32(state[12], _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+    for (; blocks >= kBlocks; blocks -= kBlocks, in += kBlocks * kBlockSize, out += kBlocks * kBlockSize) {
+
+        V x[16];
+        for (int i = 0; i < 16; ++i) {
+            x[i] = state[i];
+        }
+        for (unsigned int round = 0; round < rounds; round += 2) {
+            QuarterRound(x[0], x[4], x[8], x[12]);
+            QuarterRound(x[1], x[5], x[9], x[13]);
+            QuarterRound(x[2], x[6], x[10], x[14]);
+            QuarterRound(x[3], x[7], x[11], x[15]);
+            QuarterRound(x[0], x[5], x[10], x[15]);
+            QuarterRound(x[1], x[6], x[11], x[12]);
+            QuarterRound(x[2], x[7], x[8], x[13]);
+            QuarterRound(x[3], x[4], x[9], x[14]);
+        }
+        for (int i = 0; i < 16; ++i) {
+            x[i] = _mm256_add_epi32(x[i], state[i]);
+        }
+
+        for (int i = 0; i < 16; i += 4) {
+            Store(x + i, in + i * 4, out + i * 4);
+        }
+        state[12] = _mm256_add_epi32(state[12], _mm256_set1_epi32(kBlocks));
+    }
+
+    // less than 8 blocks left: on the 4 block kernel
+    if (blocks > 0) {
+        std::uint32_t rest[16];
+        for (int i = 0; i < 16; ++i) {
+            rest[i] = input[i];
+        }
+        rest[12] = static_cast<std::uint32_t>(_mm256_extract_epi32(state[12], 0));
+        XorSSE2(rest, rounds, in, out, blocks);
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstdint>
+
+#include "chacha_kernel.hpp"
+
+
+namespace {
+
+
+inline std::uint32_t Rotl(std::uint32_t a, int n) {
+    return (a << n) | (a >> (32 - n));
+}
+
+inline void QuarterRound(std::uint32_t * x, int a, int b, int c, int d) {
+    x[a] += x[b];
+    x[d] = Rotl(x[d] ^ x[a], 16);
+    x[c] += x[d];
+    x[b] = Rotl(x[b] ^ x[c], 12);
+    x[a] += x[b];
+    x[d] = Rotl(x[d] ^ x[a], 8);
+    x[c] += x[d];
+    x[b] = Rotl(x[b] ^ x[c], 7);
+}
+
+
+}
+
+
+void headcode::crypt::chacha::XorScalar(std::uint32_t const * input,
+                                        unsigned int rounds,
+                                        unsigned char const * in,
+                                        unsigned char * out,
+                                        std::uint64_t blocks) {
+
+    std::uint32_t state[16];
+    for (int i = 0; i < 16; ++i) {
+        state[i] = input[i];
+    }
+
+    for (; blocks > 0; --blocks, in += kBlockSize, out += kBlockSize, ++state[12]) {
+
+        std::uint32_t x[16];
+        for (int i = 0; i < 16; ++i) {
+            x[i] = state[i];
+        }
+        for (unsigned int round = 0; round < rounds; round += 2) {
+            QuarterRound(x, 0, 4, 8, 12);
+            QuarterRound(x, 1, 5, 9, 13);
+            QuarterRound(x, 2, 6, 10, 14);
+            QuarterRound(x, 3, 7, 11, 15);
+            QuarterRound(x, 0, 5, 10, 15);
+            QuarterRound(x, 1, 6, 11, 12);
+            QuarterRound(x, 2, 7, 8, 13);
+            QuarterRound(x, 3, 4, 9, 14);
+        }
+
+        for (int i = 0; i < 16; ++i) {
+            auto word = x[i] + state[i];
+            for (int j = 0; j < 4; ++j) {
+                out[i * 4 + j] = static_cast<unsigned char>(in[i * 4 + j] ^ (word >> (8 * j)));
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+// This translation unit is compiled with -msse2. It is only called after
+// a runtime check of the CPU (see chacha_dispatch.cpp).
+
+#include <cstdint>
+
+#include <emmintrin.h>
+
+#include "chacha_kernel.hpp"
+
+
+namespace {
+
+
+// 4 blocks: word i of each block in one SSE2 register.
+
+using V = __m128i;
+
+constexpr std::uint64_t kBlocks = 4;
+
+template <int n>
+inline V Rotl(V a) {
+    return _mm_or_si128(_mm_slli_epi32(a, n), _mm_srli_epi32(a, 32 - n));
+}
+
+inline void QuarterRound(V & a, V & b, V & c, V & d) {
+    a = _mm_add_epi32(a, b);
+    d = Rotl<16>(_mm_xor_si128(d, a));
+    c = _mm_add_epi32(c, d);
+    b = Rotl<12>(_mm_xor_si128(b, c));
+    a = _mm_add_epi32(a, b);
+    d = Rotl<8>(_mm_xor_si128(d, a));
+    c = _mm_add_epi32(c, d);
+    b = Rotl<7>(_mm_xor_si128(b, c));
+}
+
+/**
+ * @brief   Transposes 4 words of 4 blocks into 16 bytes of each block and XORs them onto the data.
+ * @param   x           words i to i + 3 of the 4 blocks.
+ * @param   in          the incoming data at word i of block 0.
+ * @param   out         the outgoing data at word i of block 0.
+ */
+inline void Store(V const * x, unsigned char const * in, unsigned char * out) {
+
+    auto t0 = _mm_unpacklo_epi32(x[0], x[1]);
+    auto t1 = _mm_unpacklo_epi32(x[2], x[3]);
+    auto t2 = _mm_unpackhi_epi32(x[0], x[1]);
+    auto t3 = _mm_unpackhi_epi32(x[2], x[3]);
+
+    V const rows[kBlocks] = {_mm_unpacklo_epi64(t0, t1),
+                             _mm_unpackhi_epi64(t0, t1),
+                             _mm_unpacklo_epi64(t2, t3),
+                             _mm_unpackhi_epi64(t2, t3)};
+
+    for (std::uint64_t block = 0; block < kBlocks; ++block) {
+        auto offset = block * headcode::crypt::chacha::kBlockSize;
+        auto data = _mm_loadu_si128(reinterpret_cast<V const *>(in + offset));
+        _mm_storeu_si128(reinterpret_cast<V *>(out + offset), _mm_xor_si128(data, rows[block]));
+    }
+}
+
+
+}
+
+
+void headcode::crypt::chacha::XorSSE2(std::uint32_t const * input,
+                                      unsigned int rounds,
+                                      unsigned char const * in,
+                                      unsigned char * out,
+                                      std::uint64_t blocks) {
+
+    V state[16];
+    for (int i = 0; i < 16; ++i) {
+        state[i] = _mm_set1_epi32(static_cast<int>(input[i]));
+    }
+    state[12] = _mm_add_epi32(state[12], _mm_setr_epi32(0, 1, 2, 3));
+
+    for (; blocks >= kBlocks; blocks -= kBlocks, in += kBlocks * kBlockSize, out += kBlocks * kBlockSize) {
+
+        V x[16];
+        for (int i = 0; i < 16; ++i) {
+            x[i] = state[i];
+        }
+        for (unsigned int round = 0; round < rounds; round += 2) {
+            QuarterRound(x[0], x[4], x[8], x[12]);
+            QuarterRound(x[1], x[5], x[9], x[13]);
+            QuarterRound(x[2], x[6], x[10], x[14]);
+            QuarterRound(x[3], x[7], x[11], x[15]);
+            QuarterRound(x[0], x[5], x[10], x[15]);
+            QuarterRound(x[1], x[6], x[11], x[12]);
+            QuarterRound(x[2], x[7], x[8], x[13]);
+            QuarterRound(x[3], x[4], x[9], x[14]);
+        }
+        for (int i = 0; i < 16; ++i) {
+            x[i] = _mm_add_epi32(x[i], state[i]);
+        }
+
+        for (int i = 0; i < 16; i += 4) {
+            Store(x + i, in + i * 4, out + i * 4);
+        }
+        state[12] = _mm_add_epi32(state[12], _mm_set1_epi32(kBlocks));
+    }
+
+    if (blocks > 0) {
+        std::uint32_t rest[16];
+        for (int i = 0; i < 16; ++i) {
+            rest[i] = input[i];
+        }
+        rest[12] = static_cast<std::uint32_t>(_mm_cvtsi128_si32(state[12]));
+        XorScalar(rest, rounds, in, out, blocks);
+    }
+}
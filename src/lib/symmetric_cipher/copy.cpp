@@ -98,6 +98,11 @@ int Copy::Initialize_(std::map<std::string, std::tuple<unsigned char const *, st
 }
 
 
+int Copy::Reset_() {
+    return 0;
+}
+
+
 void Copy::Register() {
     auto const & description = ::GetDescription();
     Factory::Register(description.name_, description.family_, std::make_shared<CopyProducer>());
@@ -0,0 +1,24 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "ctr.hpp"
+
+using namespace headcode::crypt;
+
+
+void headcode::crypt::ctr::AddToCounter(unsigned char * counter, std::uint64_t size, std::uint64_t blocks) {
+
+    std::uint64_t carry = 0;
+    for (std::uint64_t i = size; (i > 0) && ((blocks > 0) || (carry > 0)); --i) {
+        auto sum = static_cast<std::uint64_t>(counter[i - 1]) + (blocks & 0xff) + carry;
+        counter[i - 1] = static_cast<unsigned char>(sum);
+        carry = sum >> 8;
+        blocks >>= 8;
+    }
+}
+
@@ -0,0 +1,30 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_CTR_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_CTR_HPP
+
+#include <cstdint>
+
+
+namespace headcode::crypt::ctr {
+
+
+/**
+ * @brief   Adds a number of blocks to a big endian counter (of any size, wrapping around).
+ * @param   counter         the counter block.
+ * @param   size            size of the counter in bytes.
+ * @param   blocks          the number to add.
+ */
+void AddToCounter(unsigned char * counter, std::uint64_t size, std::uint64_t blocks);
+
+
+}
+
+
+#endif
@@ -10,6 +10,7 @@
 #include <headcode/crypt/error.hpp>
 #include <headcode/crypt/factory.hpp>
 
+#include "../ltc_aes_descriptor.hpp"
 #include "ltc_aes_192_cbc_decrypter.hpp"
 
 using namespace headcode::crypt;
@@ -48,17 +49,62 @@ static Algorithm::Description const & GetDescription() {
 }
 
 
+/**
+ * @brief   The LibTomCrypt AES 192 CBC algorithm (decryptor) on AES-NI description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetAESNIDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-aesni-aes-192-cbc-decryptor",                            // name
+            Family::kSymmetricCipher,                                     // family
+            "LibTomCrypt AES 192 CBC on AES-NI (decryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 192 Bit encryption algorithm "
+            "in CBC (cipher block chaining) mode. See: https://en.wikipedia.org/wiki/Advanced_Encryption_Standard "
+            "and https://en.wikipedia.org/wiki/Block_cipher_mode_of_operation#Cipher_block_chaining_(CBC)."
+            " The AES rounds run on the AES-NI instructions of the CPU if present, else on "
+            "the table based software AES.",
+
+            GetAESNIProvider(),                       // provider
+            16ul,                                     // input block size
+            ProcessingBlockSize::kSame,               // output block size behaviour
+            16ul,                                     // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,        // default padding strategy
+            0ul,                                      // result size
+
+            // initial data
+            {{"key", {24ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {16ul, PaddingStrategy::PADDING_PKCS_5_7, "An initialization vector.", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
 /**
  * @brief   Produces instances of the algorithm.
  */
 class LTCAES192CBCDecryptorProducer : public Factory::Producer {
+
+    bool aesni_;        //!< @brief Produces the ltc-aesni-* variant.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       produce the ltc-aesni-* variant.
+     */
+    explicit LTCAES192CBCDecryptorProducer(bool aesni) : aesni_{aesni} {
+    }
+
     /**
      * @brief   Call operator - creates the algorithm.
      * @return  A new algorithm instance.
      */
     std::unique_ptr<Algorithm> operator()() const override {
-        return std::make_unique<LTCAES192CBCDecrypter>();
+        return std::make_unique<LTCAES192CBCDecrypter>(aesni_);
     }
 
     /**
@@ -66,7 +112,7 @@ public:
      * @return  A structure describing the algorithm.
      */
     Algorithm::Description const & GetDescription() const override {
-        return ::GetDescription();
+        return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
     }
 };
 
@@ -78,13 +124,11 @@ int LTCAES192CBCDecrypter::Add_(unsigned char const * block_incoming,
 
     size_outgoing = GetDescription().block_size_outgoing_;
 
-    auto cipher_index = SetDescriptor(&aes_desc);
-    if (cipher_index == -1) {
+    if (GetCipherIndex() == -1) {
         return static_cast<int>(Error::kInvalidOperation);
     }
 
-    symmetric_CBC * state = &GetState();
-    return cbc_decrypt(block_incoming, block_outgoing, size_incoming, state);
+    return Decrypt(block_incoming, block_outgoing, size_incoming);
 }
 
 
@@ -95,15 +139,19 @@ int LTCAES192CBCDecrypter::Finalize_(unsigned char *,
 }
 
 
+LTCAES192CBCDecrypter::LTCAES192CBCDecrypter(bool aesni) : aesni_{aesni} {
+}
+
+
 Algorithm::Description const & LTCAES192CBCDecrypter::GetDescription_() const {
-    return ::GetDescription();
+    return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
 }
 
 
 int LTCAES192CBCDecrypter::Initialize_(
         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
 
-    auto cipher_index = SetDescriptor(&aes_desc);
+    auto cipher_index = SetDescriptor(aesni_ ? SelectAESNIDescriptor() : &aes_desc);
     if (cipher_index == -1) {
         return -1;
     }
@@ -128,12 +176,16 @@ int LTCAES192CBCDecrypter::Initialize_(
         return static_cast<int>(Error::kInvalidArgument);
     }
 
-    symmetric_CBC * state = &GetState();
-    return cbc_start(cipher_index, iv_data, key_data, key_size, 0, state);
+    return Start(cipher_index, iv_data, key_data, key_size);
 }
 
 
 void LTCAES192CBCDecrypter::Register() {
     auto const & description = ::GetDescription();
-    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192CBCDecryptorProducer>());
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192CBCDecryptorProducer>(false));
+
+    auto const & aesni_description = ::GetAESNIDescription();
+    Factory::Register(aesni_description.name_,
+                      aesni_description.family_,
+                      std::make_shared<LTCAES192CBCDecryptorProducer>(true));
 }
@@ -10,6 +10,7 @@
 #include <headcode/crypt/error.hpp>
 #include <headcode/crypt/factory.hpp>
 
+#include "../ltc_aes_descriptor.hpp"
 #include "ltc_aes_192_cbc_encrypter.hpp"
 
 using namespace headcode::crypt;
@@ -49,17 +50,63 @@ static Algorithm::Description const & GetDescription() {
 }
 
 
+/**
+ * @brief   The LibTomCrypt AES 192 CBC algorithm (encryptor) on AES-NI description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetAESNIDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-aesni-aes-192-cbc-encryptor",                            // name
+            Family::kSymmetricCipher,                                     // family
+            "LibTomCrypt AES 192 CBC on AES-NI (encryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 192 Bit encryption algorithm "
+            "in CBC (cipher block chaining) mode. See: https://en.wikipedia.org/wiki/Advanced_Encryption_Standard "
+            "and https://en.wikipedia.org/wiki/Block_cipher_mode_of_operation#Cipher_block_chaining_(CBC)."
+            " The AES rounds run on the AES-NI instructions of the CPU if present, else on "
+            "the table based software AES.",
+
+            GetAESNIProvider(),                       // provider
+            16ul,                                     // input block size
+            ProcessingBlockSize::kSame,               // output block size behaviour
+            16ul,                                     // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,        // default padding strategy
+            0ul,                                      // result size
+
+            // initial data
+            {{"key", {24ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {16ul, PaddingStrategy::PADDING_PKCS_5_7, "An initialization vector.", false}}},
+
+            // finalization data
+            {}
+
+    };
+    return description;
+}
+
+
 /**
  * @brief   Produces instances of the algorithm.
  */
 class LTCAES192CBCEncryptorProducer : public Factory::Producer {
+
+    bool aesni_;        //!< @brief Produces the ltc-aesni-* variant.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       produce the ltc-aesni-* variant.
+     */
+    explicit LTCAES192CBCEncryptorProducer(bool aesni) : aesni_{aesni} {
+    }
+
     /**
      * @brief   Call operator - creates the algorithm.
      * @return  A new algorithm instance.
      */
     std::unique_ptr<Algorithm> operator()() const override {
-        return std::make_unique<LTCAES192CBCEncrypter>();
+        return std::make_unique<LTCAES192CBCEncrypter>(aesni_);
     }
 
     /**
@@ -67,7 +114,7 @@ public:
      * @return  A structure describing the algorithm.
      */
     Algorithm::Description const & GetDescription() const override {
-        return ::GetDescription();
+        return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
     }
 };
 
@@ -79,8 +126,7 @@ int LTCAES192CBCEncrypter::Add_(unsigned char const * block_incoming,
 
     size_outgoing = GetDescription().block_size_outgoing_;
 
-    auto cipher_index = SetDescriptor(&aes_desc);
-    if (cipher_index == -1) {
+    if (GetCipherIndex() == -1) {
         return static_cast<int>(Error::kInvalidOperation);
     }
 
@@ -96,15 +142,19 @@ int LTCAES192CBCEncrypter::Finalize_(unsigned char *,
 }
 
 
+LTCAES192CBCEncrypter::LTCAES192CBCEncrypter(bool aesni) : aesni_{aesni} {
+}
+
+
 Algorithm::Description const & LTCAES192CBCEncrypter::GetDescription_() const {
-    return ::GetDescription();
+    return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
 }
 
 
 int LTCAES192CBCEncrypter::Initialize_(
         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
 
-    auto cipher_index = SetDescriptor(&aes_desc);
+    auto cipher_index = SetDescriptor(aesni_ ? SelectAESNIDescriptor() : &aes_desc);
     if (cipher_index == -1) {
         return static_cast<int>(Error::kInvalidArgument);
     }
@@ -129,12 +179,16 @@ int LTCAES192CBCEncrypter::Initialize_(
         return static_cast<int>(Error::kInvalidArgument);
     }
 
-    symmetric_CBC * state = &GetState();
-    return cbc_start(cipher_index, iv_data, key_data, key_size, 0, state);
+    return Start(cipher_index, iv_data, key_data, key_size);
 }
 
 
 void LTCAES192CBCEncrypter::Register() {
     auto const & description = ::GetDescription();
-    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192CBCEncryptorProducer>());
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192CBCEncryptorProducer>(false));
+
+    auto const & aesni_description = ::GetAESNIDescription();
+    Factory::Register(aesni_description.name_,
+                      aesni_description.family_,
+                      std::make_shared<LTCAES192CBCEncryptorProducer>(true));
 }
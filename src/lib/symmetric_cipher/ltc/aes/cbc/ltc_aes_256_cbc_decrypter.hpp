@@ -25,7 +25,15 @@ namespace headcode::crypt {
  */
 class LTCAES256CBCDecrypter : public LTCSymmetricCBCCipher {
 
+    bool aesni_ = false;        //!< @brief Runs on the AES-NI descriptor if the CPU supports it.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       run on the AES-NI descriptor if the CPU supports it (ltc-aesni-* variant).
+     */
+    explicit LTCAES256CBCDecrypter(bool aesni = false);
+
     /**
      * @brief   Register this class of algorithms.
      */
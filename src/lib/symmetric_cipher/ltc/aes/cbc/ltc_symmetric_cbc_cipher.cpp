@@ -0,0 +1,82 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/slices.hpp"
+#include "worker_pool.hpp"
+#include "ltc_symmetric_cbc_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+int LTCSymmetricCBCCipher::Decrypt(unsigned char const * block_incoming,
+                                   unsigned char * block_outgoing,
+                                   std::uint64_t size) {
+
+    auto slices = GetSliceCount(size, kMinSliceSize);
+    if (slices < 2) {
+        return cbc_decrypt(block_incoming, block_outgoing, size, &state_);
+    }
+
+    // the first slice runs on the state itself, all others on a copy with the cipher block
+    // before the slice as IV: all taken before any (maybe in place) decryption starts
+    std::uint64_t block_size = state_.blocklen;
+    auto slice_size = GetSliceSize(size, block_size, slices);
+    std::vector<symmetric_CBC> states(slices, state_);
+    for (std::uint64_t i = 1; (i < slices) && (i * slice_size < size); ++i) {
+        auto iv = block_incoming + i * slice_size - block_size;
+        auto res = cbc_setiv(iv, block_size, &states[i]);
+        if (res != CRYPT_OK) {
+            return res;
+        }
+    }
+    std::vector<unsigned char> last_block(block_incoming + size - block_size, block_incoming + size);
+
+    auto slice = [&](unsigned char const * in, unsigned char * out, std::uint64_t length, std::uint64_t block) {
+        auto index = block * block_size / slice_size;
+        auto state = (index == 0) ? &state_ : &states[index];
+        return cbc_decrypt(in, out, length, state);
+    };
+    auto res = RunSlices(block_incoming, block_outgoing, size, 0, block_size, slices, slice);
+    zeromem(states.data(), states.size() * sizeof(symmetric_CBC));
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    return cbc_setiv(last_block.data(), last_block.size(), &state_);
+}
+
+
+int LTCSymmetricCBCCipher::Reset_() {
+
+    if (initial_iv_size_ == 0) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    return cbc_setiv(initial_iv_.data(), initial_iv_size_, &state_);
+}
+
+
+int LTCSymmetricCBCCipher::Start(int cipher_index,
+                                 unsigned char const * iv,
+                                 unsigned char const * key,
+                                 int key_size) {
+
+    auto res = cbc_start(cipher_index, iv, key, key_size, 0, &state_);
+    if (res == CRYPT_OK) {
+        initial_iv_size_ = initial_iv_.size();
+        res = cbc_getiv(initial_iv_.data(), &initial_iv_size_, &state_);
+    }
+
+    return res;
+}
@@ -9,6 +9,8 @@
 #ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_CBC_CIPHER_HPP
 #define HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_CBC_CIPHER_HPP
 
+#include <array>
+
 #include <tomcrypt.h>
 
 #include <headcode/crypt/algorithm.hpp>
@@ -21,12 +23,28 @@ namespace headcode::crypt {
 
 /**
  * @brief   Base class of all LibTomCrypt symmetric cipher algorithms running in CBC mode.
+ *
+ * CBC decryption does not chain: each block needs the cipher block before it only. So large
+ * buffers are decrypted in slices on the worker pool, each slice on a copy of the state with
+ * the last cipher block before the slice as IV (see SetParallelism()).
  */
 class LTCSymmetricCBCCipher : public LTCSymmetricCipher {
 
     symmetric_CBC state_;        //!< @brief The LibTomCrypt CBC state structure used.
 
+    std::array<unsigned char, MAXBLOCKSIZE> initial_iv_;        //!< @brief The IV given at initialization.
+    unsigned long initial_iv_size_ = 0;                         //!< @brief Size of the IV given at initialization.
+
 protected:
+    /**
+     * @brief   Decrypts whole blocks, in slices on the worker pool if the data is large.
+     * @param   block_incoming      incoming cipher text.
+     * @param   block_outgoing      outgoing plain text (may be the incoming data).
+     * @param   size                size of the data (a multiple of the block size).
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Decrypt(unsigned char const * block_incoming, unsigned char * block_outgoing, std::uint64_t size);
+
     /**
      * @brief   Gets the symmetric CBC state used.
      * @return  The symmetric CBC state.
@@ -42,6 +60,24 @@ protected:
     symmetric_CBC const & GetState() const {
         return state_;
     }
+
+    /**
+     * @brief   Starts the CBC state and remembers the IV for later Reset() calls.
+     * @param   cipher_index        the index of the cipher in the LibTomCrypt cipher table.
+     * @param   iv                  the initialization vector (of the size of the cipher's block length).
+     * @param   key                 the key.
+     * @param   key_size            the size of the key in bytes.
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Start(int cipher_index, unsigned char const * iv, unsigned char const * key, int key_size);
+
+private:
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the initial IV and keeps the key schedule.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
 };
 
 
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/ctr.hpp"
+#include "symmetric_cipher/slices.hpp"
+#include "worker_pool.hpp"
+#include "ltc_symmetric_ctr_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCSymmetricCTRCipher::LTCSymmetricCTRCipher(ltc_cipher_descriptor const * cipher) : cipher_{cipher} {
+}
+
+
+LTCSymmetricCTRCipher::~LTCSymmetricCTRCipher() noexcept {
+    std::fill(key_.begin(), key_.end(), 0);
+}
+
+
+int LTCSymmetricCTRCipher::Add_(unsigned char const * block_incoming,
+                                std::uint64_t size_incoming,
+                                unsigned char * block_outgoing,
+                                std::uint64_t & size_outgoing) {
+
+    if (GetCipherIndex() == -1) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    size_outgoing = size_incoming;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    if (slices < 2) {
+        position_ += size_incoming;
+        return ctr_encrypt(block_incoming, block_outgoing, size_incoming, &state_);
+    }
+
+    // the head up to the next block boundary is on the running keystream
+    auto head = (block_size_ - position_ % block_size_) % block_size_;
+    auto res = ctr_encrypt(block_incoming, block_outgoing, head, &state_);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    auto slice = [this](unsigned char const * in, unsigned char * out, std::uint64_t size, std::uint64_t block) {
+        return AddSlice(in, out, size, block);
+    };
+    res = RunSlices(block_incoming + head,
+                    block_outgoing + head,
+                    size_incoming - head,
+                    (position_ + head) / block_size_,
+                    block_size_,
+                    slices,
+                    slice);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    position_ += size_incoming;
+    return Seek(position_);
+}
+
+
+int LTCSymmetricCTRCipher::AddSlice(unsigned char const * block_incoming,
+                                    unsigned char * block_outgoing,
+                                    std::uint64_t size,
+                                    std::uint64_t block) const {
+
+    auto counter = initial_iv_;
+    ctr::AddToCounter(counter.data(), block_size_, block);
+
+    symmetric_CTR state;
+    auto res = ctr_start(GetCipherIndex(),
+                         counter.data(),
+                         key_.data(),
+                         static_cast<int>(key_.size()),
+                         0,
+                         CTR_COUNTER_BIG_ENDIAN,
+                         &state);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    res = ctr_encrypt(block_incoming, block_outgoing, size, &state);
+    ctr_done(&state);
+    return res;
+}
+
+
+int LTCSymmetricCTRCipher::Finalize_(unsigned char *,
+                                     std::uint64_t,
+                                     std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    return 0;
+}
+
+
+int LTCSymmetricCTRCipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    auto cipher_index = SetDescriptor(cipher_);
+    if (cipher_index == -1) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    block_size_ = cipher_->block_length;
+
+    auto iter = initialization_data.find("key");
+    if (iter == initialization_data.end()) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [key_data, key_size] = (*iter).second;
+    if ((key_size > 0) && (key_data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying key which is NULL/nullptr while size is > 0.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    iter = initialization_data.find("iv");
+    if (iter == initialization_data.end()) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [iv_data, iv_size] = (*iter).second;
+    if ((iv_size < block_size_) || (iv_data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying IV which is too small.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    key_.assign(key_data, key_data + key_size);
+    std::memcpy(initial_iv_.data(), iv_data, block_size_);
+    position_ = 0;
+
+    return ctr_start(cipher_index,
+                     initial_iv_.data(),
+                     key_.data(),
+                     static_cast<int>(key_.size()),
+                     0,
+                     CTR_COUNTER_BIG_ENDIAN,
+                     &state_);
+}
+
+
+int LTCSymmetricCTRCipher::Reset_() {
+
+    if (!IsInitialized()) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    position_ = 0;
+    return Seek(0);
+}
+
+
+int LTCSymmetricCTRCipher::Seek(std::uint64_t position) {
+
+    auto counter = initial_iv_;
+    ctr::AddToCounter(counter.data(), block_size_, position / block_size_);
+    auto res = ctr_setiv(counter.data(), block_size_, &state_);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    // skip the keystream used within the current block
+    std::array<unsigned char, MAXBLOCKSIZE> skip{};
+    return ctr_encrypt(skip.data(), skip.data(), position % block_size_, &state_);
+}
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_CTR_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_CTR_CIPHER_HPP
+
+#include <array>
+#include <vector>
+
+#include <tomcrypt.h>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "symmetric_cipher/ltc/ltc_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all LibTomCrypt symmetric cipher algorithms running in CTR mode.
+ *
+ * The counter is the whole block, starting at the IV and incremented big endian (as OpenSSL
+ * does). Encryption and decryption are the very same. Large buffers are cut into slices
+ * processed on the worker pool, each slice with a CTR state of its own (see SetParallelism()).
+ */
+class LTCSymmetricCTRCipher : public LTCSymmetricCipher {
+
+    ltc_cipher_descriptor const * cipher_;        //!< @brief The descriptor of the block cipher.
+    symmetric_CTR state_;                         //!< @brief The LibTomCrypt CTR state structure used.
+
+    std::vector<unsigned char> key_;                          //!< @brief The key (for the states of the slices).
+    std::array<unsigned char, MAXBLOCKSIZE> initial_iv_;      //!< @brief The IV given at initialization.
+    std::uint64_t block_size_ = 0;                            //!< @brief The block size of the cipher.
+    std::uint64_t position_ = 0;                              //!< @brief Number of bytes processed so far.
+
+public:
+    /**
+     * @brief   Constructor.
+     * @param   cipher      the descriptor of the block cipher.
+     */
+    explicit LTCSymmetricCTRCipher(ltc_cipher_descriptor const * cipher);
+
+    /**
+     * @brief  Destructor.
+     */
+    ~LTCSymmetricCTRCipher() noexcept override;
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Processes a slice of the stream with a CTR state of its own.
+     * @param   block_incoming      incoming data of the slice.
+     * @param   block_outgoing      outgoing data of the slice.
+     * @param   size                size of the slice.
+     * @param   block               number of the first block of the slice (counted from the IV).
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int AddSlice(unsigned char const * block_incoming,
+                 unsigned char * block_outgoing,
+                 std::uint64_t size,
+                 std::uint64_t block) const;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the initial IV and keeps the key schedule.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Moves the CTR state to a position in the stream.
+     * @param   position        the position in bytes.
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Seek(std::uint64_t position);
+};
+
+
+}
+
+
+#endif
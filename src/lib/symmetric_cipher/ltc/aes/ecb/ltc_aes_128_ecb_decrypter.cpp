@@ -10,6 +10,7 @@
 #include <headcode/crypt/error.hpp>
 #include <headcode/crypt/factory.hpp>
 
+#include "../ltc_aes_descriptor.hpp"
 #include "ltc_aes_128_ecb_decrypter.hpp"
 
 using namespace headcode::crypt;
@@ -49,17 +50,63 @@ static Algorithm::Description const & GetDescription() {
 }
 
 
+/**
+ * @brief   The LibTomCrypt AES 128 ECB algorithm (decryptor) on AES-NI description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetAESNIDescription() {
+
+    // TODO: make const
+    static Algorithm::Description description = {
+            "ltc-aesni-aes-128-ecb-decryptor",                            // name
+            Family::kSymmetricCipher,                                     // family
+            "LibTomCrypt AES 128 ECB on AES-NI (decryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 128 Bit encryption algorithm "
+            "in ECB (electronic codebook) mode. Note that ECB bears some weaknesses and should be avoided. "
+            "See: https://en.wikipedia.org/wiki/Advanced_Encryption_Standard and "
+            "https://en.wikipedia.org/wiki/Block_cipher_mode_of_operation#ECB."
+            " The AES rounds run on the AES-NI instructions of the CPU if present, else on "
+            "the table based software AES.",
+
+            GetAESNIProvider(),                       // provider
+            16ul,                                     // input block size
+            ProcessingBlockSize::kSame,               // output block size behaviour
+            16ul,                                     // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,        // default padding strategy
+            0ul,                                      // result size
+
+            // initial data
+            {{"key", {16ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
 /**
  * @brief   Produces instances of the algorithm.
  */
 class LTCAES128ECBDecryptorProducer : public Factory::Producer {
+
+    bool aesni_;        //!< @brief Produces the ltc-aesni-* variant.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       produce the ltc-aesni-* variant.
+     */
+    explicit LTCAES128ECBDecryptorProducer(bool aesni) : aesni_{aesni} {
+    }
+
     /**
      * @brief   Call operator - creates the algorithm.
      * @return  A new algorithm instance.
      */
     std::unique_ptr<Algorithm> operator()() const override {
-        return std::make_unique<LTCAES128ECBDecrypter>();
+        return std::make_unique<LTCAES128ECBDecrypter>(aesni_);
     }
 
     /**
@@ -67,7 +114,7 @@ public:
      * @return  A structure describing the algorithm.
      */
     Algorithm::Description const & GetDescription() const override {
-        return ::GetDescription();
+        return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
     }
 };
 
@@ -77,19 +124,13 @@ int LTCAES128ECBDecrypter::Add_(unsigned char const * block_incoming,
                                 unsigned char * block_outgoing,
                                 std::uint64_t & size_outgoing) {
 
-    auto cipher_index = SetDescriptor(&aes_desc);
-    if (cipher_index == -1) {
+    size_outgoing = size_incoming;
+
+    if (GetCipherIndex() == -1) {
         return -1;
     }
 
-    // TODO: reduce duplicate and set the outgoing size
-
-    symmetric_ECB * state = &GetState();
-    int res = ecb_decrypt(block_incoming, block_outgoing, size_incoming, state);
-    if (!res) {
-        size_outgoing = size_incoming;
-    }
-    return res;
+    return Decrypt(block_incoming, block_outgoing, size_incoming);
 }
 
 
@@ -100,15 +141,19 @@ int LTCAES128ECBDecrypter::Finalize_(unsigned char *,
 }
 
 
+LTCAES128ECBDecrypter::LTCAES128ECBDecrypter(bool aesni) : aesni_{aesni} {
+}
+
+
 Algorithm::Description const & LTCAES128ECBDecrypter::GetDescription_() const {
-    return ::GetDescription();
+    return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
 }
 
 
 int LTCAES128ECBDecrypter::Initialize_(
         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
 
-    auto cipher_index = SetDescriptor(&aes_desc);
+    auto cipher_index = SetDescriptor(aesni_ ? SelectAESNIDescriptor() : &aes_desc);
     if (cipher_index == -1) {
         return -1;
     }
@@ -131,5 +176,10 @@ int LTCAES128ECBDecrypter::Initialize_(
 
 void LTCAES128ECBDecrypter::Register() {
     auto const & description = ::GetDescription();
-    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES128ECBDecryptorProducer>());
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES128ECBDecryptorProducer>(false));
+
+    auto const & aesni_description = ::GetAESNIDescription();
+    Factory::Register(aesni_description.name_,
+                      aesni_description.family_,
+                      std::make_shared<LTCAES128ECBDecryptorProducer>(true));
 }
@@ -10,6 +10,7 @@
 #include <headcode/crypt/error.hpp>
 #include <headcode/crypt/factory.hpp>
 
+#include "../ltc_aes_descriptor.hpp"
 #include "ltc_aes_192_ecb_decrypter.hpp"
 
 using namespace headcode::crypt;
@@ -48,17 +49,62 @@ static Algorithm::Description const & GetDescription() {
 }
 
 
+/**
+ * @brief   The LibTomCrypt AES 192 ECB algorithm (decryptor) on AES-NI description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetAESNIDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-aesni-aes-192-ecb-decryptor",                            // name
+            Family::kSymmetricCipher,                                     // family
+            "LibTomCrypt AES 192 ECB on AES-NI (decryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 192 Bit encryption algorithm "
+            "in ECB (electronic codebook) mode. Note that ECB bears some weaknesses and should be avoided. "
+            "See: https://en.wikipedia.org/wiki/Advanced_Encryption_Standard and "
+            "https://en.wikipedia.org/wiki/Block_cipher_mode_of_operation#ECB."
+            " The AES rounds run on the AES-NI instructions of the CPU if present, else on "
+            "the table based software AES.",
+
+            GetAESNIProvider(),                       // provider
+            16ul,                                     // input block size
+            ProcessingBlockSize::kSame,               // output block size behaviour
+            16ul,                                     // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,        // default padding strategy
+            0ul,                                      // result size
+
+            // initial data
+            {{"key", {24ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
 /**
  * @brief   Produces instances of the algorithm.
  */
 class LTCAES192ECBDecryptorProducer : public Factory::Producer {
+
+    bool aesni_;        //!< @brief Produces the ltc-aesni-* variant.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       produce the ltc-aesni-* variant.
+     */
+    explicit LTCAES192ECBDecryptorProducer(bool aesni) : aesni_{aesni} {
+    }
+
     /**
      * @brief   Call operator - creates the algorithm.
      * @return  A new algorithm instance.
      */
     std::unique_ptr<Algorithm> operator()() const override {
-        return std::make_unique<LTCAES192ECBDecrypter>();
+        return std::make_unique<LTCAES192ECBDecrypter>(aesni_);
     }
 
     /**
@@ -66,7 +112,7 @@ public:
      * @return  A structure describing the algorithm.
      */
     Algorithm::Description const & GetDescription() const override {
-        return ::GetDescription();
+        return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
     }
 };
 
@@ -78,13 +124,11 @@ int LTCAES192ECBDecrypter::Add_(unsigned char const * block_incoming,
 
     size_outgoing = size_incoming;
 
-    auto cipher_index = SetDescriptor(&aes_desc);
-    if (cipher_index == -1) {
+    if (GetCipherIndex() == -1) {
         return -1;
     }
 
-    symmetric_ECB * state = &GetState();
-    return ecb_decrypt(block_incoming, block_outgoing, size_incoming, state);
+    return Decrypt(block_incoming, block_outgoing, size_incoming);
 }
 
 
@@ -95,15 +139,19 @@ int LTCAES192ECBDecrypter::Finalize_(unsigned char *,
 }
 
 
+LTCAES192ECBDecrypter::LTCAES192ECBDecrypter(bool aesni) : aesni_{aesni} {
+}
+
+
 Algorithm::Description const & LTCAES192ECBDecrypter::GetDescription_() const {
-    return ::GetDescription();
+    return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
 }
 
 
 int LTCAES192ECBDecrypter::Initialize_(
         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
 
-    auto cipher_index = SetDescriptor(&aes_desc);
+    auto cipher_index = SetDescriptor(aesni_ ? SelectAESNIDescriptor() : &aes_desc);
     if (cipher_index == -1) {
         return -1;
     }
@@ -126,5 +174,10 @@ int LTCAES192ECBDecrypter::Initialize_(
 
 void LTCAES192ECBDecrypter::Register() {
     auto const & description = ::GetDescription();
-    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192ECBDecryptorProducer>());
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192ECBDecryptorProducer>(false));
+
+    auto const & aesni_description = ::GetAESNIDescription();
+    Factory::Register(aesni_description.name_,
+                      aesni_description.family_,
+                      std::make_shared<LTCAES192ECBDecryptorProducer>(true));
 }
@@ -10,6 +10,7 @@
 #include <headcode/crypt/error.hpp>
 #include <headcode/crypt/factory.hpp>
 
+#include "../ltc_aes_descriptor.hpp"
 #include "ltc_aes_192_ecb_encrypter.hpp"
 
 using namespace headcode::crypt;
@@ -49,17 +50,63 @@ static Algorithm::Description const & GetDescription() {
 }
 
 
+/**
+ * @brief   The LibTomCrypt AES 192 ECB algorithm (encryptor) on AES-NI description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetAESNIDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-aesni-aes-192-ecb-encryptor",                            // name
+            Family::kSymmetricCipher,                                     // family
+            "LibTomCrypt AES 192 ECB on AES-NI (encryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 192 Bit encryption algorithm "
+            "in ECB (electronic codebook) mode. Note that ECB bears some weaknesses and should be avoided. "
+            "See: https://en.wikipedia.org/wiki/Advanced_Encryption_Standard and "
+            "https://en.wikipedia.org/wiki/Block_cipher_mode_of_operation#ECB."
+            " The AES rounds run on the AES-NI instructions of the CPU if present, else on "
+            "the table based software AES.",
+
+            GetAESNIProvider(),                       // provider
+            16ul,                                     // input block size
+            ProcessingBlockSize::kSame,               // output block size behaviour
+            16ul,                                     // output block size (if changing)
+            PaddingStrategy::PADDING_PKCS_5_7,        // default padding strategy
+            0ul,                                      // result size
+
+            // initial data
+            {{"key", {24ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}}},
+
+            // finalization data
+            {}
+
+    };
+    return description;
+}
+
+
 /**
  * @brief   Produces instances of the algorithm.
  */
 class LTCAES192ECBEncryptorProducer : public Factory::Producer {
+
+    bool aesni_;        //!< @brief Produces the ltc-aesni-* variant.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       produce the ltc-aesni-* variant.
+     */
+    explicit LTCAES192ECBEncryptorProducer(bool aesni) : aesni_{aesni} {
+    }
+
     /**
      * @brief   Call operator - creates the algorithm.
      * @return  A new algorithm instance.
      */
     std::unique_ptr<Algorithm> operator()() const override {
-        return std::make_unique<LTCAES192ECBEncrypter>();
+        return std::make_unique<LTCAES192ECBEncrypter>(aesni_);
     }
 
     /**
@@ -67,7 +114,7 @@ public:
      * @return  A structure describing the algorithm.
      */
     Algorithm::Description const & GetDescription() const override {
-        return ::GetDescription();
+        return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
     }
 };
 
@@ -79,13 +126,11 @@ int LTCAES192ECBEncrypter::Add_(unsigned char const * block_incoming,
 
     size_outgoing = size_incoming;
 
-    auto cipher_index = SetDescriptor(&aes_desc);
-    if (cipher_index == -1) {
+    if (GetCipherIndex() == -1) {
         return -1;
     }
 
-    symmetric_ECB * state = &GetState();
-    return ecb_encrypt(block_incoming, block_outgoing, size_incoming, state);
+    return Encrypt(block_incoming, block_outgoing, size_incoming);
 }
 
 
@@ -96,15 +141,19 @@ int LTCAES192ECBEncrypter::Finalize_(unsigned char *,
 }
 
 
+LTCAES192ECBEncrypter::LTCAES192ECBEncrypter(bool aesni) : aesni_{aesni} {
+}
+
+
 Algorithm::Description const & LTCAES192ECBEncrypter::GetDescription_() const {
-    return ::GetDescription();
+    return aesni_ ? ::GetAESNIDescription() : ::GetDescription();
 }
 
 
 int LTCAES192ECBEncrypter::Initialize_(
         std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
 
-    auto cipher_index = SetDescriptor(&aes_desc);
+    auto cipher_index = SetDescriptor(aesni_ ? SelectAESNIDescriptor() : &aes_desc);
     if (cipher_index == -1) {
         return -1;
     }
@@ -127,5 +176,10 @@ int LTCAES192ECBEncrypter::Initialize_(
 
 void LTCAES192ECBEncrypter::Register() {
     auto const & description = ::GetDescription();
-    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192ECBEncryptorProducer>());
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES192ECBEncryptorProducer>(false));
+
+    auto const & aesni_description = ::GetAESNIDescription();
+    Factory::Register(aesni_description.name_,
+                      aesni_description.family_,
+                      std::make_shared<LTCAES192ECBEncryptorProducer>(true));
 }
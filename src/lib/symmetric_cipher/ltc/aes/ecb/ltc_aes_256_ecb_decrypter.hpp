@@ -25,7 +25,15 @@ namespace headcode::crypt {
  */
 class LTCAES256ECBDecrypter : public LTCSymmetricECBCipher {
 
+    bool aesni_ = false;        //!< @brief Runs on the AES-NI descriptor if the CPU supports it.
+
 public:
+    /**
+     * @brief   Constructor.
+     * @param   aesni       run on the AES-NI descriptor if the CPU supports it (ltc-aesni-* variant).
+     */
+    explicit LTCAES256ECBDecrypter(bool aesni = false);
+
     /**
      * @brief   Register this class of algorithms.
      */
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/slices.hpp"
+#include "worker_pool.hpp"
+#include "ltc_symmetric_ecb_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+int LTCSymmetricECBCipher::Decrypt(unsigned char const * block_incoming,
+                                   unsigned char * block_outgoing,
+                                   std::uint64_t size) {
+    return Process(block_incoming, block_outgoing, size, ecb_decrypt);
+}
+
+
+int LTCSymmetricECBCipher::Encrypt(unsigned char const * block_incoming,
+                                   unsigned char * block_outgoing,
+                                   std::uint64_t size) {
+    return Process(block_incoming, block_outgoing, size, ecb_encrypt);
+}
+
+
+int LTCSymmetricECBCipher::Process(unsigned char const * block_incoming,
+                                   unsigned char * block_outgoing,
+                                   std::uint64_t size,
+                                   ECBFunction process) {
+
+    auto slices = GetSliceCount(size, kMinSliceSize);
+    if (slices < 2) {
+        return process(block_incoming, block_outgoing, size, &state_);
+    }
+
+    // the state is read only while processing: all slices run on it
+    auto slice = [&](unsigned char const * in, unsigned char * out, std::uint64_t length, std::uint64_t) {
+        return process(in, out, length, &state_);
+    };
+    return RunSlices(block_incoming, block_outgoing, size, 0, state_.blocklen, slices, slice);
+}
+
+
+int LTCSymmetricECBCipher::Reset_() {
+    return static_cast<int>(Error::kNoError);
+}
@@ -21,12 +21,38 @@ namespace headcode::crypt {
 
 /**
  * @brief   Base class of all LibTomCrypt symmetric cipher algorithms running in ECB mode.
+ *
+ * ECB blocks are independent and the key schedule is all the state there is: large buffers are
+ * processed in slices on the worker pool, all sharing the state (see SetParallelism()).
  */
 class LTCSymmetricECBCipher : public LTCSymmetricCipher {
 
     symmetric_ECB state_;        //!< @brief The LibTomCrypt ECB state structure used.
 
+    /**
+     * @brief   ecb_encrypt() or ecb_decrypt().
+     */
+    using ECBFunction = int (*)(unsigned char const *, unsigned char *, unsigned long, symmetric_ECB *);
+
 protected:
+    /**
+     * @brief   Decrypts whole blocks, in slices on the worker pool if the data is large.
+     * @param   block_incoming      incoming cipher text.
+     * @param   block_outgoing      outgoing plain text.
+     * @param   size                size of the data (a multiple of the block size).
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Decrypt(unsigned char const * block_incoming, unsigned char * block_outgoing, std::uint64_t size);
+
+    /**
+     * @brief   Encrypts whole blocks, in slices on the worker pool if the data is large.
+     * @param   block_incoming      incoming plain text.
+     * @param   block_outgoing      outgoing cipher text.
+     * @param   size                size of the data (a multiple of the block size).
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Encrypt(unsigned char const * block_incoming, unsigned char * block_outgoing, std::uint64_t size);
+
     /**
      * @brief   Gets the symmetric ECB state used.
      * @return  The symmetric ECB state.
@@ -42,6 +68,27 @@ protected:
     symmetric_ECB const & GetState() const {
         return state_;
     }
+
+private:
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * ECB does not chain blocks, so the key schedule is all the state there is.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Runs ecb_encrypt() or ecb_decrypt() on whole blocks, in slices if the data is large.
+     * @param   block_incoming      incoming data.
+     * @param   block_outgoing      outgoing data.
+     * @param   size                size of the data (a multiple of the block size).
+     * @param   process             ecb_encrypt() or ecb_decrypt().
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Process(unsigned char const * block_incoming,
+                unsigned char * block_outgoing,
+                std::uint64_t size,
+                ECBFunction process);
 };
 
 
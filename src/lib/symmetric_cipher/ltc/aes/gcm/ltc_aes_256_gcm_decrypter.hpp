@@ -0,0 +1,49 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_AES_256_GCM_DECRYPTER_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_AES_256_GCM_DECRYPTER_HPP
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "ltc_symmetric_gcm_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The LibTomCrypt AES 256 Bit Cypher in GCM mode (decryption part).
+ */
+class LTCAES256GCMDecrypter : public LTCSymmetricGCMCipher {
+
+public:
+    /**
+     * @brief   Constructor
+     */
+    LTCAES256GCMDecrypter() : LTCSymmetricGCMCipher(&aes_desc, false) {
+    }
+
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "ltc_aes_256_gcm_encrypter.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt AES 256 GCM encrypter algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-aes-256-gcm-encryptor",                        // name
+            Family::kSymmetricCipher,                           // family
+            "LibTomCrypt AES 256 GCM (encryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 256 Bit encryption algorithm "
+            "in GCM (Galois/Counter) mode: authenticated encryption in a single pass over the data. "
+            "The 16 byte authentication tag is the result of Finalize(). "
+            "An IV must never be used twice with the same key: use Reinitialize() with a fresh IV for each "
+            "message. See: https://en.wikipedia.org/wiki/Galois/Counter_Mode.",
+
+            std::string{"libtomcrypt v"} + SCRYPT,        // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kSame,                   // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            16ul,                                         // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {12ul, PaddingStrategy::PADDING_NONE, "The nonce (12 bytes recommended).", false}},
+             {"aad", {0ul, PaddingStrategy::PADDING_NONE, "Additional authenticated data (not encrypted).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCAES256GCMEncrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCAES256GCMEncrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+Algorithm::Description const & LTCAES256GCMEncrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCAES256GCMEncrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES256GCMEncrypterProducer>());
+}
@@ -0,0 +1,191 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "ltc_symmetric_gcm_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCSymmetricGCMCipher::LTCSymmetricGCMCipher(ltc_cipher_descriptor const * cipher, bool encrypt)
+    : cipher_{cipher}, encrypt_{encrypt} {
+}
+
+
+LTCSymmetricGCMCipher::~LTCSymmetricGCMCipher() noexcept {
+    zeromem(&state_, sizeof(state_));
+}
+
+
+int LTCSymmetricGCMCipher::Add_(unsigned char const * block_incoming,
+                                std::uint64_t size_incoming,
+                                unsigned char * block_outgoing,
+                                std::uint64_t & size_outgoing) {
+
+    if (GetCipherIndex() == -1) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    size_outgoing = size_incoming;
+
+    // gcm_process() takes the plain text first, whatever the direction (and reads from const data only)
+    auto incoming = const_cast<unsigned char *>(block_incoming);
+    if (encrypt_) {
+        return gcm_process(&state_, incoming, size_incoming, block_outgoing, GCM_ENCRYPT);
+    }
+    return gcm_process(&state_, block_outgoing, size_incoming, incoming, GCM_DECRYPT);
+}
+
+
+int LTCSymmetricGCMCipher::Finalize_(
+        unsigned char * result,
+        std::uint64_t result_size,
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) {
+
+    std::array<unsigned char, kTagSize> tag;
+    unsigned long tag_size = tag.size();
+    auto res = gcm_done(&state_, tag.data(), &tag_size);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    if (encrypt_) {
+        if (result_size < kTagSize) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        std::copy(tag.begin(), tag.end(), result);
+        return static_cast<int>(Error::kNoError);
+    }
+
+    auto iter = finalization_data.find("tag");
+    if (iter == finalization_data.end()) {
+        headcode::logger::Warning{"headcode.crypt"} << "Missing authentication tag.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [expected_data, expected_size] = (*iter).second;
+    if ((expected_size < kMinTagSize) || (expected_size > kTagSize)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Invalid size of authentication tag.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    if (mem_neq(tag.data(), expected_data, expected_size) != 0) {
+        return static_cast<int>(Error::kAuthenticationFailed);
+    }
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int LTCSymmetricGCMCipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    auto cipher_index = SetDescriptor(cipher_);
+    if (cipher_index == -1) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // without a "key" only the IV changes: the key schedule and the GHASH tables are kept
+    auto key_iter = initialization_data.find("key");
+    auto rekey = key_iter != initialization_data.end();
+    if (!rekey && !keyed_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    unsigned char const * key_data = nullptr;
+    std::uint64_t key_size = 0;
+    if (rekey) {
+        std::tie(key_data, key_size) = (*key_iter).second;
+        if ((key_size > 0) && (key_data == nullptr)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key which is NULL/nullptr while size is > 0.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+    }
+
+    auto iter = initialization_data.find("iv");
+    if (iter == initialization_data.end()) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [iv_data, iv_size] = (*iter).second;
+    if ((iv_size == 0) || (iv_data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying empty IV.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    if (encrypt_ && !rekey && (iv_size == iv_.size()) &&
+        std::equal(iv_.begin(), iv_.end(), iv_data)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Refusing to encrypt with the same key and IV again.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    iv_.assign(iv_data, iv_data + iv_size);
+
+    aad_.clear();
+    iter = initialization_data.find("aad");
+    if (iter != initialization_data.end()) {
+        auto [aad_data, aad_size] = (*iter).second;
+        if (aad_size > 0) {
+            aad_.assign(aad_data, aad_data + aad_size);
+        }
+    }
+
+    int res;
+    if (rekey) {
+        // the key schedule and the GHASH tables are computed here once
+        keyed_ = false;
+        res = gcm_init(&state_, cipher_index, key_data, static_cast<int>(key_size));
+        keyed_ = (res == CRYPT_OK);
+    } else {
+        res = gcm_reset(&state_);
+    }
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    return Start();
+}
+
+
+int LTCSymmetricGCMCipher::Reset_() {
+
+    if (!IsInitialized()) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    if (encrypt_) {
+        headcode::logger::Warning{"headcode.crypt"} << "Refusing to reuse the IV: reinitialize with a new \"iv\".";
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+
+    auto res = gcm_reset(&state_);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    return Start();
+}
+
+
+int LTCSymmetricGCMCipher::Start() {
+
+    auto res = gcm_add_iv(&state_, iv_.data(), iv_.size());
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    // the AAD (even if empty) and an empty text switch the state to text mode: so a message
+    // without any text gets its tag too
+    unsigned char none = 0;
+    res = gcm_add_aad(&state_, aad_.empty() ? &none : aad_.data(), aad_.size());
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    return gcm_process(&state_, &none, 0, &none, encrypt_ ? GCM_ENCRYPT : GCM_DECRYPT);
+}
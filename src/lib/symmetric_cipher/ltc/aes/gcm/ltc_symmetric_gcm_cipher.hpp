@@ -0,0 +1,122 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_GCM_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_GCM_CIPHER_HPP
+
+#include <vector>
+
+#include <tomcrypt.h>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "symmetric_cipher/ltc/ltc_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all LibTomCrypt symmetric cipher algorithms running in GCM mode.
+ *
+ * The "iv" and the optional "aad" (additional authenticated data) are given at initialization.
+ * The encryptor writes the 16 byte tag as result of Finalize(), the decryptor takes the tag as
+ * "tag" finalization argument and fails Finalize() with Error::kAuthenticationFailed if the data
+ * does not match. GHASH runs on the LibTomCrypt 64 KiB multiplication tables (LTC_GCM_TABLES).
+ *
+ * An IV must never be used twice with the same key: the encryptor refuses Reset(). Reinitialize()
+ * with a new "iv" (and "aad") but no "key" starts the next message on the key schedule and the
+ * GHASH tables already computed.
+ */
+class LTCSymmetricGCMCipher : public LTCSymmetricCipher {
+
+    ltc_cipher_descriptor const * cipher_;        //!< @brief The descriptor of the block cipher.
+    bool encrypt_;                                //!< @brief Encrypt or Decrypt instance.
+    gcm_state state_;                             //!< @brief The LibTomCrypt GCM state structure used.
+
+    std::vector<unsigned char> iv_;         //!< @brief The IV given at initialization (restored on Reset()).
+    std::vector<unsigned char> aad_;        //!< @brief The additional authenticated data (restored on Reset()).
+    bool keyed_ = false;                    //!< @brief If true, state_ holds a key schedule and GHASH tables.
+
+public:
+    /**
+     * @brief   Size of the authentication tag.
+     */
+    static constexpr std::uint64_t kTagSize = 16;
+
+    /**
+     * @brief   Smallest size of an authentication tag accepted by the decryptor.
+     */
+    static constexpr std::uint64_t kMinTagSize = 12;
+
+    /**
+     * @brief   Constructor.
+     * @param   cipher      the descriptor of the block cipher.
+     * @param   encrypt     enrypt or decrypt instance.
+     */
+    LTCSymmetricGCMCipher(ltc_cipher_descriptor const * cipher, bool encrypt);
+
+    /**
+     * @brief  Destructor.
+     */
+    ~LTCSymmetricGCMCipher() noexcept override;
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm (the tag of the encryptor).
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (the "tag" of the decryptor).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the IV and the AAD and keeps the key schedule and the GHASH tables.
+     * The encryptor refuses with Error::kInvalidOperation as this would reuse the IV.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Starts a new message on the GCM state with the IV and AAD kept.
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Start();
+};
+
+
+}
+
+
+#endif
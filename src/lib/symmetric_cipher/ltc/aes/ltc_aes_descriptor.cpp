@@ -0,0 +1,62 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#if defined(LTC_AES_NI) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define HCS_LTC_AES_NI
+#endif
+
+#include "ltc_aes_descriptor.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Checks if the CPU supports the AES instructions (and SSE4.1 needed by LibTomCrypt).
+ * @return  true, if aesni_desc may be used.
+ */
+static bool HasAESNI() {
+#ifdef HCS_LTC_AES_NI
+    static bool const aesni = []() {
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+            return false;
+        }
+        return ((ecx & bit_AES) != 0) && ((ecx & bit_SSE4_1) != 0);
+    }();
+    return aesni;
+#else
+    return false;
+#endif
+}
+
+
+ltc_cipher_descriptor const * headcode::crypt::SelectAESNIDescriptor() {
+#ifdef HCS_LTC_AES_NI
+    if (HasAESNI()) {
+        return &aesni_desc;
+    }
+#endif
+    return &aes_desc;
+}
+
+
+std::string const & headcode::crypt::GetAESNIImplementation() {
+    static std::string const aesni{"AES-NI"};
+    static std::string const software{"software AES"};
+    return HasAESNI() ? aesni : software;
+}
+
+
+std::string const & headcode::crypt::GetAESNIProvider() {
+    static std::string const provider = std::string{"libtomcrypt v"} + SCRYPT + " (" + GetAESNIImplementation() + ")";
+    return provider;
+}
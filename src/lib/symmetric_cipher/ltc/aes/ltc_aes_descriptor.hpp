@@ -0,0 +1,46 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_AES_DESCRIPTOR_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_AES_DESCRIPTOR_HPP
+
+#include <string>
+
+#include <tomcrypt.h>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Picks the LibTomCrypt AES descriptor of the ltc-aesni-* ciphers.
+ * This is the AES-NI descriptor if LibTomCrypt has been built with AES-NI (LTC_AES_NI) and
+ * the CPU supports the AES instructions. Else this is the table based software AES.
+ * @return  The AES descriptor to use.
+ */
+ltc_cipher_descriptor const * SelectAESNIDescriptor();
+
+
+/**
+ * @brief   Names the AES implementation picked by SelectAESNIDescriptor().
+ * @return  "AES-NI" or "software AES".
+ */
+std::string const & GetAESNIImplementation();
+
+
+/**
+ * @brief   The provider of the ltc-aesni-* ciphers: the LibTomCrypt version and the AES implementation picked.
+ * @return  E.g. "libtomcrypt v1.18.2 (AES-NI)".
+ */
+std::string const & GetAESNIProvider();
+
+
+}
+
+
+#endif
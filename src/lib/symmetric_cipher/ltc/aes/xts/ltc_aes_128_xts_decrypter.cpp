@@ -0,0 +1,84 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "ltc_aes_128_xts_decrypter.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt AES 128 XTS decrypter algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-aes-128-xts-decryptor",                        // name
+            Family::kSymmetricCipher,                           // family
+            "LibTomCrypt AES 128 XTS (decryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 128 Bit encryption algorithm "
+            "in XTS mode (XEX with ciphertext stealing, IEEE P1619) for the encryption of storage devices. "
+            "The key holds the data key and the tweak key (of 16 bytes each). Each Add() takes whole data "
+            "units (sectors): the first sector is the \"sector\" given at initialization, the following count "
+            "up. Use Reinitialize() to start at another sector. Many sectors in a single Add() run on many "
+            "threads. See: https://en.wikipedia.org/wiki/Disk_encryption_theory#XTS.",
+
+            std::string{"libtomcrypt v"} + SCRYPT,        // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kSame,                   // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            0ul,                                          // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "Data key and tweak key (two halves).", false}},
+             {"sector_size", {8ul, PaddingStrategy::PADDING_NONE, "Data unit size (big endian, 4096).", true}},
+             {"sector", {8ul, PaddingStrategy::PADDING_NONE, "The first sector (big endian, 0).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCAES128XTSDecrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCAES128XTSDecrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+Algorithm::Description const & LTCAES128XTSDecrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCAES128XTSDecrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCAES128XTSDecrypterProducer>());
+}
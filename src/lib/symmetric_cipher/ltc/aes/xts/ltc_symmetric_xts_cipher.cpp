@@ -0,0 +1,145 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <array>
+#include <tuple>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/slices.hpp"
+#include "symmetric_cipher/xts.hpp"
+#include "worker_pool.hpp"
+#include "ltc_symmetric_xts_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCSymmetricXTSCipher::LTCSymmetricXTSCipher(ltc_cipher_descriptor const * cipher, bool encrypt)
+    : cipher_{cipher}, encrypt_{encrypt} {
+}
+
+
+LTCSymmetricXTSCipher::~LTCSymmetricXTSCipher() noexcept {
+    zeromem(&state_, sizeof(state_));
+}
+
+
+int LTCSymmetricXTSCipher::Add_(unsigned char const * block_incoming,
+                                std::uint64_t size_incoming,
+                                unsigned char * block_outgoing,
+                                std::uint64_t & size_outgoing) {
+
+    if ((GetCipherIndex() == -1) || (sector_size_ == 0)) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    if (size_incoming % sector_size_ != 0) {
+        headcode::logger::Warning{"headcode.crypt"} << "XTS data is not a multiple of the sector size.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    size_outgoing = size_incoming;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    int res = CRYPT_OK;
+    if (slices < 2) {
+        res = AddSectors(block_incoming, block_outgoing, size_incoming, sector_);
+    } else {
+        // the state is read only while processing: all slices run on it
+        auto slice = [this](unsigned char const * in, unsigned char * out, std::uint64_t size, std::uint64_t sector) {
+            return AddSectors(in, out, size, sector);
+        };
+        res = RunSlices(block_incoming, block_outgoing, size_incoming, sector_, sector_size_, slices, slice);
+    }
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    sector_ += size_incoming / sector_size_;
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int LTCSymmetricXTSCipher::AddSectors(unsigned char const * block_incoming,
+                                      unsigned char * block_outgoing,
+                                      std::uint64_t size,
+                                      std::uint64_t sector) const {
+
+    std::array<unsigned char, xts::kTweakSize> tweak;
+    for (std::uint64_t offset = 0; offset < size; offset += sector_size_, ++sector) {
+        xts::SetTweak(tweak.data(), sector);
+        auto in = block_incoming + offset;
+        auto out = block_outgoing + offset;
+        auto res = encrypt_ ? xts_encrypt(in, sector_size_, out, tweak.data(), &state_)
+                            : xts_decrypt(in, sector_size_, out, tweak.data(), &state_);
+        if (res != CRYPT_OK) {
+            return res;
+        }
+    }
+
+    return CRYPT_OK;
+}
+
+
+int LTCSymmetricXTSCipher::Finalize_(unsigned char *,
+                                     std::uint64_t,
+                                     std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int LTCSymmetricXTSCipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    auto cipher_index = SetDescriptor(cipher_);
+    if (cipher_index == -1) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // without a "key" only sector size and sector change: the key schedule is kept (e.g. for random reads)
+    auto iter = initialization_data.find("key");
+    auto rekey = iter != initialization_data.end();
+    if (!rekey && !keyed_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    unsigned char const * key_data = nullptr;
+    std::uint64_t key_size = 0;
+    if (rekey) {
+        keyed_ = false;
+        std::tie(key_data, key_size) = (*iter).second;
+        if ((key_data == nullptr) || (key_size == 0) || (key_size % 2 != 0)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying XTS key of invalid size.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+    }
+
+    std::uint64_t sector_size = rekey ? xts::kDefaultSectorSize : sector_size_;
+    std::uint64_t sector = 0;
+    auto res = xts::GetArguments(initialization_data, sector_size, sector);
+    if (res != static_cast<int>(Error::kNoError)) {
+        return res;
+    }
+    sector_size_ = sector_size;
+    first_sector_ = sector;
+    sector_ = sector;
+
+    if (!rekey) {
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // the first half is the data key, the second half the tweak key
+    auto half = key_size / 2;
+    res = xts_start(cipher_index, key_data, key_data + half, half, 0, &state_);
+    keyed_ = (res == CRYPT_OK);
+    return res;
+}
+
+
+int LTCSymmetricXTSCipher::Reset_() {
+    sector_ = first_sector_;
+    return static_cast<int>(Error::kNoError);
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_XTS_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_LTC_SYMMETRIC_XTS_CIPHER_HPP
+
+#include <tomcrypt.h>
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "symmetric_cipher/ltc/ltc_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all LibTomCrypt symmetric cipher algorithms running in XTS mode.
+ *
+ * The key holds the data key and the tweak key. Each Add() takes whole data units (sectors),
+ * the tweak of a sector is its number: starting at the "sector" given at initialization and
+ * counting up. Sectors are independent: many sectors in a single Add() are processed in
+ * slices on the worker pool (see SetParallelism()).
+ *
+ * Reinitialize() with a "sector" but no "key" moves to another sector on the key schedule kept:
+ * random reads of single sectors do not set up the keys again.
+ */
+class LTCSymmetricXTSCipher : public LTCSymmetricCipher {
+
+    ltc_cipher_descriptor const * cipher_;        //!< @brief The descriptor of the block cipher.
+    bool encrypt_;                                //!< @brief Encrypt or Decrypt instance.
+    symmetric_xts state_;                         //!< @brief The LibTomCrypt XTS state structure used.
+
+    std::uint64_t sector_size_ = 0;         //!< @brief Size of a data unit.
+    std::uint64_t first_sector_ = 0;        //!< @brief The sector given at initialization (restored on Reset()).
+    std::uint64_t sector_ = 0;              //!< @brief The sector of the next data unit.
+    bool keyed_ = false;                    //!< @brief If true, state_ holds the key schedules.
+
+public:
+    /**
+     * @brief   Constructor.
+     * @param   cipher      the descriptor of the block cipher.
+     * @param   encrypt     enrypt or decrypt instance.
+     */
+    LTCSymmetricXTSCipher(ltc_cipher_descriptor const * cipher, bool encrypt);
+
+    /**
+     * @brief  Destructor.
+     */
+    ~LTCSymmetricXTSCipher() noexcept override;
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add (whole sectors).
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Processes consecutive sectors.
+     * @param   block_incoming      incoming data (whole sectors).
+     * @param   block_outgoing      outgoing data.
+     * @param   size                size of the data.
+     * @param   sector              the number of the first sector.
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int AddSectors(unsigned char const * block_incoming,
+                   unsigned char * block_outgoing,
+                   std::uint64_t size,
+                   std::uint64_t sector) const;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, sector, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the first sector and keeps the key schedule.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <tuple>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+#include <headcode/crypt/factory.hpp>
+
+#include "ltc_chacha_crypt.hpp"
+#include "ltc_chacha20.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt ChaCha20 algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-chacha20",                             // name
+            Family::kSymmetricCipher,                   // family
+            "LibTomCrypt ChaCha20 stream cipher.",      // description (short/left and long/below)
+
+            "This is the ChaCha20 stream cipher of Daniel J. Bernstein as in RFC 8439: a 256 Bit key, a "
+            "96 Bit nonce (or a 64 Bit nonce with a 64 Bit counter) and a 32 Bit block counter. Encryption "
+            "and decryption are the very same and there is no padding. Constant time on any CPU, whole "
+            "blocks are computed 8 (AVX2) or 4 (SSE2) at once if the CPU supports it. A nonce must never be "
+            "used twice with the same key. See: https://en.wikipedia.org/wiki/Salsa20#ChaCha_variant.",
+
+            GetLTCChaChaProvider(),                       // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kSame,                   // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            0ul,                                          // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {12ul, PaddingStrategy::PADDING_NONE, "The nonce (12 or 8 bytes).", false}},
+             {"counter", {4ul, PaddingStrategy::PADDING_NONE, "The first block counter (big endian, 0).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCChaCha20Producer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCChaCha20Cipher>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+LTCChaCha20Cipher::~LTCChaCha20Cipher() noexcept {
+    zeromem(&state_, sizeof(state_));
+}
+
+
+int LTCChaCha20Cipher::Add_(unsigned char const * block_incoming,
+                            std::uint64_t size_incoming,
+                            unsigned char * block_outgoing,
+                            std::uint64_t & size_outgoing) {
+
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    size_outgoing = size_incoming;
+    return LTCChaChaCrypt(&state_, iv_.size(), block_incoming, size_incoming, block_outgoing);
+}
+
+
+int LTCChaCha20Cipher::Finalize_(unsigned char *,
+                                 std::uint64_t,
+                                 std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) {
+    return 0;
+}
+
+
+Algorithm::Description const & LTCChaCha20Cipher::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+int LTCChaCha20Cipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    // without a "key" only IV and counter change: the key is kept
+    auto key_iter = initialization_data.find("key");
+    auto rekey = key_iter != initialization_data.end();
+    if (!rekey && !keyed_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    unsigned char const * key_data = nullptr;
+    std::uint64_t key_size = 0;
+    if (rekey) {
+        keyed_ = false;
+        std::tie(key_data, key_size) = (*key_iter).second;
+        if ((key_size > 0) && (key_data == nullptr)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key which is NULL/nullptr while size is > 0.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+    }
+
+    auto iter = initialization_data.find("iv");
+    if (iter == initialization_data.end()) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [iv_data, iv_size] = (*iter).second;
+    if (((iv_size != 12) && (iv_size != 8)) || (iv_data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying IV of invalid size (12 or 8 bytes).";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    std::uint64_t counter = 0;
+    iter = initialization_data.find("counter");
+    if (iter != initialization_data.end()) {
+        auto [counter_data, counter_size] = (*iter).second;
+        auto max_size = (iv_size == 12) ? 4ul : 8ul;
+        if ((counter_size == 0) || (counter_size > max_size) || (counter_data == nullptr)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Invalid size of counter (1 to " << max_size << " bytes).";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        for (std::uint64_t i = 0; i < counter_size; ++i) {
+            counter = (counter << 8) | counter_data[i];
+        }
+    }
+
+    iv_.assign(iv_data, iv_data + iv_size);
+    counter_ = counter;
+
+    if (rekey) {
+        auto res = chacha_setup(&state_, key_data, key_size, kRounds);
+        if (res != CRYPT_OK) {
+            return res;
+        }
+        keyed_ = true;
+    }
+
+    return Start();
+}
+
+
+void LTCChaCha20Cipher::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCChaCha20Producer>());
+}
+
+
+int LTCChaCha20Cipher::Reset_() {
+
+    if (!keyed_) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // encryption and decryption are the same: the keystream of the IV is never handed out twice
+    headcode::logger::Warning{"headcode.crypt"} << "Refusing to reuse the IV: reinitialize with a new \"iv\".";
+    return static_cast<int>(Error::kInvalidOperation);
+}
+
+
+int LTCChaCha20Cipher::Start() {
+    if (iv_.size() == 12) {
+        return chacha_ivctr32(&state_, iv_.data(), iv_.size(), static_cast<ulong32>(counter_));
+    }
+    return chacha_ivctr64(&state_, iv_.data(), iv_.size(), counter_);
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_CHACHA20_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_CHACHA20_HPP
+
+#include <vector>
+
+#include <tomcrypt.h>
+
+#include <headcode/crypt/algorithm.hpp>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The LibTomCrypt ChaCha20 stream cipher (encryptor and decryptor).
+ *
+ * The key is set up by LibTomCrypt, whole blocks of keystream are computed by the SIMD kernel
+ * picked for this CPU (see LTCChaChaCrypt()).
+ *
+ * A keystream must never be used twice: Reset() is refused. Reinitialize() with "iv" (and
+ * "counter") but no "key" continues on the key kept, e.g. to seek within a stream.
+ */
+class LTCChaCha20Cipher : public Algorithm {
+
+    chacha_state state_;                          //!< @brief The LibTomCrypt ChaCha state structure used.
+    std::vector<unsigned char> iv_;               //!< @brief The IV given at initialization.
+    std::uint64_t counter_ = 0;                   //!< @brief The initial block counter.
+    bool keyed_ = false;                          //!< @brief The state holds a key.
+
+public:
+    /**
+     * @brief   Number of ChaCha rounds.
+     */
+    static constexpr int kRounds = 20;
+
+    /**
+     * @brief   Constructor.
+     */
+    LTCChaCha20Cipher() = default;
+
+    /**
+     * @brief  Destructor.
+     */
+    ~LTCChaCha20Cipher() noexcept override;
+
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm.
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (== final key) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Refuses to reset this object instance, as this would reuse the IV.
+     * @return  Error::kInvalidOperation (or 0 if not initialized yet).
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Sets IV and initial counter on the keyed state.
+     * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+     */
+    int Start();
+};
+
+
+}
+
+
+#endif
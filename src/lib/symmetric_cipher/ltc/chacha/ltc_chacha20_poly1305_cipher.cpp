@@ -0,0 +1,192 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "ltc_chacha_crypt.hpp"
+#include "ltc_chacha20_poly1305_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+LTCChaCha20Poly1305Cipher::LTCChaCha20Poly1305Cipher(bool encrypt) : encrypt_{encrypt} {
+}
+
+
+LTCChaCha20Poly1305Cipher::~LTCChaCha20Poly1305Cipher() noexcept {
+    zeromem(&state_, sizeof(state_));
+}
+
+
+int LTCChaCha20Poly1305Cipher::Add_(unsigned char const * block_incoming,
+                                    std::uint64_t size_incoming,
+                                    unsigned char * block_outgoing,
+                                    std::uint64_t & size_outgoing) {
+
+    if (!keyed_) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    size_outgoing = size_incoming;
+
+    // as chacha20poly1305_encrypt() and chacha20poly1305_decrypt() do, but with the keystream
+    // on the SIMD kernel: Poly1305 runs over the cipher text (read before it is overwritten)
+    int res = CRYPT_OK;
+    if (encrypt_) {
+        res = LTCChaChaCrypt(&state_.chacha, iv_.size(), block_incoming, size_incoming, block_outgoing);
+        if (res == CRYPT_OK) {
+            res = poly1305_process(&state_.poly, block_outgoing, size_incoming);
+        }
+    } else {
+        res = poly1305_process(&state_.poly, block_incoming, size_incoming);
+        if (res == CRYPT_OK) {
+            res = LTCChaChaCrypt(&state_.chacha, iv_.size(), block_incoming, size_incoming, block_outgoing);
+        }
+    }
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    state_.ctlen += size_incoming;
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int LTCChaCha20Poly1305Cipher::Finalize_(
+        unsigned char * result,
+        std::uint64_t result_size,
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) {
+
+    std::array<unsigned char, kTagSize> tag;
+    unsigned long tag_size = tag.size();
+    auto res = chacha20poly1305_done(&state_, tag.data(), &tag_size);
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    if (encrypt_) {
+        if (result_size < kTagSize) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        std::copy(tag.begin(), tag.end(), result);
+        return static_cast<int>(Error::kNoError);
+    }
+
+    auto iter = finalization_data.find("tag");
+    if (iter == finalization_data.end()) {
+        headcode::logger::Warning{"headcode.crypt"} << "Missing authentication tag.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [expected_data, expected_size] = (*iter).second;
+    if ((expected_size < kMinTagSize) || (expected_size > kTagSize)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Invalid size of authentication tag.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    if (mem_neq(tag.data(), expected_data, expected_size) != 0) {
+        return static_cast<int>(Error::kAuthenticationFailed);
+    }
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int LTCChaCha20Poly1305Cipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    // without a "key" only the IV changes: the key is kept
+    auto key_iter = initialization_data.find("key");
+    auto rekey = key_iter != initialization_data.end();
+    if (!rekey && !keyed_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    unsigned char const * key_data = nullptr;
+    std::uint64_t key_size = 0;
+    if (rekey) {
+        keyed_ = false;
+        std::tie(key_data, key_size) = (*key_iter).second;
+        if ((key_size > 0) && (key_data == nullptr)) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key which is NULL/nullptr while size is > 0.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+    }
+
+    auto iter = initialization_data.find("iv");
+    if (iter == initialization_data.end()) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [iv_data, iv_size] = (*iter).second;
+    if (((iv_size != 12) && (iv_size != 8)) || (iv_data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying IV of invalid size (12 or 8 bytes).";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    if (encrypt_ && !rekey && (iv_size == iv_.size()) && std::equal(iv_.begin(), iv_.end(), iv_data)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Refusing to encrypt with the same key and IV again.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    iv_.assign(iv_data, iv_data + iv_size);
+
+    aad_.clear();
+    iter = initialization_data.find("aad");
+    if (iter != initialization_data.end()) {
+        auto [aad_data, aad_size] = (*iter).second;
+        if (aad_size > 0) {
+            aad_.assign(aad_data, aad_data + aad_size);
+        }
+    }
+
+    if (rekey) {
+        auto res = chacha20poly1305_init(&state_, key_data, key_size);
+        if (res != CRYPT_OK) {
+            return res;
+        }
+        keyed_ = true;
+    }
+
+    return Start();
+}
+
+
+int LTCChaCha20Poly1305Cipher::Reset_() {
+
+    if (!keyed_) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    if (encrypt_) {
+        headcode::logger::Warning{"headcode.crypt"} << "Refusing to reuse the IV: reinitialize with a new \"iv\".";
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+
+    return Start();
+}
+
+
+int LTCChaCha20Poly1305Cipher::Start() {
+
+    // the IV derives a fresh Poly1305 key from the key kept in the ChaCha state
+    auto res = chacha20poly1305_setiv(&state_, iv_.data(), iv_.size());
+    if (res != CRYPT_OK) {
+        return res;
+    }
+
+    unsigned char none = 0;
+    if (!aad_.empty()) {
+        res = chacha20poly1305_add_aad(&state_, aad_.data(), aad_.size());
+        if (res != CRYPT_OK) {
+            return res;
+        }
+    }
+
+    // an empty text pads the AAD and switches the state to text mode: Add_() only adds text
+    return chacha20poly1305_encrypt(&state_, &none, 0, &none);
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "ltc_chacha_crypt.hpp"
+#include "ltc_chacha20_poly1305_decrypter.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt ChaCha20-Poly1305 decrypter algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-chacha20-poly1305-decryptor",                        // name
+            Family::kSymmetricCipher,                                 // family
+            "LibTomCrypt ChaCha20-Poly1305 (decryptor part).",        // description (short/left and long/below)
+
+            "This is the ChaCha20 stream cipher with the Poly1305 authenticator as in RFC 8439: "
+            "authenticated encryption in a single pass over the data, constant time on any CPU. "
+            "Finalize() takes the authentication tag (12 to 16 bytes) as \"tag\" argument and fails if the "
+            "data does not match. Discard all output if so. "
+            "Whole ChaCha20 blocks are computed 8 (AVX2) or 4 (SSE2) at once if the CPU supports it. "
+            "An IV must never be used twice with the same key: use Reinitialize() with a fresh IV for each "
+            "message. See: https://en.wikipedia.org/wiki/ChaCha20-Poly1305.",
+
+            GetLTCChaChaProvider(),                       // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kSame,                   // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            0ul,                                          // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {12ul, PaddingStrategy::PADDING_NONE, "The nonce (12 or 8 bytes).", false}},
+             {"aad", {0ul, PaddingStrategy::PADDING_NONE, "Additional authenticated data (not encrypted).", true}}},
+
+            // finalization data
+            {{"tag", {16ul, PaddingStrategy::PADDING_NONE, "The authentication tag.", false}}}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCChaCha20Poly1305DecrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCChaCha20Poly1305Decrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+Algorithm::Description const & LTCChaCha20Poly1305Decrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCChaCha20Poly1305Decrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCChaCha20Poly1305DecrypterProducer>());
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/factory.hpp>
+
+#include "ltc_chacha_crypt.hpp"
+#include "ltc_chacha20_poly1305_encrypter.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The LibTomCrypt ChaCha20-Poly1305 encrypter algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "ltc-chacha20-poly1305-encryptor",                        // name
+            Family::kSymmetricCipher,                                 // family
+            "LibTomCrypt ChaCha20-Poly1305 (encryptor part).",        // description (short/left and long/below)
+
+            "This is the ChaCha20 stream cipher with the Poly1305 authenticator as in RFC 8439: "
+            "authenticated encryption in a single pass over the data, constant time on any CPU. "
+            "The 16 byte authentication tag is the result of Finalize(). "
+            "Whole ChaCha20 blocks are computed 8 (AVX2) or 4 (SSE2) at once if the CPU supports it. "
+            "An IV must never be used twice with the same key: use Reinitialize() with a fresh IV for each "
+            "message. See: https://en.wikipedia.org/wiki/ChaCha20-Poly1305.",
+
+            GetLTCChaChaProvider(),                       // provider
+            0ul,                                          // input block size
+            ProcessingBlockSize::kSame,                   // output block size behaviour
+            0ul,                                          // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,                // default padding strategy
+            16ul,                                         // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {12ul, PaddingStrategy::PADDING_NONE, "The nonce (12 or 8 bytes).", false}},
+             {"aad", {0ul, PaddingStrategy::PADDING_NONE, "Additional authenticated data (not encrypted).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class LTCChaCha20Poly1305EncrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<LTCChaCha20Poly1305Encrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+Algorithm::Description const & LTCChaCha20Poly1305Encrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void LTCChaCha20Poly1305Encrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<LTCChaCha20Poly1305EncrypterProducer>());
+}
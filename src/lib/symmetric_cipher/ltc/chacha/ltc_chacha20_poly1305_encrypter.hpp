@@ -0,0 +1,49 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_CHACHA20_POLY1305_ENCRYPTER_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_LTC_CHACHA20_POLY1305_ENCRYPTER_HPP
+
+#include <headcode/crypt/algorithm.hpp>
+
+#include "ltc_chacha20_poly1305_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The LibTomCrypt ChaCha20-Poly1305 authenticated Cypher (encryptor part).
+ */
+class LTCChaCha20Poly1305Encrypter : public LTCChaCha20Poly1305Cipher {
+
+public:
+    /**
+     * @brief   Constructor
+     */
+    LTCChaCha20Poly1305Encrypter() : LTCChaCha20Poly1305Cipher(true) {
+    }
+
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include "symmetric_cipher/chacha/chacha_kernel.hpp"
+#include "ltc_chacha_crypt.hpp"
+
+using namespace headcode::crypt;
+
+
+int headcode::crypt::LTCChaChaCrypt(chacha_state * state,
+                                    std::uint64_t iv_size,
+                                    unsigned char const * in,
+                                    std::uint64_t size,
+                                    unsigned char * out) {
+
+    static chacha::Kernel const kernel = chacha::SelectKernel();
+
+    // keystream left over from the last call first
+    if ((state->ksleft > 0) && (size > 0)) {
+        auto left = std::min<std::uint64_t>(state->ksleft, size);
+        auto res = chacha_crypt(state, in, left, out);
+        if (res != CRYPT_OK) {
+            return res;
+        }
+        in += left;
+        out += left;
+        size -= left;
+    }
+
+    auto blocks = size / chacha::kBlockSize;
+    while (blocks > 0) {
+
+        // the kernels count on the low word of the counter only: stop where it wraps (which is
+        // the end of the stream for a 12 byte IV, as in chacha_crypt())
+        std::uint64_t until_wrap = (1ull << 32) - state->input[12];
+        if ((iv_size == 12) && (blocks >= until_wrap)) {
+            return CRYPT_OVERFLOW;
+        }
+        auto run = std::min(blocks, until_wrap);
+        kernel(state->input, static_cast<unsigned int>(state->rounds), in, out, run);
+
+        state->input[12] += static_cast<ulong32>(run);
+        if (state->input[12] == 0) {
+            // the 64 bit counter of the 8 byte IV
+            ++state->input[13];
+        }
+        in += run * chacha::kBlockSize;
+        out += run * chacha::kBlockSize;
+        size -= run * chacha::kBlockSize;
+        blocks -= run;
+    }
+
+    if (size > 0) {
+        return chacha_crypt(state, in, size, out);
+    }
+    return CRYPT_OK;
+}
+
+
+std::string const & headcode::crypt::GetLTCChaChaProvider() {
+    static std::string const provider = std::string{"libtomcrypt v"} + SCRYPT + " (" + chacha::GetKernelName() + ")";
+    return provider;
+}
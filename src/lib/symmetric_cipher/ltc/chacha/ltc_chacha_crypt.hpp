@@ -0,0 +1,50 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_SYMMETRIC_CIPHER_LTC_CHACHA_CRYPT_HPP
+#define HEADCODE_SPACE_CRYPT_SYMMETRIC_CIPHER_LTC_CHACHA_CRYPT_HPP
+
+#include <cstdint>
+#include <string>
+
+#include <tomcrypt.h>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Encrypts (or decrypts) data on a LibTomCrypt ChaCha state, like chacha_crypt().
+ * Whole blocks run on the keystream kernel picked for this CPU (see chacha::SelectKernel()),
+ * keystream left over from a previous call and the final partial block on LibTomCrypt. The
+ * state is advanced just like chacha_crypt() does.
+ * @param   state       the LibTomCrypt ChaCha state (set up with key, IV and counter).
+ * @param   iv_size     size of the IV: 12 bytes with a 32 bit counter, 8 bytes with a 64 bit counter.
+ * @param   in          the incoming data.
+ * @param   size        size of the data.
+ * @param   out         the outgoing data (may be the incoming data).
+ * @return  LibTomCrypt error code (CRYPT_OK == 0 == ok).
+ */
+int LTCChaChaCrypt(chacha_state * state,
+                   std::uint64_t iv_size,
+                   unsigned char const * in,
+                   std::uint64_t size,
+                   unsigned char * out);
+
+
+/**
+ * @brief   The provider of the ltc-chacha20* ciphers: the LibTomCrypt version and the keystream kernel picked.
+ * @return  The provider string.
+ */
+std::string const & GetLTCChaChaProvider();
+
+
+}
+
+
+#endif
@@ -6,27 +6,46 @@
  * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
  */
 
+#include <map>
+#include <mutex>
+
 #include "ltc_symmetric_cipher.hpp"
 
 using namespace headcode::crypt;
 
 
-LTCSymmetricCipher::~LTCSymmetricCipher() noexcept {
-    if (descriptor_ != nullptr) {
-        unregister_cipher(descriptor_);
-        descriptor_ = nullptr;
+int headcode::crypt::RegisterLTCCipher(ltc_cipher_descriptor const * descriptor) {
+
+    if (descriptor == nullptr) {
+        return -1;
+    }
+
+    static std::mutex mutex;
+    static std::map<ltc_cipher_descriptor const *, int> cipher_indexes;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    auto iter = cipher_indexes.find(descriptor);
+    if (iter != cipher_indexes.end()) {
+        return (*iter).second;
+    }
+
+    auto cipher_index = register_cipher(descriptor);
+    if (cipher_index != -1) {
+        cipher_indexes.emplace(descriptor, cipher_index);
     }
+    return cipher_index;
 }
 
 
-int LTCSymmetricCipher::SetDescriptor(ltc_cipher_descriptor const * descriptor) {
+LTCSymmetricCipher::~LTCSymmetricCipher() noexcept {
+    // The descriptor stays registered: other instances may still run on it.
+    descriptor_ = nullptr;
+    cipher_index_ = -1;
+}
 
-    int res = 0;
 
+int LTCSymmetricCipher::SetDescriptor(ltc_cipher_descriptor const * descriptor) {
     descriptor_ = descriptor;
-    if (descriptor_ != nullptr) {
-        res = register_cipher(descriptor_);
-    }
-
-    return res;
+    cipher_index_ = RegisterLTCCipher(descriptor_);
+    return cipher_index_;
 }
@@ -17,12 +17,23 @@
 namespace headcode::crypt {
 
 
+/**
+ * @brief   Registers a descriptor in the LibTomCrypt cipher table.
+ * Each descriptor is registered only once per process and never unregistered: the cipher
+ * table is global and guarded by a mutex, so it is kept out of the way of the instances.
+ * @param   descriptor      the cipher descriptor.
+ * @return  The index into the cipher_descriptor table (or -1 in case of error).
+ */
+int RegisterLTCCipher(ltc_cipher_descriptor const * descriptor);
+
+
 /**
  * @brief   Base class of all LibTomCrypt symmetric cipher algorithms.
  */
 class LTCSymmetricCipher : public Algorithm {
 
     ltc_cipher_descriptor const * descriptor_{nullptr};        //!< @brief The LibTomCrypt descriptior for the cipher.
+    int cipher_index_{-1};                                     //!< @brief Index of the descriptor in the cipher table.
 
 public:
     /**
@@ -40,7 +51,17 @@ protected:
     }
 
     /**
-     * @brief   Sets and registers the cipher descriptor.
+     * @brief   Returns the index of the current cipher in the LibTomCrypt cipher table.
+     * @return  The index of the cipher set by SetDescriptor() (or -1 if none).
+     */
+    int GetCipherIndex() const {
+        return cipher_index_;
+    }
+
+    /**
+     * @brief   Sets the cipher descriptor.
+     * The descriptor is registered in the LibTomCrypt cipher table once for the whole
+     * process (see RegisterLTCCipher()). The index is kept, so Add_() needs no table lookup.
      * @param   descriptor      The new cipher descriptor.
      * @return  The index into the cipher_descriptor table (or -1 in case of error).
      */
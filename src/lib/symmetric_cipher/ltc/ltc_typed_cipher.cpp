@@ -0,0 +1,41 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <headcode/crypt/typed.hpp>
+
+#include <tomcrypt.h>
+
+using namespace headcode::crypt;
+
+
+static_assert(sizeof(symmetric_key) <= detail::LTCAESBackend::kStateSize,
+              "The opaque state of the typed cipher is too small for the libtomcrypt symmetric_key.");
+static_assert(alignof(symmetric_key) <= 16, "The opaque state of the typed cipher is not aligned for symmetric_key.");
+
+
+// The AES block functions are called directly (and not via the cipher descriptor table
+// as cbc_encrypt() and friends do), so the typed cipher needs no registered descriptor.
+
+int detail::LTCAESBackend::Setup(void * state, unsigned char const * key, std::uint64_t key_size) noexcept {
+    return rijndael_setup(key, static_cast<int>(key_size), 0, static_cast<symmetric_key *>(state));
+}
+
+
+int detail::LTCAESBackend::EncryptBlock(void const * state, unsigned char const * in, unsigned char * out) noexcept {
+    return rijndael_ecb_encrypt(in, out, static_cast<symmetric_key const *>(state));
+}
+
+
+int detail::LTCAESBackend::DecryptBlock(void const * state, unsigned char const * in, unsigned char * out) noexcept {
+    return rijndael_ecb_decrypt(in, out, static_cast<symmetric_key const *>(state));
+}
+
+
+void detail::LTCAESBackend::Done(void * state) noexcept {
+    rijndael_done(static_cast<symmetric_key *>(state));
+}
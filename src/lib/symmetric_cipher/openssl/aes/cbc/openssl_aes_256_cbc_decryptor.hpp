@@ -9,7 +9,7 @@
 #ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_256_CBC_DECRYPTOR_HPP
 #define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_256_CBC_DECRYPTOR_HPP
 
-#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+#include "openssl_symmetric_cbc_decryptor.hpp"
 
 
 namespace headcode::crypt {
@@ -18,13 +18,13 @@ namespace headcode::crypt {
 /**
  * @brief   The OpenSSL AES 256 Bit Cypher CBC Decryptor.
  */
-class OpenSSLAES256CBCDecrypter : public OpenSSLSymmetricCipher {
+class OpenSSLAES256CBCDecrypter : public OpenSSLSymmetricCBCDecrypter {
 
 public:
     /**
      * @brief   Constructor
      */
-    OpenSSLAES256CBCDecrypter() : OpenSSLSymmetricCipher(false) {
+    OpenSSLAES256CBCDecrypter() {
     }
 
     /**
@@ -0,0 +1,70 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <vector>
+
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/slices.hpp"
+#include "worker_pool.hpp"
+#include "openssl_symmetric_cbc_decryptor.hpp"
+
+using namespace headcode::crypt;
+
+
+int OpenSSLSymmetricCBCDecrypter::Add_(unsigned char const * block_incoming,
+                                       std::uint64_t size_incoming,
+                                       unsigned char * block_outgoing,
+                                       std::uint64_t & size_outgoing) {
+
+    size_outgoing = size_incoming;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    if (slices < 2) {
+        return Update(GetCipherContext(), block_incoming, block_outgoing, size_incoming);
+    }
+
+    // the first slice runs on the context itself, all others on a copy with the cipher block
+    // before the slice as IV: all taken before any (maybe in place) decryption starts
+    std::uint64_t block_size = EVP_CIPHER_CTX_block_size(GetCipherContext());
+    auto slice_size = GetSliceSize(size_incoming, block_size, slices);
+    std::vector<EVP_CIPHER_CTX *> contexts(slices, nullptr);
+    contexts[0] = GetCipherContext();
+
+    int res = static_cast<int>(Error::kNoError);
+    for (std::uint64_t i = 1; (i < slices) && (i * slice_size < size_incoming) && (res == 0); ++i) {
+        contexts[i] = EVP_CIPHER_CTX_new();
+        auto iv = block_incoming + i * slice_size - block_size;
+        if ((contexts[i] == nullptr) || (EVP_CIPHER_CTX_copy(contexts[i], GetCipherContext()) != 1) ||
+            (EVP_CipherInit_ex(contexts[i], nullptr, nullptr, nullptr, iv, -1) != 1)) {
+            res = 1;
+        }
+    }
+    std::vector<unsigned char> last_block(block_incoming + size_incoming - block_size, block_incoming + size_incoming);
+
+    if (res == 0) {
+        auto slice = [&](unsigned char const * in, unsigned char * out, std::uint64_t length, std::uint64_t block) {
+            return Update(contexts[block * block_size / slice_size], in, out, length);
+        };
+        res = RunSlices(block_incoming, block_outgoing, size_incoming, 0, block_size, slices, slice);
+    }
+
+    for (std::uint64_t i = 1; i < slices; ++i) {
+        EVP_CIPHER_CTX_free(contexts[i]);
+    }
+    if (res != 0) {
+        return res;
+    }
+
+    // continue the chain after the last cipher block
+    if (EVP_CipherInit_ex(GetCipherContext(), nullptr, nullptr, nullptr, last_block.data(), -1) != 1) {
+        return 1;
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
@@ -0,0 +1,53 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_CBC_DECRYPTOR_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_CBC_DECRYPTOR_HPP
+
+#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all OpenSSL symmetric cipher decryptors running in CBC mode.
+ *
+ * CBC decryption does not chain: each block needs the cipher block before it only. So large
+ * buffers are decrypted in slices on the worker pool, each slice on a copy of the cipher context
+ * with the last cipher block before the slice as IV (see SetParallelism()).
+ */
+class OpenSSLSymmetricCBCDecrypter : public OpenSSLSymmetricCipher {
+
+public:
+    /**
+     * @brief   Constructor
+     */
+    OpenSSLSymmetricCBCDecrypter() : OpenSSLSymmetricCipher(false) {
+    }
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+};
+
+
+}
+
+
+#endif
@@ -0,0 +1,48 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_CTR_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_CTR_HPP
+
+#include "openssl_symmetric_ctr_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The OpenSSL AES 128 Bit Cypher in CTR mode (encryptor and decryptor).
+ */
+class OpenSSLAES128CTRCipher : public OpenSSLSymmetricCTRCipher {
+
+public:
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+protected:
+    /**
+     * @brief   Gets the OpenSSL cipher to work on.
+     * @return  The OpenSSL cipher to use.
+     */
+    EVP_CIPHER const * GetCipher() const override;
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
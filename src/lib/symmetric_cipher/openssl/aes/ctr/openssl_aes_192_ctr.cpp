@@ -0,0 +1,89 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <openssl/opensslv.h>
+
+#include <headcode/crypt/factory.hpp>
+
+#include "openssl_aes_192_ctr.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The OpenSSL AES 192 CTR algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "openssl-aes-192-ctr",                 // name
+            Family::kSymmetricCipher,              // family
+            "OpenSSL AES 192 in CTR mode.",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 192 Bit encryption algorithm "
+            "in CTR (counter) mode. The IV is the initial 128 Bit counter block, incremented big endian. "
+            "Encryption and decryption are the very same and there is no padding. Large buffers are processed "
+            "on many threads (see SetParallelism()). See: https://en.wikipedia.org/wiki/Advanced_Encryption_Standard "
+            "and https://en.wikipedia.org/wiki/Block_cipher_mode_of_operation#Counter_(CTR).",
+
+            OPENSSL_VERSION_TEXT,                 // provider
+            0ul,                                  // input block size
+            ProcessingBlockSize::kSame,           // output block size behaviour
+            0ul,                                  // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,        // default padding strategy
+            0ul,                                  // result size
+
+            // initial data
+            {{"key", {24ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {16ul, PaddingStrategy::PADDING_PKCS_5_7, "The initial counter block.", false}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class OpenSSLAES192CTRProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<OpenSSLAES192CTRCipher>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+EVP_CIPHER const * OpenSSLAES192CTRCipher::GetCipher() const {
+    return EVP_aes_192_ctr();
+}
+
+
+Algorithm::Description const & OpenSSLAES192CTRCipher::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void OpenSSLAES192CTRCipher::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLAES192CTRProducer>());
+}
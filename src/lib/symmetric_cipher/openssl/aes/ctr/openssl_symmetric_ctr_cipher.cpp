@@ -0,0 +1,120 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <array>
+
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/ctr.hpp"
+#include "symmetric_cipher/slices.hpp"
+#include "worker_pool.hpp"
+#include "openssl_symmetric_ctr_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The block size of AES (and the size of the counter).
+ */
+static std::uint64_t const kBlockSize = 16;
+
+
+int OpenSSLSymmetricCTRCipher::Add_(unsigned char const * block_incoming,
+                                    std::uint64_t size_incoming,
+                                    unsigned char * block_outgoing,
+                                    std::uint64_t & size_outgoing) {
+
+    size_outgoing = size_incoming;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    if (slices < 2) {
+        position_ += size_incoming;
+        return Update(GetCipherContext(), block_incoming, block_outgoing, size_incoming);
+    }
+
+    // the head up to the next block boundary is on the running keystream
+    auto head = (kBlockSize - position_ % kBlockSize) % kBlockSize;
+    auto res = Update(GetCipherContext(), block_incoming, block_outgoing, head);
+    if (res != 0) {
+        return res;
+    }
+
+    auto slice = [this](unsigned char const * in, unsigned char * out, std::uint64_t size, std::uint64_t block) {
+        return AddSlice(in, out, size, block);
+    };
+    res = RunSlices(block_incoming + head,
+                    block_outgoing + head,
+                    size_incoming - head,
+                    (position_ + head) / kBlockSize,
+                    kBlockSize,
+                    slices,
+                    slice);
+    if (res != 0) {
+        return res;
+    }
+
+    position_ += size_incoming;
+    return Seek(GetCipherContext(), position_);
+}
+
+
+int OpenSSLSymmetricCTRCipher::AddSlice(unsigned char const * block_incoming,
+                                        unsigned char * block_outgoing,
+                                        std::uint64_t size,
+                                        std::uint64_t block) const {
+
+    auto ctx = EVP_CIPHER_CTX_new();
+    if (ctx == nullptr) {
+        return 1;
+    }
+
+    int res = 1;
+    if (EVP_CIPHER_CTX_copy(ctx, GetCipherContext()) == 1) {
+        res = Seek(ctx, block * kBlockSize);
+        if (res == 0) {
+            res = Update(ctx, block_incoming, block_outgoing, size);
+        }
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return res;
+}
+
+
+int OpenSSLSymmetricCTRCipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+    position_ = 0;
+    return OpenSSLSymmetricCipher::Initialize_(initialization_data);
+}
+
+
+int OpenSSLSymmetricCTRCipher::Reset_() {
+    position_ = 0;
+    return OpenSSLSymmetricCipher::Reset_();
+}
+
+
+int OpenSSLSymmetricCTRCipher::Seek(EVP_CIPHER_CTX * ctx, std::uint64_t position) const {
+
+    auto const & initial_iv = GetInitialIV();
+    if (initial_iv.size() != kBlockSize) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+
+    std::array<unsigned char, kBlockSize> counter;
+    std::copy(initial_iv.begin(), initial_iv.end(), counter.begin());
+    ctr::AddToCounter(counter.data(), kBlockSize, position / kBlockSize);
+    if (EVP_CipherInit_ex(ctx, nullptr, nullptr, nullptr, counter.data(), -1) != 1) {
+        return 1;
+    }
+
+    // skip the keystream used within the current block
+    std::array<unsigned char, kBlockSize> skip{};
+    return Update(ctx, skip.data(), skip.data(), position % kBlockSize);
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_CTR_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_CTR_CIPHER_HPP
+
+#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all OpenSSL symmetric cipher algorithms running in CTR mode.
+ *
+ * Large buffers are cut into slices processed on the worker pool, each slice on a copy of
+ * the cipher context set to the counter of the slice (see SetParallelism()).
+ */
+class OpenSSLSymmetricCTRCipher : public OpenSSLSymmetricCipher {
+
+    std::uint64_t position_ = 0;        //!< @brief Number of bytes processed so far.
+
+public:
+    /**
+     * @brief   Constructor
+     */
+    OpenSSLSymmetricCTRCipher() : OpenSSLSymmetricCipher(true) {
+    }
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Processes a slice of the stream on a cipher context of its own.
+     * @param   block_incoming      incoming data of the slice.
+     * @param   block_outgoing      outgoing data of the slice.
+     * @param   size                size of the slice.
+     * @param   block               number of the first block of the slice (counted from the IV).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int AddSlice(unsigned char const * block_incoming,
+                 unsigned char * block_outgoing,
+                 std::uint64_t size,
+                 std::uint64_t block) const;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the initial IV and keeps the key schedule.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Moves a cipher context to a position in the stream.
+     * @param   ctx             the cipher context.
+     * @param   position        the position in bytes.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Seek(EVP_CIPHER_CTX * ctx, std::uint64_t position) const;
+};
+
+
+}
+
+
+#endif
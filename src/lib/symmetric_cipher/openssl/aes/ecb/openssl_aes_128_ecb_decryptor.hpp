@@ -9,7 +9,7 @@
 #ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_ECB_DECRYPTOR_HPP
 #define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_ECB_DECRYPTOR_HPP
 
-#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+#include "openssl_symmetric_ecb_cipher.hpp"
 
 
 namespace headcode::crypt {
@@ -18,13 +18,13 @@ namespace headcode::crypt {
 /**
  * @brief   The OpenSSL AES 128 Bit Cypher ECB Decryptor.
  */
-class OpenSSLAES128ECBDecrypter : public OpenSSLSymmetricCipher {
+class OpenSSLAES128ECBDecrypter : public OpenSSLSymmetricECBCipher {
 
 public:
     /**
      * @brief   Constructor
      */
-    OpenSSLAES128ECBDecrypter() : OpenSSLSymmetricCipher(false) {
+    OpenSSLAES128ECBDecrypter() : OpenSSLSymmetricECBCipher(false) {
     }
 
     /**
@@ -9,7 +9,7 @@
 #ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_ECB_ENCRYPTOR_HPP
 #define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_ECB_ENCRYPTOR_HPP
 
-#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+#include "openssl_symmetric_ecb_cipher.hpp"
 
 
 namespace headcode::crypt {
@@ -18,13 +18,13 @@ namespace headcode::crypt {
 /**
  * @brief   The OpenSSL AES 128 Bit Cypher ECB Encryptor.
  */
-class OpenSSLAES128ECBEncrypter : public OpenSSLSymmetricCipher {
+class OpenSSLAES128ECBEncrypter : public OpenSSLSymmetricECBCipher {
 
 public:
     /**
      * @brief   Constructor
      */
-    OpenSSLAES128ECBEncrypter() : OpenSSLSymmetricCipher(true) {
+    OpenSSLAES128ECBEncrypter() : OpenSSLSymmetricECBCipher(true) {
     }
 
     /**
@@ -9,7 +9,7 @@
 #ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_192_ECB_ENCRYPTOR_HPP
 #define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_192_ECB_ENCRYPTOR_HPP
 
-#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+#include "openssl_symmetric_ecb_cipher.hpp"
 
 
 namespace headcode::crypt {
@@ -18,13 +18,13 @@ namespace headcode::crypt {
 /**
  * @brief   The OpenSSL AES 192 Bit Cypher ECB Encryptor.
  */
-class OpenSSLAES192ECBEncrypter : public OpenSSLSymmetricCipher {
+class OpenSSLAES192ECBEncrypter : public OpenSSLSymmetricECBCipher {
 
 public:
     /**
      * @brief   Constructor
      */
-    OpenSSLAES192ECBEncrypter() : OpenSSLSymmetricCipher(true) {
+    OpenSSLAES192ECBEncrypter() : OpenSSLSymmetricECBCipher(true) {
     }
 
     /**
@@ -10,7 +10,7 @@
 #define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_256_ECB_ENCRYPTOR_HPP
 
 
-#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+#include "openssl_symmetric_ecb_cipher.hpp"
 
 
 namespace headcode::crypt {
@@ -19,13 +19,13 @@ namespace headcode::crypt {
 /**
  * @brief   The OpenSSL AES 256 Bit Cypher ECB Encryptor.
  */
-class OpenSSLAES256ECBEncrypter : public OpenSSLSymmetricCipher {
+class OpenSSLAES256ECBEncrypter : public OpenSSLSymmetricECBCipher {
 
 public:
     /**
      * @brief   Constructor
      */
-    OpenSSLAES256ECBEncrypter() : OpenSSLSymmetricCipher(true) {
+    OpenSSLAES256ECBEncrypter() : OpenSSLSymmetricECBCipher(true) {
     }
 
     /**
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include "symmetric_cipher/slices.hpp"
+#include "worker_pool.hpp"
+#include "openssl_symmetric_ecb_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+int OpenSSLSymmetricECBCipher::Add_(unsigned char const * block_incoming,
+                                    std::uint64_t size_incoming,
+                                    unsigned char * block_outgoing,
+                                    std::uint64_t & size_outgoing) {
+
+    size_outgoing = size_incoming;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    if (slices < 2) {
+        return Update(GetCipherContext(), block_incoming, block_outgoing, size_incoming);
+    }
+
+    auto slice = [this](unsigned char const * in, unsigned char * out, std::uint64_t size, std::uint64_t) {
+        return AddSlice(in, out, size);
+    };
+    auto block_size = static_cast<std::uint64_t>(EVP_CIPHER_CTX_block_size(GetCipherContext()));
+    return RunSlices(block_incoming, block_outgoing, size_incoming, 0, block_size, slices, slice);
+}
+
+
+int OpenSSLSymmetricECBCipher::AddSlice(unsigned char const * block_incoming,
+                                        unsigned char * block_outgoing,
+                                        std::uint64_t size) const {
+
+    auto ctx = EVP_CIPHER_CTX_new();
+    if (ctx == nullptr) {
+        return 1;
+    }
+
+    int res = 1;
+    if (EVP_CIPHER_CTX_copy(ctx, GetCipherContext()) == 1) {
+        res = Update(ctx, block_incoming, block_outgoing, size);
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return res;
+}
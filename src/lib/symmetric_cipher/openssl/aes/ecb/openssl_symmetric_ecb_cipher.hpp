@@ -0,0 +1,62 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_ECB_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_ECB_CIPHER_HPP
+
+#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all OpenSSL symmetric cipher algorithms running in ECB mode.
+ *
+ * ECB blocks are independent: large buffers are processed in slices on the worker pool, each
+ * slice on a copy of the cipher context (see SetParallelism()).
+ */
+class OpenSSLSymmetricECBCipher : public OpenSSLSymmetricCipher {
+
+public:
+    /**
+     * @brief   Constructor
+     * @param   encrypt         enrypt or decrypt instance.
+     */
+    explicit OpenSSLSymmetricECBCipher(bool encrypt) : OpenSSLSymmetricCipher(encrypt) {
+    }
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Processes a slice on a cipher context of its own.
+     * @param   block_incoming      incoming data of the slice.
+     * @param   block_outgoing      outgoing data of the slice.
+     * @param   size                size of the slice.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int AddSlice(unsigned char const * block_incoming, unsigned char * block_outgoing, std::uint64_t size) const;
+};
+
+
+}
+
+
+#endif
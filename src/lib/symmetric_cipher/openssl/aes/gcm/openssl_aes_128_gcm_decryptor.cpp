@@ -0,0 +1,91 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <openssl/opensslv.h>
+
+#include <headcode/crypt/factory.hpp>
+
+#include "openssl_aes_128_gcm_decryptor.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The OpenSSL AES 128 GCM decryptor algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "openssl-aes-128-gcm-decryptor",                // name
+            Family::kSymmetricCipher,                       // family
+            "OpenSSL AES 128 GCM (decryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 128 Bit encryption algorithm "
+            "in GCM (Galois/Counter) mode: authenticated encryption in a single pass over the data. "
+            "Finalize() takes the authentication tag (12 to 16 bytes) as \"tag\" argument and fails if the "
+            "data does not match. Discard all output if so. "
+            "An IV must never be used twice with the same key: use Reinitialize() with a fresh IV for each "
+            "message. See: https://en.wikipedia.org/wiki/Galois/Counter_Mode.",
+
+            OPENSSL_VERSION_TEXT,                 // provider
+            0ul,                                  // input block size
+            ProcessingBlockSize::kSame,           // output block size behaviour
+            0ul,                                  // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,        // default padding strategy
+            0ul,                                  // result size
+
+            // initial data
+            {{"key", {16ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {12ul, PaddingStrategy::PADDING_NONE, "The nonce (12 bytes recommended).", false}},
+             {"aad", {0ul, PaddingStrategy::PADDING_NONE, "Additional authenticated data (not encrypted).", true}}},
+
+            // finalization data
+            {{"tag", {16ul, PaddingStrategy::PADDING_NONE, "The authentication tag.", false}}}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class OpenSSLAES128GCMDecrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<OpenSSLAES128GCMDecrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+EVP_CIPHER const * OpenSSLAES128GCMDecrypter::GetCipher() const {
+    return EVP_aes_128_gcm();
+}
+
+
+Algorithm::Description const & OpenSSLAES128GCMDecrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void OpenSSLAES128GCMDecrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLAES128GCMDecrypterProducer>());
+}
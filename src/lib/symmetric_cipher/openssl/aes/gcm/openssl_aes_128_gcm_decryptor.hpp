@@ -0,0 +1,54 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_GCM_DECRYPTOR_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_OPENSSL_AES_128_GCM_DECRYPTOR_HPP
+
+#include "openssl_symmetric_gcm_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   The OpenSSL AES 128 Bit Cypher GCM Decryptor.
+ */
+class OpenSSLAES128GCMDecrypter : public OpenSSLSymmetricGCMCipher {
+
+public:
+    /**
+     * @brief   Constructor
+     */
+    OpenSSLAES128GCMDecrypter() : OpenSSLSymmetricGCMCipher(false) {
+    }
+
+    /**
+     * @brief   Register this class of algorithms.
+     */
+    static void Register();
+
+protected:
+    /**
+     * @brief   Gets the OpenSSL cipher to work on.
+     * @return  The OpenSSL cipher to use.
+     */
+    EVP_CIPHER const * GetCipher() const override;
+
+private:
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A string describing the algorithm.
+     * */
+    Description const & GetDescription_() const override;
+};
+
+
+}
+
+
+#endif
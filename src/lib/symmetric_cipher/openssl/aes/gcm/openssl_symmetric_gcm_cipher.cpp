@@ -0,0 +1,192 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "openssl_symmetric_gcm_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Largest chunk handed to EVP_CipherUpdate() (which takes an int as size).
+ */
+static std::uint64_t const kMaxChunk = 1ul << 30;
+
+
+int OpenSSLSymmetricGCMCipher::AddAAD() {
+
+    auto aad_data = aad_.data();
+    auto aad_size = aad_.size();
+    while (aad_size > 0) {
+        auto chunk = std::min<std::uint64_t>(aad_size, kMaxChunk);
+        int out_size = 0;
+        if (EVP_CipherUpdate(GetCipherContext(), nullptr, &out_size, aad_data, static_cast<int>(chunk)) != 1) {
+            return 1;
+        }
+        aad_data += chunk;
+        aad_size -= chunk;
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int OpenSSLSymmetricGCMCipher::Add_(unsigned char const * block_incoming,
+                                    std::uint64_t size_incoming,
+                                    unsigned char * block_outgoing,
+                                    std::uint64_t & size_outgoing) {
+
+    size_outgoing = 0;
+    while (size_outgoing < size_incoming) {
+        auto chunk = std::min(size_incoming - size_outgoing, kMaxChunk);
+        int out_size = 0;
+        if (EVP_CipherUpdate(GetCipherContext(),
+                             block_outgoing + size_outgoing,
+                             &out_size,
+                             block_incoming + size_outgoing,
+                             static_cast<int>(chunk)) != 1) {
+            return 1;
+        }
+        size_outgoing += out_size;
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int OpenSSLSymmetricGCMCipher::Finalize_(
+        unsigned char * result,
+        std::uint64_t result_size,
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) {
+
+    // GCM is a stream: the final call has no output, it completes the tag
+    std::array<unsigned char, EVP_MAX_BLOCK_LENGTH> final_block;
+    int final_size = 0;
+
+    if (IsEncryptor()) {
+        if (result_size < kTagSize) {
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+        if (EVP_CipherFinal_ex(GetCipherContext(), final_block.data(), &final_size) != 1) {
+            return 1;
+        }
+        auto res = EVP_CIPHER_CTX_ctrl(GetCipherContext(), EVP_CTRL_GCM_GET_TAG, static_cast<int>(kTagSize), result);
+        return res == 1 ? static_cast<int>(Error::kNoError) : 1;
+    }
+
+    auto iter = finalization_data.find("tag");
+    if (iter == finalization_data.end()) {
+        headcode::logger::Warning{"headcode.crypt"} << "Missing authentication tag.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [tag_data, tag_size] = (*iter).second;
+    if ((tag_size < kMinTagSize) || (tag_size > kTagSize)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Invalid size of authentication tag.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    // the tag is copied by OpenSSL and never written to
+    auto tag = const_cast<unsigned char *>(tag_data);
+    if (EVP_CIPHER_CTX_ctrl(GetCipherContext(), EVP_CTRL_GCM_SET_TAG, static_cast<int>(tag_size), tag) != 1) {
+        return 1;
+    }
+    if (EVP_CipherFinal_ex(GetCipherContext(), final_block.data(), &final_size) != 1) {
+        return static_cast<int>(Error::kAuthenticationFailed);
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int OpenSSLSymmetricGCMCipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    // without a "key" only the IV changes: the key schedule is kept
+    auto key_iter = initialization_data.find("key");
+    auto rekey = key_iter != initialization_data.end();
+    if (!rekey && !keyed_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    auto encrypt = IsEncryptor() ? 1 : 0;
+    unsigned char const * key_data = nullptr;
+    if (rekey) {
+        keyed_ = false;
+        if (EVP_CipherInit_ex(GetCipherContext(), GetCipher(), nullptr, nullptr, nullptr, encrypt) != 1) {
+            return 1;
+        }
+        std::uint64_t key_size = 0;
+        std::tie(key_data, key_size) = (*key_iter).second;
+        if ((key_data == nullptr) || (static_cast<int>(key_size) != EVP_CIPHER_CTX_key_length(GetCipherContext()))) {
+            headcode::logger::Warning{"headcode.crypt"} << "Applying key of invalid size.";
+            return static_cast<int>(Error::kInvalidArgument);
+        }
+    }
+
+    auto iter = initialization_data.find("iv");
+    if (iter == initialization_data.end()) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    auto [iv_data, iv_size] = (*iter).second;
+    if ((iv_size == 0) || (iv_data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Applying empty IV.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    if (IsEncryptor() && !rekey && (iv_size == iv_.size()) && std::equal(iv_.begin(), iv_.end(), iv_data)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Refusing to encrypt with the same key and IV again.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    iv_.assign(iv_data, iv_data + iv_size);
+
+    aad_.clear();
+    iter = initialization_data.find("aad");
+    if (iter != initialization_data.end()) {
+        auto [aad_data, aad_size] = (*iter).second;
+        if (aad_size > 0) {
+            aad_.assign(aad_data, aad_data + aad_size);
+        }
+    }
+
+    if (EVP_CIPHER_CTX_ctrl(GetCipherContext(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(iv_.size()), nullptr) != 1) {
+        return 1;
+    }
+    // no cipher and no key (if not given): the key schedule is kept, only the IV is set
+    if (EVP_CipherInit_ex(GetCipherContext(), nullptr, nullptr, key_data, iv_.data(), encrypt) != 1) {
+        return 1;
+    }
+    keyed_ = true;
+
+    return AddAAD();
+}
+
+
+int OpenSSLSymmetricGCMCipher::Reset_() {
+
+    if (!IsInitialized()) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    if (IsEncryptor()) {
+        headcode::logger::Warning{"headcode.crypt"} << "Refusing to reuse the IV: reinitialize with a new \"iv\".";
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+
+    // no cipher and no key: the key schedule is kept, only the IV is set again
+    if (EVP_CipherInit_ex(GetCipherContext(), nullptr, nullptr, nullptr, iv_.data(), -1) != 1) {
+        return 1;
+    }
+
+    return AddAAD();
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_GCM_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_GCM_CIPHER_HPP
+
+#include <vector>
+
+#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all OpenSSL symmetric cipher algorithms running in GCM mode.
+ *
+ * The "iv" and the optional "aad" (additional authenticated data) are given at initialization.
+ * The encryptor writes the 16 byte tag as result of Finalize(), the decryptor takes the tag as
+ * "tag" finalization argument and fails Finalize() with Error::kAuthenticationFailed if the data
+ * does not match. OpenSSL runs GHASH on PCLMULQDQ if the CPU has it.
+ * The OpenSSL ChaCha20-Poly1305 ciphers run on the very same AEAD controls and derive from here too.
+ *
+ * An IV must never be used twice with the same key: the encryptor refuses Reset(). Reinitialize()
+ * with a new "iv" (and "aad") but no "key" starts the next message on the key schedule kept.
+ */
+class OpenSSLSymmetricGCMCipher : public OpenSSLSymmetricCipher {
+
+    std::vector<unsigned char> iv_;         //!< @brief The IV given at initialization (restored on Reset()).
+    std::vector<unsigned char> aad_;        //!< @brief The additional authenticated data (restored on Reset()).
+    bool keyed_ = false;                    //!< @brief If true, the cipher context holds a key schedule.
+
+public:
+    /**
+     * @brief   Size of the authentication tag.
+     */
+    static constexpr std::uint64_t kTagSize = 16;
+
+    /**
+     * @brief   Smallest size of an authentication tag accepted by the decryptor.
+     */
+    static constexpr std::uint64_t kMinTagSize = 12;
+
+    /**
+     * @brief   Constructor
+     * @param   encrypt         enrypt or decrypt instance.
+     */
+    explicit OpenSSLSymmetricGCMCipher(bool encrypt) : OpenSSLSymmetricCipher(encrypt) {
+    }
+
+private:
+    /**
+     * @brief   Adds the AAD to the cipher context.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int AddAAD();
+
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add.
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Finalizes this object instance.
+     * @param   result                  the result of the algorithm (the tag of the encryptor).
+     * @param   result_size             size of the result for finalization.
+     * @param   finalization_data       the final data (the "tag" of the decryptor).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Finalize_(
+            unsigned char * result,
+            std::uint64_t result_size,
+            std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the IV and the AAD and keeps the key schedule.
+     * The encryptor refuses with Error::kInvalidOperation as this would reuse the IV.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+};
+
+
+}
+
+
+#endif
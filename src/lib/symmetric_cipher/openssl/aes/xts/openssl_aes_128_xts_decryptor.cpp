@@ -0,0 +1,91 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <openssl/opensslv.h>
+
+#include <headcode/crypt/factory.hpp>
+
+#include "openssl_aes_128_xts_decryptor.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The OpenSSL AES 128 XTS decryptor algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "openssl-aes-128-xts-decryptor",                // name
+            Family::kSymmetricCipher,                       // family
+            "OpenSSL AES 128 XTS (decryptor part).",        // description (short/left and long/below)
+
+            "This is the Advanced Encryption Standard AES (also known as Rijndael) 128 Bit encryption algorithm "
+            "in XTS mode (XEX with ciphertext stealing, IEEE P1619) for the encryption of storage devices. "
+            "The key holds the data key and the tweak key (of 16 bytes each). Each Add() takes whole data "
+            "units (sectors): the first sector is the \"sector\" given at initialization, the following count "
+            "up. Use Reinitialize() to start at another sector. Many sectors in a single Add() run on many "
+            "threads. See: https://en.wikipedia.org/wiki/Disk_encryption_theory#XTS.",
+
+            OPENSSL_VERSION_TEXT,                 // provider
+            0ul,                                  // input block size
+            ProcessingBlockSize::kSame,           // output block size behaviour
+            0ul,                                  // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,        // default padding strategy
+            0ul,                                  // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "Data key and tweak key (two halves).", false}},
+             {"sector_size", {8ul, PaddingStrategy::PADDING_NONE, "Data unit size (big endian, 4096).", true}},
+             {"sector", {8ul, PaddingStrategy::PADDING_NONE, "The first sector (big endian, 0).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class OpenSSLAES128XTSDecrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<OpenSSLAES128XTSDecrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+EVP_CIPHER const * OpenSSLAES128XTSDecrypter::GetCipher() const {
+    return EVP_aes_128_xts();
+}
+
+
+Algorithm::Description const & OpenSSLAES128XTSDecrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void OpenSSLAES128XTSDecrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLAES128XTSDecrypterProducer>());
+}
@@ -0,0 +1,131 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <array>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "symmetric_cipher/slices.hpp"
+#include "symmetric_cipher/xts.hpp"
+#include "worker_pool.hpp"
+#include "openssl_symmetric_xts_cipher.hpp"
+
+using namespace headcode::crypt;
+
+
+int OpenSSLSymmetricXTSCipher::Add_(unsigned char const * block_incoming,
+                                    std::uint64_t size_incoming,
+                                    unsigned char * block_outgoing,
+                                    std::uint64_t & size_outgoing) {
+
+    if (sector_size_ == 0) {
+        return static_cast<int>(Error::kInvalidOperation);
+    }
+    if (size_incoming % sector_size_ != 0) {
+        headcode::logger::Warning{"headcode.crypt"} << "XTS data is not a multiple of the sector size.";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+    size_outgoing = size_incoming;
+
+    auto slices = GetSliceCount(size_incoming, kMinSliceSize);
+    int res = static_cast<int>(Error::kNoError);
+    if (slices < 2) {
+        res = AddSectors(GetCipherContext(), block_incoming, block_outgoing, size_incoming, sector_);
+    } else {
+        auto slice = [this](unsigned char const * in, unsigned char * out, std::uint64_t size, std::uint64_t sector) {
+            return AddSlice(in, out, size, sector);
+        };
+        res = RunSlices(block_incoming, block_outgoing, size_incoming, sector_, sector_size_, slices, slice);
+    }
+    if (res != 0) {
+        return res;
+    }
+
+    sector_ += size_incoming / sector_size_;
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int OpenSSLSymmetricXTSCipher::AddSectors(EVP_CIPHER_CTX * ctx,
+                                          unsigned char const * block_incoming,
+                                          unsigned char * block_outgoing,
+                                          std::uint64_t size,
+                                          std::uint64_t sector) const {
+
+    // each EVP_CipherUpdate() is a data unit of its own, started with the tweak as IV
+    std::array<unsigned char, xts::kTweakSize> tweak;
+    for (std::uint64_t offset = 0; offset < size; offset += sector_size_, ++sector) {
+        xts::SetTweak(tweak.data(), sector);
+        if (EVP_CipherInit_ex(ctx, nullptr, nullptr, nullptr, tweak.data(), -1) != 1) {
+            return 1;
+        }
+        auto res = Update(ctx, block_incoming + offset, block_outgoing + offset, sector_size_);
+        if (res != 0) {
+            return res;
+        }
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+int OpenSSLSymmetricXTSCipher::AddSlice(unsigned char const * block_incoming,
+                                        unsigned char * block_outgoing,
+                                        std::uint64_t size,
+                                        std::uint64_t sector) const {
+
+    auto ctx = EVP_CIPHER_CTX_new();
+    if (ctx == nullptr) {
+        return 1;
+    }
+
+    int res = 1;
+    if (EVP_CIPHER_CTX_copy(ctx, GetCipherContext()) == 1) {
+        res = AddSectors(ctx, block_incoming, block_outgoing, size, sector);
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return res;
+}
+
+
+int OpenSSLSymmetricXTSCipher::Initialize_(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data) {
+
+    // without a "key" only sector size and sector change: the key schedule is kept (e.g. for random reads)
+    auto rekey = initialization_data.find("key") != initialization_data.end();
+    if (!rekey && !keyed_) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    std::uint64_t sector_size = rekey ? xts::kDefaultSectorSize : sector_size_;
+    std::uint64_t sector = 0;
+    auto res = xts::GetArguments(initialization_data, sector_size, sector);
+    if (res != static_cast<int>(Error::kNoError)) {
+        return res;
+    }
+    sector_size_ = sector_size;
+    first_sector_ = sector;
+    sector_ = sector;
+
+    if (!rekey) {
+        return static_cast<int>(Error::kNoError);
+    }
+
+    keyed_ = false;
+    res = OpenSSLSymmetricCipher::Initialize_(initialization_data);
+    keyed_ = (res == static_cast<int>(Error::kNoError));
+    return res;
+}
+
+
+int OpenSSLSymmetricXTSCipher::Reset_() {
+    sector_ = first_sector_;
+    return OpenSSLSymmetricCipher::Reset_();
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_XTS_CIPHER_HPP
+#define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_XTS_CIPHER_HPP
+
+#include "symmetric_cipher/openssl/openssl_symmetric_cipher.hpp"
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Base class of all OpenSSL symmetric cipher algorithms running in XTS mode.
+ *
+ * The key holds the data key and the tweak key. Each Add() takes whole data units (sectors),
+ * the tweak of a sector is its number: starting at the "sector" given at initialization and
+ * counting up. Sectors are independent: many sectors in a single Add() are processed in
+ * slices on the worker pool, each slice on a copy of the cipher context (see SetParallelism()).
+ *
+ * Reinitialize() with a "sector" but no "key" moves to another sector on the key schedule kept:
+ * random reads of single sectors do not set up the keys again.
+ */
+class OpenSSLSymmetricXTSCipher : public OpenSSLSymmetricCipher {
+
+    std::uint64_t sector_size_ = 0;         //!< @brief Size of a data unit.
+    std::uint64_t first_sector_ = 0;        //!< @brief The sector given at initialization (restored on Reset()).
+    std::uint64_t sector_ = 0;              //!< @brief The sector of the next data unit.
+    bool keyed_ = false;                    //!< @brief If true, the cipher context holds the key schedules.
+
+public:
+    /**
+     * @brief   Constructor
+     * @param   encrypt         enrypt or decrypt instance.
+     */
+    explicit OpenSSLSymmetricXTSCipher(bool encrypt) : OpenSSLSymmetricCipher(encrypt) {
+    }
+
+private:
+    /**
+     * @brief   Adds data to the algorithm
+     * @param   block_incoming      incoming data block to add (whole sectors).
+     * @param   size_incoming       size of the incoming data to add.
+     * @param   block_outgoing      outgoing data block.
+     * @param   size_outgoing       size of the outgoing data block (will be adjusted).
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override;
+
+    /**
+     * @brief   Processes consecutive sectors on a cipher context.
+     * @param   ctx                 the cipher context.
+     * @param   block_incoming      incoming data (whole sectors).
+     * @param   block_outgoing      outgoing data.
+     * @param   size                size of the data.
+     * @param   sector              the number of the first sector.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int AddSectors(EVP_CIPHER_CTX * ctx,
+                   unsigned char const * block_incoming,
+                   unsigned char * block_outgoing,
+                   std::uint64_t size,
+                   std::uint64_t sector) const;
+
+    /**
+     * @brief   Processes a slice of sectors on a cipher context of its own.
+     * @param   block_incoming      incoming data of the slice.
+     * @param   block_outgoing      outgoing data of the slice.
+     * @param   size                size of the slice.
+     * @param   sector              the number of the first sector of the slice.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int AddSlice(unsigned char const * block_incoming,
+                 unsigned char * block_outgoing,
+                 std::uint64_t size,
+                 std::uint64_t sector) const;
+
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, sector, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the first sector and keeps the key schedule.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+};
+
+
+}
+
+
+#endif
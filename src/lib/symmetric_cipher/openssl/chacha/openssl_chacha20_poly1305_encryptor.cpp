@@ -0,0 +1,91 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <openssl/opensslv.h>
+
+#include <headcode/crypt/factory.hpp>
+
+#include "openssl_chacha20_poly1305_encryptor.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   The OpenSSL ChaCha20-Poly1305 encryptor algorithm description.
+ * @return  The description of this algorithm.
+ */
+static Algorithm::Description const & GetDescription() {
+
+    static Algorithm::Description description = {
+            "openssl-chacha20-poly1305-encryptor",                // name
+            Family::kSymmetricCipher,                             // family
+            "OpenSSL ChaCha20-Poly1305 (encryptor part).",        // description (short/left and long/below)
+
+            "This is the ChaCha20 stream cipher with the Poly1305 authenticator as in RFC 8439: "
+            "authenticated encryption in a single pass over the data, constant time on any CPU. "
+            "The 16 byte authentication tag is the result of Finalize(). "
+            "OpenSSL runs ChaCha20 and Poly1305 on SIMD code picked for the CPU. "
+            "An IV must never be used twice with the same key: use Reinitialize() with a fresh IV for each "
+            "message. See: https://en.wikipedia.org/wiki/ChaCha20-Poly1305.",
+
+            OPENSSL_VERSION_TEXT,                 // provider
+            0ul,                                  // input block size
+            ProcessingBlockSize::kSame,           // output block size behaviour
+            0ul,                                  // output block size (if changing)
+            PaddingStrategy::PADDING_NONE,        // default padding strategy
+            16ul,                                 // result size
+
+            // initial data
+            {{"key", {32ul, PaddingStrategy::PADDING_PKCS_5_7, "A secret shared key.", false}},
+             {"iv", {12ul, PaddingStrategy::PADDING_NONE, "The nonce (12 bytes).", false}},
+             {"aad", {0ul, PaddingStrategy::PADDING_NONE, "Additional authenticated data (not encrypted).", true}}},
+
+            // finalization data
+            {}};
+
+    return description;
+}
+
+
+/**
+ * @brief   Produces instances of the algorithm.
+ */
+class OpenSSLChaCha20Poly1305EncrypterProducer : public Factory::Producer {
+public:
+    /**
+     * @brief   Call operator - creates the algorithm.
+     * @return  A new algorithm instance.
+     */
+    std::unique_ptr<Algorithm> operator()() const override {
+        return std::make_unique<OpenSSLChaCha20Poly1305Encrypter>();
+    }
+
+    /**
+     * @brief   Gets the algorithm description.
+     * @return  A structure describing the algorithm.
+     */
+    Algorithm::Description const & GetDescription() const override {
+        return ::GetDescription();
+    }
+};
+
+
+EVP_CIPHER const * OpenSSLChaCha20Poly1305Encrypter::GetCipher() const {
+    return EVP_chacha20_poly1305();
+}
+
+
+Algorithm::Description const & OpenSSLChaCha20Poly1305Encrypter::GetDescription_() const {
+    return ::GetDescription();
+}
+
+
+void OpenSSLChaCha20Poly1305Encrypter::Register() {
+    auto const & description = ::GetDescription();
+    Factory::Register(description.name_, description.family_, std::make_shared<OpenSSLChaCha20Poly1305EncrypterProducer>());
+}
@@ -6,6 +6,8 @@
  * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
  */
 
+#include <algorithm>
+
 #include <headcode/logger/logger.hpp>
 #include <headcode/crypt/error.hpp>
 
@@ -67,7 +69,57 @@ int OpenSSLSymmetricCipher::Initialize_(
     }
 
     auto e = EVP_CipherInit_ex(GetCipherContext(), nullptr, nullptr, key_data, iv_data, IsEncryptor() ? 1 : 0);
-    return e == 1 ? static_cast<int>(Error::kNoError) : 1;
+    if (e != 1) {
+        return 1;
+    }
+
+    iv_.clear();
+    if (iv_data != nullptr) {
+        iv_.assign(iv_data, iv_data + EVP_CIPHER_CTX_iv_length(GetCipherContext()));
+    }
+
+    // padding is done once by the Algorithm base class at Finalize()
+    return EVP_CIPHER_CTX_set_padding(GetCipherContext(), 0) == 1 ? static_cast<int>(Error::kNoError) : 1;
+}
+
+
+int OpenSSLSymmetricCipher::Reset_() {
+
+    if (!IsInitialized()) {
+        // not initialized yet: nothing to restore
+        return static_cast<int>(Error::kNoError);
+    }
+
+    // no cipher and no key: the key schedule is kept, only the IV is set again
+    auto iv_data = iv_.empty() ? nullptr : iv_.data();
+    if (EVP_CipherInit_ex(GetCipherContext(), nullptr, nullptr, nullptr, iv_data, -1) != 1) {
+        return 1;
+    }
+
+    return EVP_CIPHER_CTX_set_padding(GetCipherContext(), 0) == 1 ? static_cast<int>(Error::kNoError) : 1;
+}
+
+
+int OpenSSLSymmetricCipher::Update(EVP_CIPHER_CTX * ctx,
+                                   unsigned char const * block_incoming,
+                                   unsigned char * block_outgoing,
+                                   std::uint64_t size) {
+
+    // EVP_CipherUpdate() takes an int as size
+    static std::uint64_t const kMaxChunk = 1ul << 30;
+
+    while (size > 0) {
+        auto chunk = std::min(size, kMaxChunk);
+        int out_size = 0;
+        if (EVP_CipherUpdate(ctx, block_outgoing, &out_size, block_incoming, static_cast<int>(chunk)) != 1) {
+            return 1;
+        }
+        block_incoming += chunk;
+        block_outgoing += chunk;
+        size -= chunk;
+    }
+
+    return static_cast<int>(Error::kNoError);
 }
 
 
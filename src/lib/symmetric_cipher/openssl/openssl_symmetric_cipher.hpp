@@ -9,6 +9,8 @@
 #ifndef HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_CIPHER_HPP
 #define HEADCODE_SPACE_CRYPT_HASH_OPENSSL_SYMMETRIC_CIPHER_HPP
 
+#include <vector>
+
 #include <openssl/evp.h>
 
 #include <headcode/crypt/algorithm.hpp>
@@ -24,6 +26,7 @@ class OpenSSLSymmetricCipher : public Algorithm {
 
     EVP_CIPHER_CTX * ctx_{nullptr};        //!< @brief OpenSSL cipher context.
     bool encrypt_{true};                   //!< @brief Encrypt or Decrypt instance.
+    std::vector<unsigned char> iv_;        //!< @brief The IV given at initialization (restored on Reset()).
 
 public:
     /**
@@ -68,7 +71,14 @@ protected:
         return encrypt_;
     }
 
-private:
+    /**
+     * @brief   Returns the IV given at initialization.
+     * @return  The initial IV (empty if none).
+     */
+    std::vector<unsigned char> const & GetInitialIV() const {
+        return iv_;
+    }
+
     /**
      * @brief   Adds data to the algorithm
      * @param   block_incoming      incoming data block to add.
@@ -82,6 +92,35 @@ private:
              unsigned char * block_outgoing,
              std::uint64_t & size_outgoing) override;
 
+    /**
+     * @brief   Initialize this object instance.
+     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
+            override;
+
+    /**
+     * @brief   Resets this object instance back to the initialized state.
+     * This restores the initial IV and keeps the key schedule.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    int Reset_() override;
+
+    /**
+     * @brief   Runs EVP_CipherUpdate() on data of any size.
+     * @param   ctx                 the cipher context.
+     * @param   block_incoming      incoming data.
+     * @param   block_outgoing      outgoing data.
+     * @param   size                size of the data.
+     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
+     */
+    static int Update(EVP_CIPHER_CTX * ctx,
+                      unsigned char const * block_incoming,
+                      unsigned char * block_outgoing,
+                      std::uint64_t size);
+
+private:
     /**
      * @brief   Finalizes this object instance.
      * @param   result                  the result of the algorithm.
@@ -94,14 +133,6 @@ private:
             std::uint64_t result_size,
             std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & finalization_data) override;
 
-    /**
-     * @brief   Initialize this object instance.
-     * @param   initialization_data     the initial data (== initial key, IV, ...) to use, if any.
-     * @return  Error enum value if negativ (0 == ok), else something in the context of the algorithm provider.
-     */
-    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data)
-            override;
-
     /**
      * @brief   Verifies the existance and validity of an initit data element.
      * @param   data                    this will receive the deduced value.
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "worker_pool.hpp"
+#include "slices.hpp"
+
+using namespace headcode::crypt;
+
+
+std::uint64_t headcode::crypt::GetSliceSize(std::uint64_t size, std::uint64_t block_size, std::uint64_t slices) {
+    auto alignment = std::lcm(block_size, kSliceAlignment);
+    auto units_per_slice = ((size + alignment - 1) / alignment + slices - 1) / slices;
+    return std::max<std::uint64_t>(units_per_slice, 1) * alignment;
+}
+
+
+int headcode::crypt::RunSlices(unsigned char const * block_incoming,
+                               unsigned char * block_outgoing,
+                               std::uint64_t size,
+                               std::uint64_t first_block,
+                               std::uint64_t block_size,
+                               std::uint64_t slices,
+                               Slice const & slice) {
+
+    auto slice_size = GetSliceSize(size, block_size, slices);
+
+    std::atomic<int> result{0};
+    WorkerPool::GetInstance().Run(slices, [&](std::uint64_t index) {
+        auto offset = index * slice_size;
+        if (offset >= size) {
+            return;
+        }
+        auto current_size = (index + 1 == slices) ? (size - offset) : std::min(slice_size, size - offset);
+        auto block = first_block + offset / block_size;
+        auto res = slice(block_incoming + offset, block_outgoing + offset, current_size, block);
+        if (res != 0) {
+            int expected = 0;
+            result.compare_exchange_strong(expected, res);
+        }
+    });
+
+    return result;
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_SLICES_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_SLICES_HPP
+
+#include <cstdint>
+#include <functional>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   Minimum size of a slice processed on a thread of its own.
+ */
+static constexpr std::uint64_t kMinSliceSize = 64ul * 1024ul;
+
+
+/**
+ * @brief   Slices start at a multiple of this (a cache line), so no two threads write to the same line.
+ */
+static constexpr std::uint64_t kSliceAlignment = 64ul;
+
+
+/**
+ * @brief   Processes a slice of the data starting at a block boundary with a state of its own.
+ * The arguments are: incoming data, outgoing data, size and the number of the first block.
+ */
+using Slice = std::function<int(unsigned char const *, unsigned char *, std::uint64_t, std::uint64_t)>;
+
+
+/**
+ * @brief   Gets the size of all slices but the last one.
+ * @param   size                size of the data.
+ * @param   block_size          the block size of the cipher.
+ * @param   slices              the number of slices.
+ * @return  The size of a slice (a multiple of the block size and of kSliceAlignment).
+ */
+std::uint64_t GetSliceSize(std::uint64_t size, std::uint64_t block_size, std::uint64_t slices);
+
+
+/**
+ * @brief   Splits data into slices and processes them on the worker pool.
+ * All slices but the last are GetSliceSize() bytes, so each slice starts at a block boundary.
+ * @param   block_incoming      the incoming data (starting at a block boundary).
+ * @param   block_outgoing      the outgoing data.
+ * @param   size                size of the data.
+ * @param   first_block         the number of the first block of the data.
+ * @param   block_size          the block size of the cipher.
+ * @param   slices              the number of slices.
+ * @param   slice               processes a single slice.
+ * @return  The result of the first slice failed (0 == ok).
+ */
+int RunSlices(unsigned char const * block_incoming,
+              unsigned char * block_outgoing,
+              std::uint64_t size,
+              std::uint64_t first_block,
+              std::uint64_t block_size,
+              std::uint64_t slices,
+              Slice const & slice);
+
+
+}
+
+
+#endif
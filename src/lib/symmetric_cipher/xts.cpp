@@ -0,0 +1,74 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include <headcode/logger/logger.hpp>
+#include <headcode/crypt/error.hpp>
+
+#include "xts.hpp"
+
+using namespace headcode::crypt;
+
+
+/**
+ * @brief   Reads an optional unsigned big endian number of up to 8 bytes.
+ * @param   initialization_data     the initialization arguments.
+ * @param   name                    name of the argument.
+ * @param   value                   receives the number (untouched if the argument is missing).
+ * @return  true, if the argument is missing or valid.
+ */
+static bool GetNumber(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data,
+        std::string const & name,
+        std::uint64_t & value) {
+
+    auto iter = initialization_data.find(name);
+    if (iter == initialization_data.end()) {
+        return true;
+    }
+
+    auto [data, size] = (*iter).second;
+    if ((size == 0) || (size > sizeof(std::uint64_t)) || (data == nullptr)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Invalid size of " << name << " (1 to 8 bytes big endian).";
+        return false;
+    }
+
+    value = 0;
+    for (std::uint64_t i = 0; i < size; ++i) {
+        value = (value << 8) | data[i];
+    }
+    return true;
+}
+
+
+int headcode::crypt::xts::GetArguments(
+        std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data,
+        std::uint64_t & sector_size,
+        std::uint64_t & sector) {
+
+    if (!GetNumber(initialization_data, "sector_size", sector_size) ||
+        !GetNumber(initialization_data, "sector", sector)) {
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    if ((sector_size < kMinSectorSize) || (sector_size > kMaxSectorSize)) {
+        headcode::logger::Warning{"headcode.crypt"} << "Invalid sector size " << sector_size << ".";
+        return static_cast<int>(Error::kInvalidArgument);
+    }
+
+    return static_cast<int>(Error::kNoError);
+}
+
+
+void headcode::crypt::xts::SetTweak(unsigned char * tweak, std::uint64_t sector) {
+    std::fill(tweak, tweak + kTweakSize, 0);
+    for (std::uint64_t i = 0; i < sizeof(sector); ++i) {
+        tweak[i] = static_cast<unsigned char>(sector >> (8 * i));
+    }
+}
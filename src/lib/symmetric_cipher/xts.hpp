@@ -0,0 +1,69 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_XTS_HPP
+#define HEADCODE_SPACE_CRYPT_CYPHER_SYMMTERIC_XTS_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+
+
+namespace headcode::crypt::xts {
+
+
+/**
+ * @brief   Size of the tweak (the sector number as little endian AES block).
+ */
+static constexpr std::uint64_t kTweakSize = 16ul;
+
+
+/**
+ * @brief   Size of a data unit (sector) if not given at initialization.
+ */
+static constexpr std::uint64_t kDefaultSectorSize = 4096ul;
+
+
+/**
+ * @brief   Smallest size of a data unit: a single AES block.
+ */
+static constexpr std::uint64_t kMinSectorSize = 16ul;
+
+
+/**
+ * @brief   Largest size of a data unit (2^20 AES blocks as of IEEE P1619).
+ */
+static constexpr std::uint64_t kMaxSectorSize = 16ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Reads the optional "sector_size" and "sector" initialization arguments.
+ * Both are unsigned big endian numbers of up to 8 bytes. A missing argument leaves the value as is.
+ * @param   initialization_data     the initialization arguments.
+ * @param   sector_size             the size of a data unit (if not given), receives the size of a data unit.
+ * @param   sector                  the first sector (if not given), receives the number of the first sector.
+ * @return  Error enum value (0 == ok).
+ */
+int GetArguments(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const & initialization_data,
+                 std::uint64_t & sector_size,
+                 std::uint64_t & sector);
+
+
+/**
+ * @brief   Writes the tweak of a sector.
+ * @param   tweak           the tweak (kTweakSize bytes).
+ * @param   sector          the sector number.
+ */
+void SetTweak(unsigned char * tweak, std::uint64_t sector);
+
+
+}
+
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include "worker_pool.hpp"
+
+using namespace headcode::crypt;
+
+
+WorkerPool::WorkerPool(unsigned int workers) {
+    for (unsigned int i = 0; i < workers; ++i) {
+        workers_.emplace_back(&WorkerPool::Work, this);
+    }
+}
+
+
+WorkerPool::~WorkerPool() noexcept {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto & worker : workers_) {
+        worker.join();
+    }
+}
+
+
+WorkerPool & WorkerPool::GetInstance() {
+    static WorkerPool pool{std::max(std::thread::hardware_concurrency(), 1u) - 1u};
+    return pool;
+}
+
+
+void WorkerPool::Run(std::uint64_t count, std::function<void(std::uint64_t)> const & task) {
+
+    if (count == 0) {
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->task_ = &task;
+    batch->tasks_ = count;
+
+    if ((count > 1) && !workers_.empty()) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            batches_.push_back(batch);
+        }
+        wake_.notify_all();
+    }
+
+    while (RunTask(*batch)) {
+    }
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    finished_.wait(lock, [&]() { return batch->done_ == count; });
+
+    // no task left: the workers must not pick up the batch anymore
+    auto iter = std::find(batches_.begin(), batches_.end(), batch);
+    if (iter != batches_.end()) {
+        batches_.erase(iter);
+    }
+}
+
+
+bool WorkerPool::RunTask(Batch & batch) {
+
+    // The index is taken before the task is touched: a batch out of tasks may
+    // belong to a Run() which has returned already.
+    auto index = batch.next_.fetch_add(1);
+    if (index >= batch.tasks_) {
+        return false;
+    }
+
+    (*batch.task_)(index);
+
+    if (batch.done_.fetch_add(1) + 1 == batch.tasks_) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        finished_.notify_all();
+    }
+    return true;
+}
+
+
+void WorkerPool::Work() {
+
+    while (true) {
+
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            wake_.wait(lock, [&]() { return stop_ || !batches_.empty(); });
+            if (stop_) {
+                return;
+            }
+            batch = batches_.front();
+        }
+
+        if (!RunTask(*batch)) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!batches_.empty() && (batches_.front() == batch)) {
+                batches_.pop_front();
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#ifndef HEADCODE_SPACE_CRYPT_WORKER_POOL_HPP
+#define HEADCODE_SPACE_CRYPT_WORKER_POOL_HPP
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace headcode::crypt {
+
+
+/**
+ * @brief   A pool of worker threads running the slices of large buffers.
+ *
+ * The calling thread works on its own tasks too, so a Run() never waits idle for a free
+ * worker. There is one pool for the whole process, see GetInstance().
+ */
+class WorkerPool {
+
+    /**
+     * @brief   The tasks of a single Run() call.
+     */
+    struct Batch {
+        std::function<void(std::uint64_t)> const * task_;        //!< @brief The task (of the caller).
+        std::uint64_t tasks_;                                     //!< @brief Number of tasks.
+        std::atomic<std::uint64_t> next_{0};                      //!< @brief Index of the next task to run.
+        std::atomic<std::uint64_t> done_{0};                      //!< @brief Number of tasks done.
+    };
+
+    std::mutex mutex_;                                  //!< @brief Guards the batches.
+    std::condition_variable wake_;                      //!< @brief Wakes the workers on new batches.
+    std::condition_variable finished_;                  //!< @brief Wakes the callers on finished batches.
+    std::deque<std::shared_ptr<Batch>> batches_;        //!< @brief The batches with tasks to run.
+    std::vector<std::thread> workers_;                  //!< @brief The worker threads.
+    bool stop_{false};                                  //!< @brief Tells the workers to quit.
+
+public:
+    /**
+     * @brief   Constructor.
+     * @param   workers     number of worker threads.
+     */
+    explicit WorkerPool(unsigned int workers);
+
+    /**
+     * @brief   Copy Constructor.
+     */
+    WorkerPool(WorkerPool const &) = delete;
+
+    /**
+     * @brief   Move Constructor.
+     */
+    WorkerPool(WorkerPool &&) = delete;
+
+    /**
+     * @brief   Destructor. Joins the workers.
+     */
+    ~WorkerPool() noexcept;
+
+    /**
+     * @brief   Assignment.
+     */
+    WorkerPool & operator=(WorkerPool const &) = delete;
+
+    /**
+     * @brief   Move Assignment.
+     */
+    WorkerPool & operator=(WorkerPool &&) = delete;
+
+    /**
+     * @brief   Gets the worker pool of the process (one worker less than cores).
+     * @return  The worker pool.
+     */
+    static WorkerPool & GetInstance();
+
+    /**
+     * @brief   Gets the number of threads running tasks (the workers and the caller).
+     * @return  The number of threads.
+     */
+    unsigned int GetThreads() const {
+        return static_cast<unsigned int>(workers_.size()) + 1u;
+    }
+
+    /**
+     * @brief   Runs tasks 0 to count - 1 and waits until all of them are done.
+     * @param   count       number of tasks.
+     * @param   task        the task, called with the index of the task.
+     */
+    void Run(std::uint64_t count, std::function<void(std::uint64_t)> const & task);
+
+private:
+    /**
+     * @brief   Runs the next task of a batch.
+     * @param   batch       the batch.
+     * @return  false, if there has been no task left.
+     */
+    bool RunTask(Batch & batch);
+
+    /**
+     * @brief   The loop of a worker thread.
+     */
+    void Work();
+};
+
+
+/**
+ * @brief   Gets the number of slices a buffer is split into, according to GetParallelism().
+ * @param   size            size of the buffer.
+ * @param   min_slice       the minimum size of a slice.
+ * @return  The number of slices (1 if the buffer is processed on the calling thread only).
+ */
+std::uint64_t GetSliceCount(std::uint64_t size, std::uint64_t min_slice);
+
+
+}
+
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of a buffer (a storage block).
+ */
+static std::uint64_t const kBufferSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Number of buffers hashed.
+ */
+static std::uint64_t const kLoopCount = 256ul;
+
+
+/**
+ * @brief   Size of a large artefact hashed as a whole.
+ */
+static std::uint64_t const kArtefactSize = 256ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Benchmarks hashing data in pieces (one digest for all the data).
+ * @param   name            name of the hash.
+ * @param   piece_size      size of a piece added.
+ * @param   size            size of all the data.
+ * @param   threads         max threads on a piece (0: all cores, 1: off).
+ */
+static void BenchmarkHash(std::string const & name,
+                          std::uint64_t piece_size,
+                          std::uint64_t size,
+                          unsigned int threads) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, threads});
+
+    std::vector<std::byte> buffer(piece_size);
+    std::vector<std::byte> digest;
+    auto data = reinterpret_cast<unsigned char const *>(buffer.data());
+    std::uint64_t size_outgoing = 0;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < size / piece_size; ++i) {
+        ASSERT_EQ(algo->Add(data, buffer.size(), nullptr, size_outgoing), 0);
+    }
+    ASSERT_EQ(algo->Finalize(digest), 0);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start), size};
+
+    headcode::crypt::SetParallelism(parallelism);
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " (" + std::to_string(piece_size / 1024ul) +
+                          " KiB pieces, threads: " + (threads == 0 ? std::string{"all"} : std::to_string(threads)) +
+                          ") ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+TEST(Benchmark_BLAKE3, BLAKE3) {
+    BenchmarkHash("hcs-blake3", kBufferSize, kLoopCount * kBufferSize, 1);
+}
+
+
+TEST(Benchmark_BLAKE3, BLAKE3Artefact) {
+    BenchmarkHash("hcs-blake3", kArtefactSize, kArtefactSize, 1);
+    BenchmarkHash("hcs-blake3", kArtefactSize, kArtefactSize, 0);
+    BenchmarkHash("hcs-blake3", 16ul * kBufferSize, kArtefactSize, 0);
+}
+
+
+TEST(Benchmark_BLAKE3, SHANISHA256) {
+    BenchmarkHash("hcs-shani-sha256", kBufferSize, kLoopCount * kBufferSize, 1);
+}
+
+
+TEST(Benchmark_BLAKE3, LTCSHA256) {
+    BenchmarkHash("ltc-sha256", kBufferSize, kLoopCount * kBufferSize, 1);
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of a buffer (a storage block).
+ */
+static std::uint64_t const kBufferSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Size of a page (a network packet or a database page).
+ */
+static std::uint64_t const kPageSize = 4096ul;
+
+
+/**
+ * @brief   Number of bytes checksummed per run.
+ */
+static std::uint64_t const kSize = 1024ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Benchmarks checksumming data in pieces, a checksum per piece.
+ * @param   name            name of the checksum.
+ * @param   piece_size      size of a piece.
+ * @param   size            size of all the data.
+ * @param   threads         max threads on a piece (0: all cores, 1: off).
+ */
+static void BenchmarkChecksum(std::string const & name,
+                              std::uint64_t piece_size,
+                              std::uint64_t size,
+                              unsigned int threads) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, threads});
+
+    std::vector<std::byte> buffer(piece_size);
+    unsigned char checksum[8];
+    auto data = reinterpret_cast<unsigned char const *>(buffer.data());
+    std::uint64_t size_outgoing = 0;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < size / piece_size; ++i) {
+        ASSERT_EQ(algo->Reset(), 0);
+        ASSERT_EQ(algo->Add(data, buffer.size(), nullptr, size_outgoing), 0);
+        ASSERT_EQ(algo->Finalize(checksum, sizeof(checksum), {}), 0);
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start), size};
+
+    headcode::crypt::SetParallelism(parallelism);
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " (" + std::to_string(piece_size) +
+                          " byte pieces, threads: " + (threads == 0 ? std::string{"all"} : std::to_string(threads)) +
+                          ", " + algo->GetDescription().provider_ + ") ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+TEST(Benchmark_CRC, CRC32C) {
+    BenchmarkChecksum("hcs-crc32c", kPageSize, kSize, 1);
+    BenchmarkChecksum("hcs-crc32c", kBufferSize, kSize, 1);
+}
+
+
+TEST(Benchmark_CRC, CRC32) {
+    BenchmarkChecksum("hcs-crc32", kPageSize, kSize, 1);
+    BenchmarkChecksum("hcs-crc32", kBufferSize, kSize, 1);
+}
+
+
+TEST(Benchmark_CRC, CRC64) {
+    BenchmarkChecksum("hcs-crc64", kPageSize, kSize, 1);
+    BenchmarkChecksum("hcs-crc64", kBufferSize, kSize, 1);
+}
+
+
+TEST(Benchmark_CRC, Parallel) {
+    BenchmarkChecksum("hcs-crc32c", 256ul * kBufferSize, kSize, 0);
+    BenchmarkChecksum("hcs-crc32", 256ul * kBufferSize, kSize, 0);
+    BenchmarkChecksum("hcs-crc64", 256ul * kBufferSize, kSize, 0);
+}
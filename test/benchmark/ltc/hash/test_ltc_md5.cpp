@@ -29,7 +29,7 @@ TEST(Benchmark_LTCMD5, LTCMD5StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCMD5, LTCMD5StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCMD5::LTCMD5StdString ");
 
-    auto expected = std::string{"e4c88e4f741434e1f25a12f3e0a9451c"};
+    auto expected = std::string{"9d4875629ea6b99bb046b9e4a5304a38"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
@@ -29,7 +29,7 @@ TEST(Benchmark_LTCRIPEMD128, LTCRIPEMD128StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCRIPEMD128, LTCRIPEMD128StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCRIPEMD128::LTCRIPEMD128StdString ");
 
-    auto expected = std::string{"7b38c9e6a91bb5e8bce8ec28c90731db"};
+    auto expected = std::string{"475e8d5626a98036b67a113db63bc984"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
@@ -29,7 +29,7 @@ TEST(Benchmark_LTCRIPEMD256, LTCRIPEMD256StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCRIPEMD256, LTCRIPEMD256StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCRIPEMD256::LTCRIPEMD256StdString ");
 
-    auto expected = std::string{"baa2bfafa991548084d0f5ce313e4d2a21164bbc11906e5c70bf9ee1f8389a13"};
+    auto expected = std::string{"1563aefffaafc2c3cf177686fa6f1bd8efc56b175c1b6fffc2dfcfefc531b684"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
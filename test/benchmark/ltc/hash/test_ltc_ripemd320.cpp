@@ -29,7 +29,7 @@ TEST(Benchmark_LTCRIPEMD320, LTCRIPEMD320StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCRIPEMD320, LTCRIPEMD320StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCRIPEMD320::LTCRIPEMD320StdString ");
 
-    auto expected = std::string{"b51ebfcca81041e22ec41ed10f490cc7484fb299de90d3917963c12d3a669da79d500092c36afae6"};
+    auto expected = std::string{"139e62d56e5f454457ce161fc58a78693b476444ba7538ea23f0df133fdbe232c84061d0986956b4"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
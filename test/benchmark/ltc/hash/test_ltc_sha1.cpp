@@ -29,7 +29,7 @@ TEST(Benchmark_LTCSHA1, LTCSHA1StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCSHA1, LTCSHA1StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCSHA1::LTCSHA1StdString ");
 
-    auto expected = std::string{"adef2f9c47de610fb523df65a81dc2a96f57a7ec"};
+    auto expected = std::string{"3bb0cb2735b9264bc7c715d289ae801965da1784"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
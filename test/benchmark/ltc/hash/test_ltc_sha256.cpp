@@ -29,7 +29,7 @@ TEST(Benchmark_LTCSHA256, LTCSHA256StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCSHA256, LTCSHA256StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCSHA256::LTCSHA256StdString ");
 
-    auto expected = std::string{"987471f3d737a2a78c6e30d15e1ee304d15c3103f5035083484bb47e60962682"};
+    auto expected = std::string{"8a19f2283d1a8d403e8d47df84698ba14578b429c72f5d9069a74591db75e15b"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
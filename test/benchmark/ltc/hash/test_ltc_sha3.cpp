@@ -0,0 +1,141 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of a buffer (a storage block).
+ */
+static std::uint64_t const kBufferSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Number of buffers hashed.
+ */
+static std::uint64_t const kLoopCount = 256ul;
+
+
+/**
+ * @brief   Benchmarks hashing whole buffers (one digest per buffer, as for integrity checks).
+ * @param   name        name of the hash.
+ */
+static void BenchmarkHash(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> buffer(kBufferSize);
+    std::vector<std::byte> digest;
+    auto data = reinterpret_cast<unsigned char const *>(buffer.data());
+    std::uint64_t size_outgoing = 0;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kLoopCount; ++i) {
+        ASSERT_EQ(algo->Add(data, buffer.size(), nullptr, size_outgoing), 0);
+        ASSERT_EQ(algo->Finalize(digest), 0);
+        ASSERT_EQ(algo->Reset(), 0);
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               kLoopCount * kBufferSize};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Benchmarks squeezing a long output buffer by buffer (as for a large mask).
+ * @param   name        name of the extendable output function.
+ */
+static void BenchmarkSqueeze(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    ASSERT_EQ(algo->Add(std::string{"seed"}), 0);
+    std::vector<std::byte> digest;
+    ASSERT_EQ(algo->Finalize(digest), 0);
+    std::vector<std::byte> buffer(kBufferSize);
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kLoopCount; ++i) {
+        ASSERT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{buffer}), 0);
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               kLoopCount * kBufferSize};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " squeeze ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHA3224) {
+    BenchmarkHash("ltc-sha3-224");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHA3256) {
+    BenchmarkHash("ltc-sha3-256");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHA3384) {
+    BenchmarkHash("ltc-sha3-384");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHA3512) {
+    BenchmarkHash("ltc-sha3-512");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHAKE128) {
+    BenchmarkHash("ltc-shake128");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHAKE256) {
+    BenchmarkHash("ltc-shake256");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHA256) {
+    BenchmarkHash("ltc-sha256");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHA512) {
+    BenchmarkHash("ltc-sha512");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHAKE128Squeeze) {
+    BenchmarkSqueeze("ltc-shake128");
+}
+
+
+TEST(Benchmark_LTCSHA3, LTCSHAKE256Squeeze) {
+    BenchmarkSqueeze("ltc-shake256");
+}
+
+
+TEST(Benchmark_LTCSHA3, BLAKE3Squeeze) {
+    BenchmarkSqueeze("hcs-blake3");
+}
@@ -29,7 +29,7 @@ TEST(Benchmark_LTCSHA384, LTCSHA384StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -40,9 +40,9 @@ TEST(Benchmark_LTCSHA384, LTCSHA384StdString) {
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCSHA384::LTCSHA384StdString ");
 
     auto expected = std::string{
-            "8f3936492400727b3b05bdcd2256d0a0"
-            "337c0c2acc55d9da3a51d089cfabe93f"
-            "61a80a61fee9937ae6f5ea1547dc899e"};
+            "da8555a748a673b6827eb7b8e949cd00"
+            "b737c682662c6181ee3916ecce41304c"
+            "a62ee0fde36447baaf5ab313d3457118"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
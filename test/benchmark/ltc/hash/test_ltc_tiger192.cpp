@@ -29,7 +29,7 @@ TEST(Benchmark_LTCTIGER192, LTCTIGER192StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_LTCTIGER192, LTCTIGER192StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark LTCTIGER192::LTCTIGER192StdString ");
 
-    auto expected = std::string{"e7cc79344b25afdf39f43c468fbb123eca261a918b7cd6dc"};
+    auto expected = std::string{"ffb7a457260e47bd669fe4898497cc857a3d44d2b0bfdf9a"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
@@ -9,6 +9,7 @@
 #include <chrono>
 #include <cstdint>
 #include <iostream>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -116,3 +117,39 @@ TEST(Benchmark_LTCAES256ECB, LTCAES256ECBCArray) {
     std::cout << StreamPerformanceIndicators(throughput,
                                              "Benchmark Benchmark_LTCAES256ECB::LTCAES256ECBCArray ");
 }
+
+
+TEST(Benchmark_LTCAES256ECB, LTCAES256ECBThreads) {
+
+    // a large buffer in a single Add(), split into slices on 1 up to 16 threads
+    static std::uint64_t const kBufferSize = 64ul * 1024ul * 1024ul;
+    static unsigned int const kMaxThreads = 16;
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    std::vector<std::byte> plain(kBufferSize);
+    std::vector<std::byte> cipher(kBufferSize);
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, thread_count});
+        for (auto const & name : {"ltc-aes-256-ecb-encryptor", "ltc-aes-256-ecb-decryptor"}) {
+
+            auto algo = headcode::crypt::Factory::Create(name);
+            ASSERT_NE(algo.get(), nullptr);
+            auto key_algo = key;
+            key_algo.resize(algo->GetDescription().initialization_argument_.at("key").size_);
+            ASSERT_EQ(algo->Initialize({{"key", key_algo}}), 0);
+
+            auto time_start = std::chrono::high_resolution_clock::now();
+            ASSERT_EQ(algo->Add(plain, cipher), 0);
+            headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                                       kBufferSize};
+
+            auto benchmark_name = std::string{"Benchmark "} + name + " 64 MiB " + std::to_string(thread_count) +
+                                  " threads ";
+            std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+        }
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Number of Add() calls on each thread.
+ */
+static std::uint64_t const kAddCount = 20'000ul;
+
+
+/**
+ * @brief   Largest number of threads benchmarked.
+ */
+static unsigned int const kMaxThreads = 16;
+
+
+/**
+ * @brief   Encrypts the ipsum lorem text kAddCount times on each thread, each thread on an instance of its own.
+ * @param   name            name of the cipher.
+ * @param   thread_count    number of concurrent threads.
+ * @return  The elapsed time in microseconds.
+ */
+static std::uint64_t RunThreads(std::string const & name, unsigned int thread_count) {
+
+    auto worker = [&]() {
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr);
+
+        auto const & description = algo->GetDescription();
+        std::map<std::string, std::vector<std::byte>> initialization;
+        for (auto const & [argument, argument_description] : description.initialization_argument_) {
+            auto memory = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+            memory.resize(argument_description.size_);
+            initialization.emplace(argument, memory);
+        }
+        ASSERT_EQ(algo->Initialize(initialization), 0);
+
+        std::vector<std::byte> cipher;
+        for (std::uint64_t i = 0; i < kAddCount; ++i) {
+            ASSERT_EQ(algo->Add(kIpsumLoremText, cipher), 0);
+        }
+    };
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < thread_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    return headcode::benchmark::GetElapsedMicroSeconds(time_start);
+}
+
+
+/**
+ * @brief   Benchmarks concurrent encryption for 1 up to kMaxThreads threads.
+ * With the cipher registered once per process the instances don't meet on the LibTomCrypt
+ * cipher table and the total throughput scales with the threads (as long as there are cores).
+ * @param   name        name of the cipher.
+ */
+static void BenchmarkThreads(std::string const & name) {
+
+    for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+        auto elapsed = RunThreads(name, thread_count);
+        headcode::benchmark::Throughput throughput{elapsed, thread_count * kAddCount * kIpsumLoremText.size()};
+        auto benchmark_name = std::string{"Benchmark LTC threads "} + name + " " + std::to_string(thread_count) +
+                              " threads ";
+        std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+    }
+}
+
+
+TEST(Benchmark_LTCAESThreads, LTCAES128ECB) {
+    BenchmarkThreads("ltc-aes-128-ecb-encryptor");
+}
+
+
+TEST(Benchmark_LTCAESThreads, LTCAES128CBC) {
+    BenchmarkThreads("ltc-aes-128-cbc-encryptor");
+}
+
+
+TEST(Benchmark_LTCAESThreads, LTCAES256CBCDecryptor) {
+    BenchmarkThreads("ltc-aes-256-cbc-decryptor");
+}
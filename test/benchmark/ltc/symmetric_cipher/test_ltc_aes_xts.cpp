@@ -0,0 +1,167 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of the disk image.
+ */
+static std::uint64_t const kImageSize = 64ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Size of a sector.
+ */
+static std::uint64_t const kSectorSize = 4096ul;
+
+
+/**
+ * @brief   Number of random sectors read.
+ */
+static std::uint64_t const kReadCount = 16384ul;
+
+
+/**
+ * @brief   Largest number of threads benchmarked.
+ */
+static unsigned int const kMaxThreads = 16;
+
+
+/**
+ * @brief   Creates the key of a XTS cipher.
+ * @param   algo        the cipher.
+ * @return  The key.
+ */
+static std::vector<std::byte> CreateKey(headcode::crypt::Algorithm const & algo) {
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious - Mary Poppins (1964)");
+    key.resize(algo.GetDescription().initialization_argument_.at("key").size_);
+    return key;
+}
+
+
+/**
+ * @brief   Creates and initializes a XTS cipher.
+ * @param   name        name of the cipher.
+ * @return  The initialized cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr);
+    if (algo == nullptr) {
+        return algo;
+    }
+    EXPECT_EQ(algo->Initialize({{"key", CreateKey(*algo)}}), 0);
+
+    return algo;
+}
+
+
+/**
+ * @brief   Benchmarks reading random sectors of a disk image: each read decrypts a single sector.
+ * @param   name        name of the cipher (without "-encryptor"/"-decryptor").
+ * @param   rekey       pass the key again on each read (sets up the key schedule for every sector).
+ */
+static void BenchmarkRandomRead(std::string const & name, bool rekey) {
+
+    std::vector<std::byte> image(kImageSize);
+    auto decryptor = CreateCipher(name + "-decryptor");
+    ASSERT_NE(decryptor.get(), nullptr);
+    auto key = CreateKey(*decryptor);
+
+    std::mt19937_64 random{42};
+    std::uniform_int_distribution<std::uint64_t> distribution{0, kImageSize / kSectorSize - 1};
+    std::vector<std::byte> sector_number(sizeof(std::uint64_t));
+    std::vector<std::byte> plain(kSectorSize);
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kReadCount; ++i) {
+        auto sector = distribution(random);
+        for (std::size_t j = 0; j < sector_number.size(); ++j) {
+            sector_number[sector_number.size() - 1 - j] = static_cast<std::byte>(sector >> (8 * j));
+        }
+        if (rekey) {
+            ASSERT_EQ(decryptor->Reinitialize({{"key", key}, {"sector", sector_number}}), 0);
+        } else {
+            ASSERT_EQ(decryptor->Reinitialize({{"sector", sector_number}}), 0);
+        }
+        ASSERT_EQ(decryptor->Add(headcode::crypt::ByteView{image}.subview(sector * kSectorSize, kSectorSize), plain),
+                  0);
+    }
+    auto elapsed = headcode::benchmark::GetElapsedMicroSeconds(time_start);
+    headcode::benchmark::Throughput throughput{elapsed, kReadCount * kSectorSize};
+
+    std::string variant = rekey ? "with re-key" : "sector only";
+    auto benchmark_name = std::string{"Benchmark "} + name + "-decryptor random 4 KiB sector reads " + variant + " ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+    std::cout << "Benchmark " << name << "-decryptor latency per sector " << variant << ": "
+              << static_cast<double>(elapsed) / static_cast<double>(kReadCount) << " us" << std::endl;
+}
+
+
+/**
+ * @brief   Benchmarks the encryption of a whole disk image in a single Add() on 1 up to kMaxThreads threads.
+ * @param   name        name of the cipher (without "-encryptor"/"-decryptor").
+ */
+static void BenchmarkImageThreads(std::string const & name) {
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    std::vector<std::byte> plain(kImageSize);
+    std::vector<std::byte> cipher(kImageSize);
+
+    for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, thread_count});
+        auto encryptor = CreateCipher(name + "-encryptor");
+        ASSERT_NE(encryptor.get(), nullptr);
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        ASSERT_EQ(encryptor->Add(plain, cipher), 0);
+        headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                                   kImageSize};
+
+        auto benchmark_name = std::string{"Benchmark "} + name + "-encryptor 64 MiB image " +
+                              std::to_string(thread_count) + " threads ";
+        std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(Benchmark_LTCAESXTS, LTCAES128XTSRandomRead) {
+    BenchmarkRandomRead("ltc-aes-128-xts", true);
+    BenchmarkRandomRead("ltc-aes-128-xts", false);
+}
+
+
+TEST(Benchmark_LTCAESXTS, LTCAES256XTSRandomRead) {
+    BenchmarkRandomRead("ltc-aes-256-xts", true);
+    BenchmarkRandomRead("ltc-aes-256-xts", false);
+}
+
+
+TEST(Benchmark_LTCAESXTS, LTCAES128XTSImageThreads) {
+    BenchmarkImageThreads("ltc-aes-128-xts");
+}
+
+
+TEST(Benchmark_LTCAESXTS, LTCAES256XTSImageThreads) {
+    BenchmarkImageThreads("ltc-aes-256-xts");
+}
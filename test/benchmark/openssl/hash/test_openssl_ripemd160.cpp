@@ -29,7 +29,7 @@ TEST(Benchmark_OPENSSLRIPEMD160, OPENSSLRIPEMD160StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_OPENSSLRIPEMD160, OPENSSLRIPEMD160StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark OpenSSLRIPEMD160::OPENSSLRIPEMD160StdString ");
 
-    auto expected = std::string{"06c94f820cc41bd3f1ce26c960f1f0b9c8491b4d"};
+    auto expected = std::string{"be1ad1fbdc81f8e4511d83167268ea842e53c06a"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
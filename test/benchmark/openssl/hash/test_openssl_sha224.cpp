@@ -29,7 +29,7 @@ TEST(Benchmark_OPENSSLSHA224, OPENSSLSHA224StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -39,7 +39,7 @@ TEST(Benchmark_OPENSSLSHA224, OPENSSLSHA224StdString) {
 
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark OpenSSLSHA224::OPENSSLSHA224StdString ");
 
-    auto expected = std::string{"b070845eaa51831fe7983bddbc806ae6a39bc15609528b765635cf49"};
+    auto expected = std::string{"6397c510b530f14909d107700843746ea63894bd650078cf5f875ed6"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
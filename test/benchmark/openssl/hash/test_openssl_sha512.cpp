@@ -29,7 +29,7 @@ TEST(Benchmark_OPENSSLSHA512, OPENSSLSHA512StdString) {
 
     auto time_start = std::chrono::high_resolution_clock::now();
     for (std::uint64_t i = 0; i < loop_count; ++i) {
-        // this is with padding
+        // this is padded once at Finalize
         algo->Add(kIpsumLoremText);
     }
     std::vector<std::byte> result;
@@ -40,10 +40,10 @@ TEST(Benchmark_OPENSSLSHA512, OPENSSLSHA512StdString) {
     std::cout << StreamPerformanceIndicators(throughput, "Benchmark OpenSSLSHA512::OPENSSLSHA512StdString ");
 
     auto expected = std::string{
-            "2debfe2de82fea9c4186950a632533e5"
-            "64167ae88b81d8c3217b508a1c5169dc"
-            "e43aeaa226843a80f5bf2e6d95eee73b"
-            "fb64d1f5deb75003ceca40610bb4de94"};
+            "0fc0d12b4bd4134aebe978e1bbb5d065"
+            "4e0ab2171ffce6a19acdceb0f4ec0431"
+            "579b319c7b18c96d3faf8b2a028ae6b8"
+            "fc394ed27eab6a11a561921710dbb936"};
     EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
 }
 
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of a buffer (a storage block).
+ */
+static std::uint64_t const kBufferSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Number of buffers hashed.
+ */
+static std::uint64_t const kLoopCount = 256ul;
+
+
+/**
+ * @brief   Benchmarks hashing large buffers (one digest per buffer).
+ * @param   name        name of the hash.
+ */
+static void BenchmarkHash(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> buffer(kBufferSize);
+    std::vector<std::byte> digest;
+    auto data = reinterpret_cast<unsigned char const *>(buffer.data());
+    std::uint64_t size_outgoing = 0;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kLoopCount; ++i) {
+        ASSERT_EQ(algo->Add(data, buffer.size(), nullptr, size_outgoing), 0);
+        ASSERT_EQ(algo->Finalize(digest), 0);
+        ASSERT_EQ(algo->Reset(), 0);
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               kLoopCount * kBufferSize};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+TEST(Benchmark_OPENSSLSHA512256, OPENSSLSHA512256) {
+    BenchmarkHash("openssl-sha512-256");
+}
+
+
+TEST(Benchmark_OPENSSLSHA512256, OPENSSLSHA512224) {
+    BenchmarkHash("openssl-sha512-224");
+}
+
+
+TEST(Benchmark_OPENSSLSHA512256, OPENSSLSHA256) {
+    BenchmarkHash("openssl-sha256");
+}
+
+
+TEST(Benchmark_OPENSSLSHA512256, OPENSSLSHA512) {
+    BenchmarkHash("openssl-sha512");
+}
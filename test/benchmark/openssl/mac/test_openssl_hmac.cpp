@@ -0,0 +1,88 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Number of messages authenticated per run.
+ */
+static std::uint64_t const kMessageCount = 1'000'000ul;
+
+
+/**
+ * @brief   Benchmarks authenticating short messages (webhooks) with a single key.
+ * Reset() starts each message with the precomputed key blocks, Reinitialize() hashes them
+ * again: the difference is what the precomputation saves.
+ * @param   name        name of the MAC.
+ */
+static void BenchmarkShortMessages(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    std::vector<std::byte> key(32, std::byte{0x42});
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    std::vector<std::byte> messages(kMessageCount + 1024);
+    for (std::uint64_t i = 0; i < messages.size(); ++i) {
+        messages[i] = static_cast<std::byte>(i % 251);
+    }
+    unsigned char tag[64];
+    std::uint64_t size_outgoing = 0;
+
+    for (std::uint64_t message_size : {16ul, 64ul, 256ul, 1024ul}) {
+        for (bool rekey : {false, true}) {
+
+            auto time_start = std::chrono::high_resolution_clock::now();
+            for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+                if (rekey) {
+                    algo->Reinitialize({{"key", key}});
+                } else {
+                    algo->Reset();
+                }
+                algo->Add(reinterpret_cast<unsigned char const *>(messages.data()) + i,
+                          message_size,
+                          nullptr,
+                          size_outgoing);
+                algo->Finalize(tag, sizeof(tag), {});
+            }
+            auto elapsed = headcode::benchmark::GetElapsedMicroSeconds(time_start);
+            headcode::benchmark::Throughput throughput{elapsed, kMessageCount * message_size};
+
+            auto benchmark_name = std::string{"Benchmark "} + name + " message size " +
+                                  std::to_string(message_size) + (rekey ? " Reinitialize()" : " Reset()") + " (" +
+                                  std::to_string(elapsed * 1000.0 / static_cast<double>(kMessageCount)) +
+                                  " ns/tag) ";
+            std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+        }
+    }
+}
+
+
+TEST(Benchmark_OpenSSL_HMAC, HMAC_SHA1) {
+    BenchmarkShortMessages("openssl-hmac-sha1");
+}
+
+
+TEST(Benchmark_OpenSSL_HMAC, HMAC_SHA256) {
+    BenchmarkShortMessages("openssl-hmac-sha256");
+}
+
+
+TEST(Benchmark_OpenSSL_HMAC, HMAC_SHA512) {
+    BenchmarkShortMessages("openssl-hmac-sha512");
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of the large buffer handed to a single Add().
+ */
+static std::uint64_t const kBufferSize = 64ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Largest number of threads benchmarked.
+ */
+static unsigned int const kMaxThreads = 16;
+
+
+/**
+ * @brief   Creates and initializes a CBC cipher.
+ * @param   name        name of the cipher.
+ * @return  The initialized cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr);
+    if (algo == nullptr) {
+        return algo;
+    }
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(algo->GetDescription().initialization_argument_.at("key").size_);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(algo->GetDescription().initialization_argument_.at("iv").size_);
+    EXPECT_EQ(algo->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    return algo;
+}
+
+
+/**
+ * @brief   Benchmarks the decryption of a large buffer in a single Add() on 1 up to kMaxThreads threads.
+ * The (serial) encryption of the same buffer is given first for comparison.
+ * @param   name        name of the cipher (without "-encryptor"/"-decryptor").
+ */
+static void BenchmarkDecryptThreads(std::string const & name) {
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    std::vector<std::byte> plain(kBufferSize);
+    std::vector<std::byte> cipher(kBufferSize);
+
+    auto encryptor = CreateCipher(name + "-encryptor");
+    ASSERT_NE(encryptor.get(), nullptr);
+    auto time_start = std::chrono::high_resolution_clock::now();
+    ASSERT_EQ(encryptor->Add(plain, cipher), 0);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start), kBufferSize};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + "-encryptor 64 MiB ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+
+    for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, thread_count});
+        auto decryptor = CreateCipher(name + "-decryptor");
+        ASSERT_NE(decryptor.get(), nullptr);
+
+        time_start = std::chrono::high_resolution_clock::now();
+        ASSERT_EQ(decryptor->Add(cipher, plain), 0);
+        throughput = headcode::benchmark::Throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                                      kBufferSize};
+
+        benchmark_name = std::string{"Benchmark "} + name + "-decryptor 64 MiB " + std::to_string(thread_count) +
+                         " threads ";
+        std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(Benchmark_OPENSSLAESCBC, OPENSSLAES128CBCDecryptThreads) {
+    BenchmarkDecryptThreads("openssl-aes-128-cbc");
+}
+
+
+TEST(Benchmark_OPENSSLAESCBC, OPENSSLAES256CBCDecryptThreads) {
+    BenchmarkDecryptThreads("openssl-aes-256-cbc");
+}
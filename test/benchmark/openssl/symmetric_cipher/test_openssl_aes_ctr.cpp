@@ -0,0 +1,134 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Size of the large buffer handed to a single Add().
+ */
+static std::uint64_t const kBufferSize = 64ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Largest number of threads benchmarked.
+ */
+static unsigned int const kMaxThreads = 16;
+
+
+/**
+ * @brief   Creates and initializes a CTR cipher.
+ * @param   name        name of the cipher.
+ * @return  The initialized cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr);
+    if (algo == nullptr) {
+        return algo;
+    }
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(algo->GetDescription().initialization_argument_.at("key").size_);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(algo->GetDescription().initialization_argument_.at("iv").size_);
+    EXPECT_EQ(algo->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    return algo;
+}
+
+
+/**
+ * @brief   Benchmarks small strings, which are never split into slices.
+ * @param   name        name of the cipher.
+ */
+static void BenchmarkString(std::string const & name) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = CreateCipher(name);
+    ASSERT_NE(algo.get(), nullptr);
+
+    std::vector<std::byte> cipher;
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        ASSERT_EQ(algo->Add(kIpsumLoremText, cipher), 0);
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * kIpsumLoremText.size()};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " string ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Benchmarks a large buffer in a single Add() on 1 up to kMaxThreads threads.
+ * @param   name        name of the cipher.
+ */
+static void BenchmarkThreads(std::string const & name) {
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    std::vector<std::byte> plain(kBufferSize);
+    std::vector<std::byte> cipher(kBufferSize);
+
+    for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, thread_count});
+        auto algo = CreateCipher(name);
+        ASSERT_NE(algo.get(), nullptr);
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        ASSERT_EQ(algo->Add(plain, cipher), 0);
+        headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                                   kBufferSize};
+
+        auto benchmark_name = std::string{"Benchmark "} + name + " 64 MiB " + std::to_string(thread_count) +
+                              " threads ";
+        std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(Benchmark_OPENSSLAESCTR, OPENSSLAES128CTRString) {
+    BenchmarkString("openssl-aes-128-ctr");
+}
+
+
+TEST(Benchmark_OPENSSLAESCTR, OPENSSLAES128CTRThreads) {
+    BenchmarkThreads("openssl-aes-128-ctr");
+}
+
+
+TEST(Benchmark_OPENSSLAESCTR, OPENSSLAES192CTRThreads) {
+    BenchmarkThreads("openssl-aes-192-ctr");
+}
+
+
+TEST(Benchmark_OPENSSLAESCTR, OPENSSLAES256CTRString) {
+    BenchmarkString("openssl-aes-256-ctr");
+}
+
+
+TEST(Benchmark_OPENSSLAESCTR, OPENSSLAES256CTRThreads) {
+    BenchmarkThreads("openssl-aes-256-ctr");
+}
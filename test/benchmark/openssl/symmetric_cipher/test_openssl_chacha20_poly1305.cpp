@@ -0,0 +1,118 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of a buffer (a storage block).
+ */
+static std::uint64_t const kBufferSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Number of buffers encrypted.
+ */
+static std::uint64_t const kLoopCount = 256ul;
+
+
+/**
+ * @brief   Creates and initializes an algorithm.
+ * @param   name        name of the algorithm.
+ * @return  The initialized algorithm.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateAlgorithm(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr);
+    if (algo == nullptr) {
+        return algo;
+    }
+
+    auto const & description = algo->GetDescription();
+    std::map<std::string, std::vector<std::byte>> initialization;
+    for (auto const & [argument, argument_description] : description.initialization_argument_) {
+        if (!argument_description.optional_) {
+            auto memory = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+            memory.resize(argument_description.size_);
+            initialization.emplace(argument, memory);
+        }
+    }
+    EXPECT_EQ(algo->Initialize(initialization), 0);
+
+    return algo;
+}
+
+
+/**
+ * @brief   Benchmarks the encryption of whole buffers, finalized (padding or tag) after each buffer.
+ * @param   name        name of the cipher.
+ */
+static void BenchmarkCipher(std::string const & name) {
+
+    auto algo = CreateAlgorithm(name);
+    ASSERT_NE(algo.get(), nullptr);
+
+    std::vector<std::byte> plain(kBufferSize);
+    std::vector<std::byte> cipher(kBufferSize);
+    std::vector<std::byte> result;
+    std::vector<std::byte> iv(12);
+
+    // an AEAD encryptor never reuses an IV: each buffer gets one of its own while the key schedule is kept
+    auto const & arguments = algo->GetDescription().initialization_argument_;
+    auto aead = arguments.find("aad") != arguments.end();
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kLoopCount; ++i) {
+        ASSERT_EQ(algo->Add(plain, cipher), 0);
+        ASSERT_EQ(algo->Finalize(result), 0);
+        if (aead) {
+            std::memcpy(iv.data(), &i, sizeof(i));
+            ASSERT_EQ(algo->Reinitialize({{"iv", iv}}), 0);
+        } else {
+            ASSERT_EQ(algo->Reset(), 0);
+        }
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               kLoopCount * kBufferSize};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+TEST(Benchmark_OPENSSLChaCha20, OPENSSLChaCha20Poly1305) {
+    BenchmarkCipher("openssl-chacha20-poly1305-encryptor");
+}
+
+
+TEST(Benchmark_OPENSSLChaCha20, OPENSSLAES128CBC) {
+    BenchmarkCipher("openssl-aes-128-cbc-encryptor");
+}
+
+
+TEST(Benchmark_OPENSSLChaCha20, OPENSSLAES256CBC) {
+    BenchmarkCipher("openssl-aes-256-cbc-encryptor");
+}
+
+
+TEST(Benchmark_OPENSSLChaCha20, OPENSSLAES256GCM) {
+    BenchmarkCipher("openssl-aes-256-gcm-encryptor");
+}
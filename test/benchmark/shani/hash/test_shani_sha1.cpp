@@ -0,0 +1,73 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+TEST(Benchmark_SHANISHA1, SHANISHA1StdString) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha1");
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        // this is padded once at Finalize
+        algo->Add(kIpsumLoremText);
+    }
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * kIpsumLoremText.size()};
+
+    std::cout << StreamPerformanceIndicators(throughput, "Benchmark SHANISHA1::SHANISHA1StdString ");
+
+    auto expected = std::string{"3bb0cb2735b9264bc7c715d289ae801965da1784"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
+}
+
+
+TEST(Benchmark_SHANISHA1, SHANISHA1CArray) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha1");
+
+    auto block_incoming = kIpsumLoremText.c_str();
+    auto size_incoming = std::strlen(block_incoming);
+    std::uint64_t size_outgoing = 0ul;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        // this is without padding
+        algo->Add(reinterpret_cast<unsigned char const *>(block_incoming), size_incoming, nullptr, size_outgoing);
+    }
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * size_incoming};
+
+    std::cout << StreamPerformanceIndicators(throughput, "Benchmark SHANISHA1::SHANISHA1CArray ");
+
+    auto expected = std::string{"cae61d20a6352a4271f11417b041725768159a2a"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
+}
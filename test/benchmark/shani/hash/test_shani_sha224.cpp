@@ -0,0 +1,73 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+TEST(Benchmark_SHANISHA224, SHANISHA224StdString) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha224");
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        // this is padded once at Finalize
+        algo->Add(kIpsumLoremText);
+    }
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * kIpsumLoremText.size()};
+
+    std::cout << StreamPerformanceIndicators(throughput, "Benchmark SHANISHA224::SHANISHA224StdString ");
+
+    auto expected = std::string{"6397c510b530f14909d107700843746ea63894bd650078cf5f875ed6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
+}
+
+
+TEST(Benchmark_SHANISHA224, SHANISHA224CArray) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha224");
+
+    auto block_incoming = kIpsumLoremText.c_str();
+    auto size_incoming = std::strlen(block_incoming);
+    std::uint64_t size_outgoing = 0ul;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        // this is without padding
+        algo->Add(reinterpret_cast<unsigned char const *>(block_incoming), size_incoming, nullptr, size_outgoing);
+    }
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * size_incoming};
+
+    std::cout << StreamPerformanceIndicators(throughput, "Benchmark SHANISHA224::SHANISHA224CArray ");
+
+    auto expected = std::string{"dd15faac9e5b43d0232a35333f687717e25a584ca224d7ee17089c3e"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+TEST(Benchmark_SHANISHA256, SHANISHA256StdString) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha256");
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        // this is padded once at Finalize
+        algo->Add(kIpsumLoremText);
+    }
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * kIpsumLoremText.size()};
+
+    std::cout << StreamPerformanceIndicators(throughput, "Benchmark SHANISHA256::SHANISHA256StdString ");
+
+    auto expected = std::string{"8a19f2283d1a8d403e8d47df84698ba14578b429c72f5d9069a74591db75e15b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
+}
+
+
+TEST(Benchmark_SHANISHA256, SHANISHA256CArray) {
+
+    auto loop_count = 100'000u;
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha256");
+
+    auto block_incoming = kIpsumLoremText.c_str();
+    auto size_incoming = std::strlen(block_incoming);
+    std::uint64_t size_outgoing = 0ul;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < loop_count; ++i) {
+        // this is without padding
+        algo->Add(reinterpret_cast<unsigned char const *>(block_incoming), size_incoming, nullptr, size_outgoing);
+    }
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                                               loop_count * size_incoming};
+
+    std::cout << StreamPerformanceIndicators(throughput, "Benchmark SHANISHA256::SHANISHA256CArray ");
+
+    auto expected = std::string{"1ea8106595cc961d258251ad51613694c625c080e1103f1b8c5c5ed411b70de5"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(result).c_str(), expected.c_str());
+}
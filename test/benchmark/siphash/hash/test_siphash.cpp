@@ -0,0 +1,109 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Number of keys hashed per latency run.
+ */
+static std::uint64_t const kKeyCount = 10'000'000ul;
+
+
+/**
+ * @brief   Creates the keys: a key starts a byte further on each time.
+ * @return  The memory of the keys.
+ */
+static std::vector<std::byte> CreateKeys() {
+    std::vector<std::byte> keys(kKeyCount + 64);
+    for (std::uint64_t i = 0; i < keys.size(); ++i) {
+        keys[i] = static_cast<std::byte>(i % 251);
+    }
+    return keys;
+}
+
+
+/**
+ * @brief   Prints the ns per hash of a run.
+ * @param   name            name of the run.
+ * @param   key_size        size of the keys.
+ * @param   elapsed         microseconds elapsed.
+ */
+static void Print(std::string const & name, std::uint64_t key_size, std::uint64_t elapsed) {
+    headcode::benchmark::Throughput throughput{elapsed, kKeyCount * key_size};
+    auto ns_per_hash = static_cast<double>(elapsed) * 1000.0 / static_cast<double>(kKeyCount);
+    auto benchmark_name = std::string{"Benchmark "} + name + " key size " + std::to_string(key_size) + " (" +
+                          std::to_string(ns_per_hash) + " ns/hash) ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Benchmarks hashing small keys with the algorithm (virtual Reset(), Add() and Finalize()).
+ * @param   name        name of the hash.
+ */
+static void BenchmarkAlgorithm(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize({{"key", std::vector<std::byte>(16)}}), 0);
+
+    auto keys = CreateKeys();
+    unsigned char hash[16];
+    std::uint64_t size_outgoing = 0;
+
+    for (std::uint64_t key_size : {8ul, 16ul, 32ul, 64ul}) {
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kKeyCount; ++i) {
+            algo->Reset();
+            algo->Add(reinterpret_cast<unsigned char const *>(keys.data()) + i, key_size, nullptr, size_outgoing);
+            algo->Finalize(hash, sizeof(hash), {});
+        }
+        Print(name, key_size, headcode::benchmark::GetElapsedMicroSeconds(time_start));
+    }
+}
+
+
+TEST(Benchmark_SipHash, SipHash_2_4) {
+    BenchmarkAlgorithm("hcs-siphash-2-4");
+}
+
+
+TEST(Benchmark_SipHash, SipHash_2_4_128) {
+    BenchmarkAlgorithm("hcs-siphash-2-4-128");
+}
+
+
+TEST(Benchmark_SipHash, SipHash24_inlined) {
+
+    headcode::crypt::SipHash24 siphash;
+    ASSERT_EQ(siphash.SetKey(std::vector<std::byte>(16)), 0);
+    auto keys = CreateKeys();
+    auto data = reinterpret_cast<unsigned char const *>(keys.data());
+
+    for (std::uint64_t key_size : {8ul, 16ul, 32ul, 64ul}) {
+
+        // fold the hashes: the loop can not be dropped
+        std::uint64_t folded = 0;
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kKeyCount; ++i) {
+            folded ^= siphash.Hash(headcode::crypt::ByteView{data + i, key_size});
+        }
+        Print("SipHash24::Hash()", key_size, headcode::benchmark::GetElapsedMicroSeconds(time_start));
+        EXPECT_NE(folded, 0ul);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Number of messages processed per run.
+ */
+static std::uint64_t const kMessageCount = 100'000ul;
+
+
+/**
+ * @brief   Number of messages handed to the batch hasher at once.
+ */
+static std::uint64_t const kBatchSize = 64ul;
+
+
+/**
+ * @brief   Prints the result of a single run.
+ * @param   name            name of the run.
+ * @param   elapsed         elapsed microseconds.
+ * @param   message_size    size of a single message.
+ */
+static void Report(std::string const & name, std::uint64_t elapsed, std::uint64_t message_size) {
+    headcode::benchmark::Throughput throughput{elapsed, kMessageCount * message_size};
+    auto benchmark_name = std::string{"Benchmark BatchHasher::"} + name + " message size " +
+                          std::to_string(message_size) + " (" +
+                          std::to_string(elapsed * 1000.0 / static_cast<double>(kMessageCount)) + " ns/message) ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Hashes many small messages one by one on a reused instance and in batches.
+ * @param   name        name of the hash.
+ */
+static void BenchmarkBatch(std::string const & name) {
+
+    for (std::uint64_t message_size : {16ul, 64ul, 256ul, 1024ul}) {
+
+        std::vector<headcode::crypt::ByteView> messages;
+        for (std::uint64_t i = 0; i < kBatchSize; ++i) {
+            messages.emplace_back(reinterpret_cast<unsigned char const *>(kIpsumLoremText.c_str()) + i, message_size);
+        }
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr);
+        algo->Initialize();
+        std::vector<std::byte> expected;
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            algo->Add(messages[i % kBatchSize]);
+            algo->Finalize(expected);
+            algo->Reset();
+        }
+        Report(name + " single", headcode::benchmark::GetElapsedMicroSeconds(time_start), message_size);
+
+        for (std::uint64_t max_lanes : {1ul, 4ul, 0ul}) {
+
+            auto hasher = headcode::crypt::Factory::CreateBatchHasher(name, max_lanes);
+            ASSERT_NE(hasher.get(), nullptr);
+            std::vector<std::byte> digests;
+
+            time_start = std::chrono::high_resolution_clock::now();
+            for (std::uint64_t i = 0; i < kMessageCount; i += kBatchSize) {
+                hasher->Hash(messages, digests);
+            }
+            Report(name + " batch " + std::to_string(hasher->GetLanes()) + " lanes",
+                   headcode::benchmark::GetElapsedMicroSeconds(time_start),
+                   message_size);
+
+            auto result_size = hasher->GetDescription().result_size_;
+            auto last = (kMessageCount - 1) % kBatchSize;
+            EXPECT_EQ((std::vector<std::byte>{digests.begin() + last * result_size,
+                                              digests.begin() + (last + 1) * result_size}),
+                      expected);
+        }
+    }
+}
+
+
+TEST(Benchmark_BatchHasher, MBMD5) {
+    BenchmarkBatch("hcs-mb-md5");
+}
+
+
+TEST(Benchmark_BatchHasher, MBSHA1) {
+    BenchmarkBatch("hcs-mb-sha1");
+}
+
+
+TEST(Benchmark_BatchHasher, MBSHA256) {
+    BenchmarkBatch("hcs-mb-sha256");
+}
+
+
+#ifdef OPENSSL
+
+TEST(Benchmark_BatchHasher, OpenSSLSHA256) {
+    BenchmarkBatch("openssl-sha256");
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Total amount of bytes pushed through the algorithm for each chunk size.
+ */
+static std::uint64_t const kTotalSize = 4ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Largest chunk size benchmarked.
+ */
+static std::uint64_t const kMaxChunkSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Creates and initializes an algorithm instance.
+ * @param   name        name of the algorithm.
+ * @return  An initialized algorithm instance.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateAlgorithm(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    if (algo == nullptr) {
+        return algo;
+    }
+
+    std::map<std::string, std::vector<std::byte>> initialization_data;
+    for (auto const & [argument_name, argument_definition] : algo->GetDescription().initialization_argument_) {
+        auto argument = headcode::mem::StringToMemory(kIpsumLoremText);
+        argument.resize(argument_definition.size_);
+        initialization_data[argument_name] = argument;
+    }
+    if (algo->Initialize(initialization_data) != 0) {
+        algo.reset();
+    }
+
+    return algo;
+}
+
+
+/**
+ * @brief   Streams kTotalSize bytes in chunks of 1 Byte up to 1 MiB into the algorithm.
+ * Each run must produce the very same output as adding all data at once.
+ * @param   name        name of the algorithm.
+ */
+static void BenchmarkChunkSizes(std::string const & name) {
+
+    for (std::uint64_t chunk_size = 1; chunk_size <= kMaxChunkSize; chunk_size *= 2) {
+
+        auto loop_count = kTotalSize / chunk_size;
+
+        std::vector<std::byte> chunk{chunk_size};
+        for (std::uint64_t i = 0; i < chunk_size; i += kIpsumLoremText.size()) {
+            std::memcpy(chunk.data() + i, kIpsumLoremText.c_str(), std::min(chunk_size - i, kIpsumLoremText.size()));
+        }
+
+        // the reference: all data at once
+        std::vector<std::byte> all_data;
+        all_data.reserve(loop_count * chunk_size);
+        for (std::uint64_t i = 0; i < loop_count; ++i) {
+            all_data.insert(all_data.end(), chunk.begin(), chunk.end());
+        }
+        auto algo_reference = CreateAlgorithm(name);
+        ASSERT_NE(algo_reference.get(), nullptr);
+        std::vector<std::byte> expected;
+        ASSERT_EQ(algo_reference->Add(all_data, expected), 0);
+        std::vector<std::byte> expected_final;
+        ASSERT_EQ(algo_reference->Finalize(expected_final), 0);
+        expected.insert(expected.end(), expected_final.begin(), expected_final.end());
+
+        // the chunked stream
+        auto algo = CreateAlgorithm(name);
+        ASSERT_NE(algo.get(), nullptr);
+        std::vector<std::byte> result;
+        result.reserve(expected.size());
+        std::vector<std::byte> block_outgoing;
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < loop_count; ++i) {
+            ASSERT_EQ(algo->Add(chunk, block_outgoing), 0);
+            result.insert(result.end(), block_outgoing.begin(), block_outgoing.end());
+        }
+        std::vector<std::byte> result_final;
+        ASSERT_EQ(algo->Finalize(result_final), 0);
+        auto elapsed = headcode::benchmark::GetElapsedMicroSeconds(time_start);
+        result.insert(result.end(), result_final.begin(), result_final.end());
+
+        headcode::benchmark::Throughput throughput{elapsed, loop_count * chunk_size};
+        auto benchmark_name = std::string{"Benchmark ChunkSize::"} + name + " chunk size " +
+                              std::to_string(chunk_size) + " (" +
+                              std::to_string(elapsed * 1000.0 / static_cast<double>(loop_count)) + " ns/call) ";
+        std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+
+        ASSERT_EQ(result.size(), expected.size());
+        EXPECT_EQ(std::memcmp(result.data(), expected.data(), expected.size()), 0);
+    }
+}
+
+
+TEST(Benchmark_ChunkSize, LTCSHA256) {
+    BenchmarkChunkSizes("ltc-sha256");
+}
+
+
+TEST(Benchmark_ChunkSize, LTCAES128CBC) {
+    BenchmarkChunkSizes("ltc-aes-128-cbc-encryptor");
+}
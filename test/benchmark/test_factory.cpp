@@ -0,0 +1,94 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Number of Create() calls on each thread.
+ */
+static std::uint64_t const kCreateCount = 100'000ul;
+
+
+/**
+ * @brief   Largest number of threads benchmarked.
+ */
+static unsigned int const kMaxThreads = 64;
+
+
+/**
+ * @brief   Calls Factory::Create() kCreateCount times on each thread.
+ * @param   name            name of the algorithm.
+ * @param   thread_count    number of concurrent threads.
+ * @param   by_id           if true, the algorithm is created by its resolved id, else by its name.
+ * @return  The elapsed time in microseconds.
+ */
+static std::uint64_t RunThreads(std::string const & name, unsigned int thread_count, bool by_id) {
+
+    auto id = headcode::crypt::Factory::Resolve(name);
+
+    auto worker = [&]() {
+        for (std::uint64_t i = 0; i < kCreateCount; ++i) {
+            auto algo = by_id ? headcode::crypt::Factory::Create(id) : headcode::crypt::Factory::Create(name);
+            ASSERT_NE(algo.get(), nullptr);
+        }
+    };
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < thread_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    return headcode::benchmark::GetElapsedMicroSeconds(time_start);
+}
+
+
+/**
+ * @brief   Benchmarks concurrent Factory::Create() calls for 1 up to kMaxThreads threads.
+ * With a lock-free registry the number of Create() calls per second scales with the threads
+ * (as long as there are enough cores and the allocator keeps up).
+ * @param   name        name of the algorithm.
+ */
+static void BenchmarkCreate(std::string const & name) {
+
+    for (auto by_id : {false, true}) {
+        for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+            auto elapsed = RunThreads(name, thread_count, by_id);
+            auto calls = thread_count * kCreateCount;
+            auto calls_per_second = static_cast<double>(calls) * 1'000'000.0 / static_cast<double>(elapsed);
+
+            std::cout << "Benchmark Factory::Create(" << (by_id ? "id" : "name") << ") " << name << " "
+                      << thread_count << " threads: " << calls << " calls in " << elapsed << " us ("
+                      << static_cast<std::uint64_t>(calls_per_second) << " calls/s)" << std::endl;
+        }
+    }
+}
+
+
+TEST(Benchmark_Factory, Create_NoHash) {
+    BenchmarkCreate("nohash");
+}
+
+
+TEST(Benchmark_Factory, Create_LTCSHA256) {
+    BenchmarkCreate("ltc-sha256");
+}
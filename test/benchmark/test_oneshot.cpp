@@ -0,0 +1,88 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Number of messages processed per run.
+ */
+static std::uint64_t const kMessageCount = 100'000ul;
+
+
+/**
+ * @brief   Prints the result of a single run.
+ * @param   name            name of the run.
+ * @param   elapsed         elapsed microseconds.
+ * @param   message_size    size of a single message.
+ */
+static void Report(std::string const & name, std::uint64_t elapsed, std::uint64_t message_size) {
+    headcode::benchmark::Throughput throughput{elapsed, kMessageCount * message_size};
+    auto benchmark_name = std::string{"Benchmark OneShot::"} + name + " message size " +
+                          std::to_string(message_size) + " (" +
+                          std::to_string(elapsed * 1000.0 / static_cast<double>(kMessageCount)) + " ns/message) ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Hashes small messages with a new instance per message and with Digest().
+ * @param   name        name of the hash.
+ */
+static void BenchmarkDigest(std::string const & name) {
+
+    for (std::uint64_t message_size : {16ul, 64ul, 256ul, 1024ul}) {
+
+        headcode::crypt::ByteView message{reinterpret_cast<unsigned char const *>(kIpsumLoremText.c_str()),
+                                          message_size};
+        std::vector<std::byte> expected;
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            auto algo = headcode::crypt::Factory::Create(name);
+            algo->Initialize();
+            algo->Add(message);
+            algo->Finalize(expected);
+        }
+        Report(name + " Create()", headcode::benchmark::GetElapsedMicroSeconds(time_start), message_size);
+
+        std::vector<std::byte> digest;
+        time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            headcode::crypt::Digest(name, message, digest);
+        }
+        Report(name + " Digest()", headcode::benchmark::GetElapsedMicroSeconds(time_start), message_size);
+
+        EXPECT_EQ(digest, expected);
+    }
+}
+
+
+TEST(Benchmark_OneShot, LTCSHA256) {
+    BenchmarkDigest("ltc-sha256");
+}
+
+
+#ifdef OPENSSL
+
+TEST(Benchmark_OneShot, OpenSSLSHA256) {
+    BenchmarkDigest("openssl-sha256");
+}
+
+#endif
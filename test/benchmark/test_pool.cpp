@@ -0,0 +1,125 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Size of a single message.
+ */
+static std::uint64_t const kMessageSize = 64ul;
+
+
+/**
+ * @brief   Number of messages processed by each thread.
+ */
+static std::uint64_t const kMessageCount = 20'000ul;
+
+
+/**
+ * @brief   Largest number of threads benchmarked.
+ */
+static unsigned int const kMaxThreads = 32;
+
+
+/**
+ * @brief   Hashes kMessageCount messages on each thread, getting a new instance per message.
+ * @param   name            name of the algorithm.
+ * @param   thread_count    number of concurrent threads.
+ * @param   pooled          if true, instances are borrowed from the pool, else created anew.
+ * @return  The elapsed time in microseconds.
+ */
+static std::uint64_t RunThreads(std::string const & name, unsigned int thread_count, bool pooled) {
+
+    headcode::crypt::ByteView message{reinterpret_cast<unsigned char const *>(kIpsumLoremText.c_str()), kMessageSize};
+
+    auto worker = [&]() {
+        std::vector<std::byte> hash;
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            if (pooled) {
+                auto algo = headcode::crypt::Factory::Acquire(name);
+                ASSERT_TRUE(algo);
+                ASSERT_EQ(algo->Add(message), 0);
+                ASSERT_EQ(algo->Finalize(hash), 0);
+            } else {
+                auto algo = headcode::crypt::Factory::Create(name);
+                ASSERT_NE(algo.get(), nullptr);
+                ASSERT_EQ(algo->Initialize(), 0);
+                ASSERT_EQ(algo->Add(message), 0);
+                ASSERT_EQ(algo->Finalize(hash), 0);
+            }
+        }
+    };
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < thread_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    return headcode::benchmark::GetElapsedMicroSeconds(time_start);
+}
+
+
+/**
+ * @brief   Compares Factory::Create() against Factory::Acquire() for 1 up to kMaxThreads threads.
+ * @param   name        name of the algorithm.
+ */
+static void BenchmarkPool(std::string const & name) {
+
+    for (unsigned int thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+
+        auto bytes = thread_count * kMessageCount * kMessageSize;
+
+        auto elapsed = RunThreads(name, thread_count, false);
+        headcode::benchmark::Throughput throughput_create{elapsed, bytes};
+        auto benchmark_name = std::string{"Benchmark Pool::"} + name + " Create() " + std::to_string(thread_count) +
+                              " threads ";
+        std::cout << StreamPerformanceIndicators(throughput_create, benchmark_name.c_str());
+
+        auto statistics_start = headcode::crypt::Factory::GetPoolStatistics(name);
+        elapsed = RunThreads(name, thread_count, true);
+        auto statistics = headcode::crypt::Factory::GetPoolStatistics(name);
+        headcode::benchmark::Throughput throughput_acquire{elapsed, bytes};
+        benchmark_name = std::string{"Benchmark Pool::"} + name + " Acquire() " + std::to_string(thread_count) +
+                         " threads (hits: " + std::to_string(statistics.hits_ - statistics_start.hits_) +
+                         ", misses: " + std::to_string(statistics.misses_ - statistics_start.misses_) + ") ";
+        std::cout << StreamPerformanceIndicators(throughput_acquire, benchmark_name.c_str());
+
+        EXPECT_EQ((statistics.hits_ + statistics.misses_) - (statistics_start.hits_ + statistics_start.misses_),
+                  thread_count * kMessageCount);
+    }
+}
+
+
+TEST(Benchmark_Pool, LTCSHA256) {
+    BenchmarkPool("ltc-sha256");
+}
+
+
+#ifdef OPENSSL
+
+TEST(Benchmark_Pool, OpenSSLSHA256) {
+    BenchmarkPool("openssl-sha256");
+}
+
+#endif
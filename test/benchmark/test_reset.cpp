@@ -0,0 +1,140 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Size of a single message.
+ */
+static std::uint64_t const kMessageSize = 64ul;
+
+
+/**
+ * @brief   Number of messages processed per run.
+ */
+static std::uint64_t const kMessageCount = 100'000ul;
+
+
+/**
+ * @brief   Returns the initialization arguments for an algorithm.
+ * @param   name        name of the algorithm.
+ * @return  The initialization arguments taken from the ipsum lorem text.
+ */
+static std::map<std::string, std::vector<std::byte>> GetInitializationData(std::string const & name) {
+
+    std::map<std::string, std::vector<std::byte>> initialization_data;
+    auto description = headcode::crypt::Factory::GetAlgorithmDescriptions()->at(name);
+    for (auto const & [argument_name, argument_definition] : description.initialization_argument_) {
+        auto argument = headcode::mem::StringToMemory(kIpsumLoremText);
+        argument.resize(argument_definition.size_);
+        initialization_data[argument_name] = argument;
+    }
+
+    return initialization_data;
+}
+
+
+/**
+ * @brief   Processes kMessageCount messages of kMessageSize bytes each: once with a fresh
+ * instance per message and once with a single instance which is Reset() after each message.
+ * Both runs must produce the very same output.
+ * @param   name        name of the algorithm.
+ */
+static void BenchmarkReset(std::string const & name) {
+
+    auto initialization_data = GetInitializationData(name);
+    headcode::crypt::ByteView message{reinterpret_cast<unsigned char const *>(kIpsumLoremText.c_str()), kMessageSize};
+
+    std::vector<std::byte> result_create;
+    std::vector<std::byte> result_reset;
+    std::vector<std::byte> block_outgoing;
+    std::vector<std::byte> block_final;
+
+    // create, initialize, add, finalize and drop an instance per message
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr);
+        ASSERT_EQ(algo->Initialize(initialization_data), 0);
+        ASSERT_EQ(algo->Add(message, block_outgoing), 0);
+        ASSERT_EQ(algo->Finalize(block_final), 0);
+        if (i == 0) {
+            result_create = block_outgoing;
+            result_create.insert(result_create.end(), block_final.begin(), block_final.end());
+        }
+    }
+    auto elapsed = headcode::benchmark::GetElapsedMicroSeconds(time_start);
+
+    headcode::benchmark::Throughput throughput_create{elapsed, kMessageCount * kMessageSize};
+    auto benchmark_name = std::string{"Benchmark Reset::"} + name + " create per message (" +
+                          std::to_string(elapsed * 1000.0 / static_cast<double>(kMessageCount)) + " ns/message) ";
+    std::cout << StreamPerformanceIndicators(throughput_create, benchmark_name.c_str());
+
+    // a single instance reset after each message
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(initialization_data), 0);
+
+    time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+        ASSERT_EQ(algo->Add(message, block_outgoing), 0);
+        ASSERT_EQ(algo->Finalize(block_final), 0);
+        if (i == kMessageCount - 1) {
+            result_reset = block_outgoing;
+            result_reset.insert(result_reset.end(), block_final.begin(), block_final.end());
+        }
+        ASSERT_EQ(algo->Reset(), 0);
+    }
+    elapsed = headcode::benchmark::GetElapsedMicroSeconds(time_start);
+
+    headcode::benchmark::Throughput throughput_reset{elapsed, kMessageCount * kMessageSize};
+    benchmark_name = std::string{"Benchmark Reset::"} + name + " reset per message (" +
+                     std::to_string(elapsed * 1000.0 / static_cast<double>(kMessageCount)) + " ns/message) ";
+    std::cout << StreamPerformanceIndicators(throughput_reset, benchmark_name.c_str());
+
+    ASSERT_FALSE(result_create.empty());
+    ASSERT_EQ(result_reset.size(), result_create.size());
+    EXPECT_EQ(std::memcmp(result_reset.data(), result_create.data(), result_create.size()), 0);
+}
+
+
+TEST(Benchmark_Reset, LTCSHA256) {
+    BenchmarkReset("ltc-sha256");
+}
+
+
+TEST(Benchmark_Reset, LTCAES128CBC) {
+    BenchmarkReset("ltc-aes-128-cbc-encryptor");
+}
+
+
+#ifdef OPENSSL
+
+TEST(Benchmark_Reset, OpenSSLSHA256) {
+    BenchmarkReset("openssl-sha256");
+}
+
+
+TEST(Benchmark_Reset, OpenSSLAES128CBC) {
+    BenchmarkReset("openssl-aes-128-cbc-encryptor");
+}
+
+#endif
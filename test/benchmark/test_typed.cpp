@@ -0,0 +1,142 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include <shared/ipsum_lorem.hpp>
+
+
+/**
+ * @brief   Number of messages processed per run.
+ */
+static std::uint64_t const kMessageCount = 100'000ul;
+
+
+/**
+ * @brief   Prints the result of a single run.
+ * @param   name            name of the run.
+ * @param   elapsed         elapsed microseconds.
+ * @param   message_size    size of a single message.
+ */
+static void Report(std::string const & name, std::uint64_t elapsed, std::uint64_t message_size) {
+    headcode::benchmark::Throughput throughput{elapsed, kMessageCount * message_size};
+    auto benchmark_name = std::string{"Benchmark Typed::"} + name + " message size " + std::to_string(message_size) +
+                          " (" + std::to_string(elapsed * 1000.0 / static_cast<double>(kMessageCount)) +
+                          " ns/message) ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Hashes small messages with the runtime algorithm (reused) and the typed hash.
+ * @param   name        name of the runtime algorithm.
+ */
+template <typename TypedHash>
+static void BenchmarkHash(std::string const & name) {
+
+    for (std::uint64_t message_size : {16ul, 64ul, 256ul, 1024ul}) {
+
+        headcode::crypt::ByteView message{reinterpret_cast<unsigned char const *>(kIpsumLoremText.c_str()),
+                                          message_size};
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr);
+        ASSERT_EQ(algo->Initialize(), 0);
+        std::vector<std::byte> expected;
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            algo->Add(message);
+            algo->Finalize(expected);
+            algo->Reset();
+        }
+        Report(name + " runtime", headcode::benchmark::GetElapsedMicroSeconds(time_start), message_size);
+
+        TypedHash typed_hash;
+        typename TypedHash::Digest digest;
+
+        time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            typed_hash.Add(message);
+            typed_hash.Finalize(digest);
+        }
+        Report(name + " typed", headcode::benchmark::GetElapsedMicroSeconds(time_start), message_size);
+
+        ASSERT_EQ(expected.size(), digest.size());
+        EXPECT_EQ(std::memcmp(digest.data(), expected.data(), expected.size()), 0);
+    }
+}
+
+
+TEST(Benchmark_Typed, LTCSHA256) {
+    BenchmarkHash<headcode::crypt::Hash<headcode::crypt::Sha256, headcode::crypt::Provider::kLTC>>("ltc-sha256");
+}
+
+
+#ifdef OPENSSL
+
+TEST(Benchmark_Typed, OpenSSLSHA256) {
+    BenchmarkHash<headcode::crypt::Hash<headcode::crypt::Sha256, headcode::crypt::Provider::kOpenSSL>>(
+            "openssl-sha256");
+}
+
+#endif
+
+
+TEST(Benchmark_Typed, LTCAES128CBC) {
+
+    auto key = headcode::mem::StringToMemory(kIpsumLoremText);
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory(kIpsumLoremText);
+    iv.resize(16);
+
+    for (std::uint64_t message_size : {16ul, 64ul, 256ul, 1024ul}) {
+
+        headcode::crypt::ByteView message{reinterpret_cast<unsigned char const *>(kIpsumLoremText.c_str()),
+                                          message_size};
+
+        auto algo = headcode::crypt::Factory::Create("ltc-aes-128-cbc-encryptor");
+        ASSERT_NE(algo.get(), nullptr);
+        ASSERT_EQ(algo->Initialize({{"key", key}, {"iv", iv}}), 0);
+        std::vector<std::byte> expected;
+
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            algo->Add(message, expected);
+            algo->Reset();
+        }
+        Report("ltc-aes-128-cbc-encryptor runtime", headcode::benchmark::GetElapsedMicroSeconds(time_start),
+               message_size);
+
+        headcode::crypt::Cipher<headcode::crypt::Aes128Cbc, headcode::crypt::Encryption> typed_cipher;
+        ASSERT_EQ(typed_cipher.Initialize(key, iv), 0);
+        std::vector<std::byte> result{message_size};
+        std::uint64_t result_size = 0;
+
+        time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kMessageCount; ++i) {
+            typed_cipher.Add(message, result, result_size);
+            typed_cipher.Reset();
+        }
+        Report("ltc-aes-128-cbc-encryptor typed", headcode::benchmark::GetElapsedMicroSeconds(time_start),
+               message_size);
+
+        ASSERT_EQ(expected.size(), result_size);
+        EXPECT_EQ(std::memcmp(result.data(), expected.data(), expected.size()), 0);
+    }
+}
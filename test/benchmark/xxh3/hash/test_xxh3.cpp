@@ -0,0 +1,113 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/benchmark/benchmark.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   Size of a buffer (a storage block).
+ */
+static std::uint64_t const kBufferSize = 1024ul * 1024ul;
+
+
+/**
+ * @brief   Number of bytes hashed per throughput run.
+ */
+static std::uint64_t const kSize = 1024ul * 1024ul * 1024ul;
+
+
+/**
+ * @brief   Number of keys hashed per latency run.
+ */
+static std::uint64_t const kKeyCount = 1'000'000ul;
+
+
+/**
+ * @brief   Benchmarks hashing large buffers.
+ * @param   name        name of the hash.
+ */
+static void BenchmarkThroughput(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> buffer(kBufferSize);
+    unsigned char hash[16];
+    auto data = reinterpret_cast<unsigned char const *>(buffer.data());
+    std::uint64_t size_outgoing = 0;
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i < kSize / kBufferSize; ++i) {
+        ASSERT_EQ(algo->Reset(), 0);
+        ASSERT_EQ(algo->Add(data, buffer.size(), nullptr, size_outgoing), 0);
+        ASSERT_EQ(algo->Finalize(hash, sizeof(hash), {}), 0);
+    }
+    headcode::benchmark::Throughput throughput{headcode::benchmark::GetElapsedMicroSeconds(time_start), kSize};
+
+    auto benchmark_name = std::string{"Benchmark "} + name + " (" + std::to_string(kBufferSize) + " byte buffers, " +
+                          algo->GetDescription().provider_ + ") ";
+    std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+}
+
+
+/**
+ * @brief   Benchmarks hashing small keys (hash table and cache keys) one after the other.
+ * @param   name        name of the hash.
+ */
+static void BenchmarkLatency(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> keys(kKeyCount + 256);
+    for (std::uint64_t i = 0; i < keys.size(); ++i) {
+        keys[i] = static_cast<std::byte>(i % 251);
+    }
+    unsigned char hash[16];
+    std::uint64_t size_outgoing = 0;
+
+    for (std::uint64_t key_size : {8ul, 16ul, 32ul, 64ul, 128ul, 256ul}) {
+
+        // a key a byte further on each time: the hash can not be hoisted out of the loop
+        auto time_start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < kKeyCount; ++i) {
+            algo->Reset();
+            algo->Add(reinterpret_cast<unsigned char const *>(keys.data()) + i, key_size, nullptr, size_outgoing);
+            algo->Finalize(hash, sizeof(hash), {});
+        }
+        auto elapsed = headcode::benchmark::GetElapsedMicroSeconds(time_start);
+        headcode::benchmark::Throughput throughput{elapsed, kKeyCount * key_size};
+
+        auto benchmark_name = std::string{"Benchmark "} + name + " key size " + std::to_string(key_size) + " (" +
+                              std::to_string(elapsed * 1000.0 / static_cast<double>(kKeyCount)) + " ns/hash) ";
+        std::cout << StreamPerformanceIndicators(throughput, benchmark_name.c_str());
+    }
+}
+
+
+TEST(Benchmark_XXH3, XXH3_64) {
+    BenchmarkThroughput("hcs-xxh3-64");
+    BenchmarkLatency("hcs-xxh3-64");
+}
+
+
+TEST(Benchmark_XXH3, XXH3_128) {
+    BenchmarkThroughput("hcs-xxh3-128");
+    BenchmarkLatency("hcs-xxh3-128");
+}
@@ -0,0 +1,279 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Computes the CRC-64 bit by bit.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The checksum.
+ */
+static std::uint64_t ReferenceCRC64(std::byte const * data, std::uint64_t size) {
+    std::uint64_t crc = ~0ul;
+    for (std::uint64_t i = 0; i < size; ++i) {
+        crc ^= static_cast<std::uint64_t>(data[i]);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xc96c5795d7870f42ul : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+
+/**
+ * @brief   Runs data through the checksum.
+ * @param   algo        the algorithm.
+ * @param   data        the data.
+ * @param   size        size of the data.
+ * @return  The checksum as number.
+ */
+static std::uint64_t Checksum(headcode::crypt::Algorithm * algo, std::byte const * data, std::uint64_t size) {
+    EXPECT_EQ(algo->Reset(), 0);
+    EXPECT_EQ(algo->Add(headcode::crypt::ByteView{data, size}), 0);
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+    std::uint64_t crc = 0;
+    for (auto b : checksum) {
+        crc = (crc << 8) | static_cast<std::uint64_t>(b);
+    }
+    return crc;
+}
+
+
+TEST(Checksum_CRC64, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-crc64");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kChecksum);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 8ul);
+    EXPECT_TRUE(description.initialization_argument_.empty());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Checksum_CRC64, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+    EXPECT_EQ(checksum.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"4a3e70ba6ffe2db4"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+}
+
+
+TEST(Checksum_CRC64, check) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // the check value of the catalogue of parametrised CRC algorithms
+    EXPECT_EQ(algo->Add(std::string{"123456789"}), 0);
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+
+    auto expected = std::string{"995dc9bbdf1939fa"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+}
+
+
+TEST(Checksum_CRC64, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-crc64");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+    EXPECT_EQ(checksum.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"169b28a7b587d7b3"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Checksum_CRC64, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+
+    auto expected = std::string{"169b28a7b587d7b3"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+}
+
+
+TEST(Checksum_CRC64, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+    EXPECT_EQ(checksum.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"0000000000000000"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+}
+
+
+TEST(Checksum_CRC64, sizes) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // the kernel of the CPU has to agree with the bits on any size at any alignment
+    std::vector<std::byte> input(70000);
+    for (std::uint64_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<std::byte>((i * 7 + i / 251) & 0xff);
+    }
+    std::vector<std::uint64_t> sizes;
+    for (std::uint64_t size = 0; size <= 300; ++size) {
+        sizes.push_back(size);
+    }
+    sizes.insert(sizes.end(), {767ul, 768ul, 769ul, 4095ul, 24575ul, 24576ul, 24577ul, 69992ul});
+    for (auto size : sizes) {
+        for (std::uint64_t offset = 0; offset < 8; ++offset) {
+            EXPECT_EQ(Checksum(algo.get(), input.data() + offset, size), ReferenceCRC64(input.data() + offset, size))
+                    << "size: " << size << ", offset: " << offset;
+        }
+    }
+}
+
+
+TEST(Checksum_CRC64, parallel) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // slices run through registers of their own on many threads: the checksum stays the same
+    std::vector<std::byte> input(3ul * 1024ul * 1024ul + 5ul);
+    for (std::uint64_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<std::byte>(i % 251);
+    }
+    auto expected = ReferenceCRC64(input.data(), input.size());
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (auto const & setting : {headcode::crypt::Parallelism{headcode::crypt::Parallelism::kDefaultThreshold, 1},
+                                 headcode::crypt::Parallelism{1, 0},
+                                 headcode::crypt::Parallelism{1, 3},
+                                 headcode::crypt::Parallelism{1, 16}}) {
+        headcode::crypt::SetParallelism(setting);
+        EXPECT_EQ(Checksum(algo.get(), input.data(), input.size()), expected) << "threads: " << setting.threads_;
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(Checksum_CRC64, combine) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    auto expected = Checksum(algo.get(), text.data(), text.size());
+    for (std::uint64_t split : {0ul, 1ul, 100ul, 1000ul, text.size() - 1, text.size()}) {
+        auto crc_a = Checksum(algo.get(), text.data(), split);
+        auto crc_b = Checksum(algo.get(), text.data() + split, text.size() - split);
+        EXPECT_EQ(headcode::crypt::CombineCRC64(crc_a, crc_b, text.size() - split), expected) << "split: " << split;
+    }
+}
+
+
+TEST(Checksum_CRC64, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char checksum[7];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{checksum, sizeof(checksum)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Checksum_CRC64, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> checksum;
+    EXPECT_EQ(algo->Finalize(checksum), 0);
+
+    auto expected = std::string{"169b28a7b587d7b3"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Checksum_CRC64, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-crc64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    auto expected = std::string{"169b28a7b587d7b3"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> checksum;
+        EXPECT_EQ(algo->Finalize(checksum), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(checksum).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+}
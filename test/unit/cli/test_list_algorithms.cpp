@@ -32,6 +32,19 @@ static std::set<std::string> const kAlgorithms{
         "openssl-aes-128-cbc-encryptor",
         "openssl-aes-256-cbc-decryptor",
         "openssl-aes-128-cbc-decryptor",
+        "openssl-aes-128-ctr",
+        "openssl-aes-192-ctr",
+        "openssl-aes-256-ctr",
+        "openssl-aes-128-gcm-encryptor",
+        "openssl-aes-128-gcm-decryptor",
+        "openssl-aes-256-gcm-encryptor",
+        "openssl-aes-256-gcm-decryptor",
+        "openssl-aes-128-xts-encryptor",
+        "openssl-aes-128-xts-decryptor",
+        "openssl-aes-256-xts-encryptor",
+        "openssl-aes-256-xts-decryptor",
+        "openssl-chacha20-poly1305-encryptor",
+        "openssl-chacha20-poly1305-decryptor",
         "ltc-aes-256-ecb-encryptor",
         "ltc-aes-192-ecb-decryptor",
         "ltc-aes-256-ecb-decryptor",
@@ -44,18 +57,54 @@ static std::set<std::string> const kAlgorithms{
         "ltc-aes-192-cbc-decryptor",
         "ltc-aes-128-cbc-encryptor",
         "ltc-aes-256-cbc-encryptor",
+        "ltc-aesni-aes-128-ecb-encryptor",
+        "ltc-aesni-aes-128-ecb-decryptor",
+        "ltc-aesni-aes-128-cbc-encryptor",
+        "ltc-aesni-aes-128-cbc-decryptor",
+        "ltc-aesni-aes-192-ecb-encryptor",
+        "ltc-aesni-aes-192-ecb-decryptor",
+        "ltc-aesni-aes-192-cbc-encryptor",
+        "ltc-aesni-aes-192-cbc-decryptor",
+        "ltc-aesni-aes-256-ecb-encryptor",
+        "ltc-aesni-aes-256-ecb-decryptor",
+        "ltc-aesni-aes-256-cbc-encryptor",
+        "ltc-aesni-aes-256-cbc-decryptor",
+        "ltc-aes-128-ctr",
+        "ltc-aes-192-ctr",
+        "ltc-aes-256-ctr",
+        "ltc-aes-128-gcm-encryptor",
+        "ltc-aes-128-gcm-decryptor",
+        "ltc-aes-256-gcm-encryptor",
+        "ltc-aes-256-gcm-decryptor",
+        "ltc-aes-128-xts-encryptor",
+        "ltc-aes-128-xts-decryptor",
+        "ltc-aes-256-xts-encryptor",
+        "ltc-aes-256-xts-decryptor",
+        "ltc-chacha20",
+        "ltc-chacha20-poly1305-encryptor",
+        "ltc-chacha20-poly1305-decryptor",
         "copy",
         "openssl-md5",
         "openssl-sha1",
         "openssl-ripemd160",
         "openssl-sha384",
         "openssl-sha512",
+        "openssl-sha512-224",
+        "openssl-sha512-256",
         "openssl-sha256",
         "openssl-sha224",
         "ltc-ripemd320",
         "ltc-sha224",
         "ltc-tiger192",
         "ltc-sha512",
+        "ltc-sha512-224",
+        "ltc-sha512-256",
+        "ltc-sha3-224",
+        "ltc-sha3-256",
+        "ltc-sha3-384",
+        "ltc-sha3-512",
+        "ltc-shake128",
+        "ltc-shake256",
         "ltc-ripemd160",
         "ltc-ripemd128",
         "ltc-md5",
@@ -63,6 +112,31 @@ static std::set<std::string> const kAlgorithms{
         "ltc-sha384",
         "ltc-ripemd256",
         "ltc-sha1",
+        "ltc-blake2b-256",
+        "ltc-blake2b-512",
+        "ltc-blake2s-256",
+        "hcs-mb-md5",
+        "hcs-mb-sha1",
+        "hcs-mb-sha256",
+        "hcs-shani-sha1",
+        "hcs-shani-sha224",
+        "hcs-shani-sha256",
+        "hcs-blake2bp",
+        "hcs-blake2sp",
+        "hcs-blake3",
+        "hcs-crc32",
+        "hcs-crc32c",
+        "hcs-crc64",
+        "hcs-xxh3-64",
+        "hcs-xxh3-128",
+        "hcs-siphash-2-4",
+        "hcs-siphash-2-4-128",
+        "ltc-hmac-sha1",
+        "ltc-hmac-sha256",
+        "ltc-hmac-sha512",
+        "openssl-hmac-sha1",
+        "openssl-hmac-sha256",
+        "openssl-hmac-sha512",
         "nohash"};
 
 
@@ -71,7 +145,12 @@ TEST(Crypt_list_algorithms, regular) {
     std::stringstream ss;
     ListAlgorithms(ss);
 
-    static std::set<std::string> const kNonAlgorithmOutput{std::string{}, "Symmetric Ciphers", "Hashes"};
+    static std::set<std::string> const kNonAlgorithmOutput{std::string{},
+                                                           "Symmetric Ciphers",
+                                                           "Hashes",
+                                                           "Checksums",
+                                                           "Non-Cryptographic Hashes",
+                                                           "Message Authentication Codes"};
 
     auto lines = Split(ss.str());
     for (auto const & line : lines) {
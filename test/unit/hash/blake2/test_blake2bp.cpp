@@ -0,0 +1,353 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_BLAKE2BP, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-blake2bp");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 64ul);
+
+    ASSERT_EQ(description.initialization_argument_.size(), 1ul);
+    auto const & key = description.initialization_argument_.at("key");
+    EXPECT_EQ(key.size_, 64ul);
+    EXPECT_TRUE(key.optional_);
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_BLAKE2BP, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "e3c82f707f793ffde046e490ee6e6fa0"
+            "be2def4ff20aa5a63eb0bf9475381301"
+            "f4b041e3fea156aea06d14042c2d6e00"
+            "fb29af53633a2b4b83ae4256d923bb72"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE2BP, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2bp");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "3a16441fcf2af77c5e2f80992d07c266"
+            "fb730f98c57beefd0c607646130cd4a0"
+            "e56f7fbe8e4e22948880dff686ffa151"
+            "26fb39213799c2e636b836d9ba0118e9"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_BLAKE2BP, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2bp");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "3a16441fcf2af77c5e2f80992d07c266"
+            "fb730f98c57beefd0c607646130cd4a0"
+            "e56f7fbe8e4e22948880dff686ffa151"
+            "26fb39213799c2e636b836d9ba0118e9"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE2BP, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2bp");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "b5ef811a8038f70b628fa8b294daae74"
+            "92b1ebe343a80eaabbf1f6ae664dd67b"
+            "9d90b0120791eab81dc96985f28849f6"
+            "a305186a85501b405114bfa678df9380"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE2BP, keyed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // the key is 00 01 02 ... and so is the message (like the BLAKE2 known answer tests)
+    std::vector<std::byte> key(64);
+    for (std::uint64_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<std::byte>(i);
+    }
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul,
+             std::string{
+                    "9d9461073e4eb640a255357b839f394b"
+                    "838c6ff57c9b686a3f76107c1066728f"
+                    "3c9956bd785cbc3bf79dc2ab578c5a0c"
+                    "063b9d9c405848de1dbe821cd05c940a"}},
+            {1ul,
+             std::string{
+                    "ff8e90a37b94623932c59f7559f26035"
+                    "029c376732cb14d41602001cbb73adb7"
+                    "9293a2dbda5f60703025144d158e2735"
+                    "529596251c73c0345ca6fccb1fb1e97e"}},
+            {255ul,
+             std::string{
+                    "96fbcbb60bd313b8845033e5bc058a38"
+                    "027438572d7e7957f3684f6268aadd3a"
+                    "d08d21767ed6878685331ba98571487e"
+                    "12470aad669326716e46667f69f8d7e8"}},
+            {512ul,
+             std::string{
+                    "14ba32c1c80bb32c8282aa53f341f45d"
+                    "aabda12bda41f7ad8ec75baa743a41ad"
+                    "f2376ad3de32fb576d3efdcadf3f59d2"
+                    "5b40b915681cc90dee3a9b2cb02061ea"}},
+            {513ul,
+             std::string{
+                    "2d9af8503c1b107aece8ecc73f2c2a6e"
+                    "cfe3def943ab277bb3323643b8bbd336"
+                    "31e34d0f095a4afb0193b2d44bcd1138"
+                    "3d60ad020472b19f28f3edf3dbcbdcda"}},
+            {1025ul,
+             std::string{
+                    "b1042aeddf0f6e6fd7449c7423587ead"
+                    "f441eb36f792826a94a4d347cd5d78d6"
+                    "e00874077c3c0558308f36e53fbe9e66"
+                    "c8b080eacb144df156e6a8a5fb0945d6"}}};
+
+    for (auto const & [size, digest] : expected) {
+        std::vector<std::byte> message(size);
+        for (std::uint64_t i = 0; i < message.size(); ++i) {
+            message[i] = static_cast<std::byte>(i & 0xff);
+        }
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), digest.c_str()) << "size: " << size;
+    }
+
+    // a key too large is refused
+    key.push_back(std::byte{0});
+    EXPECT_NE(algo->Initialize({{"key", key}}), 0);
+}
+
+
+TEST(Hash_BLAKE2BP, stripes) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // the last stripes are held back until Finalize(): any size and any split of the data must hash alike
+    std::map<std::uint64_t, std::string> const expected = {
+            {1ul,
+             std::string{
+                    "a139280e72757b723e6473d5be59f36e"
+                    "9d50fc5cd7d4585cbc09804895a36c52"
+                    "1242fb2789f85cb9e35491f31d4a6952"
+                    "f9d8e097aef94fa1ca0b12525721f03d"}},
+            {511ul,
+             std::string{
+                    "fa14897433dd69321b1933a1fe101fdd"
+                    "463dc15fffe3f572c0b489bb607edff8"
+                    "b6dd04a23871be993d64af5aaa9b76af"
+                    "482a2363a36c1e6daaef21d3e3ac29c6"}},
+            {512ul,
+             std::string{
+                    "5b3a0e990c4e8c6e5463e763a6686551"
+                    "a129a81ab48c49cd8dc10519dfe2d02d"
+                    "2a451cbba6511775b6a9cb26db88363c"
+                    "dd067ffb7183efe19826678b2fc9f349"}},
+            {513ul,
+             std::string{
+                    "cd79fbbded91823272abb7a97a553060"
+                    "8f0583bd5405c7765156c4d8754ddf43"
+                    "5d6d71b84f83c6381078935e378d4bf0"
+                    "f752b309d1398af578e103e443b8ac55"}},
+            {1024ul,
+             std::string{
+                    "98b6de75c42e1e5cdd6623aca47a1a35"
+                    "9e9aef84f10d6bf125093331d9f5c63f"
+                    "c7a2908b66f51bf068dd213b90f72fb1"
+                    "3da8d7d37cc7b020188df451ffd32684"}},
+            {1025ul,
+             std::string{
+                    "922470cb5ae0fe54810587de238bc407"
+                    "f597ef6b519b1607515a2b467b9592c9"
+                    "89faa496ccf734b8388d3c61a0180f76"
+                    "bb8680f0ae1cdb8538737084c1349832"}},
+            {1536ul,
+             std::string{
+                    "40f965939934e8abbb0e7904a96c58f6"
+                    "be63df67e670a98ed005c0f417235354"
+                    "d3f95f57baae7acd7ae966d4356d3400"
+                    "adf458e14c8eefedb72cdcc11e65e1f4"}},
+            {4096ul,
+             std::string{
+                    "774ed38751554ea2933f2b019c715d65"
+                    "62c50de8af741d5c484cee5de663fb70"
+                    "e2d311a91bb373291c56d0b25943a7be"
+                    "3f11ffd6feba07ad0aad66f610a7a4ff"}},
+            {4097ul,
+             std::string{
+                    "65e1ddc72b56acc924ce51985a0a355b"
+                    "361e874f3328d71aa40d6fd6e22ba7a3"
+                    "bd93c2344bc77acea4cf4afc58dd691f"
+                    "500e45983eb98f716de5fd1753d90fe3"}},
+            {10000ul,
+             std::string{
+                    "c89f293aa30fa81048807bb9be246aef"
+                    "3752baeae101951369bc2fd97196f4ff"
+                    "7867348cde4cf25cd4c38f32af12745b"
+                    "64593a4b1a3dfcef6499d1842cc6ae80"}}};
+
+    for (auto const & [size, digest] : expected) {
+        std::vector<std::byte> message(size);
+        for (std::uint64_t i = 0; i < message.size(); ++i) {
+            message[i] = static_cast<std::byte>(i & 0xff);
+        }
+        for (std::uint64_t chunk_size : {1ul, 100ul, 512ul, 513ul, 1500ul, 20000ul}) {
+            EXPECT_EQ(algo->Reset(), 0);
+            for (std::uint64_t i = 0; i < message.size(); i += chunk_size) {
+                auto chunk_end = std::min(message.size(), i + chunk_size);
+                EXPECT_EQ(algo->Add(std::vector<std::byte>{message.begin() + i, message.begin() + chunk_end}), 0);
+            }
+            std::vector<std::byte> hash;
+            EXPECT_EQ(algo->Finalize(hash), 0);
+            EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), digest.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_BLAKE2BP, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2bp");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "3a16441fcf2af77c5e2f80992d07c266"
+            "fb730f98c57beefd0c607646130cd4a0"
+            "e56f7fbe8e4e22948880dff686ffa151"
+            "26fb39213799c2e636b836d9ba0118e9"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_BLAKE2BP, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2bp");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{
+            "3a16441fcf2af77c5e2f80992d07c266"
+            "fb730f98c57beefd0c607646130cd4a0"
+            "e56f7fbe8e4e22948880dff686ffa151"
+            "26fb39213799c2e636b836d9ba0118e9"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{
+            "b5ef811a8038f70b628fa8b294daae74"
+            "92b1ebe343a80eaabbf1f6ae664dd67b"
+            "9d90b0120791eab81dc96985f28849f6"
+            "a305186a85501b405114bfa678df9380"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
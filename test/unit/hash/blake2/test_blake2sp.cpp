@@ -0,0 +1,261 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_BLAKE2SP, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-blake2sp");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 32ul);
+
+    ASSERT_EQ(description.initialization_argument_.size(), 1ul);
+    auto const & key = description.initialization_argument_.at("key");
+    EXPECT_EQ(key.size_, 32ul);
+    EXPECT_TRUE(key.optional_);
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_BLAKE2SP, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"9adcc03dbd57bb170ddd9efbe748f03695251767828ef6a0f0451b366823ebfd"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE2SP, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2sp");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"583a4a0a5c59b9d30ba8f42be5b3f72e38eead3b6266f95450ed9a547396b3ec"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_BLAKE2SP, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2sp");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"583a4a0a5c59b9d30ba8f42be5b3f72e38eead3b6266f95450ed9a547396b3ec"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE2SP, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2sp");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"dd0e891776933f43c7d032b08a917e25741f8aa9a12c12e1cac8801500f2ca4f"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE2SP, keyed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // the key is 00 01 02 ... and so is the message (like the BLAKE2 known answer tests)
+    std::vector<std::byte> key(32);
+    for (std::uint64_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<std::byte>(i);
+    }
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul,
+             std::string{"715cb13895aeb678f6124160bff21465b30f4f6874193fc851b4621043f09cc6"}},
+            {1ul,
+             std::string{"40578ffa52bf51ae1866f4284d3a157fc1bcd36ac13cbdcb0377e4d0cd0b6603"}},
+            {255ul,
+             std::string{"0c8a36597d7461c63a94732821c941856c668376606c86a52de0ee4104c615db"}},
+            {512ul,
+             std::string{"3246bc18b42253f58d3bc21dd51c14290c0b78d4d9d5274087bff2ca297c51fc"}},
+            {513ul,
+             std::string{"583dc2f1f106e8b85fab4795371576d75eca0fad5a0cc5ede81ad54bd405d873"}},
+            {1025ul,
+             std::string{"95b9c345aa7e1791df0209064837221717b009dd90816a06ae4a83f6e6c12f8d"}}};
+
+    for (auto const & [size, digest] : expected) {
+        std::vector<std::byte> message(size);
+        for (std::uint64_t i = 0; i < message.size(); ++i) {
+            message[i] = static_cast<std::byte>(i & 0xff);
+        }
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), digest.c_str()) << "size: " << size;
+    }
+
+    // a key too large is refused
+    key.push_back(std::byte{0});
+    EXPECT_NE(algo->Initialize({{"key", key}}), 0);
+}
+
+
+TEST(Hash_BLAKE2SP, stripes) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // the last stripes are held back until Finalize(): any size and any split of the data must hash alike
+    std::map<std::uint64_t, std::string> const expected = {
+            {1ul,
+             std::string{"a6b9eecc25227ad788c99d3f236debc8da408849e9a5178978727a81457f7239"}},
+            {511ul,
+             std::string{"50285271956932d39b0967202b56006cbb6d738ee29e5a867edf72c8c4386f1b"}},
+            {512ul,
+             std::string{"322ce06cc141a0b3d89bcdcfcb385975dbca56e5719a78c34000fcec2e15b55d"}},
+            {513ul,
+             std::string{"1336628c7f1541c7815fc0ff1fb5dfb07a85cf5a17a2872a3ce4b322d4a03d0b"}},
+            {1024ul,
+             std::string{"c9f79171d19c3703b7ebf9f762ce3fd24b302e2281f72da31a65014ff923c859"}},
+            {1025ul,
+             std::string{"1cf65560deef7dad5282fa8b42e289d71a43b972b24eb3c8ed4d6e725e5f14ad"}},
+            {1536ul,
+             std::string{"399bf742b49a597858a1b0c2b599f9fd4d6d66204941a893bc79fcf097e9d992"}},
+            {4096ul,
+             std::string{"4256f46f2fde01d76a66f2530cf8ce07816dc441d8f99ab9e28d1af490715912"}},
+            {4097ul,
+             std::string{"ff56cf04d1724a53f37ffea682e83bbcd0033f6fc0dfef6a21dbf621a79eb667"}},
+            {10000ul,
+             std::string{"b29efdd6156fdfd98e4eef8c9b09f033ad6ff21f0edf339e3f78dd91c6a1d9cb"}}};
+
+    for (auto const & [size, digest] : expected) {
+        std::vector<std::byte> message(size);
+        for (std::uint64_t i = 0; i < message.size(); ++i) {
+            message[i] = static_cast<std::byte>(i & 0xff);
+        }
+        for (std::uint64_t chunk_size : {1ul, 100ul, 512ul, 513ul, 1500ul, 20000ul}) {
+            EXPECT_EQ(algo->Reset(), 0);
+            for (std::uint64_t i = 0; i < message.size(); i += chunk_size) {
+                auto chunk_end = std::min(message.size(), i + chunk_size);
+                EXPECT_EQ(algo->Add(std::vector<std::byte>{message.begin() + i, message.begin() + chunk_end}), 0);
+            }
+            std::vector<std::byte> hash;
+            EXPECT_EQ(algo->Finalize(hash), 0);
+            EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), digest.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_BLAKE2SP, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake2sp");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"583a4a0a5c59b9d30ba8f42be5b3f72e38eead3b6266f95450ed9a547396b3ec"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_BLAKE2SP, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake2sp");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{"583a4a0a5c59b9d30ba8f42be5b3f72e38eead3b6266f95450ed9a547396b3ec"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{"dd0e891776933f43c7d032b08a917e25741f8aa9a12c12e1cac8801500f2ca4f"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
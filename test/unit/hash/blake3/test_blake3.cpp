@@ -0,0 +1,399 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   The input of the official BLAKE3 test vectors: bytes 0, 1, ... 250, 0, 1, ...
+ * @param   size        size of the input.
+ * @return  The input.
+ */
+static std::vector<std::byte> GetInput(std::uint64_t size) {
+    std::vector<std::byte> input(size);
+    for (std::uint64_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<std::byte>(i % 251);
+    }
+    return input;
+}
+
+
+/**
+ * @brief   Hashes an input in pieces.
+ * @param   algo            the algorithm.
+ * @param   input           the input.
+ * @param   chunk_size      size of the pieces added.
+ * @return  The digest as hex string.
+ */
+static std::string HashChunked(headcode::crypt::Algorithm * algo,
+                               std::vector<std::byte> const & input,
+                               std::uint64_t chunk_size) {
+    EXPECT_EQ(algo->Reset(), 0);
+    for (std::uint64_t i = 0; i < input.size(); i += chunk_size) {
+        auto chunk_end = std::min(input.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{input.begin() + i, input.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    return headcode::mem::MemoryToHex(hash);
+}
+
+
+TEST(Hash_BLAKE3, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-blake3");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 32ul);
+
+    ASSERT_EQ(description.initialization_argument_.size(), 2ul);
+    auto const & key = description.initialization_argument_.at("key");
+    EXPECT_EQ(key.size_, 32ul);
+    EXPECT_TRUE(key.optional_);
+    auto const & context = description.initialization_argument_.at("context");
+    EXPECT_EQ(context.size_, 0ul);
+    EXPECT_TRUE(context.optional_);
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_BLAKE3, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"4c9bd68d7f0baa2e167cef98295eb1ec99a3ec8f0656b33dbae943b387f31d5d"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE3, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake3");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a5b0b90bf950ef4477cb0cd19694aae12d60ab2317db65e5c38a7e882917f875"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_BLAKE3, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake3");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a5b0b90bf950ef4477cb0cd19694aae12d60ab2317db65e5c38a7e882917f875"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE3, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake3");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_BLAKE3, vectors) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // the official test vectors: any size and any split of the data must hash alike
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul, std::string{"af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"}},
+            {1ul, std::string{"2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213"}},
+            {1023ul, std::string{"10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11"}},
+            {1024ul, std::string{"42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7"}},
+            {1025ul, std::string{"d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444"}},
+            {2048ul, std::string{"e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a"}},
+            {2049ul, std::string{"5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030"}},
+            {3072ul, std::string{"b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2"}},
+            {3073ul, std::string{"7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3"}},
+            {4096ul, std::string{"015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969"}},
+            {4097ul, std::string{"9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995"}},
+            {5120ul, std::string{"9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833"}},
+            {8193ul, std::string{"bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b"}},
+            {16384ul, std::string{"f875d6646de28985646f34ee13be9a576fd515f76b5b0a26bb324735041ddde4"}},
+            {31744ul, std::string{"62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47"}},
+            {102400ul, std::string{"bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085"}}};
+
+    for (auto const & [size, digest] : expected) {
+        auto input = GetInput(size);
+        for (std::uint64_t chunk_size : {1ul, 63ul, 1024ul, 1025ul, 4096ul, 200000ul}) {
+            EXPECT_STREQ(HashChunked(algo.get(), input, chunk_size).c_str(), digest.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_BLAKE3, keyed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory("whats the Elvish word for friend")}}), 0);
+
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul, std::string{"92b2b75604ed3c761f9d6f62392c8a9227ad0ea3f09573e783f1498a4ed60d26"}},
+            {1ul, std::string{"6d7878dfff2f485635d39013278ae14f1454b8c0a3a2d34bc1ab38228a80c95b"}},
+            {1025ul, std::string{"357dc55de0c7e382c900fd6e320acc04146be01db6a8ce7210b7189bd664ea69"}},
+            {8193ul, std::string{"954a2a75420c8d6547e3ba5b98d963e6fa6491addc8c023189cc519821b4a1f5"}},
+            {102400ul, std::string{"1c35d1a5811083fd7119f5d5d1ba027b4d01c0c6c49fb6ff2cf75393ea5db4a7"}}};
+
+    for (auto const & [size, digest] : expected) {
+        auto input = GetInput(size);
+        for (std::uint64_t chunk_size : {1000ul, 200000ul}) {
+            EXPECT_STREQ(HashChunked(algo.get(), input, chunk_size).c_str(), digest.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+
+    // the key must be 32 bytes
+    EXPECT_NE(algo->Initialize({{"key", headcode::mem::StringToMemory("whats the Elvish word")}}), 0);
+}
+
+
+TEST(Hash_BLAKE3, derive_key) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    auto context = headcode::mem::StringToMemory("BLAKE3 2019-12-27 16:29:52 test vectors context");
+    ASSERT_EQ(algo->Initialize({{"context", context}}), 0);
+
+    // the data added is the key material
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul, std::string{"2cc39783c223154fea8dfb7c1b1660f2ac2dcbd1c1de8277b0b0dd39b7e50d7d"}},
+            {1ul, std::string{"b3e2e340a117a499c6cf2398a19ee0d29cca2bb7404c73063382693bf66cb06c"}},
+            {1025ul, std::string{"effaa245f065fbf82ac186839a249707c3bddf6d3fdda22d1b95a3c970379bcb"}},
+            {8193ul, std::string{"af1e0346e389b17c23200270a64aa4e1ead98c61695d917de7d5b00491c9b0f1"}},
+            {102400ul, std::string{"4652cff7a3f385a6103b5c260fc1593e13c778dbe608efb092fe7ee69df6e9c6"}}};
+
+    for (auto const & [size, digest] : expected) {
+        auto input = GetInput(size);
+        for (std::uint64_t chunk_size : {1000ul, 200000ul}) {
+            EXPECT_STREQ(HashChunked(algo.get(), input, chunk_size).c_str(), digest.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+
+    // either a key or a context
+    auto key = headcode::mem::StringToMemory("whats the Elvish word for friend");
+    EXPECT_NE(algo->Initialize({{"key", key}, {"context", context}}), 0);
+}
+
+
+TEST(Hash_BLAKE3, extendable_output) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // Finalize() into memory of any size: the default digest is the start of the output
+    auto expected = std::string{
+            "d00278ae47eb27b34faecf67b4fe263f"
+            "82d5412916c1ffd97c8cb7fb814b8444"
+            "f4c4a22b4b399155358a994e52bf255d"
+            "e60035742ec71bd08ac275a1b51cc6bf"
+            "e332b0ef84b409108cda080e6269ed4b"
+            "3e2c3f7d722aa4cdc98d16deb554e562"
+            "7be8f955c98e1d5f9565a9194cad0c42"
+            "85f93700062d9595adb992ae68ff1280"
+            "0ab67a"};
+    auto input = GetInput(1025);
+    for (std::uint64_t size : {131ul, 64ul, 33ul, 32ul, 7ul, 1ul}) {
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(input), 0);
+        std::vector<std::byte> hash(size);
+        EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash}), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.substr(0, 2 * size).c_str()) << size;
+    }
+}
+
+
+TEST(Hash_BLAKE3, squeeze) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // nothing to squeeze before Finalize()
+    std::vector<std::byte> piece(7);
+    EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}),
+              static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+
+    // the output squeezed piece by piece is the output written at once
+    auto expected = std::string{
+            "d00278ae47eb27b34faecf67b4fe263f"
+            "82d5412916c1ffd97c8cb7fb814b8444"
+            "f4c4a22b4b399155358a994e52bf255d"
+            "e60035742ec71bd08ac275a1b51cc6bf"
+            "e332b0ef84b409108cda080e6269ed4b"
+            "3e2c3f7d722aa4cdc98d16deb554e562"
+            "7be8f955c98e1d5f9565a9194cad0c42"
+            "85f93700062d9595adb992ae68ff1280"
+            "0ab67afea516f221cf7d1f8434fc36d8"
+            "f6fbdf38d445c44d96ba3bb1d4a2e2ae"
+            "9a53fd46d39307628a47f890cab6ac33"
+            "3aad48c0c11edf69e2a6437e8abf42d3"
+            "35327eee"};
+    EXPECT_EQ(algo->Add(GetInput(1025)), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    std::string output = headcode::mem::MemoryToHex(hash);
+    for (std::uint64_t size : {1ul, 0ul, 31ul, 64ul, 65ul, 3ul}) {
+        piece.resize(size);
+        EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}), 0);
+        output += headcode::mem::MemoryToHex(piece);
+    }
+    EXPECT_STREQ(output.c_str(), expected.c_str());
+
+    // a reset drops the output
+    EXPECT_EQ(algo->Reset(), 0);
+    EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}),
+              static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+}
+
+
+TEST(Hash_BLAKE3, parallel) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+    auto keyed = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(keyed.get(), nullptr);
+    EXPECT_EQ(keyed->Initialize({{"key", headcode::mem::StringToMemory("whats the Elvish word for friend")}}), 0);
+
+    // large subtrees are hashed on many threads: the digest stays the same
+    auto input = GetInput(3ul * 1024ul * 1024ul + 5ul);
+    auto expected = std::string{"a7bb55bed0c04f58879d1fc1cafb27e14e931f4411fe63baf5b2d5a60357bffb"};
+    auto expected_keyed = std::string{"77433d2b54044bbdef84fde55f3f5d93aff2f0ce51ec3225bd3ee316207f0b92"};
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (auto const & setting : {headcode::crypt::Parallelism{headcode::crypt::Parallelism::kDefaultThreshold, 1},
+                                 headcode::crypt::Parallelism{1, 0},
+                                 headcode::crypt::Parallelism{1, 3},
+                                 headcode::crypt::Parallelism{1, 16}}) {
+        headcode::crypt::SetParallelism(setting);
+        for (std::uint64_t chunk_size : {input.size(), 1024ul * 1024ul + 7ul, 3000ul}) {
+            EXPECT_STREQ(HashChunked(algo.get(), input, chunk_size).c_str(), expected.c_str())
+                    << "threads: " << setting.threads_ << ", chunk size: " << chunk_size;
+            EXPECT_STREQ(HashChunked(keyed.get(), input, chunk_size).c_str(), expected_keyed.c_str())
+                    << "threads: " << setting.threads_ << ", chunk size: " << chunk_size;
+        }
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(Hash_BLAKE3, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-blake3");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a5b0b90bf950ef4477cb0cd19694aae12d60ab2317db65e5c38a7e882917f875"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_BLAKE3, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-blake3");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{"a5b0b90bf950ef4477cb0cd19694aae12d60ab2317db65e5c38a7e882917f875"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{"af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
@@ -0,0 +1,208 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_LTCBLAKE2b256, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-blake2b-256");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 32ul);
+
+    ASSERT_EQ(description.initialization_argument_.size(), 1ul);
+    auto const & key = description.initialization_argument_.at("key");
+    EXPECT_EQ(key.size_, 64ul);
+    EXPECT_TRUE(key.optional_);
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_LTCBLAKE2b256, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"69d7d3b0afba81826d27024c17f7f183659ed0812cf27b382eaef9fdc29b5712"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCBLAKE2b256, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-256");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"522b944b07c27bbcc7dd9fc1255e3b6f419edbfe604f3f8803ed22f40ff1ec6d"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCBLAKE2b256, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-256");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"522b944b07c27bbcc7dd9fc1255e3b6f419edbfe604f3f8803ed22f40ff1ec6d"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCBLAKE2b256, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-256");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"0e5751c026e543b2e8ab2eb06099daa1d1e5df47778f7787faab45cdf12fe3a8"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCBLAKE2b256, keyed) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // the key is 00 01 02 ... and so is the message (like the BLAKE2 known answer tests)
+    std::vector<std::byte> key(64);
+    for (std::uint64_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<std::byte>(i);
+    }
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul,
+             std::string{"2fa9fbd9be36437de204e139e97d402bce68c828f43391608c891b5faed8a98a"}},
+            {1ul,
+             std::string{"34758b647135628297fb09c7930cd04e9528e5669112f5b1318493e14de77e55"}},
+            {3ul,
+             std::string{"3e57c5ab79418defd6e252719a380096d9abf1901db38e0be7d404eb7206c0dc"}},
+            {255ul,
+             std::string{"fe7b76a61787c089141f9e10fca1e5092488d89c62ea793fb2c5b1f849b4f2cb"}}};
+
+    for (auto const & [size, digest] : expected) {
+        std::vector<std::byte> message(size);
+        for (std::uint64_t i = 0; i < message.size(); ++i) {
+            message[i] = static_cast<std::byte>(i & 0xff);
+        }
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), digest.c_str()) << "size: " << size;
+    }
+
+    // a key too large is refused
+    key.push_back(std::byte{0});
+    EXPECT_NE(algo->Initialize({{"key", key}}), 0);
+}
+
+
+TEST(Hash_LTCBLAKE2b256, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-256");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"522b944b07c27bbcc7dd9fc1255e3b6f419edbfe604f3f8803ed22f40ff1ec6d"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCBLAKE2b256, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{"522b944b07c27bbcc7dd9fc1255e3b6f419edbfe604f3f8803ed22f40ff1ec6d"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{"0e5751c026e543b2e8ab2eb06099daa1d1e5df47778f7787faab45cdf12fe3a8"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
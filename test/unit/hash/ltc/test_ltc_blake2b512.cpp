@@ -0,0 +1,252 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_LTCBLAKE2b512, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-blake2b-512");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 64ul);
+
+    ASSERT_EQ(description.initialization_argument_.size(), 1ul);
+    auto const & key = description.initialization_argument_.at("key");
+    EXPECT_EQ(key.size_, 64ul);
+    EXPECT_TRUE(key.optional_);
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_LTCBLAKE2b512, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "87af9dc4afe5651b7aa89124b905fd21"
+            "4bf17c79af58610db86a0fb1e0194622"
+            "a4e9d8e395b352223a8183b0d421c099"
+            "4b98286cbf8c68a495902e0fe6e2bda2"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCBLAKE2b512, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-512");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "23581838711728997751e446436c673e"
+            "b23ce03852ae399dac454b581a41b24c"
+            "a3584c86bf4238ea5e0ac1fc6c01dc90"
+            "0ab864c343289cbb65f60d33c12865eb"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCBLAKE2b512, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-512");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "23581838711728997751e446436c673e"
+            "b23ce03852ae399dac454b581a41b24c"
+            "a3584c86bf4238ea5e0ac1fc6c01dc90"
+            "0ab864c343289cbb65f60d33c12865eb"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCBLAKE2b512, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-512");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "786a02f742015903c6c6fd852552d272"
+            "912f4740e15847618a86e217f71f5419"
+            "d25e1031afee585313896444934eb04b"
+            "903a685b1448b755d56f701afe9be2ce"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCBLAKE2b512, keyed) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // the key is 00 01 02 ... and so is the message (like the BLAKE2 known answer tests)
+    std::vector<std::byte> key(64);
+    for (std::uint64_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<std::byte>(i);
+    }
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    std::map<std::uint64_t, std::string> const expected = {
+            {0ul,
+             std::string{
+                    "10ebb67700b1868efb4417987acf4690"
+                    "ae9d972fb7a590c2f02871799aaa4786"
+                    "b5e996e8f0f4eb981fc214b005f42d2f"
+                    "f4233499391653df7aefcbc13fc51568"}},
+            {1ul,
+             std::string{
+                    "961f6dd1e4dd30f63901690c512e78e4"
+                    "b45e4742ed197c3c5e45c549fd25f2e4"
+                    "187b0bc9fe30492b16b0d0bc4ef9b0f3"
+                    "4c7003fac09a5ef1532e69430234cebd"}},
+            {3ul,
+             std::string{
+                    "33d0825dddf7ada99b0e7e307104ad07"
+                    "ca9cfd9692214f1561356315e784f3e5"
+                    "a17e364ae9dbb14cb2036df932b77f4b"
+                    "292761365fb328de7afdc6d8998f5fc1"}},
+            {255ul,
+             std::string{
+                    "142709d62e28fcccd0af97fad0f8465b"
+                    "971e82201dc51070faa0372aa43e9248"
+                    "4be1c1e73ba10906d5d1853db6a4106e"
+                    "0a7bf9800d373d6dee2d46d62ef2a461"}}};
+
+    for (auto const & [size, digest] : expected) {
+        std::vector<std::byte> message(size);
+        for (std::uint64_t i = 0; i < message.size(); ++i) {
+            message[i] = static_cast<std::byte>(i & 0xff);
+        }
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), digest.c_str()) << "size: " << size;
+    }
+
+    // a key too large is refused
+    key.push_back(std::byte{0});
+    EXPECT_NE(algo->Initialize({{"key", key}}), 0);
+}
+
+
+TEST(Hash_LTCBLAKE2b512, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-blake2b-512");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "23581838711728997751e446436c673e"
+            "b23ce03852ae399dac454b581a41b24c"
+            "a3584c86bf4238ea5e0ac1fc6c01dc90"
+            "0ab864c343289cbb65f60d33c12865eb"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCBLAKE2b512, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-blake2b-512");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{
+            "23581838711728997751e446436c673e"
+            "b23ce03852ae399dac454b581a41b24c"
+            "a3584c86bf4238ea5e0ac1fc6c01dc90"
+            "0ab864c343289cbb65f60d33c12865eb"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{
+            "786a02f742015903c6c6fd852552d272"
+            "912f4740e15847618a86e217f71f5419"
+            "d25e1031afee585313896444934eb04b"
+            "903a685b1448b755d56f701afe9be2ce"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
@@ -0,0 +1,249 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_LTCSHAKE128, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-shake128");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 32ul);
+    EXPECT_TRUE(description.initialization_argument_.empty());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_LTCSHAKE128, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"634069e6b13c3af64c57f05babf5911b6acf1d309b9624fc92b0c0bd9f27f538"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCSHAKE128, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake128");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"0d084c21ba25014812b861d0c45d95cc29b00f9c35edee037d2b3b8d458fc118"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCSHAKE128, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake128");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"0d084c21ba25014812b861d0c45d95cc29b00f9c35edee037d2b3b8d458fc118"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCSHAKE128, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake128");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCSHAKE128, extendable_output) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // Finalize() into memory of any size: the default digest is the start of the output
+    auto expected = std::string{
+            "634069e6b13c3af64c57f05babf5911b"
+            "6acf1d309b9624fc92b0c0bd9f27f538"
+            "6331af1672c94b194ce623030744b31e"
+            "848b7309ee7182c4319a1f67f8644d20"
+            "34039832313286eb06af2e3fa8d3caa8"
+            "9c72638f9d1b26151d904ed006bd9ae7"
+            "688f99f57d4195c5cee9eb51508c4916"
+            "9df4c5ee6588e458a69fdc7878215555"
+            "0ef567e503b355d906417cb85e30e715"
+            "6e53af8be5b0858955c46e21e6fa777b"
+            "7e351c8dba47949f33b00deef231afc3"
+            "b861aaf543a8a3db940f8309d1facd1f"
+            "684ac021c61432db"};
+    for (std::uint64_t size : {200ul, 168ul, 136ul, 65ul, 32ul, 1ul}) {
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(std::string{"The quick brown fox jumps over the lazy dog."}), 0);
+        std::vector<std::byte> hash(size);
+        EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash}), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.substr(0, 2 * size).c_str()) << size;
+    }
+
+    // but not into nothing
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_NE(algo->Finalize(headcode::crypt::MutableByteView{hash}), 0);
+}
+
+
+TEST(Hash_LTCSHAKE128, squeeze) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // nothing to squeeze before Finalize()
+    std::vector<std::byte> piece(7);
+    EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}),
+              static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+
+    // the output squeezed piece by piece is the output written at once
+    auto expected = std::string{
+            "634069e6b13c3af64c57f05babf5911b"
+            "6acf1d309b9624fc92b0c0bd9f27f538"
+            "6331af1672c94b194ce623030744b31e"
+            "848b7309ee7182c4319a1f67f8644d20"
+            "34039832313286eb06af2e3fa8d3caa8"
+            "9c72638f9d1b26151d904ed006bd9ae7"
+            "688f99f57d4195c5cee9eb51508c4916"
+            "9df4c5ee6588e458a69fdc7878215555"
+            "0ef567e503b355d906417cb85e30e715"
+            "6e53af8be5b0858955c46e21e6fa777b"
+            "7e351c8dba47949f33b00deef231afc3"
+            "b861aaf543a8a3db940f8309d1facd1f"
+            "684ac021c61432dba58fa4a2a5148fd0"
+            "edc6e6987d9783850e3f7c517986d875"
+            "25f6e9856987e669ef38e0b3b7996c87"
+            "77d657d4aac1885b8f2cfeed70e645c8"
+            "69f32d31945565cb2a7d981958d393f8"
+            "005dbffb0c00dfccc8f0d6111729f3a6"
+            "4e69d2fd4399de6c11635a6a"};
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox jumps over the lazy dog."}), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    std::string output = headcode::mem::MemoryToHex(hash);
+    for (std::uint64_t size : {1ul, 0ul, 7ul, 63ul, 64ul, 135ul, 0ul}) {
+        piece.resize(size);
+        EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}), 0);
+        output += headcode::mem::MemoryToHex(piece);
+    }
+    EXPECT_STREQ(output.c_str(), expected.c_str());
+
+    // a reset drops the output
+    EXPECT_EQ(algo->Reset(), 0);
+    EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}),
+              static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+}
+
+
+TEST(Hash_LTCSHAKE128, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake128");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"0d084c21ba25014812b861d0c45d95cc29b00f9c35edee037d2b3b8d458fc118"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCSHAKE128, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{"0d084c21ba25014812b861d0c45d95cc29b00f9c35edee037d2b3b8d458fc118"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{"7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
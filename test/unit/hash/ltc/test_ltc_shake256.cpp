@@ -0,0 +1,277 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_LTCSHAKE256, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-shake256");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 64ul);
+    EXPECT_TRUE(description.initialization_argument_.empty());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_LTCSHAKE256, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "bd225bfc8b255f3036f0c8866010ed00"
+            "53b5163a3cae111e723c0c8e704eca4e"
+            "5d0f1e2a2fa18c8a219de6b88d5917ff"
+            "5dd75b5fb345e7409a3b333b508a65fb"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCSHAKE256, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake256");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "844abd0fa5ba77fe13ac1bc1d80543ea"
+            "2771f6e33a78eab67cc08514e33104df"
+            "3963ce137bef508127ee8350cd954590"
+            "05e3f36305d0dd375375e9c162f7027b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCSHAKE256, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake256");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "844abd0fa5ba77fe13ac1bc1d80543ea"
+            "2771f6e33a78eab67cc08514e33104df"
+            "3963ce137bef508127ee8350cd954590"
+            "05e3f36305d0dd375375e9c162f7027b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCSHAKE256, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake256");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "46b9dd2b0ba88d13233b3feb743eeb24"
+            "3fcd52ea62b81b82b50c27646ed5762f"
+            "d75dc4ddd8c0f200cb05019d67b592f6"
+            "fc821c49479ab48640292eacb3b7c4be"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_LTCSHAKE256, extendable_output) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // Finalize() into memory of any size: the default digest is the start of the output
+    auto expected = std::string{
+            "bd225bfc8b255f3036f0c8866010ed00"
+            "53b5163a3cae111e723c0c8e704eca4e"
+            "5d0f1e2a2fa18c8a219de6b88d5917ff"
+            "5dd75b5fb345e7409a3b333b508a65fb"
+            "1fd2849dc4f0a7195abce099dc6ac265"
+            "012f542d628417605452f97a67eb737c"
+            "91b75021a8823a8d04a2a0f26530fe4d"
+            "42b41be8830cabf5929b43bb4cafc635"
+            "0b4105f852f1ef2b536ea572a1eae0bd"
+            "2c77a005b3499806a03b986c3b53f61a"
+            "f81e5f9cf5c010d10eea427793ba0100"
+            "ee1a89864708b979ca55381c2bfb8d10"
+            "5b6c0d4a253a13bf"};
+    for (std::uint64_t size : {200ul, 168ul, 136ul, 65ul, 64ul, 1ul}) {
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(std::string{"The quick brown fox jumps over the lazy dog."}), 0);
+        std::vector<std::byte> hash(size);
+        EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash}), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.substr(0, 2 * size).c_str()) << size;
+    }
+
+    // but not into nothing
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_NE(algo->Finalize(headcode::crypt::MutableByteView{hash}), 0);
+}
+
+
+TEST(Hash_LTCSHAKE256, squeeze) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // nothing to squeeze before Finalize()
+    std::vector<std::byte> piece(7);
+    EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}),
+              static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+
+    // the output squeezed piece by piece is the output written at once
+    auto expected = std::string{
+            "bd225bfc8b255f3036f0c8866010ed00"
+            "53b5163a3cae111e723c0c8e704eca4e"
+            "5d0f1e2a2fa18c8a219de6b88d5917ff"
+            "5dd75b5fb345e7409a3b333b508a65fb"
+            "1fd2849dc4f0a7195abce099dc6ac265"
+            "012f542d628417605452f97a67eb737c"
+            "91b75021a8823a8d04a2a0f26530fe4d"
+            "42b41be8830cabf5929b43bb4cafc635"
+            "0b4105f852f1ef2b536ea572a1eae0bd"
+            "2c77a005b3499806a03b986c3b53f61a"
+            "f81e5f9cf5c010d10eea427793ba0100"
+            "ee1a89864708b979ca55381c2bfb8d10"
+            "5b6c0d4a253a13bf4b42c3218ee1a9da"
+            "4418403e81ef947e99e6ff2b6867d08d"
+            "e4a59e4f504c9768ad26034561b69434"
+            "0d63ca539e5a95b5ef1c4f79e8166bbd"
+            "6099d236fec1a97bf1f5f98c39927053"
+            "50bc3caff31b3e2bfecea243d07f4fba"
+            "52e9a288437b8ae7e72d5c6a"};
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox jumps over the lazy dog."}), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    std::string output = headcode::mem::MemoryToHex(hash);
+    for (std::uint64_t size : {1ul, 0ul, 7ul, 63ul, 64ul, 135ul, 0ul}) {
+        piece.resize(size);
+        EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}), 0);
+        output += headcode::mem::MemoryToHex(piece);
+    }
+    EXPECT_STREQ(output.c_str(), expected.c_str());
+
+    // a reset drops the output
+    EXPECT_EQ(algo->Reset(), 0);
+    EXPECT_EQ(algo->Squeeze(headcode::crypt::MutableByteView{piece}),
+              static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+}
+
+
+TEST(Hash_LTCSHAKE256, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "ltc-shake256");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{
+            "844abd0fa5ba77fe13ac1bc1d80543ea"
+            "2771f6e33a78eab67cc08514e33104df"
+            "3963ce137bef508127ee8350cd954590"
+            "05e3f36305d0dd375375e9c162f7027b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_LTCSHAKE256, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-shake256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{
+            "844abd0fa5ba77fe13ac1bc1d80543ea"
+            "2771f6e33a78eab67cc08514e33104df"
+            "3963ce137bef508127ee8350cd954590"
+            "05e3f36305d0dd375375e9c162f7027b"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{
+            "46b9dd2b0ba88d13233b3feb743eeb24"
+            "3fcd52ea62b81b82b50c27646ed5762f"
+            "d75dc4ddd8c0f200cb05019d67b592f6"
+            "fc821c49479ab48640292eacb3b7c4be"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
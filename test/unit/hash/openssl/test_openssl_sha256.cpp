@@ -6,6 +6,8 @@
  * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
  */
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include <headcode/crypt/crypt.hpp>
@@ -73,6 +75,29 @@ TEST(Hash_OPENSSLSHA256, regular) {
 }
 
 
+TEST(Hash_OPENSSLSHA256, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("openssl-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "openssl-sha256");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // odd sized chunks are collected and padded only once at the very end
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"8372e8dc1413d0636d8db66e5f8f4f885e703e67c736aa80a881ac400dc8613b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
 TEST(Hash_OPENSSLSHA256, empty) {
 
     auto algo = headcode::crypt::Factory::Create("openssl-sha256");
@@ -106,3 +131,33 @@ TEST(Hash_OPENSSLSHA256, noinit) {
     EXPECT_FALSE(algo->IsInitialized());
     EXPECT_TRUE(algo->IsFinalized());
 }
+
+
+TEST(Hash_OPENSSLSHA256, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("openssl-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // a reset instance hashes like a fresh one
+    auto expected = std::string{"8372e8dc1413d0636d8db66e5f8f4f885e703e67c736aa80a881ac400dc8613b"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_TRUE(algo->IsFinalized());
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // reset drops any data added so far
+    EXPECT_EQ(algo->Add(std::string{"The quick brown fox"}), 0);
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    expected = std::string{"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
@@ -0,0 +1,139 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_SHANISHA1, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-shani-sha1");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 64ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 20ul);
+
+    EXPECT_TRUE(description.initialization_argument_.empty());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_SHANISHA1, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"627fc7a1afda64d792a264db058f2d2af4b1f55a"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SHANISHA1, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha1");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"90ad14798b19175b03ffa6b54e60de67813876df"};
+    auto result = headcode::mem::MemoryToHex(hash);
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_SHANISHA1, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha1");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"da39a3ee5e6b4b0d3255bfef95601890afd80709"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SHANISHA1, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha1");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"90ad14798b19175b03ffa6b54e60de67813876df"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_SHANISHA1, ltc) {
+
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    // same digests as LibTomCrypt for any size, any chunking
+    for (std::uint64_t size : {0ul, 1ul, 55ul, 56ul, 63ul, 64ul, 65ul, 127ul, 128ul, 1000ul, text.size()}) {
+
+        auto ltc = headcode::crypt::Factory::Create("ltc-sha1");
+        ASSERT_NE(ltc.get(), nullptr);
+        auto algo = headcode::crypt::Factory::Create("hcs-shani-sha1");
+        ASSERT_NE(algo.get(), nullptr);
+
+        std::vector<std::byte> expected;
+        EXPECT_EQ(ltc->Initialize(), 0);
+        EXPECT_EQ(ltc->Add(headcode::crypt::ByteView{text.data(), size}), 0);
+        EXPECT_EQ(ltc->Finalize(expected), 0);
+
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Initialize(), 0);
+        for (std::uint64_t i = 0; i < size; i += 100) {
+            EXPECT_EQ(algo->Add(headcode::crypt::ByteView{text.data() + i, std::min<std::uint64_t>(100, size - i)}), 0);
+        }
+        EXPECT_EQ(algo->Finalize(hash), 0);
+
+        EXPECT_EQ(hash, expected) << "size " << size;
+    }
+}
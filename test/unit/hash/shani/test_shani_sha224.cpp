@@ -0,0 +1,139 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Hash_SHANISHA224, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-shani-sha224");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 64ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 28ul);
+
+    EXPECT_TRUE(description.initialization_argument_.empty());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_SHANISHA224, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"9ab9ea9b927fe3317c4d16f9a06aa452fe7587339e383fff46997341"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SHANISHA224, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha224");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a446cb8d8d4461be1ff5c179f888605dbef9be00b0fd840f52af97f9"};
+    auto result = headcode::mem::MemoryToHex(hash);
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_SHANISHA224, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha224");
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SHANISHA224, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-shani-sha224");
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a446cb8d8d4461be1ff5c179f888605dbef9be00b0fd840f52af97f9"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_SHANISHA224, ltc) {
+
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    // same digests as LibTomCrypt for any size, any chunking
+    for (std::uint64_t size : {0ul, 1ul, 55ul, 56ul, 63ul, 64ul, 65ul, 127ul, 128ul, 1000ul, text.size()}) {
+
+        auto ltc = headcode::crypt::Factory::Create("ltc-sha224");
+        ASSERT_NE(ltc.get(), nullptr);
+        auto algo = headcode::crypt::Factory::Create("hcs-shani-sha224");
+        ASSERT_NE(algo.get(), nullptr);
+
+        std::vector<std::byte> expected;
+        EXPECT_EQ(ltc->Initialize(), 0);
+        EXPECT_EQ(ltc->Add(headcode::crypt::ByteView{text.data(), size}), 0);
+        EXPECT_EQ(ltc->Finalize(expected), 0);
+
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Initialize(), 0);
+        for (std::uint64_t i = 0; i < size; i += 100) {
+            EXPECT_EQ(algo->Add(headcode::crypt::ByteView{text.data() + i, std::min<std::uint64_t>(100, size - i)}), 0);
+        }
+        EXPECT_EQ(algo->Finalize(hash), 0);
+
+        EXPECT_EQ(hash, expected) << "size " << size;
+    }
+}
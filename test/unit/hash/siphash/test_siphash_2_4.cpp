@@ -0,0 +1,269 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Creates bytes 00 01 02 ... as used by the vectors of the SipHash reference.
+ * @param   size        number of bytes.
+ * @return  The bytes.
+ */
+static std::vector<std::byte> CreateSequence(std::uint64_t size) {
+    std::vector<std::byte> sequence(size);
+    for (std::uint64_t i = 0; i < size; ++i) {
+        sequence[i] = static_cast<std::byte>(i);
+    }
+    return sequence;
+}
+
+
+TEST(Hash_SipHash_2_4, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-siphash-2-4");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 8ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_SipHash_2_4, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"9b602581fce4d4f8"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SipHash_2_4, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-siphash-2-4");
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"efb5689d21dd1474"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_SipHash_2_4, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 3) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+
+    auto expected = std::string{"efb5689d21dd1474"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SipHash_2_4, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"310e0edd47db6f72"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SipHash_2_4, reference) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    // the vectors of the SipHash reference: key 00 01 .. 0f, message 00 01 .. (size - 1)
+    std::vector<std::tuple<std::uint64_t, std::string>> const expected = {
+            {0ul, "310e0edd47db6f72"},
+            {1ul, "fd67dc93c539f874"},
+            {7ul, "37d1018bf50002ab"},
+            {8ul, "6224939a79f5f593"},
+            {9ul, "b0e4a90bdf82009e"},
+            {15ul, "e545be4961ca29a1"},
+            {16ul, "db9bc2577fcc2a3f"},
+            {17ul, "9447be2cf5e99a69"},
+            {31ul, "42c341d8fa92d832"},
+            {32ul, "ce7cf2722f512771"},
+            {63ul, "724506eb4c328a95"},
+            {64ul, "d8ca02850bc4d2ac"},
+    };
+    for (auto const & [size, expected_hash] : expected) {
+        auto message = CreateSequence(size);
+        for (std::uint64_t chunk_size : {64ul, 1ul, 3ul, 8ul, 9ul}) {
+            EXPECT_EQ(algo->Reset(), 0);
+            for (std::uint64_t i = 0; i < size; i += chunk_size) {
+                EXPECT_EQ(algo->Add(headcode::crypt::ByteView{message.data() + i, std::min(chunk_size, size - i)}),
+                          0);
+            }
+            std::vector<std::byte> hash;
+            EXPECT_EQ(algo->Finalize(hash), 0);
+            EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected_hash.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_SipHash_2_4, inlined) {
+
+    auto key = CreateSequence(16);
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    headcode::crypt::SipHash24 siphash;
+    ASSERT_EQ(siphash.SetKey(key), 0);
+
+    // the number is the little endian value of the digest
+    EXPECT_EQ(siphash.Hash(CreateSequence(15)), 0xa129ca6149be45e5ul);
+
+    for (std::uint64_t size = 0; size <= 64; ++size) {
+        auto message = CreateSequence(size);
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+
+        std::uint64_t expected = 0;
+        for (std::uint64_t i = 0; i < 8; ++i) {
+            expected |= static_cast<std::uint64_t>(hash[i]) << (8 * i);
+        }
+        EXPECT_EQ(siphash.Hash(message), expected) << "size: " << size;
+    }
+}
+
+
+TEST(Hash_SipHash_2_4, inlined_key) {
+
+    headcode::crypt::SipHash24 siphash;
+    EXPECT_EQ(siphash.SetKey(CreateSequence(15)), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_EQ(siphash.SetKey(CreateSequence(16)), 0);
+    EXPECT_EQ(siphash.Hash(headcode::crypt::ByteView{}), 0x726fdb47dd0e0e31ul);
+
+    // a wrong key later on keeps the key set before
+    EXPECT_EQ(siphash.SetKey(CreateSequence(17)), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_EQ(siphash.Hash(headcode::crypt::ByteView{}), 0x726fdb47dd0e0e31ul);
+}
+
+
+TEST(Hash_SipHash_2_4, no_key) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize(), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_SipHash_2_4, invalid_key) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(32)}}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_SipHash_2_4, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char hash[7];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash, sizeof(hash)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_SipHash_2_4, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // without a key there is no hash
+    EXPECT_EQ(algo->Add(kIpsumLoremText), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+    EXPECT_FALSE(algo->IsInitialized());
+}
+
+
+TEST(Hash_SipHash_2_4, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    auto expected = std::string{"efb5689d21dd1474"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+}
@@ -0,0 +1,250 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Creates bytes 00 01 02 ... as used by the vectors of the SipHash reference.
+ * @param   size        number of bytes.
+ * @return  The bytes.
+ */
+static std::vector<std::byte> CreateSequence(std::uint64_t size) {
+    std::vector<std::byte> sequence(size);
+    for (std::uint64_t i = 0; i < size; ++i) {
+        sequence[i] = static_cast<std::byte>(i);
+    }
+    return sequence;
+}
+
+
+TEST(Hash_SipHash_2_4_128, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-siphash-2-4-128");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 16ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_SipHash_2_4_128, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a620a9d84746e61175e8715f83997bc8"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SipHash_2_4_128, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-siphash-2-4-128");
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a2719f528406f404d4a06c5f1fdf89c6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_SipHash_2_4_128, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 3) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+
+    auto expected = std::string{"a2719f528406f404d4a06c5f1fdf89c6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SipHash_2_4_128, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"a3817f04ba25a8e66df67214c7550293"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_SipHash_2_4_128, reference) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    // the vectors of the SipHash reference: key 00 01 .. 0f, message 00 01 .. (size - 1)
+    std::vector<std::tuple<std::uint64_t, std::string>> const expected = {
+            {0ul, "a3817f04ba25a8e66df67214c7550293"},
+            {1ul, "da87c1d86b99af44347659119b22fc45"},
+            {7ul, "a1f1ebbed8dbc153c0b84aa61ff08239"},
+            {8ul, "3b62a9ba6258f5610f83e264f31497b4"},
+            {9ul, "264499060ad9baabc47f8b02bb6d71ed"},
+            {15ul, "5493e99933b0a8117e08ec0f97cfc3d9"},
+            {16ul, "6ee2a4ca67b054bbfd3315bf85230577"},
+            {17ul, "473d06e8738db89854c066c47ae47740"},
+            {31ul, "2939b0183223fafc1723de4f52c43d35"},
+            {32ul, "7c3956ca5eeafc3e363e9d556546eb68"},
+            {63ul, "5150d1772f50834a503e069a973fbd7c"},
+            {64ul, "1eaf077dc0d4cd3f8cad4d383658a74b"},
+    };
+    for (auto const & [size, expected_hash] : expected) {
+        auto message = CreateSequence(size);
+        for (std::uint64_t chunk_size : {64ul, 1ul, 3ul, 8ul, 9ul}) {
+            EXPECT_EQ(algo->Reset(), 0);
+            for (std::uint64_t i = 0; i < size; i += chunk_size) {
+                EXPECT_EQ(algo->Add(headcode::crypt::ByteView{message.data() + i, std::min(chunk_size, size - i)}),
+                          0);
+            }
+            std::vector<std::byte> hash;
+            EXPECT_EQ(algo->Finalize(hash), 0);
+            EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected_hash.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_SipHash_2_4_128, inlined) {
+
+    auto key = CreateSequence(16);
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    headcode::crypt::SipHash24 siphash;
+    ASSERT_EQ(siphash.SetKey(key), 0);
+
+    for (std::uint64_t size = 0; size <= 64; ++size) {
+        auto message = CreateSequence(size);
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+
+        auto inlined = siphash.Hash128(message);
+        EXPECT_TRUE(std::equal(inlined.begin(), inlined.end(), hash.begin(), hash.end())) << "size: " << size;
+    }
+}
+
+
+TEST(Hash_SipHash_2_4_128, no_key) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize(), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_SipHash_2_4_128, invalid_key) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(32)}}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_SipHash_2_4_128, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char hash[15];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash, sizeof(hash)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_SipHash_2_4_128, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // without a key there is no hash
+    EXPECT_EQ(algo->Add(kIpsumLoremText), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+    EXPECT_FALSE(algo->IsInitialized());
+}
+
+
+TEST(Hash_SipHash_2_4_128, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-siphash-2-4-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", CreateSequence(16)}}), 0);
+
+    auto expected = std::string{"a2719f528406f404d4a06c5f1fdf89c6"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+}
@@ -0,0 +1,299 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Creates the input of the size tests.
+ * @return  The input.
+ */
+static std::vector<std::byte> CreateInput() {
+    std::vector<std::byte> input(70000);
+    for (std::uint64_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<std::byte>((i * 7 + i / 251) & 0xff);
+    }
+    return input;
+}
+
+
+/**
+ * @brief   Hashes data in chunks.
+ * @param   algo            the algorithm.
+ * @param   data            the data.
+ * @param   size            size of the data.
+ * @param   chunk_size      size of the chunks.
+ * @return  The hash as hex string.
+ */
+static std::string Hash(headcode::crypt::Algorithm * algo,
+                        std::byte const * data,
+                        std::uint64_t size,
+                        std::uint64_t chunk_size) {
+    EXPECT_EQ(algo->Reset(), 0);
+    for (std::uint64_t i = 0; i < size; i += chunk_size) {
+        EXPECT_EQ(algo->Add(headcode::crypt::ByteView{data + i, std::min(chunk_size, size - i)}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    return headcode::mem::MemoryToHex(hash);
+}
+
+
+TEST(Hash_XXH3_128, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-xxh3-128");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kNonCryptographicHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 16ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("seed"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_XXH3_128, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"d06a8295313e6a153ff8e02db829c73c"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_XXH3_128, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-xxh3-128");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"15f75c6bdc831a9c9bb08f7f78f30ea6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_XXH3_128, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+
+    auto expected = std::string{"15f75c6bdc831a9c9bb08f7f78f30ea6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_XXH3_128, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"99aa06d3014798d86001c324468d497f"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_XXH3_128, sizes) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // each of the short paths, the stripes, the blocks and the buffer of 256 bytes in between
+    auto input = CreateInput();
+    std::vector<std::tuple<std::uint64_t, std::string>> const expected = {
+            {0ul, "99aa06d3014798d86001c324468d497f"},
+            {1ul, "a6cd5e9392000f6ac44bdff4074eecdb"},
+            {3ul, "656e81c56e41fe02c3489259e968ad9e"},
+            {4ul, "ab5c3e7474d809db81a65295de8e7dde"},
+            {8ul, "e4b9dd0b66ff3c50ebabbd0695002ff6"},
+            {9ul, "82ddc95bc76007671c69c3f04aaed08c"},
+            {16ul, "ddf6c1254d70f76794eaa17b20756f46"},
+            {17ul, "263f67af63088041735fe434ded90c3c"},
+            {32ul, "a86b514658f976a5407920045a9a834c"},
+            {33ul, "a943d80ce26ed2928b59b4dfba3c9de4"},
+            {64ul, "a7fa95f7f23b64a7edae5e0312655703"},
+            {65ul, "c12aaf5f8a1782a45c95500a9909a96f"},
+            {96ul, "dbfa0cd6e568ef54acb9f0967e182865"},
+            {97ul, "bc31691d04ea6efefee64835dcb60271"},
+            {128ul, "dd9e5aa9bd51cc9cc6bd21ecc865f29f"},
+            {129ul, "00433635cf8d872e7f4accb76587485b"},
+            {200ul, "dbfff5e13c798ab90497bdb3d145ccd6"},
+            {240ul, "89e3a0a2ee355d25d10beb4e0599e4b3"},
+            {241ul, "75f4da43f23cce5a541b19226f0052e8"},
+            {255ul, "aa3bbe481f43a1b6d7b24287b3dcf385"},
+            {256ul, "d49510bd86c6d0acf2331523b74cf0a4"},
+            {257ul, "22b23a9516c3533133074291cf400551"},
+            {511ul, "59e4eb420b47ce6c9b2070ddfe0d1609"},
+            {512ul, "f201a7b3c9b5a955717ea4dbb4b419c1"},
+            {1024ul, "03de0c29e9f0bc7fba464919c6bb3ccd"},
+            {1025ul, "7584e04fe3414e5a2aa0034e7827ee42"},
+            {2048ul, "019ce17e87a3de06956f98bea3210c05"},
+            {2049ul, "5f0a3305dab16878e26adc81a9c9e336"},
+            {16384ul, "789df0df292c63be7426889d378343cd"},
+            {16385ul, "eea0b873b7437c0af9ce64137022fa42"},
+            {70000ul, "e236404279f16699abc7a44b0837612b"},
+    };
+    for (auto const & [size, hash] : expected) {
+        for (std::uint64_t chunk_size : {70000ul, 1ul, 63ul, 64ul, 255ul, 256ul, 257ul, 1000ul}) {
+            EXPECT_STREQ(Hash(algo.get(), input.data(), size, chunk_size).c_str(), hash.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_XXH3_128, seed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // the seed 0x0123456789abcdef, big endian
+    std::vector<std::byte> seed = {std::byte{0x01},
+                                   std::byte{0x23},
+                                   std::byte{0x45},
+                                   std::byte{0x67},
+                                   std::byte{0x89},
+                                   std::byte{0xab},
+                                   std::byte{0xcd},
+                                   std::byte{0xef}};
+    EXPECT_EQ(algo->Initialize({{"seed", seed}}), 0);
+
+    auto input = CreateInput();
+    std::vector<std::tuple<std::uint64_t, std::string>> const expected = {
+            {0ul, "a4cb05dbbf09907aaaa287af24a9bb3a"},
+            {3ul, "77b33259350d3773abdb7d6994061ab8"},
+            {8ul, "0c85457e33ac64a550eec61c4193c369"},
+            {16ul, "9e8327e234062a4d522848b4c15c9896"},
+            {100ul, "f87d787800fbb978f043a4e027db7b53"},
+            {200ul, "789bf645383114660d406da986536775"},
+            {1000ul, "b1bb17000eb4665c102d0ee75d29063f"},
+            {70000ul, "688cb670dda0fbbc9c5d31a268822819"},
+    };
+    for (auto const & [size, hash] : expected) {
+        for (std::uint64_t chunk_size : {70000ul, 7ul, 256ul}) {
+            EXPECT_STREQ(Hash(algo.get(), input.data(), size, chunk_size).c_str(), hash.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+
+    // a seed of 0 is no seed
+    auto zero_seeded = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(zero_seeded.get(), nullptr);
+    EXPECT_EQ(zero_seeded->Initialize({{"seed", std::vector<std::byte>(8)}}), 0);
+    EXPECT_STREQ(Hash(zero_seeded.get(), input.data(), 1000, 1000).c_str(),
+                 Hash(headcode::crypt::Factory::Create("hcs-xxh3-128").get(), input.data(), 1000, 1000).c_str());
+}
+
+
+TEST(Hash_XXH3_128, invalid_seed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize({{"seed", std::vector<std::byte>(6)}}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_XXH3_128, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char hash[15];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash, sizeof(hash)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_XXH3_128, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+
+    auto expected = std::string{"15f75c6bdc831a9c9bb08f7f78f30ea6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_XXH3_128, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-128");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    auto expected = std::string{"15f75c6bdc831a9c9bb08f7f78f30ea6"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+}
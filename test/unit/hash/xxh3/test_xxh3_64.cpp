@@ -0,0 +1,299 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Creates the input of the size tests.
+ * @return  The input.
+ */
+static std::vector<std::byte> CreateInput() {
+    std::vector<std::byte> input(70000);
+    for (std::uint64_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<std::byte>((i * 7 + i / 251) & 0xff);
+    }
+    return input;
+}
+
+
+/**
+ * @brief   Hashes data in chunks.
+ * @param   algo            the algorithm.
+ * @param   data            the data.
+ * @param   size            size of the data.
+ * @param   chunk_size      size of the chunks.
+ * @return  The hash as hex string.
+ */
+static std::string Hash(headcode::crypt::Algorithm * algo,
+                        std::byte const * data,
+                        std::uint64_t size,
+                        std::uint64_t chunk_size) {
+    EXPECT_EQ(algo->Reset(), 0);
+    for (std::uint64_t i = 0; i < size; i += chunk_size) {
+        EXPECT_EQ(algo->Add(headcode::crypt::ByteView{data + i, std::min(chunk_size, size - i)}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    return headcode::mem::MemoryToHex(hash);
+}
+
+
+TEST(Hash_XXH3_64, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "hcs-xxh3-64");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kNonCryptographicHash);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 8ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("seed"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(Hash_XXH3_64, simple) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    EXPECT_EQ(algo->Add(text), 0);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"b614e0225d51db19"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_XXH3_64, regular) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_STREQ(algo->GetDescription().name_.c_str(), "hcs-xxh3-64");
+    EXPECT_EQ(algo->Initialize(), 0);
+    EXPECT_TRUE(algo->IsInitialized());
+    EXPECT_FALSE(algo->IsFinalized());
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"9bb08f7f78f30ea6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_XXH3_64, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+
+    auto expected = std::string{"9bb08f7f78f30ea6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_XXH3_64, empty) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+    EXPECT_EQ(hash.size(), algo->GetDescription().result_size_);
+
+    auto expected = std::string{"2d06800538d394c2"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(Hash_XXH3_64, sizes) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    // each of the short paths, the stripes, the blocks and the buffer of 256 bytes in between
+    auto input = CreateInput();
+    std::vector<std::tuple<std::uint64_t, std::string>> const expected = {
+            {0ul, "2d06800538d394c2"},
+            {1ul, "c44bdff4074eecdb"},
+            {3ul, "c3489259e968ad9e"},
+            {4ul, "d3d60c1519014e89"},
+            {8ul, "b88dee77f6bf6980"},
+            {9ul, "03688dcad730d826"},
+            {16ul, "9da23836adf2be1e"},
+            {17ul, "f34c3c9cf5a112d1"},
+            {32ul, "99cb9ad0f1a11fbe"},
+            {33ul, "c077b45492d29cde"},
+            {64ul, "6efb76ff16f37561"},
+            {65ul, "2640848e9137156b"},
+            {96ul, "764d2d5db92942df"},
+            {97ul, "077acb7e5f4fd940"},
+            {128ul, "65f3c2c00fa93185"},
+            {129ul, "28065c6ec25f5b25"},
+            {200ul, "7c64f3b17285e96a"},
+            {240ul, "4917a75c0ef8eed7"},
+            {241ul, "541b19226f0052e8"},
+            {255ul, "d7b24287b3dcf385"},
+            {256ul, "f2331523b74cf0a4"},
+            {257ul, "33074291cf400551"},
+            {511ul, "9b2070ddfe0d1609"},
+            {512ul, "717ea4dbb4b419c1"},
+            {1024ul, "ba464919c6bb3ccd"},
+            {1025ul, "2aa0034e7827ee42"},
+            {2048ul, "956f98bea3210c05"},
+            {2049ul, "e26adc81a9c9e336"},
+            {16384ul, "7426889d378343cd"},
+            {16385ul, "f9ce64137022fa42"},
+            {70000ul, "abc7a44b0837612b"},
+    };
+    for (auto const & [size, hash] : expected) {
+        for (std::uint64_t chunk_size : {70000ul, 1ul, 63ul, 64ul, 255ul, 256ul, 257ul, 1000ul}) {
+            EXPECT_STREQ(Hash(algo.get(), input.data(), size, chunk_size).c_str(), hash.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+}
+
+
+TEST(Hash_XXH3_64, seed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // the seed 0x0123456789abcdef, big endian
+    std::vector<std::byte> seed = {std::byte{0x01},
+                                   std::byte{0x23},
+                                   std::byte{0x45},
+                                   std::byte{0x67},
+                                   std::byte{0x89},
+                                   std::byte{0xab},
+                                   std::byte{0xcd},
+                                   std::byte{0xef}};
+    EXPECT_EQ(algo->Initialize({{"seed", seed}}), 0);
+
+    auto input = CreateInput();
+    std::vector<std::tuple<std::uint64_t, std::string>> const expected = {
+            {0ul, "cc1ca35a1b089c5c"},
+            {3ul, "abdb7d6994061ab8"},
+            {8ul, "03487b3192ad1e7a"},
+            {16ul, "a243bb83a7a147a2"},
+            {100ul, "6b8df1b98b996b4b"},
+            {200ul, "3b70276c6a28fa82"},
+            {1000ul, "102d0ee75d29063f"},
+            {70000ul, "9c5d31a268822819"},
+    };
+    for (auto const & [size, hash] : expected) {
+        for (std::uint64_t chunk_size : {70000ul, 7ul, 256ul}) {
+            EXPECT_STREQ(Hash(algo.get(), input.data(), size, chunk_size).c_str(), hash.c_str())
+                    << "size: " << size << ", chunk size: " << chunk_size;
+        }
+    }
+
+    // a seed of 0 is no seed
+    auto zero_seeded = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(zero_seeded.get(), nullptr);
+    EXPECT_EQ(zero_seeded->Initialize({{"seed", std::vector<std::byte>(8)}}), 0);
+    EXPECT_STREQ(Hash(zero_seeded.get(), input.data(), 1000, 1000).c_str(),
+                 Hash(headcode::crypt::Factory::Create("hcs-xxh3-64").get(), input.data(), 1000, 1000).c_str());
+}
+
+
+TEST(Hash_XXH3_64, invalid_seed) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize({{"seed", std::vector<std::byte>(6)}}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_XXH3_64, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char hash[7];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash, sizeof(hash)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(Hash_XXH3_64, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+
+    algo->Add(kIpsumLoremText);
+    std::vector<std::byte> hash;
+    EXPECT_EQ(algo->Finalize(hash), 0);
+
+    auto expected = std::string{"9bb08f7f78f30ea6"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+
+    EXPECT_FALSE(algo->IsInitialized());
+    EXPECT_TRUE(algo->IsFinalized());
+}
+
+
+TEST(Hash_XXH3_64, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("hcs-xxh3-64");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    auto expected = std::string{"9bb08f7f78f30ea6"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(algo->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+}
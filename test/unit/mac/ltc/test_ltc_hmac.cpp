@@ -0,0 +1,442 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   The key of the webhook tests.
+ */
+static std::string const kWebhookKey{"secret webhook key"};
+
+
+/**
+ * @brief   Computes a tag with a fresh instance.
+ * @param   name        name of the algorithm.
+ * @param   key         the key.
+ * @param   message     the message.
+ * @return  The tag as hex string.
+ */
+static std::string Tag(std::string const & name, std::vector<std::byte> const & key, std::string const & message) {
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", key}}), 0);
+    EXPECT_EQ(algo->Add(message), 0);
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+    EXPECT_EQ(tag.size(), algo->GetDescription().result_size_);
+    return headcode::mem::MemoryToHex(tag);
+}
+
+
+
+TEST(MAC_LTC_HMAC_SHA1, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-hmac-sha1");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kMessageAuthenticationCode);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 20ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, rfc) {
+
+    // the test cases 1, 2 and 6 of RFC 4231 (RFC 2202 for SHA-1 with the key of RFC 4231)
+    std::vector<std::tuple<std::vector<std::byte>, std::string, std::string>> const expected = {
+            {std::vector<std::byte>(20, std::byte{0x0b}),
+             "Hi There",
+             "b617318655057264e28bc0b6fb378c8ef146be00"},
+            {headcode::mem::StringToMemory("Jefe"),
+             "what do ya want for nothing?",
+             "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79"},
+            {std::vector<std::byte>(131, std::byte{0xaa}),
+             "Test Using Larger Than Block-Size Key - Hash Key First",
+             "90d0dace1c1bdc957339307803160335bde6df2b"},
+    };
+    for (auto const & [key, message, tag] : expected) {
+        EXPECT_STREQ(Tag("ltc-hmac-sha1", key, message).c_str(), tag.c_str()) << "message: " << message;
+    }
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, empty) {
+
+    // an empty key is padded to a block of zeros
+    auto expected = std::string{"fbdb1d1b18aa6c08324b7d64b71fb76370690e1d"};
+    EXPECT_STREQ(Tag("ltc-hmac-sha1", std::vector<std::byte>{}, std::string{}).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 5) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+
+    auto expected = std::string{"d586c91530ea8377f94b6ce6b606ff92f129b774"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    // the key stays: each message after Reset() is authenticated with the same key
+    auto expected = std::string{"d586c91530ea8377f94b6ce6b606ff92f129b774"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> tag;
+        EXPECT_EQ(algo->Finalize(tag), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // a new key via Reinitialize()
+    EXPECT_EQ(algo->Reinitialize({{"key", headcode::mem::StringToMemory("Jefe")}}), 0);
+    EXPECT_EQ(algo->Add(std::string{"what do ya want for nothing?"}), 0);
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+    expected = std::string{"effcdf6ae5eb2fa2d27416d5f184df9c259a7c79"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, no_key) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize(), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char tag[19];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{tag, sizeof(tag)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(MAC_LTC_HMAC_SHA1, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha1");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // without a key there is no tag
+    EXPECT_EQ(algo->Add(kIpsumLoremText), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+    EXPECT_FALSE(algo->IsInitialized());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-hmac-sha256");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kMessageAuthenticationCode);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 32ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, rfc) {
+
+    // the test cases 1, 2 and 6 of RFC 4231 (RFC 2202 for SHA-1 with the key of RFC 4231)
+    std::vector<std::tuple<std::vector<std::byte>, std::string, std::string>> const expected = {
+            {std::vector<std::byte>(20, std::byte{0x0b}),
+             "Hi There",
+             "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"},
+            {headcode::mem::StringToMemory("Jefe"),
+             "what do ya want for nothing?",
+             "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"},
+            {std::vector<std::byte>(131, std::byte{0xaa}),
+             "Test Using Larger Than Block-Size Key - Hash Key First",
+             "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"},
+    };
+    for (auto const & [key, message, tag] : expected) {
+        EXPECT_STREQ(Tag("ltc-hmac-sha256", key, message).c_str(), tag.c_str()) << "message: " << message;
+    }
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, empty) {
+
+    // an empty key is padded to a block of zeros
+    auto expected = std::string{"b613679a0814d9ec772f95d778c35fc5ff1697c493715653c6c712144292c5ad"};
+    EXPECT_STREQ(Tag("ltc-hmac-sha256", std::vector<std::byte>{}, std::string{}).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 5) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+
+    auto expected = std::string{"e4f763abd44fc0db6f093b4072e987c642ee71e1e452ba800cd19d6e3aa2d64b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    // the key stays: each message after Reset() is authenticated with the same key
+    auto expected = std::string{"e4f763abd44fc0db6f093b4072e987c642ee71e1e452ba800cd19d6e3aa2d64b"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> tag;
+        EXPECT_EQ(algo->Finalize(tag), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // a new key via Reinitialize()
+    EXPECT_EQ(algo->Reinitialize({{"key", headcode::mem::StringToMemory("Jefe")}}), 0);
+    EXPECT_EQ(algo->Add(std::string{"what do ya want for nothing?"}), 0);
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+    expected = std::string{"5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, no_key) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize(), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char tag[31];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{tag, sizeof(tag)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(MAC_LTC_HMAC_SHA256, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // without a key there is no tag
+    EXPECT_EQ(algo->Add(kIpsumLoremText), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+    EXPECT_FALSE(algo->IsInitialized());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha512");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+    EXPECT_STREQ(description.name_.c_str(), "ltc-hmac-sha512");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kMessageAuthenticationCode);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.block_size_outgoing_, 0ul);
+    EXPECT_EQ(description.result_size_, 64ul);
+    EXPECT_EQ(description.initialization_argument_.size(), 1ul);
+    EXPECT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.finalization_argument_.empty());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, rfc) {
+
+    // the test cases 1, 2 and 6 of RFC 4231 (RFC 2202 for SHA-1 with the key of RFC 4231)
+    std::vector<std::tuple<std::vector<std::byte>, std::string, std::string>> const expected = {
+            {std::vector<std::byte>(20, std::byte{0x0b}),
+             "Hi There",
+             "87aa7cdea5ef619d4ff0b4241a1d6cb02379f4e2ce4ec2787ad0b30545e17cde"
+             "daa833b7d6b8a702038b274eaea3f4e4be9d914eeb61f1702e696c203a126854"},
+            {headcode::mem::StringToMemory("Jefe"),
+             "what do ya want for nothing?",
+             "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea250554"
+             "9758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737"},
+            {std::vector<std::byte>(131, std::byte{0xaa}),
+             "Test Using Larger Than Block-Size Key - Hash Key First",
+             "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f352"
+             "6b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598"},
+    };
+    for (auto const & [key, message, tag] : expected) {
+        EXPECT_STREQ(Tag("ltc-hmac-sha512", key, message).c_str(), tag.c_str()) << "message: " << message;
+    }
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, empty) {
+
+    // an empty key is padded to a block of zeros
+    auto expected = std::string{"b936cee86c9f87aa5d3c6f2e84cb5a4239a5fe50480a6ec66b70ab5b1f4ac673"
+                                "0c6c515421b327ec1d69402e53dfb49ad7381eb067b338fd7b0cb22247225d47"};
+    EXPECT_STREQ(Tag("ltc-hmac-sha512", std::vector<std::byte>{}, std::string{}).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, chunked) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha512");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    // no block size: odd sized chunks make no difference
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < text.size(); i += chunk_size, chunk_size += 5) {
+        auto chunk_end = std::min(text.size(), i + chunk_size);
+        EXPECT_EQ(algo->Add(std::vector<std::byte>{text.begin() + i, text.begin() + chunk_end}), 0);
+    }
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+
+    auto expected = std::string{"0b54e736408abe9d5b62807ea3f3ed6fae1491c16a10f63969801fee9a95c31d"
+                                "1af9c8aba7c7538ed3db7da9503467fceeead25f5d69a11b02a2bb3cab9ab00f"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, reset) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha512");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    // the key stays: each message after Reset() is authenticated with the same key
+    auto expected = std::string{"0b54e736408abe9d5b62807ea3f3ed6fae1491c16a10f63969801fee9a95c31d"
+                                "1af9c8aba7c7538ed3db7da9503467fceeead25f5d69a11b02a2bb3cab9ab00f"};
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> tag;
+        EXPECT_EQ(algo->Finalize(tag), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // a new key via Reinitialize()
+    EXPECT_EQ(algo->Reinitialize({{"key", headcode::mem::StringToMemory("Jefe")}}), 0);
+    EXPECT_EQ(algo->Add(std::string{"what do ya want for nothing?"}), 0);
+    std::vector<std::byte> tag;
+    EXPECT_EQ(algo->Finalize(tag), 0);
+    expected = std::string{"164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea250554"
+                           "9758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(tag).c_str(), expected.c_str());
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, no_key) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha512");
+    ASSERT_NE(algo.get(), nullptr);
+
+    EXPECT_EQ(algo->Initialize(), static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, result_size) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha512");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize({{"key", headcode::mem::StringToMemory(kWebhookKey)}}), 0);
+
+    EXPECT_EQ(algo->Add(kIpsumLoremText), 0);
+    unsigned char tag[63];
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{tag, sizeof(tag)}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(MAC_LTC_HMAC_SHA512, noinit) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-hmac-sha512");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // without a key there is no tag
+    EXPECT_EQ(algo->Add(kIpsumLoremText), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+    EXPECT_FALSE(algo->IsInitialized());
+}
@@ -6,6 +6,8 @@
  * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
  */
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include <headcode/mem/mem.hpp>
@@ -182,12 +184,15 @@ TEST(SymmetricCipher_LTC_AES_128_CBC, regular) {
 
     std::vector<std::byte> cipher;
     EXPECT_EQ(algo_enc->Add(plain, cipher), 0);
-    EXPECT_LE(plain.size(), cipher.size());
+    EXPECT_GE(plain.size(), cipher.size());
     EXPECT_EQ(cipher.size() % algo_enc->GetDescription().block_size_outgoing_, 0ul);
 
+    // the last incomplete block is padded and encrypted at finalization
     std::vector<std::byte> result_enc;
     EXPECT_EQ(algo_enc->Finalize(result_enc), 0);
-    EXPECT_TRUE(result_enc.empty());
+    EXPECT_EQ(result_enc.size(), algo_enc->GetDescription().block_size_outgoing_);
+    cipher.insert(cipher.end(), result_enc.begin(), result_enc.end());
+    EXPECT_LE(plain.size(), cipher.size());
 
     // --------- decrypt ---------
 
@@ -212,10 +217,131 @@ TEST(SymmetricCipher_LTC_AES_128_CBC, regular) {
     // --------- check ---------
 
     // convert back to text and cut off any added padding in the decrypted text
-    auto plain_txt = std::string{reinterpret_cast<char const *>(plain.data())};
-    auto plain_decrypted_txt = std::string{reinterpret_cast<char const *>(plain_decrypted.data())};
+    auto plain_txt = std::string{reinterpret_cast<char const *>(plain.data()), plain.size()};
+    auto plain_decrypted_txt = std::string{reinterpret_cast<char const *>(plain_decrypted.data()), plain_decrypted.size()};
     plain_decrypted_txt.resize(plain_txt.size());
 
     EXPECT_NE(std::memcmp(plain_decrypted.data(), cipher.data(), plain_decrypted.size()), 0);
     EXPECT_STREQ(plain_txt.c_str(), plain_decrypted_txt.c_str());
 }
+
+
+TEST(SymmetricCipher_LTC_AES_128_CBC, chunked) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(16);
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    // --------- encrypt at once ---------
+
+    auto algo_enc = headcode::crypt::Factory::Create("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(algo_enc.get(), nullptr);
+    ASSERT_EQ(algo_enc->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    std::vector<std::byte> cipher;
+    EXPECT_EQ(algo_enc->Add(plain, cipher), 0);
+    std::vector<std::byte> cipher_tail;
+    EXPECT_EQ(algo_enc->Finalize(cipher_tail), 0);
+    cipher.insert(cipher.end(), cipher_tail.begin(), cipher_tail.end());
+
+    // --------- encrypt in odd sized chunks ---------
+
+    auto algo_enc_chunked = headcode::crypt::Factory::Create("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(algo_enc_chunked.get(), nullptr);
+    ASSERT_EQ(algo_enc_chunked->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    std::vector<std::byte> cipher_chunked;
+    std::uint64_t chunk_size = 1;
+    for (std::uint64_t i = 0; i < plain.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(plain.size(), i + chunk_size);
+        std::vector<std::byte> block_outgoing;
+        EXPECT_EQ(algo_enc_chunked->Add(std::vector<std::byte>{plain.begin() + i, plain.begin() + chunk_end},
+                                        block_outgoing),
+                  0);
+        EXPECT_EQ(block_outgoing.size() % algo_enc_chunked->GetDescription().block_size_outgoing_, 0ul);
+        cipher_chunked.insert(cipher_chunked.end(), block_outgoing.begin(), block_outgoing.end());
+    }
+    EXPECT_EQ(algo_enc_chunked->Finalize(cipher_tail), 0);
+    cipher_chunked.insert(cipher_chunked.end(), cipher_tail.begin(), cipher_tail.end());
+
+    ASSERT_EQ(cipher.size(), cipher_chunked.size());
+    EXPECT_EQ(std::memcmp(cipher.data(), cipher_chunked.data(), cipher.size()), 0);
+
+    // --------- decrypt in odd sized chunks ---------
+
+    auto algo_dec = headcode::crypt::Factory::Create("ltc-aes-128-cbc-decryptor");
+    ASSERT_NE(algo_dec.get(), nullptr);
+    ASSERT_EQ(algo_dec->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    std::vector<std::byte> plain_decrypted;
+    chunk_size = 1;
+    for (std::uint64_t i = 0; i < cipher.size(); i += chunk_size, chunk_size += 6) {
+        auto chunk_end = std::min(cipher.size(), i + chunk_size);
+        std::vector<std::byte> block_outgoing;
+        EXPECT_EQ(algo_dec->Add(std::vector<std::byte>{cipher.begin() + i, cipher.begin() + chunk_end},
+                                block_outgoing),
+                  0);
+        plain_decrypted.insert(plain_decrypted.end(), block_outgoing.begin(), block_outgoing.end());
+    }
+    std::vector<std::byte> plain_tail;
+    EXPECT_EQ(algo_dec->Finalize(plain_tail), 0);
+    EXPECT_TRUE(plain_tail.empty());
+
+    ASSERT_EQ(plain_decrypted.size(), cipher.size());
+    EXPECT_EQ(std::memcmp(plain.data(), plain_decrypted.data(), plain.size()), 0);
+}
+
+
+TEST(SymmetricCipher_LTC_AES_128_CBC, reset) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(16);
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+    plain.resize(plain.size() - plain.size() % 16);
+
+    auto algo_reference = headcode::crypt::Factory::Create("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(algo_reference.get(), nullptr);
+    ASSERT_EQ(algo_reference->Initialize({{"key", key}, {"iv", iv}}), 0);
+    std::vector<std::byte> expected;
+    EXPECT_EQ(algo_reference->Add(plain, expected), 0);
+    ASSERT_EQ(expected.size(), plain.size());
+
+    // a reset instance starts over with the initial IV
+    auto algo = headcode::crypt::Factory::Create("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize({{"key", key}, {"iv", iv}}), 0);
+    for (int i = 0; i < 3; ++i) {
+        std::vector<std::byte> cipher;
+        EXPECT_EQ(algo->Add(plain, cipher), 0);
+        std::vector<std::byte> cipher_tail;
+        EXPECT_EQ(algo->Finalize(cipher_tail), 0);
+        EXPECT_TRUE(cipher_tail.empty());
+        ASSERT_EQ(cipher.size(), expected.size());
+        EXPECT_EQ(std::memcmp(cipher.data(), expected.data(), expected.size()), 0);
+
+        EXPECT_EQ(algo->Reset(), 0);
+        EXPECT_TRUE(algo->IsInitialized());
+        EXPECT_FALSE(algo->IsFinalized());
+    }
+
+    // a reinitialized instance picks up the new key
+    auto key_other = headcode::mem::StringToMemory("The quick brown fox jumps over the lazy dog.");
+    key_other.resize(16);
+    EXPECT_EQ(algo->Reinitialize({{"key", key_other}, {"iv", iv}}), 0);
+    std::vector<std::byte> cipher_other;
+    EXPECT_EQ(algo->Add(plain, cipher_other), 0);
+    ASSERT_EQ(cipher_other.size(), expected.size());
+    EXPECT_NE(std::memcmp(cipher_other.data(), expected.data(), expected.size()), 0);
+
+    auto algo_dec = headcode::crypt::Factory::Create("ltc-aes-128-cbc-decryptor");
+    ASSERT_NE(algo_dec.get(), nullptr);
+    ASSERT_EQ(algo_dec->Initialize({{"key", key_other}, {"iv", iv}}), 0);
+    std::vector<std::byte> plain_decrypted;
+    EXPECT_EQ(algo_dec->Add(cipher_other, plain_decrypted), 0);
+    ASSERT_EQ(plain_decrypted.size(), plain.size());
+    EXPECT_EQ(std::memcmp(plain_decrypted.data(), plain.data(), plain.size()), 0);
+}
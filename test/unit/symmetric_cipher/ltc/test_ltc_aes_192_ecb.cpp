@@ -150,12 +150,15 @@ TEST(SymmetricCipher_LTC_AES_192_ECB, regular) {
 
     std::vector<std::byte> cipher;
     EXPECT_EQ(algo_enc->Add(plain, cipher), 0);
-    EXPECT_LE(plain.size(), cipher.size());
+    EXPECT_GE(plain.size(), cipher.size());
     EXPECT_EQ(cipher.size() % algo_enc->GetDescription().block_size_outgoing_, 0ul);
 
+    // the last incomplete block is padded and encrypted at finalization
     std::vector<std::byte> result_enc;
     EXPECT_EQ(algo_enc->Finalize(result_enc), 0);
-    EXPECT_TRUE(result_enc.empty());
+    EXPECT_EQ(result_enc.size(), algo_enc->GetDescription().block_size_outgoing_);
+    cipher.insert(cipher.end(), result_enc.begin(), result_enc.end());
+    EXPECT_LE(plain.size(), cipher.size());
 
     // --------- decrypt ---------
 
@@ -175,8 +178,8 @@ TEST(SymmetricCipher_LTC_AES_192_ECB, regular) {
     // --------- check ---------
 
     // convert back to text and cut off any added padding in the decrypted text
-    auto plain_txt = std::string{reinterpret_cast<char const *>(plain.data())};
-    auto plain_decrypted_txt = std::string{reinterpret_cast<char const *>(plain_decrypted.data())};
+    auto plain_txt = std::string{reinterpret_cast<char const *>(plain.data()), plain.size()};
+    auto plain_decrypted_txt = std::string{reinterpret_cast<char const *>(plain_decrypted.data()), plain_decrypted.size()};
     plain_decrypted_txt.resize(plain_txt.size());
 
     EXPECT_NE(std::memcmp(plain_decrypted.data(), cipher.data(), plain_decrypted.size()), 0);
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Creates and initializes an ECB cipher.
+ * @param   name        name of the cipher.
+ * @return  The initialized cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    if (algo == nullptr) {
+        return algo;
+    }
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(algo->GetDescription().initialization_argument_.at("key").size_);
+    EXPECT_EQ(algo->Initialize({{"key", key}}), 0) << name;
+
+    return algo;
+}
+
+
+/**
+ * @brief   Runs an ECB cipher on a text, handing the text in chunks of the given sizes.
+ * @param   name        name of the cipher.
+ * @param   text        the text (a multiple of the block size).
+ * @param   chunks      sizes of the chunks (the last chunk repeats until the text is done).
+ * @return  The output of the cipher.
+ */
+static std::vector<std::byte> RunCipher(std::string const & name,
+                                        std::vector<std::byte> const & text,
+                                        std::vector<std::uint64_t> const & chunks = {}) {
+
+    std::vector<std::byte> result;
+    auto algo = CreateCipher(name);
+    if (algo == nullptr) {
+        return result;
+    }
+
+    std::uint64_t offset = 0;
+    std::uint64_t chunk = text.size();
+    for (std::size_t i = 0; offset < text.size(); ++i) {
+        if (i < chunks.size()) {
+            chunk = chunks[i];
+        }
+        auto size = std::min<std::uint64_t>(chunk, text.size() - offset);
+        std::vector<std::byte> output;
+        EXPECT_EQ(algo->Add(headcode::crypt::ByteView{text}.subview(offset, size), output), 0) << name;
+        result.insert(result.end(), output.begin(), output.end());
+        offset += size;
+    }
+
+    std::vector<std::byte> final_block;
+    EXPECT_EQ(algo->Finalize(final_block), 0) << name;
+    result.insert(result.end(), final_block.begin(), final_block.end());
+    return result;
+}
+
+
+TEST(SymmetricCipher_LTC_AES_ECB, parallel) {
+
+    auto lorem = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<std::byte> text;
+    while (text.size() < 3ul * 1024ul * 1024ul) {
+        text.insert(text.end(), lorem.begin(), lorem.end());
+    }
+    text.resize(3ul * 1024ul * 1024ul + 48ul);
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (auto const & name : {"ltc-aes-128-ecb",
+                              "ltc-aes-192-ecb",
+                              "ltc-aes-256-ecb",
+                              "ltc-aesni-aes-128-ecb",
+                              "ltc-aesni-aes-192-ecb",
+                              "ltc-aesni-aes-256-ecb"}) {
+
+        auto encryptor = std::string{name} + "-encryptor";
+        auto decryptor = std::string{name} + "-decryptor";
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, 1});
+        auto cipher = RunCipher(encryptor, text);
+        auto serial = RunCipher(decryptor, cipher);
+        ASSERT_EQ(serial.size(), cipher.size()) << name;
+        EXPECT_TRUE(std::equal(text.begin(), text.end(), serial.begin())) << name;
+
+        headcode::crypt::SetParallelism({1, 0});
+        EXPECT_EQ(RunCipher(encryptor, text, {7, 1024ul * 1024ul + 9}), cipher) << name;
+        EXPECT_EQ(RunCipher(decryptor, cipher), serial) << name;
+        EXPECT_EQ(RunCipher(decryptor, cipher, {5, 1024ul * 1024ul + 3, 11}), serial) << name;
+        EXPECT_EQ(RunCipher(decryptor, cipher, {2ul * 1024ul * 1024ul, 7}), serial) << name;
+
+        headcode::crypt::SetParallelism({1, 3});
+        EXPECT_EQ(RunCipher(decryptor, cipher, {1024ul * 1024ul + 16ul}), serial) << name;
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(SymmetricCipher_LTC_AES_ECB, parallel_in_place) {
+
+    auto lorem = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<std::byte> text;
+    while (text.size() < 2ul * 1024ul * 1024ul) {
+        text.insert(text.end(), lorem.begin(), lorem.end());
+    }
+    text.resize(2ul * 1024ul * 1024ul);
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (auto const & name : {"ltc-aes-128-ecb",
+                              "ltc-aes-192-ecb",
+                              "ltc-aes-256-ecb",
+                              "ltc-aesni-aes-128-ecb",
+                              "ltc-aesni-aes-192-ecb",
+                              "ltc-aesni-aes-256-ecb"}) {
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, 1});
+        auto cipher = RunCipher(std::string{name} + "-encryptor", text);
+        ASSERT_EQ(cipher.size(), text.size()) << name;
+
+        // decrypt in place, in two calls
+        headcode::crypt::SetParallelism({1, 0});
+        auto algo = CreateCipher(std::string{name} + "-decryptor");
+        ASSERT_NE(algo.get(), nullptr) << name;
+        auto data = reinterpret_cast<unsigned char *>(cipher.data());
+        std::uint64_t half = text.size() / 2;
+        std::uint64_t size_outgoing = half;
+        EXPECT_EQ(algo->Add(data, half, data, size_outgoing), 0) << name;
+        size_outgoing = cipher.size() - half;
+        EXPECT_EQ(algo->Add(data + half, cipher.size() - half, data + half, size_outgoing), 0) << name;
+
+        EXPECT_TRUE(std::equal(text.begin(), text.end(), cipher.begin())) << name;
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
@@ -0,0 +1,309 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Turns a hex string into memory.
+ * @param   hex         the hex string.
+ * @return  The memory.
+ */
+static std::vector<std::byte> FromHex(std::string const & hex) {
+    std::vector<std::byte> memory;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+        memory.push_back(static_cast<std::byte>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+    return memory;
+}
+
+
+/**
+ * @brief   Creates and initializes a GCM cipher.
+ * @param   name        name of the cipher.
+ * @param   key         the key.
+ * @param   iv          the IV.
+ * @param   aad         the additional authenticated data.
+ * @return  The cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name,
+                                                                std::vector<std::byte> const & key,
+                                                                std::vector<std::byte> const & iv,
+                                                                std::vector<std::byte> const & aad) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    if (algo != nullptr) {
+        EXPECT_EQ(algo->Initialize({{"key", key}, {"iv", iv}, {"aad", aad}}), 0) << name;
+    }
+    return algo;
+}
+
+
+/**
+ * @brief   Adds a text to a cipher in chunks.
+ * @param   algo        the cipher.
+ * @param   text        the text.
+ * @param   chunk       size of the chunks.
+ * @return  The output of the cipher.
+ */
+static std::vector<std::byte> AddChunks(headcode::crypt::Algorithm & algo,
+                                        std::vector<std::byte> const & text,
+                                        std::uint64_t chunk) {
+
+    std::vector<std::byte> result;
+    for (std::uint64_t offset = 0; offset < text.size(); offset += chunk) {
+        auto size = std::min<std::uint64_t>(chunk, text.size() - offset);
+        std::vector<std::byte> output;
+        EXPECT_EQ(algo.Add(headcode::crypt::ByteView{text}.subview(offset, size), output), 0);
+        EXPECT_EQ(output.size(), size);
+        result.insert(result.end(), output.begin(), output.end());
+    }
+    return result;
+}
+
+
+TEST(SymmetricCipher_LTC_AES_GCM, creation) {
+
+    for (auto const & [name, key_size] : std::map<std::string, std::uint64_t>{{"ltc-aes-128-gcm-encryptor", 16ul},
+                                                                             {"ltc-aes-128-gcm-decryptor", 16ul},
+                                                                             {"ltc-aes-256-gcm-encryptor", 32ul},
+                                                                             {"ltc-aes-256-gcm-decryptor", 32ul}}) {
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr) << name;
+
+        headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+        bool encryptor = name.find("encryptor") != std::string::npos;
+
+        EXPECT_STREQ(description.name_.c_str(), name.c_str());
+        EXPECT_EQ(description.family_, headcode::crypt::Family::kSymmetricCipher);
+        EXPECT_FALSE(description.description_short_.empty());
+        EXPECT_FALSE(description.description_long_.empty());
+        EXPECT_EQ(description.block_size_incoming_, 0ul);
+        EXPECT_EQ(description.result_size_, encryptor ? 16ul : 0ul);
+
+        EXPECT_EQ(description.initialization_argument_.size(), 3ul);
+        ASSERT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+        EXPECT_EQ(description.initialization_argument_.at("key").size_, key_size);
+        ASSERT_NE(description.initialization_argument_.find("iv"), description.initialization_argument_.end());
+        EXPECT_EQ(description.initialization_argument_.at("iv").size_, 12ul);
+        EXPECT_FALSE(description.initialization_argument_.at("iv").optional_);
+        ASSERT_NE(description.initialization_argument_.find("aad"), description.initialization_argument_.end());
+        EXPECT_TRUE(description.initialization_argument_.at("aad").optional_);
+
+        if (encryptor) {
+            EXPECT_TRUE(description.finalization_argument_.empty());
+        } else {
+            ASSERT_NE(description.finalization_argument_.find("tag"), description.finalization_argument_.end());
+            EXPECT_EQ(description.finalization_argument_.at("tag").size_, 16ul);
+            EXPECT_FALSE(description.finalization_argument_.at("tag").optional_);
+        }
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_AES_GCM, test_vectors) {
+
+    // The Galois/Counter Mode of Operation (GCM), McGrew and Viega: test cases 1, 2, 4, 13, 14 and 16
+    struct TestCase {
+        std::string bits_;
+        std::string key_;
+        std::string iv_;
+        std::string aad_;
+        std::string plain_;
+        std::string cipher_;
+        std::string tag_;
+    };
+
+    std::string const key_4 = "feffe9928665731c6d6a8f9467308308";
+    std::string const iv_4 = "cafebabefacedbaddecaf888";
+    std::string const aad_4 = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+    std::string const plain_4 =
+            "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+            "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39";
+
+    std::vector<TestCase> const test_cases{
+            {"128", std::string(32, '0'), std::string(24, '0'), "", "", "", "58e2fccefa7e3061367f1d57a4e7455a"},
+            {"128",
+             std::string(32, '0'),
+             std::string(24, '0'),
+             "",
+             std::string(32, '0'),
+             "0388dace60b6a392f328c2b971b2fe78",
+             "ab6e47d42cec13bdf53a67b21257bddf"},
+            {"128",
+             key_4,
+             iv_4,
+             aad_4,
+             plain_4,
+             "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+             "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+             "5bc94fbc3221a5db94fae95ae7121a47"},
+            {"256", std::string(64, '0'), std::string(24, '0'), "", "", "", "530f8afbc74536b9a963b4f1c4cb738b"},
+            {"256",
+             std::string(64, '0'),
+             std::string(24, '0'),
+             "",
+             std::string(32, '0'),
+             "cea7403d4d606b6e074ec5d3baf39d18",
+             "d0d1c8a799996bf0265b98b5d48ab919"},
+            {"256",
+             key_4 + key_4,
+             iv_4,
+             aad_4,
+             plain_4,
+             "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+             "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662",
+             "76fc6ece0f4e1768cddf8853bb2d551b"}};
+
+    for (auto const & test_case : test_cases) {
+
+        auto key = FromHex(test_case.key_);
+        auto iv = FromHex(test_case.iv_);
+        auto aad = FromHex(test_case.aad_);
+        auto plain = FromHex(test_case.plain_);
+        auto cipher = FromHex(test_case.cipher_);
+        auto tag = FromHex(test_case.tag_);
+        auto prefix = std::string{"ltc-aes-"} + test_case.bits_ + "-gcm-";
+
+        for (std::uint64_t chunk : {1ul, 7ul, 16ul, 64ul}) {
+
+            auto encryptor = CreateCipher(prefix + "encryptor", key, iv, aad);
+            ASSERT_NE(encryptor.get(), nullptr);
+            EXPECT_EQ(AddChunks(*encryptor, plain, chunk), cipher) << test_case.tag_;
+            std::vector<std::byte> result;
+            EXPECT_EQ(encryptor->Finalize(result), 0);
+            EXPECT_EQ(result, tag) << test_case.tag_;
+
+            auto decryptor = CreateCipher(prefix + "decryptor", key, iv, aad);
+            ASSERT_NE(decryptor.get(), nullptr);
+            EXPECT_EQ(AddChunks(*decryptor, cipher, chunk), plain) << test_case.tag_;
+            EXPECT_EQ(decryptor->Finalize(result, {{"tag", tag}}), 0) << test_case.tag_;
+        }
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_AES_GCM, authentication) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto aad = headcode::mem::StringToMemory("sector 42");
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto encryptor = CreateCipher("ltc-aes-128-gcm-encryptor", key, iv, aad);
+    ASSERT_NE(encryptor.get(), nullptr);
+    std::vector<std::byte> cipher;
+    ASSERT_EQ(encryptor->Add(plain, cipher), 0);
+    std::vector<std::byte> tag;
+    ASSERT_EQ(encryptor->Finalize(tag), 0);
+    ASSERT_EQ(tag.size(), 16ul);
+
+    auto decrypt = [&](std::vector<std::byte> const & data,
+                       std::vector<std::byte> const & data_aad,
+                       std::map<std::string, std::vector<std::byte>> const & finalization) {
+        auto decryptor = CreateCipher("ltc-aes-128-gcm-decryptor", key, iv, data_aad);
+        std::vector<std::byte> output;
+        EXPECT_EQ(decryptor->Add(data, output), 0);
+        std::vector<std::byte> result;
+        return decryptor->Finalize(result, finalization);
+    };
+
+    auto const kAuthenticationFailed = static_cast<int>(headcode::crypt::Error::kAuthenticationFailed);
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", tag}}), 0);
+
+    auto tampered = cipher;
+    tampered[100] ^= std::byte{0x01};
+    EXPECT_EQ(decrypt(tampered, aad, {{"tag", tag}}), kAuthenticationFailed);
+
+    auto tampered_tag = tag;
+    tampered_tag[15] ^= std::byte{0x80};
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", tampered_tag}}), kAuthenticationFailed);
+    EXPECT_EQ(decrypt(cipher, headcode::mem::StringToMemory("sector 43"), {{"tag", tag}}), kAuthenticationFailed);
+
+    // truncated tags down to 12 bytes are fine, shorter ones and none at all are not
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", std::vector<std::byte>{tag.begin(), tag.begin() + 12}}}), 0);
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", std::vector<std::byte>{tag.begin(), tag.begin() + 8}}}), kInvalidArgument);
+    EXPECT_EQ(decrypt(cipher, aad, {}), kInvalidArgument);
+}
+
+
+TEST(SymmetricCipher_LTC_AES_GCM, reset_refuses_iv_reuse) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto aad = headcode::mem::StringToMemory("sector 42");
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto algo = CreateCipher("ltc-aes-256-gcm-encryptor", key, iv, aad);
+    ASSERT_NE(algo.get(), nullptr);
+
+    std::vector<std::byte> cipher_first;
+    EXPECT_EQ(algo->Add(plain, cipher_first), 0);
+    std::vector<std::byte> tag_first;
+    EXPECT_EQ(algo->Finalize(tag_first), 0);
+
+    // the encryptor never runs twice with the same key and IV
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+    auto const kInvalidOperation = static_cast<int>(headcode::crypt::Error::kInvalidOperation);
+    EXPECT_EQ(algo->Reset(), kInvalidOperation);
+    EXPECT_TRUE(algo->IsFinalized());
+    EXPECT_EQ(algo->Reinitialize({{"iv", iv}, {"aad", aad}}), kInvalidArgument);
+
+    // a new IV only keeps the key: same output as a fresh instance
+    iv[0] ^= std::byte{0x01};
+    EXPECT_EQ(algo->Reinitialize({{"iv", iv}, {"aad", aad}}), 0);
+    std::vector<std::byte> cipher_second;
+    EXPECT_EQ(algo->Add(plain, cipher_second), 0);
+    std::vector<std::byte> tag_second;
+    EXPECT_EQ(algo->Finalize(tag_second), 0);
+    EXPECT_NE(cipher_first, cipher_second);
+    EXPECT_NE(tag_first, tag_second);
+
+    auto fresh = CreateCipher("ltc-aes-256-gcm-encryptor", key, iv, aad);
+    ASSERT_NE(fresh.get(), nullptr);
+    std::vector<std::byte> cipher_fresh;
+    EXPECT_EQ(fresh->Add(plain, cipher_fresh), 0);
+    std::vector<std::byte> tag_fresh;
+    EXPECT_EQ(fresh->Finalize(tag_fresh), 0);
+    EXPECT_EQ(cipher_second, cipher_fresh);
+    EXPECT_EQ(tag_second, tag_fresh);
+
+    // no IV without a key
+    auto unkeyed = headcode::crypt::Factory::Create("ltc-aes-256-gcm-encryptor");
+    ASSERT_NE(unkeyed.get(), nullptr);
+    EXPECT_EQ(unkeyed->Initialize({{"iv", iv}}), kInvalidArgument);
+
+    // the decryptor may run the same message again
+    auto decryptor = CreateCipher("ltc-aes-256-gcm-decryptor", key, iv, aad);
+    ASSERT_NE(decryptor.get(), nullptr);
+    for (int i = 0; i < 2; ++i) {
+        std::vector<std::byte> decrypted;
+        EXPECT_EQ(decryptor->Add(cipher_second, decrypted), 0);
+        EXPECT_EQ(decrypted, plain);
+        std::vector<std::byte> result;
+        EXPECT_EQ(decryptor->Finalize(result, {{"tag", tag_second}}), 0);
+        EXPECT_EQ(decryptor->Reset(), 0);
+    }
+}
@@ -0,0 +1,302 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Turns a hex string into memory.
+ * @param   hex         the hex string.
+ * @return  The memory.
+ */
+static std::vector<std::byte> FromHex(std::string const & hex) {
+    std::vector<std::byte> memory;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+        memory.push_back(static_cast<std::byte>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+    return memory;
+}
+
+
+/**
+ * @brief   Creates a key of the size needed by the cipher (two different halves).
+ * @param   algo        the cipher.
+ * @return  The key.
+ */
+static std::vector<std::byte> CreateKey(headcode::crypt::Algorithm const & algo) {
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious - Mary Poppins (1964)");
+    key.resize(algo.GetDescription().initialization_argument_.at("key").size_);
+    return key;
+}
+
+
+/**
+ * @brief   Creates and initializes a XTS cipher.
+ * @param   name        name of the cipher.
+ * @param   arguments   the initialization arguments (a key is created if missing).
+ * @return  The cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(
+        std::string const & name,
+        std::map<std::string, std::vector<std::byte>> arguments = {}) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    if (algo != nullptr) {
+        if (arguments.find("key") == arguments.end()) {
+            arguments.emplace("key", CreateKey(*algo));
+        }
+        EXPECT_EQ(algo->Initialize(arguments), 0) << name;
+    }
+    return algo;
+}
+
+
+/**
+ * @brief   Creates a disk image of some sectors filled with text.
+ * @param   size        size of the image.
+ * @return  The image.
+ */
+static std::vector<std::byte> CreateImage(std::uint64_t size) {
+    auto lorem = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<std::byte> image;
+    while (image.size() < size) {
+        image.insert(image.end(), lorem.begin(), lorem.end());
+    }
+    image.resize(size);
+    return image;
+}
+
+
+TEST(SymmetricCipher_LTC_AES_XTS, creation) {
+
+    for (auto const & name : {"ltc-aes-128-xts-encryptor",
+                              "ltc-aes-128-xts-decryptor",
+                              "ltc-aes-256-xts-encryptor",
+                              "ltc-aes-256-xts-decryptor"}) {
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr) << name;
+
+        auto const & description = algo->GetDescription();
+        EXPECT_STREQ(description.name_.c_str(), name);
+        EXPECT_EQ(description.family_, headcode::crypt::Family::kSymmetricCipher);
+        EXPECT_EQ(description.block_size_incoming_, 0ul);
+        EXPECT_EQ(description.result_size_, 0ul);
+        EXPECT_EQ(description.initialization_argument_.size(), 3ul);
+        EXPECT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+        EXPECT_NE(description.initialization_argument_.find("sector_size"),
+                  description.initialization_argument_.end());
+        EXPECT_NE(description.initialization_argument_.find("sector"), description.initialization_argument_.end());
+        EXPECT_TRUE(description.finalization_argument_.empty());
+
+        // no key, no sectors
+        std::vector<std::byte> output;
+        EXPECT_NE(algo->Add(std::vector<std::byte>(4096), output), 0) << name;
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_AES_XTS, test_vectors) {
+
+    // IEEE P1619 XTS-AES-128 vectors 2 and 3 (32 byte data units)
+    struct TestVector {
+        std::string key_;
+        std::string sector_;
+        std::string plain_;
+        std::string cipher_;
+    };
+    std::vector<TestVector> const test_vectors = {
+            {"1111111111111111111111111111111122222222222222222222222222222222",
+             "3333333333",
+             "4444444444444444444444444444444444444444444444444444444444444444",
+             "c454185e6a16936e39334038acef838bfb186fff7480adc4289382ecd6d394f0"},
+            {"fffefdfcfbfaf9f8f7f6f5f4f3f2f1f022222222222222222222222222222222",
+             "3333333333",
+             "4444444444444444444444444444444444444444444444444444444444444444",
+             "af85336b597afc1a900b2eb21ec949d292df4c047e0b21532186a5971a227a89"}};
+
+    for (auto const & test_vector : test_vectors) {
+
+        std::map<std::string, std::vector<std::byte>> arguments = {{"key", FromHex(test_vector.key_)},
+                                                                   {"sector_size", FromHex("20")},
+                                                                   {"sector", FromHex(test_vector.sector_)}};
+
+        auto encryptor = CreateCipher("ltc-aes-128-xts-encryptor", arguments);
+        ASSERT_NE(encryptor.get(), nullptr);
+        std::vector<std::byte> cipher;
+        EXPECT_EQ(encryptor->Add(FromHex(test_vector.plain_), cipher), 0);
+        EXPECT_EQ(cipher, FromHex(test_vector.cipher_));
+
+        auto decryptor = CreateCipher("ltc-aes-128-xts-decryptor", arguments);
+        ASSERT_NE(decryptor.get(), nullptr);
+        std::vector<std::byte> plain;
+        EXPECT_EQ(decryptor->Add(cipher, plain), 0);
+        EXPECT_EQ(plain, FromHex(test_vector.plain_));
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_AES_XTS, random_access) {
+
+    auto image = CreateImage(64ul * 4096ul);
+
+    for (auto const & name : {"ltc-aes-128-xts", "ltc-aes-256-xts"}) {
+
+        auto encryptor = CreateCipher(std::string{name} + "-encryptor");
+        ASSERT_NE(encryptor.get(), nullptr) << name;
+        std::vector<std::byte> cipher;
+        EXPECT_EQ(encryptor->Add(image, cipher), 0) << name;
+        ASSERT_EQ(cipher.size(), image.size()) << name;
+        EXPECT_NE(cipher, image) << name;
+
+        // decrypt single sectors picked from the image
+        auto decryptor = CreateCipher(std::string{name} + "-decryptor");
+        ASSERT_NE(decryptor.get(), nullptr) << name;
+        auto key = CreateKey(*decryptor);
+        for (std::uint64_t sector : {37ul, 0ul, 63ul, 5ul}) {
+            std::vector<std::byte> sector_number{std::byte{static_cast<unsigned char>(sector)}};
+            EXPECT_EQ(decryptor->Reinitialize({{"key", key}, {"sector", sector_number}}), 0) << name;
+            std::vector<std::byte> plain;
+            EXPECT_EQ(decryptor->Add(headcode::crypt::ByteView{cipher}.subview(sector * 4096ul, 4096ul), plain), 0)
+                    << name;
+            ASSERT_EQ(plain.size(), 4096ul) << name;
+            EXPECT_TRUE(std::equal(plain.begin(), plain.end(), image.begin() + sector * 4096ul)) << name;
+        }
+
+        // consecutive calls continue with the next sector
+        EXPECT_EQ(decryptor->Reinitialize({{"key", key}}), 0) << name;
+        std::vector<std::byte> plain;
+        for (std::uint64_t offset = 0; offset < cipher.size(); offset += 3ul * 4096ul) {
+            auto size = std::min<std::uint64_t>(3ul * 4096ul, cipher.size() - offset);
+            std::vector<std::byte> output;
+            EXPECT_EQ(decryptor->Add(headcode::crypt::ByteView{cipher}.subview(offset, size), output), 0) << name;
+            plain.insert(plain.end(), output.begin(), output.end());
+        }
+        EXPECT_EQ(plain, image) << name;
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_AES_XTS, sector_without_key) {
+
+    auto image = CreateImage(16ul * 512ul);
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+
+    for (auto const & name : {"ltc-aes-128-xts", "ltc-aes-256-xts"}) {
+
+        auto encryptor = CreateCipher(std::string{name} + "-encryptor", {{"sector_size", FromHex("0200")}});
+        ASSERT_NE(encryptor.get(), nullptr) << name;
+        std::vector<std::byte> cipher;
+        EXPECT_EQ(encryptor->Add(image, cipher), 0) << name;
+        ASSERT_EQ(cipher.size(), image.size()) << name;
+
+        // a new sector only: key and sector size are kept
+        auto decryptor = CreateCipher(std::string{name} + "-decryptor", {{"sector_size", FromHex("0200")}});
+        ASSERT_NE(decryptor.get(), nullptr) << name;
+        for (std::uint64_t sector : {9ul, 0ul, 15ul, 3ul}) {
+            std::vector<std::byte> sector_number{std::byte{static_cast<unsigned char>(sector)}};
+            EXPECT_EQ(decryptor->Reinitialize({{"sector", sector_number}}), 0) << name;
+            std::vector<std::byte> plain;
+            EXPECT_EQ(decryptor->Add(headcode::crypt::ByteView{cipher}.subview(sector * 512ul, 512ul), plain), 0)
+                    << name;
+            ASSERT_EQ(plain.size(), 512ul) << name;
+            EXPECT_TRUE(std::equal(plain.begin(), plain.end(), image.begin() + sector * 512ul)) << name;
+        }
+
+        // no sector without a key
+        auto unkeyed = headcode::crypt::Factory::Create(std::string{name} + "-decryptor");
+        ASSERT_NE(unkeyed.get(), nullptr) << name;
+        EXPECT_EQ(unkeyed->Initialize({{"sector", FromHex("01")}}), kInvalidArgument) << name;
+    }
+}
+
+TEST(SymmetricCipher_LTC_AES_XTS, parallel) {
+
+    auto image = CreateImage(3ul * 1024ul * 1024ul + 8ul * 512ul);
+    std::map<std::string, std::vector<std::byte>> arguments = {{"sector_size", FromHex("0200")},
+                                                               {"sector", FromHex("0100000000")}};
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (auto const & name : {"ltc-aes-128-xts", "ltc-aes-256-xts"}) {
+
+        auto encryptor = std::string{name} + "-encryptor";
+        auto decryptor = std::string{name} + "-decryptor";
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, 1});
+        std::vector<std::byte> serial;
+        auto algo = CreateCipher(encryptor, arguments);
+        ASSERT_NE(algo.get(), nullptr) << name;
+        EXPECT_EQ(algo->Add(image, serial), 0) << name;
+
+        for (auto threads : {0u, 3u}) {
+            headcode::crypt::SetParallelism({1, threads});
+            std::vector<std::byte> cipher;
+            algo = CreateCipher(encryptor, arguments);
+            EXPECT_EQ(algo->Add(image, cipher), 0) << name;
+            EXPECT_EQ(cipher, serial) << name;
+
+            // decrypt in place
+            algo = CreateCipher(decryptor, arguments);
+            auto data = reinterpret_cast<unsigned char *>(cipher.data());
+            std::uint64_t size_outgoing = cipher.size();
+            EXPECT_EQ(algo->Add(data, cipher.size(), data, size_outgoing), 0) << name;
+            EXPECT_EQ(cipher, image) << name;
+        }
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(SymmetricCipher_LTC_AES_XTS, invalid) {
+
+    auto algo = CreateCipher("ltc-aes-128-xts-encryptor");
+    ASSERT_NE(algo.get(), nullptr);
+
+    // whole sectors only
+    std::vector<std::byte> output;
+    EXPECT_EQ(algo->Add(std::vector<std::byte>(4096ul + 16ul), output),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+
+    auto key = CreateKey(*algo);
+    EXPECT_EQ(algo->Reinitialize({{"key", key}, {"sector_size", FromHex("08")}}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_EQ(algo->Reinitialize({{"key", key}, {"sector", FromHex("010203040506070809")}}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(SymmetricCipher_LTC_AES_XTS, reset) {
+
+    auto image = CreateImage(4ul * 4096ul);
+    auto algo = CreateCipher("ltc-aes-256-xts-encryptor", {{"sector", FromHex("2a")}});
+    ASSERT_NE(algo.get(), nullptr);
+
+    std::vector<std::byte> cipher_first;
+    EXPECT_EQ(algo->Add(image, cipher_first), 0);
+
+    // the next call continues with the next sectors: a different output
+    std::vector<std::byte> cipher_second;
+    EXPECT_EQ(algo->Add(image, cipher_second), 0);
+    EXPECT_NE(cipher_first, cipher_second);
+
+    // back to the first sector
+    EXPECT_EQ(algo->Reset(), 0);
+    std::vector<std::byte> cipher_third;
+    EXPECT_EQ(algo->Add(image, cipher_third), 0);
+    EXPECT_EQ(cipher_first, cipher_third);
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Runs a cipher on a text.
+ * @param   name        name of the cipher.
+ * @param   text        the text (of whole blocks).
+ * @return  The output of the cipher.
+ */
+static std::vector<std::byte> RunCipher(std::string const & name, std::vector<std::byte> const & text) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    std::vector<std::byte> result;
+    if (algo == nullptr) {
+        return result;
+    }
+
+    auto const & description = algo->GetDescription();
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(description.initialization_argument_.at("key").size_);
+    std::map<std::string, std::vector<std::byte>> initialization{{"key", key}};
+    if (description.initialization_argument_.find("iv") != description.initialization_argument_.end()) {
+        initialization.emplace("iv", headcode::mem::StringToMemory("0123456789abcdef"));
+    }
+
+    EXPECT_EQ(algo->Initialize(initialization), 0) << name;
+    EXPECT_EQ(algo->Add(text, result), 0) << name;
+    std::vector<std::byte> final_block;
+    EXPECT_EQ(algo->Finalize(final_block), 0) << name;
+    return result;
+}
+
+
+TEST(SymmetricCipher_LTC_AESNI, descriptions) {
+
+    for (auto const & bits : {"128", "192", "256"}) {
+        for (auto const & mode : {"ecb", "cbc"}) {
+            for (auto const & part : {"encryptor", "decryptor"}) {
+
+                auto suffix = std::string{"aes-"} + bits + "-" + mode + "-" + part;
+                auto software = headcode::crypt::Factory::Create("ltc-" + suffix);
+                auto aesni = headcode::crypt::Factory::Create("ltc-aesni-" + suffix);
+                ASSERT_NE(software.get(), nullptr) << suffix;
+                ASSERT_NE(aesni.get(), nullptr) << suffix;
+
+                auto const & description = aesni->GetDescription();
+                EXPECT_STREQ(description.name_.c_str(), ("ltc-aesni-" + suffix).c_str());
+                EXPECT_EQ(description.family_, headcode::crypt::Family::kSymmetricCipher);
+                EXPECT_FALSE(description.description_short_.empty());
+                EXPECT_FALSE(description.description_long_.empty());
+                EXPECT_EQ(description.block_size_incoming_, software->GetDescription().block_size_incoming_);
+                EXPECT_EQ(description.block_size_outgoing_, software->GetDescription().block_size_outgoing_);
+                EXPECT_EQ(description.initialization_argument_.size(),
+                          software->GetDescription().initialization_argument_.size());
+
+                // the provider tells the AES implementation picked
+                auto const & provider = description.provider_;
+                EXPECT_EQ(provider.find("libtomcrypt v"), 0ul) << provider;
+                EXPECT_TRUE((provider.find("(AES-NI)") != std::string::npos) ||
+                            (provider.find("(software AES)") != std::string::npos))
+                        << provider;
+                EXPECT_EQ(software->GetDescription().provider_.find("AES"), std::string::npos);
+            }
+        }
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_AESNI, same_as_software) {
+
+    // whole blocks only: the output of Add() is all there is
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    text.resize(64 * 16);
+
+    for (auto const & bits : {"128", "192", "256"}) {
+        for (auto const & mode : {"ecb", "cbc"}) {
+
+            auto suffix = std::string{"aes-"} + bits + "-" + mode + "-";
+            auto cipher = RunCipher("ltc-" + suffix + "encryptor", text);
+            ASSERT_FALSE(cipher.empty()) << suffix;
+            EXPECT_EQ(RunCipher("ltc-aesni-" + suffix + "encryptor", text), cipher) << suffix;
+
+            auto plain = RunCipher("ltc-" + suffix + "decryptor", cipher);
+            EXPECT_EQ(plain, text) << suffix;
+            EXPECT_EQ(RunCipher("ltc-aesni-" + suffix + "decryptor", cipher), plain) << suffix;
+        }
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Turns a hex string into memory.
+ * @param   hex         the hex string.
+ * @return  The memory.
+ */
+static std::vector<std::byte> FromHex(std::string const & hex) {
+    std::vector<std::byte> memory;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+        memory.push_back(static_cast<std::byte>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+    return memory;
+}
+
+
+/**
+ * @brief   Creates and initializes the ChaCha20 cipher.
+ * @param   arguments   the initialization arguments.
+ * @return  The cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(
+        std::map<std::string, std::vector<std::byte>> const & arguments) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-chacha20");
+    EXPECT_NE(algo.get(), nullptr);
+    if (algo != nullptr) {
+        EXPECT_EQ(algo->Initialize(arguments), 0);
+    }
+    return algo;
+}
+
+
+/**
+ * @brief   Adds a text to a cipher in chunks.
+ * @param   algo        the cipher.
+ * @param   text        the text.
+ * @param   chunk       size of the chunks.
+ * @return  The output of the cipher.
+ */
+static std::vector<std::byte> AddChunks(headcode::crypt::Algorithm & algo,
+                                        std::vector<std::byte> const & text,
+                                        std::uint64_t chunk) {
+
+    std::vector<std::byte> result;
+    for (std::uint64_t offset = 0; offset < text.size(); offset += chunk) {
+        auto size = std::min<std::uint64_t>(chunk, text.size() - offset);
+        std::vector<std::byte> output;
+        EXPECT_EQ(algo.Add(headcode::crypt::ByteView{text}.subview(offset, size), output), 0);
+        EXPECT_EQ(output.size(), size);
+        result.insert(result.end(), output.begin(), output.end());
+    }
+    return result;
+}
+
+
+TEST(SymmetricCipher_LTC_ChaCha20, creation) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-chacha20");
+    ASSERT_NE(algo.get(), nullptr);
+
+    headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+    EXPECT_STREQ(description.name_.c_str(), "ltc-chacha20");
+    EXPECT_EQ(description.family_, headcode::crypt::Family::kSymmetricCipher);
+    EXPECT_FALSE(description.description_short_.empty());
+    EXPECT_FALSE(description.description_long_.empty());
+    EXPECT_EQ(description.block_size_incoming_, 0ul);
+    EXPECT_EQ(description.result_size_, 0ul);
+
+    EXPECT_EQ(description.initialization_argument_.size(), 3ul);
+    ASSERT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+    EXPECT_EQ(description.initialization_argument_.at("key").size_, 32ul);
+    ASSERT_NE(description.initialization_argument_.find("iv"), description.initialization_argument_.end());
+    EXPECT_EQ(description.initialization_argument_.at("iv").size_, 12ul);
+    ASSERT_NE(description.initialization_argument_.find("counter"), description.initialization_argument_.end());
+    EXPECT_TRUE(description.initialization_argument_.at("counter").optional_);
+    EXPECT_TRUE(description.finalization_argument_.empty());
+
+    // no key, no data
+    std::vector<std::byte> output;
+    EXPECT_NE(algo->Add(std::vector<std::byte>(64), output), 0);
+}
+
+
+TEST(SymmetricCipher_LTC_ChaCha20, test_vectors) {
+
+    // RFC 8439, 2.4.2
+    auto key = FromHex("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    auto iv = FromHex("000000000000004a00000000");
+    auto plain = headcode::mem::StringToMemory(
+            "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, "
+            "sunscreen would be it.");
+    auto cipher = FromHex(
+            "6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0bf91b65c5524733ab8f593dabcd62b357"
+            "1639d624e65152ab8f530c359f0861d807ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+            "5af90bbf74a35be6b40b8eedf2785e42874d");
+
+    for (std::uint64_t chunk : {1ul, 7ul, 64ul, 128ul}) {
+        auto algo = CreateCipher({{"key", key}, {"iv", iv}, {"counter", FromHex("01")}});
+        ASSERT_NE(algo.get(), nullptr);
+        EXPECT_EQ(AddChunks(*algo, plain, chunk), cipher) << chunk;
+
+        // encryption and decryption are the same
+        algo = CreateCipher({{"key", key}, {"iv", iv}, {"counter", FromHex("00000001")}});
+        EXPECT_EQ(AddChunks(*algo, cipher, chunk), plain) << chunk;
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_ChaCha20, large) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto lorem = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<std::byte> plain;
+    while (plain.size() < 1024ul * 1024ul) {
+        plain.insert(plain.end(), lorem.begin(), lorem.end());
+    }
+    plain.resize(1024ul * 1024ul + 13ul);
+
+    // a 12 byte IV with a 32 bit counter and an 8 byte IV with a 64 bit counter
+    for (auto const & iv : {FromHex("000102030405060708090a0b"), FromHex("0001020304050607")}) {
+
+        // whole blocks on the SIMD kernels or byte by byte: the same output
+        auto algo = CreateCipher({{"key", key}, {"iv", iv}});
+        ASSERT_NE(algo.get(), nullptr);
+        auto cipher = AddChunks(*algo, plain, plain.size());
+        EXPECT_NE(cipher, plain);
+
+        for (std::uint64_t chunk : {1ul, 65ul, 511ul, 4096ul + 7ul}) {
+            algo = CreateCipher({{"key", key}, {"iv", iv}});
+            EXPECT_EQ(AddChunks(*algo, plain, chunk), cipher) << chunk;
+        }
+
+        // decrypt in place
+        algo = CreateCipher({{"key", key}, {"iv", iv}});
+        auto data = reinterpret_cast<unsigned char *>(cipher.data());
+        std::uint64_t size_outgoing = cipher.size();
+        EXPECT_EQ(algo->Add(data, cipher.size(), data, size_outgoing), 0);
+        EXPECT_EQ(cipher, plain);
+    }
+}
+
+
+TEST(SymmetricCipher_LTC_ChaCha20, counter) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = FromHex("000102030405060708090a0b");
+    auto plain = std::vector<std::byte>(64ul * 100ul);
+
+    auto algo = CreateCipher({{"key", key}, {"iv", iv}});
+    ASSERT_NE(algo.get(), nullptr);
+    auto cipher = AddChunks(*algo, plain, plain.size());
+
+    // starting at block 42 is the keystream from byte 42 * 64 on
+    algo = CreateCipher({{"key", key}, {"iv", iv}, {"counter", FromHex("2a")}});
+    auto tail = AddChunks(*algo, std::vector<std::byte>(plain.begin() + 42 * 64, plain.end()), 1000);
+    EXPECT_TRUE(std::equal(tail.begin(), tail.end(), cipher.begin() + 42 * 64));
+
+    // no more than 2^32 blocks on a 12 byte IV
+    algo = CreateCipher({{"key", key}, {"iv", iv}, {"counter", FromHex("fffffffe")}});
+    std::vector<std::byte> output;
+    EXPECT_EQ(algo->Add(std::vector<std::byte>(64), output), 0);
+    EXPECT_NE(algo->Add(std::vector<std::byte>(64), output), 0);
+
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+    EXPECT_EQ(algo->Reinitialize({{"key", key}, {"iv", iv}, {"counter", FromHex("0100000000")}}), kInvalidArgument);
+    EXPECT_EQ(algo->Reinitialize({{"key", key}, {"iv", FromHex("0001020304")}}), kInvalidArgument);
+}
+
+
+TEST(SymmetricCipher_LTC_ChaCha20, reset_refuses_iv_reuse) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = FromHex("000102030405060708090a0b");
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto algo = CreateCipher({{"key", key}, {"iv", iv}});
+    ASSERT_NE(algo.get(), nullptr);
+
+    std::vector<std::byte> cipher_first;
+    EXPECT_EQ(algo->Add(plain, cipher_first), 0);
+
+    // no way back to the IV: the keystream goes on
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+    auto const kInvalidOperation = static_cast<int>(headcode::crypt::Error::kInvalidOperation);
+    EXPECT_EQ(algo->Reset(), kInvalidOperation);
+    std::vector<std::byte> cipher_second;
+    EXPECT_EQ(algo->Add(plain, cipher_second), 0);
+    EXPECT_NE(cipher_first, cipher_second);
+
+    // a new IV only keeps the key: same output as a fresh instance
+    auto iv_other = FromHex("0b0a09080706050403020100");
+    EXPECT_EQ(algo->Reinitialize({{"iv", iv_other}}), 0);
+    auto cipher_third = AddChunks(*algo, plain, plain.size());
+    auto fresh = CreateCipher({{"key", key}, {"iv", iv_other}});
+    ASSERT_NE(fresh.get(), nullptr);
+    EXPECT_EQ(cipher_third, AddChunks(*fresh, plain, plain.size()));
+
+    // seeking within the stream of the first IV
+    EXPECT_EQ(algo->Reinitialize({{"iv", iv}, {"counter", FromHex("01")}}), 0);
+    auto tail = AddChunks(*algo, std::vector<std::byte>(plain.begin() + 64, plain.end()), 1000);
+    EXPECT_TRUE(std::equal(tail.begin(), tail.end(), cipher_first.begin() + 64));
+
+    // no IV without a key
+    auto unkeyed = headcode::crypt::Factory::Create("ltc-chacha20");
+    ASSERT_NE(unkeyed.get(), nullptr);
+    EXPECT_EQ(unkeyed->Initialize({{"iv", iv}}), kInvalidArgument);
+}
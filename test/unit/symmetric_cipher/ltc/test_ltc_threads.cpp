@@ -0,0 +1,101 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Creates and initializes a cipher.
+ * @param   name        name of the cipher.
+ * @return  The initialized cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    if (algo == nullptr) {
+        return algo;
+    }
+
+    std::map<std::string, std::vector<std::byte>> initialization;
+    for (auto const & [argument, description] : algo->GetDescription().initialization_argument_) {
+        auto memory = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+        memory.resize(description.size_);
+        initialization.emplace(argument, memory);
+    }
+    EXPECT_EQ(algo->Initialize(initialization), 0) << name;
+    return algo;
+}
+
+
+TEST(SymmetricCipher_LTC_Threads, destroyed_instance) {
+
+    // dropping an instance must not pull the cipher away from the others
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    text.resize(64 * 16);
+
+    auto algo = CreateCipher("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(algo.get(), nullptr);
+    CreateCipher("ltc-aes-128-cbc-encryptor").reset();
+    CreateCipher("ltc-aes-128-ecb-encryptor").reset();
+
+    std::vector<std::byte> cipher;
+    EXPECT_EQ(algo->Add(text, cipher), 0);
+    EXPECT_EQ(cipher.size(), text.size());
+
+    auto other = CreateCipher("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(other.get(), nullptr);
+    std::vector<std::byte> expected;
+    EXPECT_EQ(other->Add(text, expected), 0);
+    EXPECT_EQ(cipher, expected);
+}
+
+
+TEST(SymmetricCipher_LTC_Threads, concurrent) {
+
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    text.resize(64 * 16);
+
+    for (auto const & name : {"ltc-aes-128-ecb-encryptor", "ltc-aes-256-cbc-encryptor", "ltc-aes-192-cbc-decryptor"}) {
+
+        std::vector<std::byte> expected;
+        auto algo = CreateCipher(name);
+        ASSERT_NE(algo.get(), nullptr);
+        ASSERT_EQ(algo->Add(text, expected), 0);
+
+        std::vector<std::vector<std::byte>> results(8);
+        std::vector<std::thread> threads;
+        for (auto & result : results) {
+            threads.emplace_back([&]() {
+                for (int i = 0; i < 100; ++i) {
+                    auto cipher = CreateCipher(name);
+                    ASSERT_NE(cipher.get(), nullptr);
+                    result.clear();
+                    ASSERT_EQ(cipher->Add(text, result), 0);
+                }
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        for (auto const & result : results) {
+            EXPECT_EQ(result, expected) << name;
+        }
+    }
+}
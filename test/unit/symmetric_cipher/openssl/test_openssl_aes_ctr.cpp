@@ -0,0 +1,205 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Turns a hex string into memory.
+ * @param   hex         the hex string.
+ * @return  The memory.
+ */
+static std::vector<std::byte> FromHex(std::string const & hex) {
+    std::vector<std::byte> memory;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+        memory.push_back(static_cast<std::byte>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+    return memory;
+}
+
+
+/**
+ * @brief   Runs a CTR cipher on a text, handing the text in chunks of the given sizes.
+ * @param   name        name of the cipher.
+ * @param   key         the key.
+ * @param   iv          the initial counter block.
+ * @param   text        the text.
+ * @param   chunks      sizes of the chunks (the last chunk repeats until the text is done).
+ * @return  The output of the cipher.
+ */
+static std::vector<std::byte> RunCipher(std::string const & name,
+                                        std::vector<std::byte> const & key,
+                                        std::vector<std::byte> const & iv,
+                                        std::vector<std::byte> const & text,
+                                        std::vector<std::uint64_t> const & chunks = {}) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    std::vector<std::byte> result;
+    if (algo == nullptr) {
+        return result;
+    }
+    EXPECT_EQ(algo->Initialize({{"key", key}, {"iv", iv}}), 0) << name;
+
+    std::uint64_t offset = 0;
+    std::uint64_t chunk = text.size();
+    for (std::size_t i = 0; offset < text.size(); ++i) {
+        if (i < chunks.size()) {
+            chunk = chunks[i];
+        }
+        auto size = std::min<std::uint64_t>(chunk, text.size() - offset);
+        std::vector<std::byte> output;
+        EXPECT_EQ(algo->Add(headcode::crypt::ByteView{text}.subview(offset, size), output), 0) << name;
+        EXPECT_EQ(output.size(), size) << name;
+        result.insert(result.end(), output.begin(), output.end());
+        offset += size;
+    }
+
+    std::vector<std::byte> final_block;
+    EXPECT_EQ(algo->Finalize(final_block), 0) << name;
+    EXPECT_TRUE(final_block.empty()) << name;
+    return result;
+}
+
+
+TEST(SymmetricCipher_OpenSSL_AES_CTR, creation) {
+
+    for (auto const & [name, key_size] : std::map<std::string, std::uint64_t>{
+                 {"openssl-aes-128-ctr", 16ul}, {"openssl-aes-192-ctr", 24ul}, {"openssl-aes-256-ctr", 32ul}}) {
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr) << name;
+
+        headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+
+        EXPECT_STREQ(description.name_.c_str(), name.c_str());
+        EXPECT_EQ(description.family_, headcode::crypt::Family::kSymmetricCipher);
+        EXPECT_FALSE(description.description_short_.empty());
+        EXPECT_FALSE(description.description_long_.empty());
+        EXPECT_EQ(description.block_size_incoming_, 0ul);
+        EXPECT_EQ(description.block_size_outgoing_, 0ul);
+        EXPECT_EQ(description.result_size_, 0ul);
+
+        EXPECT_EQ(description.initialization_argument_.size(), 2ul);
+        ASSERT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+        EXPECT_EQ(description.initialization_argument_.at("key").size_, key_size);
+        EXPECT_FALSE(description.initialization_argument_.at("key").optional_);
+        ASSERT_NE(description.initialization_argument_.find("iv"), description.initialization_argument_.end());
+        EXPECT_EQ(description.initialization_argument_.at("iv").size_, 16ul);
+        EXPECT_FALSE(description.initialization_argument_.at("iv").optional_);
+
+        EXPECT_TRUE(description.finalization_argument_.empty());
+    }
+}
+
+
+TEST(SymmetricCipher_OpenSSL_AES_CTR, nist_sp800_38a) {
+
+    // NIST SP 800-38A, F.5.1, F.5.3 and F.5.5
+    auto iv = FromHex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+    auto plain = FromHex(
+            "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+            "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710");
+
+    std::map<std::string, std::pair<std::string, std::string>> const vectors{
+            {"openssl-aes-128-ctr",
+             {"2b7e151628aed2a6abf7158809cf4f3c",
+              "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+              "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee"}},
+            {"openssl-aes-192-ctr",
+             {"8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b",
+              "1abc932417521ca24f2b0459fe7e6e0b090339ec0aa6faefd5ccc2c6f4ce8e94"
+              "1e36b26bd1ebc670d1bd1d665620abf74f78a7f6d29809585a97daec58c6b050"}},
+            {"openssl-aes-256-ctr",
+             {"603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4",
+              "601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c5"
+              "2b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941a6"}}};
+
+    for (auto const & [name, vector] : vectors) {
+        auto key = FromHex(vector.first);
+        auto cipher = FromHex(vector.second);
+        EXPECT_EQ(RunCipher(name, key, iv, plain), cipher) << name;
+        EXPECT_EQ(RunCipher(name, key, iv, cipher), plain) << name;
+        EXPECT_EQ(RunCipher(name, key, iv, plain, {1, 7, 16, 5, 3}), cipher) << name;
+    }
+}
+
+
+TEST(SymmetricCipher_OpenSSL_AES_CTR, parallel) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = FromHex("00000000000000000000000000fffff0");
+    auto iv_wrap = FromHex("fffffffffffffffffffffffffffffff0");
+
+    auto lorem = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<std::byte> text;
+    while (text.size() < 3ul * 1024ul * 1024ul + 7ul) {
+        text.insert(text.end(), lorem.begin(), lorem.end());
+    }
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    for (auto const & name : {"openssl-aes-128-ctr", "openssl-aes-192-ctr", "openssl-aes-256-ctr"}) {
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr) << name;
+        auto key_algo = key;
+        key_algo.resize(algo->GetDescription().initialization_argument_.at("key").size_);
+
+        headcode::crypt::SetParallelism({headcode::crypt::Parallelism::kDefaultThreshold, 1});
+        auto serial = RunCipher(name, key_algo, iv, text);
+        auto serial_wrap = RunCipher(name, key_algo, iv_wrap, text);
+        ASSERT_EQ(serial.size(), text.size());
+
+        headcode::crypt::SetParallelism({1, 0});
+        EXPECT_EQ(RunCipher(name, key_algo, iv, text), serial) << name;
+        EXPECT_EQ(RunCipher(name, key_algo, iv, text, {5, 1024ul * 1024ul + 3, 11}), serial) << name;
+        EXPECT_EQ(RunCipher(name, key_algo, iv_wrap, text, {13, 2ul * 1024ul * 1024ul}), serial_wrap) << name;
+
+        headcode::crypt::SetParallelism({1, 3});
+        EXPECT_EQ(RunCipher(name, key_algo, iv, text, {9}), serial) << name;
+        EXPECT_EQ(RunCipher(name, key_algo, iv, serial), text) << name;
+    }
+    headcode::crypt::SetParallelism(parallelism);
+}
+
+
+TEST(SymmetricCipher_OpenSSL_AES_CTR, reset) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(16);
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto algo = headcode::crypt::Factory::Create("openssl-aes-128-ctr");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    std::vector<std::byte> cipher_first;
+    EXPECT_EQ(algo->Add(text, cipher_first), 0);
+    EXPECT_EQ(cipher_first.size(), text.size());
+
+    algo->Reset();
+    std::vector<std::byte> cipher_second;
+    EXPECT_EQ(algo->Add(text, cipher_second), 0);
+    EXPECT_EQ(cipher_first, cipher_second);
+
+    std::vector<std::byte> cipher_third;
+    EXPECT_EQ(algo->Add(text, cipher_third), 0);
+    EXPECT_NE(cipher_first, cipher_third);
+}
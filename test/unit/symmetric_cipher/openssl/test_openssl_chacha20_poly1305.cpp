@@ -0,0 +1,299 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Turns a hex string into memory.
+ * @param   hex         the hex string.
+ * @return  The memory.
+ */
+static std::vector<std::byte> FromHex(std::string const & hex) {
+    std::vector<std::byte> memory;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+        memory.push_back(static_cast<std::byte>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+    return memory;
+}
+
+
+/**
+ * @brief   Creates and initializes a ChaCha20-Poly1305 cipher.
+ * @param   name        name of the cipher.
+ * @param   key         the key.
+ * @param   iv          the IV.
+ * @param   aad         the additional authenticated data.
+ * @return  The cipher.
+ */
+static std::unique_ptr<headcode::crypt::Algorithm> CreateCipher(std::string const & name,
+                                                                std::vector<std::byte> const & key,
+                                                                std::vector<std::byte> const & iv,
+                                                                std::vector<std::byte> const & aad) {
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr) << name;
+    if (algo != nullptr) {
+        EXPECT_EQ(algo->Initialize({{"key", key}, {"iv", iv}, {"aad", aad}}), 0) << name;
+    }
+    return algo;
+}
+
+
+/**
+ * @brief   Adds a text to a cipher in chunks.
+ * @param   algo        the cipher.
+ * @param   text        the text.
+ * @param   chunk       size of the chunks.
+ * @return  The output of the cipher.
+ */
+static std::vector<std::byte> AddChunks(headcode::crypt::Algorithm & algo,
+                                        std::vector<std::byte> const & text,
+                                        std::uint64_t chunk) {
+
+    std::vector<std::byte> result;
+    for (std::uint64_t offset = 0; offset < text.size(); offset += chunk) {
+        auto size = std::min<std::uint64_t>(chunk, text.size() - offset);
+        std::vector<std::byte> output;
+        EXPECT_EQ(algo.Add(headcode::crypt::ByteView{text}.subview(offset, size), output), 0);
+        EXPECT_EQ(output.size(), size);
+        result.insert(result.end(), output.begin(), output.end());
+    }
+    return result;
+}
+
+
+/**
+ * @brief   The plain text of the RFC 8439 test vectors.
+ */
+static char const * const kSunscreen =
+        "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would "
+        "be it.";
+
+
+TEST(SymmetricCipher_OpenSSL_ChaCha20Poly1305, creation) {
+
+    for (auto const & name : {"openssl-chacha20-poly1305-encryptor", "openssl-chacha20-poly1305-decryptor"}) {
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr) << name;
+
+        headcode::crypt::Algorithm::Description const & description = algo->GetDescription();
+        bool encryptor = std::string{name}.find("encryptor") != std::string::npos;
+
+        EXPECT_STREQ(description.name_.c_str(), name);
+        EXPECT_EQ(description.family_, headcode::crypt::Family::kSymmetricCipher);
+        EXPECT_FALSE(description.description_short_.empty());
+        EXPECT_FALSE(description.description_long_.empty());
+        EXPECT_EQ(description.block_size_incoming_, 0ul);
+        EXPECT_EQ(description.result_size_, encryptor ? 16ul : 0ul);
+
+        EXPECT_EQ(description.initialization_argument_.size(), 3ul);
+        ASSERT_NE(description.initialization_argument_.find("key"), description.initialization_argument_.end());
+        EXPECT_EQ(description.initialization_argument_.at("key").size_, 32ul);
+        ASSERT_NE(description.initialization_argument_.find("iv"), description.initialization_argument_.end());
+        EXPECT_EQ(description.initialization_argument_.at("iv").size_, 12ul);
+        ASSERT_NE(description.initialization_argument_.find("aad"), description.initialization_argument_.end());
+        EXPECT_TRUE(description.initialization_argument_.at("aad").optional_);
+
+        if (encryptor) {
+            EXPECT_TRUE(description.finalization_argument_.empty());
+        } else {
+            ASSERT_NE(description.finalization_argument_.find("tag"), description.finalization_argument_.end());
+            EXPECT_FALSE(description.finalization_argument_.at("tag").optional_);
+        }
+    }
+}
+
+
+TEST(SymmetricCipher_OpenSSL_ChaCha20Poly1305, test_vectors) {
+
+    // RFC 8439, 2.8.2
+    auto key = FromHex("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f");
+    auto iv = FromHex("070000004041424344454647");
+    auto aad = FromHex("50515253c0c1c2c3c4c5c6c7");
+    auto plain = headcode::mem::StringToMemory(kSunscreen);
+    auto cipher = FromHex(
+            "d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d63dbea45e8ca9671282fafb69da92728b"
+            "1a71de0a9e060b2905d6a5b67ecd3b3692ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+            "3ff4def08e4b7a9de576d26586cec64b6116");
+    auto tag = FromHex("1ae10b594f09e26a7e902ecbd0600691");
+
+    for (std::uint64_t chunk : {1ul, 7ul, 64ul, 128ul}) {
+
+        auto encryptor = CreateCipher("openssl-chacha20-poly1305-encryptor", key, iv, aad);
+        ASSERT_NE(encryptor.get(), nullptr);
+        EXPECT_EQ(AddChunks(*encryptor, plain, chunk), cipher) << chunk;
+        std::vector<std::byte> result;
+        EXPECT_EQ(encryptor->Finalize(result), 0);
+        EXPECT_EQ(result, tag) << chunk;
+
+        auto decryptor = CreateCipher("openssl-chacha20-poly1305-decryptor", key, iv, aad);
+        ASSERT_NE(decryptor.get(), nullptr);
+        EXPECT_EQ(AddChunks(*decryptor, cipher, chunk), plain) << chunk;
+        EXPECT_EQ(decryptor->Finalize(result, {{"tag", tag}}), 0) << chunk;
+    }
+}
+
+
+TEST(SymmetricCipher_OpenSSL_ChaCha20Poly1305, authentication) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto aad = headcode::mem::StringToMemory("sector 42");
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto encryptor = CreateCipher("openssl-chacha20-poly1305-encryptor", key, iv, aad);
+    ASSERT_NE(encryptor.get(), nullptr);
+    std::vector<std::byte> cipher;
+    ASSERT_EQ(encryptor->Add(plain, cipher), 0);
+    std::vector<std::byte> tag;
+    ASSERT_EQ(encryptor->Finalize(tag), 0);
+    ASSERT_EQ(tag.size(), 16ul);
+
+    auto decrypt = [&](std::vector<std::byte> const & data,
+                       std::vector<std::byte> const & data_aad,
+                       std::map<std::string, std::vector<std::byte>> const & finalization) {
+        auto decryptor = CreateCipher("openssl-chacha20-poly1305-decryptor", key, iv, data_aad);
+        std::vector<std::byte> output;
+        EXPECT_EQ(decryptor->Add(data, output), 0);
+        std::vector<std::byte> result;
+        return decryptor->Finalize(result, finalization);
+    };
+
+    auto const kAuthenticationFailed = static_cast<int>(headcode::crypt::Error::kAuthenticationFailed);
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", tag}}), 0);
+
+    auto tampered = cipher;
+    tampered[100] ^= std::byte{0x01};
+    EXPECT_EQ(decrypt(tampered, aad, {{"tag", tag}}), kAuthenticationFailed);
+
+    auto tampered_tag = tag;
+    tampered_tag[15] ^= std::byte{0x80};
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", tampered_tag}}), kAuthenticationFailed);
+    EXPECT_EQ(decrypt(cipher, headcode::mem::StringToMemory("sector 43"), {{"tag", tag}}), kAuthenticationFailed);
+
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", std::vector<std::byte>{tag.begin(), tag.begin() + 12}}}), 0);
+    EXPECT_EQ(decrypt(cipher, aad, {{"tag", std::vector<std::byte>{tag.begin(), tag.begin() + 8}}}), kInvalidArgument);
+    EXPECT_EQ(decrypt(cipher, aad, {}), kInvalidArgument);
+}
+
+
+TEST(SymmetricCipher_OpenSSL_ChaCha20Poly1305, large) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto lorem = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<std::byte> plain;
+    while (plain.size() < 1024ul * 1024ul) {
+        plain.insert(plain.end(), lorem.begin(), lorem.end());
+    }
+    plain.resize(1024ul * 1024ul + 13ul);
+
+    // whole blocks on the SIMD kernels or byte by byte: the same cipher text
+    auto encryptor = CreateCipher("openssl-chacha20-poly1305-encryptor", key, iv, {});
+    ASSERT_NE(encryptor.get(), nullptr);
+    auto cipher = AddChunks(*encryptor, plain, plain.size());
+    std::vector<std::byte> tag;
+    EXPECT_EQ(encryptor->Finalize(tag), 0);
+
+    for (std::uint64_t chunk : {65ul, 511ul, 4096ul + 7ul}) {
+        encryptor = CreateCipher("openssl-chacha20-poly1305-encryptor", key, iv, {});
+        EXPECT_EQ(AddChunks(*encryptor, plain, chunk), cipher) << chunk;
+        std::vector<std::byte> result;
+        EXPECT_EQ(encryptor->Finalize(result), 0);
+        EXPECT_EQ(result, tag) << chunk;
+    }
+
+    // decrypt in place
+    auto decryptor = CreateCipher("openssl-chacha20-poly1305-decryptor", key, iv, {});
+    ASSERT_NE(decryptor.get(), nullptr);
+    auto data = reinterpret_cast<unsigned char *>(cipher.data());
+    std::uint64_t size_outgoing = cipher.size();
+    EXPECT_EQ(decryptor->Add(data, cipher.size(), data, size_outgoing), 0);
+    EXPECT_EQ(cipher, plain);
+    std::vector<std::byte> result;
+    EXPECT_EQ(decryptor->Finalize(result, {{"tag", tag}}), 0);
+}
+
+
+TEST(SymmetricCipher_OpenSSL_ChaCha20Poly1305, reset_refuses_iv_reuse) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto aad = headcode::mem::StringToMemory("sector 42");
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto algo = CreateCipher("openssl-chacha20-poly1305-encryptor", key, iv, aad);
+    ASSERT_NE(algo.get(), nullptr);
+
+    std::vector<std::byte> cipher_first;
+    EXPECT_EQ(algo->Add(plain, cipher_first), 0);
+    std::vector<std::byte> tag_first;
+    EXPECT_EQ(algo->Finalize(tag_first), 0);
+
+    // the encryptor never runs twice with the same key and IV
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+    auto const kInvalidOperation = static_cast<int>(headcode::crypt::Error::kInvalidOperation);
+    EXPECT_EQ(algo->Reset(), kInvalidOperation);
+    EXPECT_TRUE(algo->IsFinalized());
+    EXPECT_EQ(algo->Reinitialize({{"iv", iv}, {"aad", aad}}), kInvalidArgument);
+
+    // a new IV only keeps the key: same output as a fresh instance
+    iv[0] ^= std::byte{0x01};
+    EXPECT_EQ(algo->Reinitialize({{"iv", iv}, {"aad", aad}}), 0);
+    std::vector<std::byte> cipher_second;
+    EXPECT_EQ(algo->Add(plain, cipher_second), 0);
+    std::vector<std::byte> tag_second;
+    EXPECT_EQ(algo->Finalize(tag_second), 0);
+    EXPECT_NE(cipher_first, cipher_second);
+    EXPECT_NE(tag_first, tag_second);
+
+    auto fresh = CreateCipher("openssl-chacha20-poly1305-encryptor", key, iv, aad);
+    ASSERT_NE(fresh.get(), nullptr);
+    std::vector<std::byte> cipher_fresh;
+    EXPECT_EQ(fresh->Add(plain, cipher_fresh), 0);
+    std::vector<std::byte> tag_fresh;
+    EXPECT_EQ(fresh->Finalize(tag_fresh), 0);
+    EXPECT_EQ(cipher_second, cipher_fresh);
+    EXPECT_EQ(tag_second, tag_fresh);
+
+    // no IV without a key
+    auto unkeyed = headcode::crypt::Factory::Create("openssl-chacha20-poly1305-encryptor");
+    ASSERT_NE(unkeyed.get(), nullptr);
+    EXPECT_EQ(unkeyed->Initialize({{"iv", iv}}), kInvalidArgument);
+
+    // the decryptor may run the same message again
+    auto decryptor = CreateCipher("openssl-chacha20-poly1305-decryptor", key, iv, aad);
+    ASSERT_NE(decryptor.get(), nullptr);
+    for (int i = 0; i < 2; ++i) {
+        std::vector<std::byte> decrypted;
+        EXPECT_EQ(decryptor->Add(cipher_second, decrypted), 0);
+        EXPECT_EQ(decrypted, plain);
+        std::vector<std::byte> result;
+        EXPECT_EQ(decryptor->Finalize(result, {{"tag", tag_second}}), 0);
+        EXPECT_EQ(decryptor->Reset(), 0);
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+
+
+/**
+ * @brief   An algorithm written before Reset() existed: it does not override Reset_().
+ * It copies blocks of 4 bytes.
+ */
+class LegacyAlgorithm : public headcode::crypt::Algorithm {
+
+    int Add_(unsigned char const * block_incoming,
+             std::uint64_t size_incoming,
+             unsigned char * block_outgoing,
+             std::uint64_t & size_outgoing) override {
+        if (size_incoming > 0) {
+            std::memcpy(block_outgoing, block_incoming, size_incoming);
+        }
+        size_outgoing = size_incoming;
+        return 0;
+    }
+
+    int Finalize_(unsigned char *,
+                  std::uint64_t,
+                  std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) override {
+        return 0;
+    }
+
+    Description const & GetDescription_() const override {
+        static Description description = {"legacy",
+                                          headcode::crypt::Family::kHash,
+                                          "Legacy",
+                                          "An algorithm without Reset_().",
+                                          "test",
+                                          4ul,
+                                          headcode::crypt::ProcessingBlockSize::kSame,
+                                          4ul,
+                                          headcode::crypt::PaddingStrategy::PADDING_NONE,
+                                          0ul,
+                                          {},
+                                          {}};
+        return description;
+    }
+
+    int Initialize_(std::map<std::string, std::tuple<unsigned char const *, std::uint64_t>> const &) override {
+        return 0;
+    }
+};
+
+
+TEST(Algorithm, reset_default) {
+
+    LegacyAlgorithm algorithm;
+    EXPECT_EQ(algorithm.Initialize(), 0);
+    EXPECT_EQ(algorithm.Add(std::string_view{"abc"}), 0);
+    std::vector<std::byte> result;
+    EXPECT_EQ(algorithm.Finalize(result), 0);
+    EXPECT_TRUE(algorithm.IsFinalized());
+
+    EXPECT_EQ(algorithm.Reset(), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+    EXPECT_TRUE(algorithm.IsFinalized());
+
+    // Reinitialize() still works without Reset_()
+    EXPECT_EQ(algorithm.Reinitialize(std::map<std::string, std::vector<std::byte>>{}), 0);
+    EXPECT_FALSE(algorithm.IsFinalized());
+}
+
+
+TEST(Algorithm, reset_refused_keeps_carry) {
+
+    LegacyAlgorithm algorithm;
+    EXPECT_EQ(algorithm.Initialize(), 0);
+
+    // 3 bytes wait for the 4th in the carry buffer
+    std::vector<std::byte> outgoing;
+    EXPECT_EQ(algorithm.Add(std::string_view{"abc"}, outgoing), 0);
+    EXPECT_TRUE(outgoing.empty());
+
+    EXPECT_EQ(algorithm.Reset(), static_cast<int>(headcode::crypt::Error::kInvalidOperation));
+
+    EXPECT_EQ(algorithm.Add(std::string_view{"d"}, outgoing), 0);
+    ASSERT_EQ(outgoing.size(), 4ul);
+    EXPECT_EQ(std::memcmp(outgoing.data(), "abcd", 4), 0);
+}
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+#include <headcode/mem/mem.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Computes the digest of a single message the classic way.
+ * @param   name        name of the hash.
+ * @param   message     the message.
+ * @return  the digest.
+ */
+static std::vector<std::byte> ComputeDigest(std::string const & name, headcode::crypt::ByteView message) {
+    auto algo = headcode::crypt::Factory::Create(name);
+    EXPECT_NE(algo.get(), nullptr);
+    std::vector<std::byte> digest;
+    if (algo != nullptr) {
+        EXPECT_EQ(algo->Initialize(), 0);
+        EXPECT_EQ(algo->Add(message), 0);
+        EXPECT_EQ(algo->Finalize(digest), 0);
+    }
+    return digest;
+}
+
+
+/**
+ * @brief   Checks that a batch hasher matches the classic algorithm on messages of many sizes.
+ * @param   name        name of the hash.
+ * @param   max_lanes   max lanes of the batch hasher.
+ */
+static void CheckBatch(std::string const & name, std::uint64_t max_lanes) {
+
+    auto hasher = headcode::crypt::Factory::CreateBatchHasher(name, max_lanes);
+    ASSERT_NE(hasher.get(), nullptr);
+    EXPECT_STREQ(hasher->GetDescription().name_.c_str(), name.c_str());
+    if (max_lanes > 0) {
+        EXPECT_LE(hasher->GetLanes(), max_lanes);
+    }
+
+    // messages of any size in mixed order: lanes finish at different times
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    std::vector<headcode::crypt::ByteView> messages;
+    for (std::uint64_t i = 0; i < 150; ++i) {
+        auto size = (i * 37) % 300;
+        messages.emplace_back(text.data() + i, size);
+    }
+
+    std::vector<std::byte> digests;
+    ASSERT_EQ(hasher->Hash(messages, digests), 0);
+
+    auto result_size = hasher->GetDescription().result_size_;
+    ASSERT_EQ(digests.size(), messages.size() * result_size);
+    for (std::uint64_t i = 0; i < messages.size(); ++i) {
+        auto expected = ComputeDigest(name, messages[i]);
+        auto digest = std::vector<std::byte>{digests.begin() + i * result_size,
+                                             digests.begin() + (i + 1) * result_size};
+        EXPECT_EQ(digest, expected) << name << ", lanes " << hasher->GetLanes() << ", message " << i;
+    }
+}
+
+
+TEST(BatchHasher, multi_buffer) {
+    for (auto const & name : {"hcs-mb-md5", "hcs-mb-sha1", "hcs-mb-sha256"}) {
+        CheckBatch(name, 1);
+        CheckBatch(name, 4);
+        CheckBatch(name, 8);
+        CheckBatch(name, 0);
+    }
+}
+
+
+TEST(BatchHasher, lanes) {
+    auto single = headcode::crypt::Factory::CreateBatchHasher("hcs-mb-sha256", 1);
+    ASSERT_NE(single.get(), nullptr);
+    EXPECT_EQ(single->GetLanes(), 1ul);
+
+    auto best = headcode::crypt::Factory::CreateBatchHasher("hcs-mb-sha256");
+    ASSERT_NE(best.get(), nullptr);
+    EXPECT_GE(best->GetLanes(), 1ul);
+    EXPECT_LE(best->GetLanes(), 8ul);
+}
+
+
+TEST(BatchHasher, serial) {
+    auto hasher = headcode::crypt::Factory::CreateBatchHasher("ltc-sha256");
+    ASSERT_NE(hasher.get(), nullptr);
+    EXPECT_EQ(hasher->GetLanes(), 1ul);
+    CheckBatch("ltc-sha256", 0);
+}
+
+
+TEST(BatchHasher, small) {
+
+    auto hasher = headcode::crypt::Factory::CreateBatchHasher("hcs-mb-sha256");
+    ASSERT_NE(hasher.get(), nullptr);
+
+    auto text = std::string{"The quick brown fox jumps over the lazy dog."};
+    std::vector<headcode::crypt::ByteView> messages{headcode::crypt::ByteView{text}, {}};
+    std::vector<std::byte> digests;
+    EXPECT_EQ(hasher->Hash(messages, digests), 0);
+    EXPECT_EQ(digests.size(), 64ul);
+
+    auto first = std::vector<std::byte>{digests.begin(), digests.begin() + 32};
+    auto second = std::vector<std::byte>{digests.begin() + 32, digests.end()};
+    auto expected = std::string{"a83e558088b4bc88bf3bbdaf6d0bb98ef2291288c12f1f5289d6f9f82d03f4ec"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(first).c_str(), expected.c_str());
+    expected = std::string{"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(second).c_str(), expected.c_str());
+
+    // no messages, no digests
+    EXPECT_EQ(hasher->Hash(std::vector<headcode::crypt::ByteView>{}, digests), 0);
+    EXPECT_TRUE(digests.empty());
+}
+
+
+TEST(BatchHasher, invalid) {
+
+    EXPECT_EQ(headcode::crypt::Factory::CreateBatchHasher("this-is-not-a-hash"), nullptr);
+    EXPECT_EQ(headcode::crypt::Factory::CreateBatchHasher("copy"), nullptr);
+
+    auto hasher = headcode::crypt::Factory::CreateBatchHasher("hcs-mb-sha256");
+    ASSERT_NE(hasher.get(), nullptr);
+
+    std::vector<headcode::crypt::ByteView> messages{headcode::crypt::ByteView{kIpsumLoremText},
+                                                    headcode::crypt::ByteView{kIpsumLoremText}};
+    std::vector<std::byte> digests(32);
+    EXPECT_EQ(hasher->Hash(messages.data(), messages.size(), headcode::crypt::MutableByteView{digests}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_EQ(hasher->Hash(nullptr, 2, headcode::crypt::MutableByteView{digests}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
@@ -0,0 +1,164 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(ByteView, views) {
+
+    headcode::crypt::ByteView empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.data(), nullptr);
+    EXPECT_EQ(empty.size(), 0ul);
+
+    std::string_view text{"The quick brown fox jumps over the lazy dog."};
+    headcode::crypt::ByteView text_view{text};
+    EXPECT_FALSE(text_view.empty());
+    EXPECT_EQ(text_view.data(), reinterpret_cast<unsigned char const *>(text.data()));
+    EXPECT_EQ(text_view.size(), text.size());
+
+    auto sub_view = text_view.subview(4, 5);
+    EXPECT_EQ(sub_view.size(), 5ul);
+    EXPECT_EQ(std::memcmp(sub_view.data(), "quick", 5), 0);
+
+    std::vector<std::byte> memory{16};
+    headcode::crypt::MutableByteView memory_view{memory};
+    EXPECT_EQ(memory_view.data(), reinterpret_cast<unsigned char *>(memory.data()));
+    EXPECT_EQ(memory_view.size(), memory.size());
+
+    headcode::crypt::ByteView memory_const_view = memory_view;
+    EXPECT_EQ(memory_const_view.data(), memory_view.data());
+    EXPECT_EQ(memory_const_view.size(), memory_view.size());
+}
+
+
+TEST(ByteView, hash) {
+
+    auto algo = headcode::crypt::Factory::Create("ltc-sha256");
+    ASSERT_NE(algo.get(), nullptr);
+    EXPECT_EQ(algo->Initialize(), 0);
+
+    std::string_view text{kIpsumLoremText};
+    EXPECT_EQ(algo->Add(text.substr(0, 1000)), 0);
+    EXPECT_EQ(algo->Add(headcode::crypt::ByteView{text}.subview(1000, text.size() - 1000)), 0);
+
+    std::vector<std::byte> hash{algo->GetDescription().result_size_};
+    EXPECT_EQ(algo->Finalize(headcode::crypt::MutableByteView{hash}), 0);
+
+    auto expected = std::string{"8372e8dc1413d0636d8db66e5f8f4f885e703e67c736aa80a881ac400dc8613b"};
+    EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+}
+
+
+TEST(ByteView, cipher) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+
+    auto algo = headcode::crypt::Factory::Create("ltc-aes-128-ecb-encryptor");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+
+    auto algo_reference = headcode::crypt::Factory::Create("ltc-aes-128-ecb-encryptor");
+    ASSERT_NE(algo_reference.get(), nullptr);
+    ASSERT_EQ(algo_reference->Initialize({{"key", key}}), 0);
+
+    std::vector<std::byte> expected;
+    EXPECT_EQ(algo_reference->Add(kIpsumLoremText, expected), 0);
+
+    // feed 2 partial blocks: the first call has no whole block yet
+    std::string_view text{kIpsumLoremText};
+    unsigned char cipher[4096];
+    std::uint64_t cipher_size = 0;
+    EXPECT_EQ(algo->GetOutgoingSize(10), 0ul);
+    EXPECT_EQ(algo->Add(text.substr(0, 10), headcode::crypt::MutableByteView{cipher, sizeof(cipher)}, cipher_size), 0);
+    EXPECT_EQ(cipher_size, 0ul);
+
+    // too small outgoing memory is refused
+    auto size_needed = algo->GetOutgoingSize(text.size() - 10);
+    EXPECT_EQ(size_needed, expected.size());
+    EXPECT_NE(algo->Add(text.substr(10), headcode::crypt::MutableByteView{cipher, size_needed - 1}, cipher_size), 0);
+
+    EXPECT_EQ(algo->Add(text.substr(10), headcode::crypt::MutableByteView{cipher, sizeof(cipher)}, cipher_size), 0);
+    ASSERT_EQ(cipher_size, expected.size());
+    EXPECT_EQ(std::memcmp(cipher, expected.data(), expected.size()), 0);
+}
+
+
+TEST(ByteView, finalize_carry) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("0123456789abcdef");
+
+    auto encryptor = headcode::crypt::Factory::Create("ltc-aes-128-cbc-encryptor");
+    ASSERT_NE(encryptor.get(), nullptr);
+    ASSERT_EQ(encryptor->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    // 1000 bytes: 62 whole blocks and 8 bytes left in the carry buffer until Finalize()
+    std::string_view text{kIpsumLoremText};
+    text = text.substr(0, 1000);
+    auto padded_size = (text.size() / 16ul + 1ul) * 16ul;
+
+    unsigned char cipher[1024];
+    std::uint64_t cipher_size = 0;
+    EXPECT_EQ(encryptor->Add(text, headcode::crypt::MutableByteView{cipher, sizeof(cipher)}, cipher_size), 0);
+    EXPECT_EQ(cipher_size, 992ul);
+
+    // the last block does not fit: refused, nothing lost
+    EXPECT_EQ(encryptor->GetFinalizeSize(), 16ul);
+    EXPECT_EQ(encryptor->Finalize(headcode::crypt::MutableByteView{cipher + cipher_size, 15}),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_FALSE(encryptor->IsFinalized());
+
+    EXPECT_EQ(encryptor->Finalize(headcode::crypt::MutableByteView{cipher + cipher_size, 16}), 0);
+    cipher_size += 16;
+    ASSERT_EQ(cipher_size, padded_size);
+    EXPECT_EQ(encryptor->GetFinalizeSize(), 0ul);
+
+    // same cipher as of the vector based Finalize()
+    ASSERT_EQ(encryptor->Reset(), 0);
+    std::vector<std::byte> expected;
+    std::vector<std::byte> expected_tail;
+    EXPECT_EQ(encryptor->Add(text, expected), 0);
+    EXPECT_EQ(encryptor->Finalize(expected_tail), 0);
+    expected.insert(expected.end(), expected_tail.begin(), expected_tail.end());
+    ASSERT_EQ(expected.size(), padded_size);
+    EXPECT_EQ(std::memcmp(cipher, expected.data(), expected.size()), 0);
+
+    // and as of the raw memory Finalize()
+    ASSERT_EQ(encryptor->Reset(), 0);
+    unsigned char cipher_raw[1024];
+    std::uint64_t cipher_raw_size = 0;
+    EXPECT_EQ(encryptor->Add(text, headcode::crypt::MutableByteView{cipher_raw, sizeof(cipher_raw)}, cipher_raw_size),
+              0);
+    EXPECT_NE(encryptor->Finalize(cipher_raw + cipher_raw_size, 8, {}), 0);
+    EXPECT_EQ(encryptor->Finalize(cipher_raw + cipher_raw_size, 16, {}), 0);
+    EXPECT_EQ(std::memcmp(cipher_raw, expected.data(), expected.size()), 0);
+
+    // round trip
+    auto decryptor = headcode::crypt::Factory::Create("ltc-aes-128-cbc-decryptor");
+    ASSERT_NE(decryptor.get(), nullptr);
+    ASSERT_EQ(decryptor->Initialize({{"key", key}, {"iv", iv}}), 0);
+
+    std::vector<std::byte> plain;
+    std::vector<std::byte> plain_tail;
+    EXPECT_EQ(decryptor->Add(headcode::crypt::ByteView{cipher, cipher_size}, plain), 0);
+    EXPECT_EQ(decryptor->Finalize(plain_tail), 0);
+    plain.insert(plain.end(), plain_tail.begin(), plain_tail.end());
+    ASSERT_EQ(plain.size(), padded_size);
+    EXPECT_EQ(std::memcmp(plain.data(), text.data(), text.size()), 0);
+}
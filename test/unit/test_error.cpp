@@ -27,3 +27,9 @@ TEST(Error, text_invalid_operation) {
     auto text = headcode::crypt::GetErrorText(headcode::crypt::Error::kInvalidOperation);
     EXPECT_FALSE(text.empty());
 }
+
+
+TEST(Error, text_authentication_failed) {
+    auto text = headcode::crypt::GetErrorText(headcode::crypt::Error::kAuthenticationFailed);
+    EXPECT_FALSE(text.empty());
+}
@@ -6,6 +6,11 @@
  * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
  */
 
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <headcode/crypt/crypt.hpp>
@@ -22,19 +27,63 @@ TEST(Factory, list_symmetric_cipher) {
     auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
 
     std::uint64_t symmetric_cyphers_count{0};
-    for (auto const & [name, description] : algorithms) {
+    for (auto const & [name, description] : *algorithms) {
         if (description.family_ == headcode::crypt::Family::kSymmetricCipher) {
             symmetric_cyphers_count++;
         }
     }
 
-    std::uint64_t expected_count = 13ul;
+    std::uint64_t expected_count = 39ul;
 #ifdef OPENSSL
-    expected_count += 12ul;
+    expected_count += 25ul;
 #endif
 
     EXPECT_EQ(symmetric_cyphers_count, expected_count);
-    EXPECT_NE(algorithms.find("copy"), algorithms.end());
+    EXPECT_NE(algorithms->find("copy"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-128-ecb-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-128-ecb-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-128-cbc-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-128-cbc-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-192-ecb-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-192-ecb-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-192-cbc-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-192-cbc-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-256-ecb-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-256-ecb-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-256-cbc-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aesni-aes-256-cbc-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-128-ctr"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-192-ctr"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-256-ctr"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-128-gcm-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-128-gcm-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-256-gcm-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-256-gcm-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-128-xts-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-128-xts-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-256-xts-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-aes-256-xts-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-chacha20"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-chacha20-poly1305-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-chacha20-poly1305-decryptor"), algorithms->end());
+
+#ifdef OPENSSL
+
+    EXPECT_NE(algorithms->find("openssl-aes-128-ctr"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-192-ctr"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-256-ctr"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-128-gcm-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-128-gcm-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-256-gcm-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-256-gcm-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-128-xts-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-128-xts-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-256-xts-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-aes-256-xts-decryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-chacha20-poly1305-encryptor"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-chacha20-poly1305-decryptor"), algorithms->end());
+
+#endif
 }
 
 
@@ -43,42 +92,139 @@ TEST(Factory, list_hashes) {
     auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
 
     std::uint64_t hashes_count{0};
-    for (auto const & [name, description] : algorithms) {
+    for (auto const & [name, description] : *algorithms) {
         if (description.family_ == headcode::crypt::Family::kHash) {
             hashes_count++;
         }
     }
 
-    std::uint64_t expected_count = 12ul;
+    std::uint64_t expected_count = 34ul;
 #ifdef OPENSSL
-    expected_count += 7ul;
+    expected_count += 9ul;
 #endif
 
     EXPECT_EQ(hashes_count, expected_count);
 
-    EXPECT_NE(algorithms.find("nohash"), algorithms.end());
+    EXPECT_NE(algorithms->find("nohash"), algorithms->end());
+
+    EXPECT_NE(algorithms->find("ltc-blake2b-256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-blake2b-512"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-blake2s-256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-md5"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-ripemd128"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-ripemd160"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-ripemd256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-ripemd320"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha1"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha224"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha384"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha512"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha512-224"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha512-256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha3-224"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha3-256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha3-384"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-sha3-512"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-shake128"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-shake256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-tiger192"), algorithms->end());
+
+    EXPECT_NE(algorithms->find("hcs-mb-md5"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-mb-sha1"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-mb-sha256"), algorithms->end());
+
+    EXPECT_NE(algorithms->find("hcs-shani-sha1"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-shani-sha224"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-shani-sha256"), algorithms->end());
+
+    EXPECT_NE(algorithms->find("hcs-blake2bp"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-blake2sp"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-blake3"), algorithms->end());
+
+    EXPECT_NE(algorithms->find("hcs-siphash-2-4"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-siphash-2-4-128"), algorithms->end());
+
+#ifdef OPENSSL
+
+    EXPECT_NE(algorithms->find("openssl-md5"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-ripemd160"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha1"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha224"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha256"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha384"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha512"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha512-224"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-sha512-256"), algorithms->end());
+
+#endif
+}
+
+
+TEST(Factory, list_checksums) {
+
+    auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
+
+    std::uint64_t checksums_count{0};
+    for (auto const & [name, description] : *algorithms) {
+        if (description.family_ == headcode::crypt::Family::kChecksum) {
+            checksums_count++;
+        }
+    }
+
+    EXPECT_EQ(checksums_count, 3ul);
+
+    EXPECT_NE(algorithms->find("hcs-crc32"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-crc32c"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-crc64"), algorithms->end());
+}
+
+
+TEST(Factory, list_non_cryptographic_hashes) {
+
+    auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
+
+    std::uint64_t hashes_count{0};
+    for (auto const & [name, description] : *algorithms) {
+        if (description.family_ == headcode::crypt::Family::kNonCryptographicHash) {
+            hashes_count++;
+        }
+    }
+
+    EXPECT_EQ(hashes_count, 2ul);
+
+    EXPECT_NE(algorithms->find("hcs-xxh3-64"), algorithms->end());
+    EXPECT_NE(algorithms->find("hcs-xxh3-128"), algorithms->end());
+}
+
 
-    EXPECT_NE(algorithms.find("ltc-md5"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-ripemd128"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-ripemd160"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-ripemd256"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-ripemd320"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-sha1"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-sha224"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-sha256"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-sha384"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-sha512"), algorithms.end());
-    EXPECT_NE(algorithms.find("ltc-tiger192"), algorithms.end());
+TEST(Factory, list_message_authentication_codes) {
+
+    auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
+
+    std::uint64_t macs_count{0};
+    for (auto const & [name, description] : *algorithms) {
+        if (description.family_ == headcode::crypt::Family::kMessageAuthenticationCode) {
+            macs_count++;
+        }
+    }
+
+    std::uint64_t expected_count = 3ul;
+#ifdef OPENSSL
+    expected_count += 3ul;
+#endif
+
+    EXPECT_EQ(macs_count, expected_count);
+
+    EXPECT_NE(algorithms->find("ltc-hmac-sha1"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-hmac-sha256"), algorithms->end());
+    EXPECT_NE(algorithms->find("ltc-hmac-sha512"), algorithms->end());
 
 #ifdef OPENSSL
 
-    EXPECT_NE(algorithms.find("openssl-md5"), algorithms.end());
-    EXPECT_NE(algorithms.find("openssl-ripemd160"), algorithms.end());
-    EXPECT_NE(algorithms.find("openssl-sha1"), algorithms.end());
-    EXPECT_NE(algorithms.find("openssl-sha224"), algorithms.end());
-    EXPECT_NE(algorithms.find("openssl-sha256"), algorithms.end());
-    EXPECT_NE(algorithms.find("openssl-sha384"), algorithms.end());
-    EXPECT_NE(algorithms.find("openssl-sha512"), algorithms.end());
+    EXPECT_NE(algorithms->find("openssl-hmac-sha1"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-hmac-sha256"), algorithms->end());
+    EXPECT_NE(algorithms->find("openssl-hmac-sha512"), algorithms->end());
 
 #endif
 }
@@ -88,9 +234,114 @@ TEST(Factory, list_unknown) {
 
     // every algorithm must belong to a known family
     auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
-    auto some_unknown = std::any_of(algorithms.begin(), algorithms.end(), [](auto const & p) {
+    auto some_unknown = std::any_of(algorithms->begin(), algorithms->end(), [](auto const & p) {
         return p.second.family_ == headcode::crypt::Family::kUnknown;
     });
 
     EXPECT_FALSE(some_unknown);
 }
+
+
+TEST(Factory, resolve) {
+
+    EXPECT_EQ(headcode::crypt::Factory::Resolve("UNKNOWN-ALGORITHM"), headcode::crypt::kUnknownAlgorithmId);
+    EXPECT_EQ(headcode::crypt::Factory::Create(headcode::crypt::kUnknownAlgorithmId).get(), nullptr);
+
+    // ids are dense: each known algorithm has its own id below the number of algorithms
+    auto algorithms = headcode::crypt::Factory::GetAlgorithmDescriptions();
+    std::set<headcode::crypt::AlgorithmId> ids;
+    for (auto const & [name, description] : *algorithms) {
+        auto id = headcode::crypt::Factory::Resolve(name);
+        ASSERT_NE(id, headcode::crypt::kUnknownAlgorithmId);
+        EXPECT_LT(id, algorithms->size());
+        EXPECT_TRUE(ids.insert(id).second);
+
+        auto algo = headcode::crypt::Factory::Create(id);
+        ASSERT_NE(algo.get(), nullptr);
+        EXPECT_STREQ(algo->GetDescription().name_.c_str(), name.c_str());
+    }
+
+    auto id = headcode::crypt::Factory::Resolve("nohash");
+    auto handle = headcode::crypt::Factory::Acquire(id);
+    ASSERT_TRUE(handle);
+    EXPECT_STREQ(handle->GetDescription().name_.c_str(), "nohash");
+}
+
+
+TEST(Factory, register) {
+
+    // a producer of the nohash algorithm under a different name
+    struct TestProducer : headcode::crypt::Factory::Producer {
+        std::unique_ptr<headcode::crypt::Algorithm> operator()() const override {
+            return headcode::crypt::Factory::Create("nohash");
+        }
+        headcode::crypt::Algorithm::Description description_ =
+                headcode::crypt::Factory::GetAlgorithmDescriptions()->at("nohash");
+        headcode::crypt::Algorithm::Description const & GetDescription() const override {
+            return description_;
+        }
+    };
+
+    auto count = headcode::crypt::Factory::GetAlgorithmDescriptions()->size();
+    auto version = headcode::crypt::Factory::GetRegistryVersion();
+    EXPECT_GE(version, count);
+    EXPECT_EQ(headcode::crypt::Factory::Resolve("test-nohash"), headcode::crypt::kUnknownAlgorithmId);
+
+    headcode::crypt::Factory::Register("test-nohash", headcode::crypt::Family::kHash, std::make_shared<TestProducer>());
+    EXPECT_EQ(headcode::crypt::Factory::GetRegistryVersion(), version + 1);
+    auto id = headcode::crypt::Factory::Resolve("test-nohash");
+    ASSERT_NE(id, headcode::crypt::kUnknownAlgorithmId);
+    EXPECT_EQ(headcode::crypt::Factory::GetAlgorithmDescriptions()->size(), count + 1);
+    EXPECT_NE(headcode::crypt::Factory::Create(id).get(), nullptr);
+
+    // re-registering keeps the id
+    headcode::crypt::Factory::Register("test-nohash", headcode::crypt::Family::kHash, std::make_shared<TestProducer>());
+    EXPECT_EQ(headcode::crypt::Factory::Resolve("test-nohash"), id);
+    EXPECT_EQ(headcode::crypt::Factory::GetAlgorithmDescriptions()->size(), count + 1);
+}
+
+
+TEST(Factory, register_while_reading) {
+
+    struct TestProducer : headcode::crypt::Factory::Producer {
+        std::unique_ptr<headcode::crypt::Algorithm> operator()() const override {
+            return headcode::crypt::Factory::Create("nohash");
+        }
+        headcode::crypt::Algorithm::Description description_ =
+                headcode::crypt::Factory::GetAlgorithmDescriptions()->at("nohash");
+        headcode::crypt::Algorithm::Description const & GetDescription() const override {
+            return description_;
+        }
+    };
+
+    // readers pick up new snapshots while old ones are dropped
+    std::atomic<bool> stop = false;
+    std::atomic<std::uint64_t> failures = 0;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            while (!stop) {
+                if (headcode::crypt::Factory::Create("nohash") == nullptr) {
+                    ++failures;
+                }
+                if (headcode::crypt::Factory::GetAlgorithmDescriptions()->count("nohash") != 1) {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    auto version = headcode::crypt::Factory::GetRegistryVersion();
+    for (int i = 0; i < 200; ++i) {
+        headcode::crypt::Factory::Register(
+                "test-nohash-concurrent", headcode::crypt::Family::kHash, std::make_shared<TestProducer>());
+    }
+    stop = true;
+    for (auto & reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(failures, 0ul);
+    EXPECT_EQ(headcode::crypt::Factory::GetRegistryVersion(), version + 200);
+    EXPECT_NE(headcode::crypt::Factory::Create("test-nohash-concurrent").get(), nullptr);
+}
@@ -23,6 +23,24 @@ TEST(Family, text_hash) {
 }
 
 
+TEST(Family, text_checksum) {
+    auto text = headcode::crypt::GetFamilyText(headcode::crypt::Family::kChecksum);
+    EXPECT_FALSE(text.empty());
+}
+
+
+TEST(Family, text_non_cryptographic_hash) {
+    auto text = headcode::crypt::GetFamilyText(headcode::crypt::Family::kNonCryptographicHash);
+    EXPECT_FALSE(text.empty());
+}
+
+
+TEST(Family, text_message_authentication_code) {
+    auto text = headcode::crypt::GetFamilyText(headcode::crypt::Family::kMessageAuthenticationCode);
+    EXPECT_FALSE(text.empty());
+}
+
+
 TEST(Family, text_unknown) {
     auto text = headcode::crypt::GetFamilyText(headcode::crypt::Family::kUnknown);
     EXPECT_FALSE(text.empty());
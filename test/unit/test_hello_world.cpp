@@ -25,9 +25,12 @@ TEST(HelloWorld, hello_world) {
     auto algorithm = headcode::crypt::Factory::Create("openssl-aes-128-cbc-encryptor");
     algorithm->Initialize({{"key", {key, 16}}, {"iv", {iv, 16}}});
 
-    // encrypt some data (note: the input will be padded!)
+    // encrypt some data (note: the last block will be padded at Finalize!)
     std::vector<std::byte> cipher;
     algorithm->Add("Hello World!", cipher);
+    std::vector<std::byte> cipher_tail;
+    algorithm->Finalize(cipher_tail);
+    cipher.insert(cipher.end(), cipher_tail.begin(), cipher_tail.end());
 
     // show the cipher
     for (unsigned int i = 0; i < cipher.size(); ++i) {
@@ -0,0 +1,237 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Computes a digest the long way: new instance, Initialize(), Add() and Finalize().
+ * @param   name        name of the hash.
+ * @param   text        the text to hash.
+ * @return  The digest.
+ */
+static std::vector<std::byte> ComputeDigest(std::string const & name, std::string_view text) {
+    auto algo = headcode::crypt::Factory::Create(name);
+    algo->Initialize();
+    algo->Add(text);
+    std::vector<std::byte> result;
+    algo->Finalize(result);
+    return result;
+}
+
+
+/**
+ * @brief   Runs a text through a cipher the long way: new instance, Initialize(), Add() and Finalize().
+ * @param   name        name of the cipher.
+ * @param   key         the key.
+ * @param   iv          the IV.
+ * @param   data        the data to process.
+ * @return  The processed data.
+ */
+static std::vector<std::byte> ComputeCipher(std::string const & name,
+                                            std::vector<std::byte> const & key,
+                                            std::vector<std::byte> const & iv,
+                                            std::vector<std::byte> const & data) {
+    auto algo = headcode::crypt::Factory::Create(name);
+    algo->Initialize({{"key", key}, {"iv", iv}});
+    std::vector<std::byte> result;
+    algo->Add(data, result);
+    std::vector<std::byte> tail;
+    algo->Finalize(tail);
+    result.insert(result.end(), tail.begin(), tail.end());
+    return result;
+}
+
+
+TEST(OneShot, digest) {
+
+    std::string_view text{kIpsumLoremText};
+    std::vector<std::string> names{"ltc-md5", "ltc-sha256", "ltc-sha512"};
+#ifdef OPENSSL
+    names.emplace_back("openssl-sha256");
+#endif
+
+    for (auto const & name : names) {
+        for (std::uint64_t size : {0ul, 1ul, 64ul, 100ul, text.size()}) {
+            auto expected = ComputeDigest(name, text.substr(0, size));
+            std::vector<std::byte> digest;
+            // twice: the second call runs on the cached instance
+            for (int i = 0; i < 2; ++i) {
+                ASSERT_EQ(headcode::crypt::Digest(name, text.substr(0, size), digest), 0);
+                EXPECT_EQ(digest, expected) << name << " size " << size;
+            }
+            ASSERT_EQ(headcode::crypt::Digest(headcode::crypt::Factory::Resolve(name), text.substr(0, size), digest), 0);
+            EXPECT_EQ(digest, expected) << name << " size " << size;
+        }
+    }
+
+    std::vector<std::byte> digest;
+    EXPECT_EQ(headcode::crypt::Digest("unknown", text, digest),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_EQ(headcode::crypt::Digest(headcode::crypt::kUnknownAlgorithmId, text, digest),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+    EXPECT_EQ(headcode::crypt::Digest("ltc-aes-128-cbc-encryptor", text, digest),
+              static_cast<int>(headcode::crypt::Error::kInvalidArgument));
+}
+
+
+TEST(OneShot, cipher) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(16);
+    auto other_iv = headcode::mem::StringToMemory("This is another initialization vector.");
+    other_iv.resize(16);
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    std::vector<std::byte> cipher;
+    std::vector<std::byte> plain;
+    for (auto const & current_iv : {iv, iv, other_iv, iv}) {
+
+        auto expected = ComputeCipher("ltc-aes-128-cbc-encryptor", key, current_iv, text);
+        ASSERT_EQ(headcode::crypt::Encrypt("ltc-aes-128-cbc-encryptor", key, current_iv, text, cipher), 0);
+        EXPECT_EQ(cipher, expected);
+
+        // the decrypted text keeps the padding of the last block
+        ASSERT_EQ(headcode::crypt::Decrypt("ltc-aes-128-cbc-decryptor", key, current_iv, cipher, plain), 0);
+        EXPECT_EQ(plain, ComputeCipher("ltc-aes-128-cbc-decryptor", key, current_iv, cipher));
+        ASSERT_GE(plain.size(), text.size());
+        plain.resize(text.size());
+        EXPECT_EQ(plain, text);
+    }
+
+    // ECB takes no IV
+    ASSERT_EQ(headcode::crypt::Encrypt("ltc-aes-128-ecb-encryptor", key, iv, text, cipher), 0);
+    auto algo = headcode::crypt::Factory::Create("ltc-aes-128-ecb-encryptor");
+    ASSERT_EQ(algo->Initialize({{"key", key}}), 0);
+    std::vector<std::byte> expected;
+    ASSERT_EQ(algo->Add(text, expected), 0);
+    std::vector<std::byte> tail;
+    ASSERT_EQ(algo->Finalize(tail), 0);
+    expected.insert(expected.end(), tail.begin(), tail.end());
+    EXPECT_EQ(cipher, expected);
+
+    // CTR runs in both directions
+    ASSERT_EQ(headcode::crypt::Encrypt("ltc-aes-128-ctr", key, iv, text, cipher), 0);
+    ASSERT_EQ(headcode::crypt::Decrypt("ltc-aes-128-ctr", key, iv, cipher, plain), 0);
+    EXPECT_EQ(plain, text);
+
+    // wrong direction, wrong key size, hash instead of cipher: no result
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+    EXPECT_EQ(headcode::crypt::Encrypt("ltc-aes-128-cbc-decryptor", key, iv, text, cipher), kInvalidArgument);
+    EXPECT_TRUE(cipher.empty());
+    EXPECT_EQ(headcode::crypt::Decrypt("ltc-aes-128-cbc-encryptor", key, iv, text, plain), kInvalidArgument);
+    EXPECT_TRUE(plain.empty());
+    cipher = text;
+    auto id = headcode::crypt::Factory::Resolve("ltc-aes-128-cbc-decryptor");
+    EXPECT_EQ(headcode::crypt::Encrypt(id, key, iv, text, cipher), kInvalidArgument);
+    EXPECT_TRUE(cipher.empty());
+    key.resize(15);
+    cipher = text;
+    EXPECT_NE(headcode::crypt::Encrypt("ltc-aes-128-cbc-encryptor", key, iv, text, cipher), 0);
+    EXPECT_TRUE(cipher.empty());
+    cipher = text;
+    EXPECT_EQ(headcode::crypt::Encrypt("ltc-sha256", key, iv, text, cipher), kInvalidArgument);
+    EXPECT_TRUE(cipher.empty());
+}
+
+
+TEST(OneShot, authenticated_cipher) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(32);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    // no way to pass AAD or tag: refused in both directions
+    auto const kInvalidArgument = static_cast<int>(headcode::crypt::Error::kInvalidArgument);
+    for (auto const & name : {"ltc-aes-256-gcm", "ltc-chacha20-poly1305"}) {
+        std::vector<std::byte> result = text;
+        EXPECT_EQ(headcode::crypt::Encrypt(std::string{name} + "-encryptor", key, iv, text, result), kInvalidArgument)
+                << name;
+        EXPECT_TRUE(result.empty()) << name;
+        result = text;
+        EXPECT_EQ(headcode::crypt::Decrypt(std::string{name} + "-decryptor", key, iv, text, result), kInvalidArgument)
+                << name;
+        EXPECT_TRUE(result.empty()) << name;
+    }
+}
+
+
+TEST(OneShot, threads) {
+
+    std::string_view text{kIpsumLoremText};
+    auto expected = ComputeDigest("ltc-sha256", text);
+
+    // each thread works on its own instance
+    std::vector<std::thread> threads;
+    std::vector<int> failures(8, 0);
+    for (unsigned int t = 0; t < failures.size(); ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<std::byte> digest;
+            for (int i = 0; i < 100; ++i) {
+                if ((headcode::crypt::Digest("ltc-sha256", text, digest) != 0) || (digest != expected)) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    for (auto failure : failures) {
+        EXPECT_EQ(failure, 0);
+    }
+}
+
+
+TEST(OneShot, register) {
+
+    // a producer creating instances of another algorithm
+    struct TestProducer : headcode::crypt::Factory::Producer {
+        std::string name_;
+        headcode::crypt::Algorithm::Description description_;
+        explicit TestProducer(std::string name)
+                : name_{std::move(name)},
+                  description_{headcode::crypt::Factory::GetAlgorithmDescriptions()->at(name_)} {
+        }
+        std::unique_ptr<headcode::crypt::Algorithm> operator()() const override {
+            return headcode::crypt::Factory::Create(name_);
+        }
+        headcode::crypt::Algorithm::Description const & GetDescription() const override {
+            return description_;
+        }
+    };
+
+    std::string_view text{kIpsumLoremText};
+    std::vector<std::byte> digest;
+
+    headcode::crypt::Factory::Register(
+            "test-oneshot", headcode::crypt::Family::kHash, std::make_shared<TestProducer>("ltc-sha256"));
+    ASSERT_EQ(headcode::crypt::Digest("test-oneshot", text, digest), 0);
+    EXPECT_EQ(digest, ComputeDigest("ltc-sha256", text));
+
+    // the cached instance of the thread must not outlive the registration
+    headcode::crypt::Factory::Register(
+            "test-oneshot", headcode::crypt::Family::kHash, std::make_shared<TestProducer>("ltc-md5"));
+    ASSERT_EQ(headcode::crypt::Digest("test-oneshot", text, digest), 0);
+    EXPECT_EQ(digest, ComputeDigest("ltc-md5", text));
+}
@@ -0,0 +1,36 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <gtest/gtest.h>
+
+#include <headcode/crypt/crypt.hpp>
+
+
+TEST(Parallelism, default_off) {
+
+    headcode::crypt::Parallelism defaults;
+    EXPECT_EQ(defaults.threads_, 1u);
+    EXPECT_EQ(defaults.threshold_, headcode::crypt::Parallelism::kDefaultThreshold);
+
+    auto parallelism = headcode::crypt::GetParallelism();
+    EXPECT_EQ(parallelism.threads_, 1u);
+    EXPECT_EQ(parallelism.threshold_, headcode::crypt::Parallelism::kDefaultThreshold);
+}
+
+
+TEST(Parallelism, opt_in) {
+
+    auto parallelism = headcode::crypt::GetParallelism();
+
+    headcode::crypt::SetParallelism({4ul * 1024ul * 1024ul, 0});
+    EXPECT_EQ(headcode::crypt::GetParallelism().threads_, 0u);
+    EXPECT_EQ(headcode::crypt::GetParallelism().threshold_, 4ul * 1024ul * 1024ul);
+
+    headcode::crypt::SetParallelism(parallelism);
+    EXPECT_EQ(headcode::crypt::GetParallelism().threads_, 1u);
+}
@@ -0,0 +1,194 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+TEST(Pool, unknown_algorithm) {
+
+    auto handle = headcode::crypt::Factory::Acquire("UNKNOWN-ALGORITHM");
+    EXPECT_FALSE(handle);
+    EXPECT_EQ(handle.get(), nullptr);
+
+    auto statistics = headcode::crypt::Factory::GetPoolStatistics("UNKNOWN-ALGORITHM");
+    EXPECT_EQ(statistics.hits_, 0ul);
+    EXPECT_EQ(statistics.misses_, 0ul);
+    EXPECT_FALSE(headcode::crypt::Factory::SetPoolLimit("UNKNOWN-ALGORITHM", 1));
+}
+
+
+TEST(Pool, recycle) {
+
+    auto statistics_start = headcode::crypt::Factory::GetPoolStatistics("ltc-sha256");
+    EXPECT_GT(statistics_start.limit_, 0ul);
+
+    auto expected = std::string{"8372e8dc1413d0636d8db66e5f8f4f885e703e67c736aa80a881ac400dc8613b"};
+    headcode::crypt::Algorithm * first_instance = nullptr;
+    for (int i = 0; i < 3; ++i) {
+
+        auto handle = headcode::crypt::Factory::Acquire("ltc-sha256");
+        ASSERT_TRUE(handle);
+        EXPECT_TRUE(handle->IsInitialized());
+        EXPECT_FALSE(handle->IsFinalized());
+        if (i == 0) {
+            first_instance = handle.get();
+        } else {
+            // same thread: the very same instance is recycled
+            EXPECT_EQ(handle.get(), first_instance);
+        }
+
+        EXPECT_EQ(handle->Add(kIpsumLoremText), 0);
+        std::vector<std::byte> hash;
+        EXPECT_EQ(handle->Finalize(hash), 0);
+        EXPECT_STREQ(headcode::mem::MemoryToHex(hash).c_str(), expected.c_str());
+    }
+
+    auto statistics = headcode::crypt::Factory::GetPoolStatistics("ltc-sha256");
+    EXPECT_EQ((statistics.hits_ + statistics.misses_) - (statistics_start.hits_ + statistics_start.misses_), 3ul);
+    EXPECT_GE(statistics.hits_ - statistics_start.hits_, 2ul);
+    EXPECT_GE(statistics.size_, 1ul);
+}
+
+
+TEST(Pool, keyed) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto key_other = headcode::mem::StringToMemory("The quick brown fox jumps over the lazy dog.");
+    key_other.resize(16);
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+    plain.resize(64);
+
+    std::vector<std::byte> cipher;
+    {
+        auto handle = headcode::crypt::Factory::Acquire("ltc-aes-128-ecb-encryptor", {{"key", key}});
+        ASSERT_TRUE(handle);
+        EXPECT_EQ(handle->Add(plain, cipher), 0);
+    }
+
+    // a recycled keyed instance is reinitialized with the new key
+    auto handle = headcode::crypt::Factory::Acquire("ltc-aes-128-ecb-encryptor", {{"key", key_other}});
+    ASSERT_TRUE(handle);
+    std::vector<std::byte> cipher_other;
+    EXPECT_EQ(handle->Add(plain, cipher_other), 0);
+    ASSERT_EQ(cipher_other.size(), cipher.size());
+    EXPECT_NE(std::memcmp(cipher.data(), cipher_other.data(), cipher.size()), 0);
+
+    auto algo = headcode::crypt::Factory::Create("ltc-aes-128-ecb-encryptor");
+    ASSERT_NE(algo.get(), nullptr);
+    ASSERT_EQ(algo->Initialize({{"key", key_other}}), 0);
+    std::vector<std::byte> expected;
+    EXPECT_EQ(algo->Add(plain, expected), 0);
+    ASSERT_EQ(cipher_other.size(), expected.size());
+    EXPECT_EQ(std::memcmp(cipher_other.data(), expected.data(), expected.size()), 0);
+
+    // missing key: no instance
+    handle.Release();
+    EXPECT_FALSE(handle);
+    EXPECT_FALSE(headcode::crypt::Factory::Acquire("ltc-aes-128-ecb-encryptor"));
+}
+
+
+TEST(Pool, aead) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(12);
+    auto plain = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto statistics_start = headcode::crypt::Factory::GetPoolStatistics("openssl-aes-128-gcm-encryptor");
+    {
+        auto handle = headcode::crypt::Factory::Acquire("openssl-aes-128-gcm-encryptor", {{"key", key}, {"iv", iv}});
+        ASSERT_TRUE(handle);
+        std::vector<std::byte> cipher;
+        EXPECT_EQ(handle->Add(plain, cipher), 0);
+        std::vector<std::byte> tag;
+        EXPECT_EQ(handle->Finalize(tag), 0);
+    }
+
+    // the encryptor refused Reset() but is still recycled
+    auto statistics = headcode::crypt::Factory::GetPoolStatistics("openssl-aes-128-gcm-encryptor");
+    EXPECT_EQ(statistics.size_, statistics_start.size_ + 1);
+
+    // a new IV without a key does not pick up the key of the previous user
+    iv[0] ^= std::byte{0x01};
+    EXPECT_FALSE(headcode::crypt::Factory::Acquire("openssl-aes-128-gcm-encryptor", {{"iv", iv}}));
+
+    auto handle = headcode::crypt::Factory::Acquire("openssl-aes-128-gcm-encryptor", {{"key", key}, {"iv", iv}});
+    ASSERT_TRUE(handle);
+    statistics = headcode::crypt::Factory::GetPoolStatistics("openssl-aes-128-gcm-encryptor");
+    EXPECT_EQ(statistics.hits_, statistics_start.hits_ + 1);
+}
+
+TEST(Pool, limit) {
+
+    ASSERT_TRUE(headcode::crypt::Factory::SetPoolLimit("nohash", 2));
+
+    {
+        std::vector<headcode::crypt::Factory::Handle> handles;
+        for (int i = 0; i < 5; ++i) {
+            handles.push_back(headcode::crypt::Factory::Acquire("nohash"));
+            ASSERT_TRUE(handles.back());
+        }
+    }
+    auto statistics = headcode::crypt::Factory::GetPoolStatistics("nohash");
+    EXPECT_EQ(statistics.limit_, 2ul);
+    EXPECT_EQ(statistics.size_, 2ul);
+
+    // no pooling at all
+    ASSERT_TRUE(headcode::crypt::Factory::SetPoolLimit("nohash", 0));
+    statistics = headcode::crypt::Factory::GetPoolStatistics("nohash");
+    EXPECT_EQ(statistics.size_, 0ul);
+    {
+        auto handle = headcode::crypt::Factory::Acquire("nohash");
+        ASSERT_TRUE(handle);
+    }
+    statistics = headcode::crypt::Factory::GetPoolStatistics("nohash");
+    EXPECT_EQ(statistics.size_, 0ul);
+
+    ASSERT_TRUE(headcode::crypt::Factory::SetPoolLimit("nohash", 64));
+}
+
+
+TEST(Pool, threads) {
+
+    auto statistics_start = headcode::crypt::Factory::GetPoolStatistics("copy");
+
+    static int const thread_count = 8;
+    static int const loop_count = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < loop_count; ++i) {
+                auto handle = headcode::crypt::Factory::Acquire("copy");
+                ASSERT_TRUE(handle);
+                std::vector<std::byte> result;
+                EXPECT_EQ(handle->Add(kIpsumLoremText, result), 0);
+                EXPECT_EQ(result.size(), kIpsumLoremText.size());
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    auto statistics = headcode::crypt::Factory::GetPoolStatistics("copy");
+    EXPECT_EQ((statistics.hits_ + statistics.misses_) - (statistics_start.hits_ + statistics_start.misses_),
+              static_cast<std::uint64_t>(thread_count * loop_count));
+    EXPECT_LE(statistics.misses_ - statistics_start.misses_, static_cast<std::uint64_t>(thread_count));
+}
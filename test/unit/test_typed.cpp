@@ -0,0 +1,196 @@
+/*
+ * This file is part of the headcode.space crypt.
+ *
+ * The 'LICENSE.txt' file in the project root holds the software license.
+ * Copyright (C) 2020-2021 headcode.space e.U.
+ * Oliver Maurhart <info@headcode.space>, https://www.headcode.space
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <headcode/mem/mem.hpp>
+#include <headcode/crypt/crypt.hpp>
+
+#include "shared/ipsum_lorem.hpp"
+
+
+/**
+ * @brief   Checks a typed hash against the runtime algorithm of the same name for various message sizes.
+ * @param   name        name of the runtime algorithm.
+ */
+template <typename TypedHash>
+static void CheckHash(std::string const & name) {
+
+    std::string_view text{kIpsumLoremText};
+    TypedHash typed_hash;
+    for (std::uint64_t size : {0ul, 1ul, 55ul, 63ul, 64ul, 65ul, 127ul, 128ul, 1000ul, text.size()}) {
+
+        auto algo = headcode::crypt::Factory::Create(name);
+        ASSERT_NE(algo.get(), nullptr);
+        ASSERT_EQ(algo->Initialize(), 0);
+        ASSERT_EQ(algo->Add(text.substr(0, size)), 0);
+        std::vector<std::byte> expected;
+        ASSERT_EQ(algo->Finalize(expected), 0);
+        ASSERT_EQ(expected.size(), TypedHash::kResultSize);
+
+        // one shot
+        auto digest = TypedHash::Compute(text.substr(0, size));
+        EXPECT_EQ(std::memcmp(digest.data(), expected.data(), expected.size()), 0) << name << " size " << size;
+
+        // reused instance, two parts
+        EXPECT_EQ(typed_hash.Add(text.substr(0, size / 3)), 0);
+        EXPECT_EQ(typed_hash.Add(text.substr(size / 3, size - size / 3)), 0);
+        EXPECT_EQ(typed_hash.Finalize(digest), 0);
+        EXPECT_EQ(std::memcmp(digest.data(), expected.data(), expected.size()), 0) << name << " size " << size;
+    }
+}
+
+
+TEST(Typed, hash_ltc) {
+
+    using headcode::crypt::Hash;
+    using headcode::crypt::Provider;
+
+    static_assert(Hash<headcode::crypt::Sha256>::kResultSize == 32);
+    static_assert(sizeof(Hash<headcode::crypt::Sha256>::Digest) == 32);
+
+    CheckHash<Hash<headcode::crypt::Md5, Provider::kLTC>>("ltc-md5");
+    CheckHash<Hash<headcode::crypt::Ripemd128, Provider::kLTC>>("ltc-ripemd128");
+    CheckHash<Hash<headcode::crypt::Ripemd160, Provider::kLTC>>("ltc-ripemd160");
+    CheckHash<Hash<headcode::crypt::Ripemd256, Provider::kLTC>>("ltc-ripemd256");
+    CheckHash<Hash<headcode::crypt::Ripemd320, Provider::kLTC>>("ltc-ripemd320");
+    CheckHash<Hash<headcode::crypt::Sha1, Provider::kLTC>>("ltc-sha1");
+    CheckHash<Hash<headcode::crypt::Sha224, Provider::kLTC>>("ltc-sha224");
+    CheckHash<Hash<headcode::crypt::Sha256, Provider::kLTC>>("ltc-sha256");
+    CheckHash<Hash<headcode::crypt::Sha384, Provider::kLTC>>("ltc-sha384");
+    CheckHash<Hash<headcode::crypt::Sha512, Provider::kLTC>>("ltc-sha512");
+    CheckHash<Hash<headcode::crypt::Tiger192, Provider::kLTC>>("ltc-tiger192");
+}
+
+
+#ifdef OPENSSL
+
+TEST(Typed, hash_openssl) {
+
+    using headcode::crypt::Hash;
+    using headcode::crypt::Provider;
+
+    CheckHash<Hash<headcode::crypt::Md5, Provider::kOpenSSL>>("openssl-md5");
+    CheckHash<Hash<headcode::crypt::Ripemd160, Provider::kOpenSSL>>("openssl-ripemd160");
+    CheckHash<Hash<headcode::crypt::Sha1, Provider::kOpenSSL>>("openssl-sha1");
+    CheckHash<Hash<headcode::crypt::Sha224, Provider::kOpenSSL>>("openssl-sha224");
+    CheckHash<Hash<headcode::crypt::Sha256, Provider::kOpenSSL>>("openssl-sha256");
+    CheckHash<Hash<headcode::crypt::Sha384, Provider::kOpenSSL>>("openssl-sha384");
+    CheckHash<Hash<headcode::crypt::Sha512, Provider::kOpenSSL>>("openssl-sha512");
+}
+
+#endif
+
+
+/**
+ * @brief   Checks a typed cipher against the runtime algorithm of the same name.
+ * The text is added in odd sized chunks to the typed cipher.
+ * @param   name        name of the runtime algorithm.
+ */
+template <typename TypedCipher>
+static void CheckCipher(std::string const & name) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(TypedCipher::kKeySize);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(TypedCipher::kIVSize);
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+
+    auto algo = headcode::crypt::Factory::Create(name);
+    ASSERT_NE(algo.get(), nullptr);
+    std::map<std::string, std::vector<std::byte>> initialization_data{{"key", key}};
+    if (TypedCipher::kIVSize > 0) {
+        initialization_data["iv"] = iv;
+    }
+    ASSERT_EQ(algo->Initialize(initialization_data), 0);
+    std::vector<std::byte> expected;
+    ASSERT_EQ(algo->Add(text, expected), 0);
+    std::vector<std::byte> expected_final;
+    ASSERT_EQ(algo->Finalize(expected_final), 0);
+    expected.insert(expected.end(), expected_final.begin(), expected_final.end());
+
+    TypedCipher typed_cipher;
+    EXPECT_FALSE(typed_cipher.IsInitialized());
+    std::uint64_t size_outgoing = 0;
+    std::vector<std::byte> result{text.size() + TypedCipher::kBlockSize};
+    EXPECT_NE(typed_cipher.Add(text, result, size_outgoing), 0);
+    EXPECT_NE(typed_cipher.Initialize(key, headcode::crypt::ByteView{iv.data(), iv.size() + 1}), 0);
+    ASSERT_EQ(typed_cipher.Initialize(key, iv), 0);
+    EXPECT_TRUE(typed_cipher.IsInitialized());
+
+    // twice: Finalize() resets the cipher for the next message
+    for (int i = 0; i < 2; ++i) {
+        std::uint64_t result_size = 0;
+        std::uint64_t chunk_size = 1;
+        for (std::uint64_t j = 0; j < text.size(); j += chunk_size, chunk_size += 6) {
+            auto chunk = headcode::crypt::ByteView{text}.subview(j, std::min(chunk_size, text.size() - j));
+            auto out = headcode::crypt::MutableByteView{result}.subview(result_size, result.size() - result_size);
+            EXPECT_EQ(typed_cipher.GetOutgoingSize(chunk.size()) <= out.size(), true);
+            ASSERT_EQ(typed_cipher.Add(chunk, out, size_outgoing), 0);
+            result_size += size_outgoing;
+        }
+        auto out = headcode::crypt::MutableByteView{result}.subview(result_size, result.size() - result_size);
+        ASSERT_EQ(typed_cipher.Finalize(out, size_outgoing), 0);
+        result_size += size_outgoing;
+
+        ASSERT_EQ(result_size, expected.size()) << name;
+        EXPECT_EQ(std::memcmp(result.data(), expected.data(), expected.size()), 0) << name;
+    }
+}
+
+
+TEST(Typed, cipher) {
+
+    using headcode::crypt::Cipher;
+    using headcode::crypt::Decryption;
+    using headcode::crypt::Encryption;
+
+    CheckCipher<Cipher<headcode::crypt::Aes128Cbc, Encryption>>("ltc-aes-128-cbc-encryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes192Cbc, Encryption>>("ltc-aes-192-cbc-encryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes256Cbc, Encryption>>("ltc-aes-256-cbc-encryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes128Cbc, Decryption>>("ltc-aes-128-cbc-decryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes192Cbc, Decryption>>("ltc-aes-192-cbc-decryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes256Cbc, Decryption>>("ltc-aes-256-cbc-decryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes128Ecb, Encryption>>("ltc-aes-128-ecb-encryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes192Ecb, Encryption>>("ltc-aes-192-ecb-encryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes256Ecb, Encryption>>("ltc-aes-256-ecb-encryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes128Ecb, Decryption>>("ltc-aes-128-ecb-decryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes192Ecb, Decryption>>("ltc-aes-192-ecb-decryptor");
+    CheckCipher<Cipher<headcode::crypt::Aes256Ecb, Decryption>>("ltc-aes-256-ecb-decryptor");
+}
+
+
+TEST(Typed, cipher_roundtrip) {
+
+    auto key = headcode::mem::StringToMemory("supercalifragilisticexpialidocious");
+    key.resize(16);
+    auto iv = headcode::mem::StringToMemory("This is an initialization vector.");
+    iv.resize(16);
+    auto text = headcode::mem::StringToMemory(kIpsumLoremText);
+    text.resize(text.size() - text.size() % 16);
+
+    headcode::crypt::Cipher<headcode::crypt::Aes128Cbc, headcode::crypt::Encryption> encryptor;
+    ASSERT_EQ(encryptor.Initialize(key, iv), 0);
+    std::vector<std::byte> cipher{text.size()};
+    std::uint64_t size_outgoing = 0;
+    ASSERT_EQ(encryptor.Add(text, cipher, size_outgoing), 0);
+    ASSERT_EQ(size_outgoing, text.size());
+
+    // decrypt in place
+    headcode::crypt::Cipher<headcode::crypt::Aes128Cbc, headcode::crypt::Decryption> decryptor;
+    ASSERT_EQ(decryptor.Initialize(key, iv), 0);
+    ASSERT_EQ(decryptor.Add(cipher, cipher, size_outgoing), 0);
+    ASSERT_EQ(size_outgoing, text.size());
+    EXPECT_EQ(std::memcmp(cipher.data(), text.data(), text.size()), 0);
+}